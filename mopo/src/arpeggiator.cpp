@@ -34,6 +34,7 @@ namespace mopo {
     MOPO_ASSERT(note_handler);
     pressed_notes_.reserve(MIDI_SIZE);
     sustained_notes_.reserve(MIDI_SIZE);
+    deferred_note_offs_.reserve(MIDI_SIZE);
   }
 
   void Arpeggiator::process() {
@@ -47,23 +48,61 @@ namespace mopo {
     mopo_float delta_phase = frequency / sample_rate_;
     mopo_float new_phase = phase_ + buffer_size_ * delta_phase;
 
-    // If we're past the gate phase and we're playing a note, turn it off.
-    if (new_phase >= gate && last_played_note_ >= 0) {
-      int offset = utils::iclamp((gate - phase_) / delta_phase, 0, buffer_size_ - 1);
-      note_handler_->noteOff(last_played_note_, offset);
-      last_played_note_ = -1;
-    }
+    // Deferred note offs never run past the next step.
+    int last_offset = buffer_size_ - 1;
+    if (getNumNotes() && new_phase >= 1)
+      last_offset = utils::iclamp((1 - phase_) / delta_phase, 0, buffer_size_ - 1);
+    for (const std::pair<mopo_float, int>& note_off : deferred_note_offs_)
+      note_handler_->noteOff(note_off.first, std::min(note_off.second, last_offset));
+    deferred_note_offs_.clear();
+
+    // Fast rates can cross several steps in one buffer so play each of them.
+    // _phase_ is kept relative to the start of the buffer so every event
+    // gets its own offset.
+    bool played_note = false;
+    while (true) {
+      // If we're past the gate phase and we're playing a note, turn it off.
+      // A voice only takes one event per buffer, so a note that started in
+      // this buffer is turned off at the same offset in the next one. Every
+      // deferred note is held one buffer longer than its gate.
+      if (new_phase >= gate && last_played_note_ >= 0) {
+        int offset = utils::iclamp((gate - phase_) / delta_phase, 0, buffer_size_ - 1);
+        if (played_note) {
+          removeDeferredNoteOff(last_played_note_);
+          deferred_note_offs_.push_back(std::pair<mopo_float, int>(last_played_note_, offset));
+        }
+        else
+          note_handler_->noteOff(last_played_note_, offset);
+        last_played_note_ = -1;
+      }
+
+      // Check if it's time to play the next note.
+      if (getNumNotes() == 0 || new_phase < 1)
+        break;
 
-    // Check if it's time to play the next note.
-    if (getNumNotes() && new_phase >= 1) {
       int offset = utils::iclamp((1 - phase_) / delta_phase, 0, buffer_size_ - 1);
       std::pair<mopo_float, mopo_float> note = getNextNote();
+
+      // A deferred note off would cut this note too. The earlier voice with
+      // this note is released along with it instead.
+      removeDeferredNoteOff(note.first);
       note_handler_->noteOn(note.first, note.second, offset);
       last_played_note_ = note.first;
-      phase_ = new_phase - 1.0;
+      played_note = true;
+      phase_ -= 1.0;
+      new_phase -= 1.0;
+    }
+
+    phase_ = new_phase;
+  }
+
+  void Arpeggiator::removeDeferredNoteOff(mopo_float note) {
+    for (auto iter = deferred_note_offs_.begin(); iter != deferred_note_offs_.end(); ++iter) {
+      if (iter->first == note) {
+        deferred_note_offs_.erase(iter);
+        return;
+      }
     }
-    else
-      phase_ = new_phase;
   }
 
   std::pair<mopo_float, mopo_float> Arpeggiator::getNextNote() {
@@ -157,6 +196,7 @@ namespace mopo {
     ascending_.clear();
     decending_.clear();
     as_played_.clear();
+    deferred_note_offs_.clear();
     note_handler_->allNotesOff();
   }
 
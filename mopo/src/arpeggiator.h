@@ -63,6 +63,7 @@ namespace mopo {
       CircularQueue<mopo_float>& getPressedNotes();
       std::pair<mopo_float, mopo_float> getNextNote();
       void addNoteToPatterns(mopo_float note);
+      void removeDeferredNoteOff(mopo_float note);
       void removeNoteFromPatterns(mopo_float note);
 
       void allNotesOff(int sample = 0) override;
@@ -87,6 +88,8 @@ namespace mopo {
       std::vector<mopo_float> as_played_;
       std::vector<mopo_float> ascending_;
       std::vector<mopo_float> decending_;
+      // Note offs held for the next buffer with the offset they fell on.
+      std::vector<std::pair<mopo_float, int>> deferred_note_offs_;
 
       std::map<mopo_float, mopo_float> active_notes_;
       CircularQueue<mopo_float> pressed_notes_;
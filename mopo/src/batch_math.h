@@ -0,0 +1,103 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef BATCH_MATH_H
+#define BATCH_MATH_H
+
+#include "common.h"
+
+#include <cmath>
+
+namespace mopo {
+
+  // Whole buffer versions of the approximations in utils.h.
+  // Every loop here is branch free and, apart from the floor in fractional,
+  // only uses operations that SSE2/NEON can do on packed doubles so the
+  // compiler vectorizes them. _dest_ may be
+  // the same buffer as the source for in place processing.
+  namespace batch {
+
+    // Same rational approximation as utils::quickTanh.
+    // Max absolute error against tanh is 2.8e-3 over the whole real line.
+    inline void quickTanh(mopo_float* dest, const mopo_float* source, int size) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i) {
+        mopo_float value = source[i];
+        mopo_float abs_value = fabs(value);
+        mopo_float square = value * value;
+
+        mopo_float num = value * (2.45550750702956 + 2.45550750702956 * abs_value +
+                                  square * (0.893229853513558 + 0.821226666969744 * abs_value));
+        mopo_float den = 2.44506634652299 + (2.44506634652299 + square) *
+                         fabs(value + 0.814642734961073 * value * abs_value);
+        dest[i] = num / den;
+      }
+    }
+
+    // Same approximation as utils::quickSin1, phase is in [0, 1].
+    // Max absolute error against sin(2 * pi * phase) is 9.3e-4.
+    inline void quickSin1(mopo_float* dest, const mopo_float* phase, int size) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i) {
+        mopo_float adjusted = 0.5 - phase[i];
+        mopo_float approx = adjusted * (8.0 - 16.0 * fabs(adjusted));
+        dest[i] = approx * (0.776 + 0.224 * fabs(approx));
+      }
+    }
+
+    // Fractional part, value - floor(value). floor vectorizes with SSE4.1 or
+    // NEON and runs scalar on plain SSE2, but unlike an int cast it works for
+    // any value.
+    inline void fractional(mopo_float* dest, const mopo_float* source, int size) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i)
+        dest[i] = source[i] - std::floor(source[i]);
+    }
+
+    inline void clamp(mopo_float* dest, const mopo_float* source, int size,
+                      mopo_float min, mopo_float max) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i)
+        dest[i] = fmin(max, fmax(source[i], min));
+    }
+
+    // Same as the fold in Distortion. Exact.
+    inline void linearFold(mopo_float* dest, const mopo_float* source, int size) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i)
+        dest[i] = 0.25 * source[i] + 0.75;
+
+      fractional(dest, dest, size);
+
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i)
+        dest[i] = fabs(2.0 - 4.0 * dest[i]) - 1.0;
+    }
+
+    // Sine fold using quickSin1. Max absolute error 9.3e-4.
+    inline void sinFold(mopo_float* dest, const mopo_float* source, int size) {
+      VECTORIZE_LOOP
+      for (int i = 0; i < size; ++i)
+        dest[i] = -0.25 * source[i] + 0.5;
+
+      fractional(dest, dest, size);
+      quickSin1(dest, dest, size);
+    }
+  } // namespace batch
+} // namespace mopo
+
+#endif // BATCH_MATH_H
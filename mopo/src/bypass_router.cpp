@@ -19,17 +19,38 @@
 namespace mopo {
 
   BypassRouter::BypassRouter(int num_inputs, int num_outputs) :
-      ProcessorRouter(num_inputs, num_outputs) { }
+      ProcessorRouter(num_inputs, num_outputs), crossfade_(false), was_on_(false) { }
 
   void BypassRouter::process() {
     MOPO_ASSERT(inputMatchesBufferSize(kAudio));
 
-    mopo_float should_process = input(kOn)->at(0);
-    if (should_process)
+    bool should_process = input(kOn)->at(0);
+    bool fading = crossfade_ && should_process != was_on_;
+    if (should_process || fading)
       ProcessorRouter::process();
-    else  {
+
+    if (fading)
+      crossfade(should_process);
+    else if (!should_process) {
       for (int i = 0; i < numOutputs(); ++i)
         utils::copyBuffer(output(i)->buffer, input(kAudio)->source->buffer, buffer_size_);
     }
+    was_on_ = should_process;
+  }
+
+  void BypassRouter::crossfade(bool fade_in) {
+    const mopo_float* dry = input(kAudio)->source->buffer;
+    mopo_float start = fade_in ? 0.0 : 1.0;
+    mopo_float inc = (fade_in ? 1.0 : -1.0) / buffer_size_;
+
+    for (int o = 0; o < numOutputs(); ++o) {
+      mopo_float* dest = output(o)->buffer;
+
+      VECTORIZE_LOOP
+      for (int i = 0; i < buffer_size_; ++i) {
+        mopo_float wet = start + (i + 1) * inc;
+        dest[i] = dry[i] + wet * (dest[i] - dry[i]);
+      }
+    }
   }
 } // namespace mopo
@@ -37,6 +37,17 @@ namespace mopo {
       }
 
       void process() override;
+
+      // Blends between the dry and processed audio over one buffer when
+      // switched. This runs the processors for one more buffer after turning
+      // off so it's only for routers that switch while a voice plays.
+      void setCrossfade(bool crossfade) { crossfade_ = crossfade; }
+
+    private:
+      void crossfade(bool fade_in);
+
+      bool crossfade_;
+      bool was_on_;
   };
 } // namespace mopo
 
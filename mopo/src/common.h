@@ -37,6 +37,12 @@
 #define VECTORIZE_LOOP
 #endif
 
+#ifdef _MSC_VER
+#define MOPO_RESTRICT __restrict
+#else
+#define MOPO_RESTRICT __restrict__
+#endif
+
 namespace mopo {
 
   typedef double mopo_float;
@@ -15,113 +15,73 @@
  */
 
 #include "distortion.h"
+
+#include "batch_math.h"
 #include "utils.h"
 
 namespace mopo {
 
-  namespace {
-    inline mopo_float linearFold(mopo_float t) {
-      mopo_float adjust = 0.25 * t + 0.75;
-      mopo_float range = adjust - floor(adjust);
-      return fabs(2.0 - 4.0 * range) - 1.0;
-    }
-
-    inline mopo_float sinFold(mopo_float t) {
-      mopo_float adjust = -0.25 * t + 0.5;
-      mopo_float range = adjust - floor(adjust);
-      return utils::quickSin1(range);
-    }
-  } // namespace
-
-
   Distortion::Distortion() :
       Processor(Distortion::kNumInputs, 1), last_mix_(0.0), last_drive_(0.0) { }
 
-  void Distortion::processSoftClip() {
+  void Distortion::applyDrive(mopo_float* MOPO_RESTRICT dest) {
     const mopo_float* audio = input(kAudio)->source->buffer;
+    mopo_float last_drive = last_drive_;
     mopo_float next_drive = input(kDrive)->at(0);
-    mopo_float mult_drive = (next_drive - last_drive_) / buffer_size_;
-    mopo_float next_mix = input(kMix)->at(0);
-    mopo_float mult_mix = (next_mix - last_mix_) / buffer_size_;
-
-    mopo_float* dest = output()->buffer;
+    mopo_float mult_drive = (next_drive - last_drive) / buffer_size_;
     int buffer_size = buffer_size_;
 
     VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size; ++i) {
-      mopo_float mix = last_mix_ + i * mult_mix;
-      mopo_float drive = last_drive_ + i * mult_drive;
-      mopo_float distort = drive * audio[i];
-      dest[i] = utils::interpolate(audio[i], utils::quickTanh(distort), mix);
-    }
+    for (int i = 0; i < buffer_size; ++i)
+      dest[i] = (last_drive + i * mult_drive) * audio[i];
 
-    last_mix_ = next_mix;
     last_drive_ = next_drive;
   }
 
-  void Distortion::processHardClip() {
+  void Distortion::mixOutput(const mopo_float* MOPO_RESTRICT distorted) {
     const mopo_float* audio = input(kAudio)->source->buffer;
-    mopo_float next_drive = input(kDrive)->at(0);
-    mopo_float mult_drive = (next_drive - last_drive_) / buffer_size_;
+    mopo_float last_mix = last_mix_;
     mopo_float next_mix = input(kMix)->at(0);
-    mopo_float mult_mix = (next_mix - last_mix_) / buffer_size_;
+    mopo_float mult_mix = (next_mix - last_mix) / buffer_size_;
 
-    mopo_float* dest = output()->buffer;
+    mopo_float* MOPO_RESTRICT dest = output()->buffer;
     int buffer_size = buffer_size_;
 
+    VECTORIZE_LOOP
     for (int i = 0; i < buffer_size; ++i) {
-      mopo_float mix = last_mix_ + i * mult_mix;
-      mopo_float drive = last_drive_ + i * mult_drive;
-      mopo_float distort = utils::clamp(drive * audio[i], -1.0, 1.0);
-      dest[i] = utils::interpolate(audio[i], distort, mix);
+      mopo_float mix = last_mix + i * mult_mix;
+      dest[i] = utils::interpolate(audio[i], distorted[i], mix);
     }
 
     last_mix_ = next_mix;
-    last_drive_ = next_drive;
   }
 
-  void Distortion::processLinearFold() {
-    const mopo_float* audio = input(kAudio)->source->buffer;
-    mopo_float next_drive = input(kDrive)->at(0);
-    mopo_float mult_drive = (next_drive - last_drive_) / buffer_size_;
-    mopo_float next_mix = input(kMix)->at(0);
-    mopo_float mult_mix = (next_mix - last_mix_) / buffer_size_;
-
-    mopo_float* dest = output()->buffer;
-    int buffer_size = buffer_size_;
+  void Distortion::processSoftClip() {
+    mopo_float distorted[MAX_BUFFER_SIZE];
+    applyDrive(distorted);
+    batch::quickTanh(distorted, distorted, buffer_size_);
+    mixOutput(distorted);
+  }
 
-    VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size; ++i) {
-      mopo_float mix = last_mix_ + i * mult_mix;
-      mopo_float drive = last_drive_ + i * mult_drive;
-      mopo_float distort = linearFold(drive * audio[i]);
-      dest[i] = utils::interpolate(audio[i], distort, mix);
-    }
+  void Distortion::processHardClip() {
+    mopo_float distorted[MAX_BUFFER_SIZE];
+    applyDrive(distorted);
+    batch::clamp(distorted, distorted, buffer_size_, -1.0, 1.0);
+    mixOutput(distorted);
+  }
 
-    last_mix_ = next_mix;
-    last_drive_ = next_drive;
+  void Distortion::processLinearFold() {
+    mopo_float distorted[MAX_BUFFER_SIZE];
+    applyDrive(distorted);
+    batch::linearFold(distorted, distorted, buffer_size_);
+    mixOutput(distorted);
   }
 
   void Distortion::processSinFold() {
-    const mopo_float* audio = input(kAudio)->source->buffer;
-    mopo_float next_drive = input(kDrive)->at(0);
-    mopo_float mult_drive = (next_drive - last_drive_) / buffer_size_;
-    mopo_float next_mix = input(kMix)->at(0);
-    mopo_float mult_mix = (next_mix - last_mix_) / buffer_size_;
-
-    mopo_float* dest = output()->buffer;
-    int buffer_size = buffer_size_;
-
-    VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size; ++i) {
-      mopo_float mix = last_mix_ + i * mult_mix;
-      mopo_float drive = last_drive_ + i * mult_drive;
-      mopo_float distort = sinFold(drive * audio[i]);
-      dest[i] = utils::interpolate(audio[i], distort, mix);
-    }
-
-    last_mix_ = next_mix;
-    last_drive_ = next_drive;
+    mopo_float distorted[MAX_BUFFER_SIZE];
+    applyDrive(distorted);
+    batch::sinFold(distorted, distorted, buffer_size_);
+    mixOutput(distorted);
   }
 
   void Distortion::process() {
@@ -58,6 +58,12 @@ namespace mopo {
       void processSinFold();
 
     private:
+      // Writes the audio input scaled by the drive ramp for this buffer.
+      void applyDrive(mopo_float* MOPO_RESTRICT dest);
+
+      // Crossfades the dry input with _distorted_ by the mix ramp.
+      void mixOutput(const mopo_float* MOPO_RESTRICT distorted);
+
       mopo_float last_mix_;
       mopo_float last_drive_;
   };
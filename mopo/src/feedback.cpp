@@ -28,13 +28,13 @@ namespace mopo {
     if (control_rate_)
       buffer_[0] = input(0)->at(0);
     else
-      utils::copyBuffer(buffer_, input(0)->source->buffer, buffer_size_);
+      utils::copyBuffer(buffer_.data(), input(0)->source->buffer, buffer_size_);
   }
 
   void Feedback::refreshOutput() {
     if (control_rate_)
       output(0)->buffer[0] = buffer_[0];
     else
-      utils::copyBuffer(output(0)->buffer, buffer_, MAX_BUFFER_SIZE);
+      utils::copyBuffer(output(0)->buffer, buffer_.data(), MAX_BUFFER_SIZE);
   }
 } // namespace mopo
@@ -21,6 +21,8 @@
 #include "processor.h"
 #include "utils.h"
 
+#include <vector>
+
 namespace mopo {
 
   // A special processor for the purpose of feedback loops in the signal flow.
@@ -28,9 +30,9 @@ namespace mopo {
   // sample feedback processing.
   class Feedback : public Processor {
     public:
-      Feedback(bool control_rate = false) : Processor(1, 1, control_rate) {
-        utils::zeroBuffer(buffer_, MAX_BUFFER_SIZE);
-      }
+      Feedback(bool control_rate = false) :
+          Processor(1, 1, control_rate),
+          buffer_(control_rate ? 1 : MAX_BUFFER_SIZE, 0.0) { }
 
       virtual ~Feedback() { }
 
@@ -52,7 +54,8 @@ namespace mopo {
       }
 
     protected:
-      mopo_float buffer_[MAX_BUFFER_SIZE];
+      // Copied into every voice, so control rate feedback only keeps one.
+      std::vector<mopo_float> buffer_;
   };
 
   namespace cr {
@@ -30,29 +30,37 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(kTarget));
     MOPO_ASSERT(inputMatchesBufferSize(kRunSeconds));
 
+    const mopo_float* target = input(kTarget)->source->buffer;
+    const mopo_float* run_seconds = input(kRunSeconds)->source->buffer;
+    mopo_float* dest = output(0)->buffer;
+
     int i = 0;
     if (input(kTriggerJump)->source->triggered) {
-      int trigger_offset = input(kTriggerJump)->source->trigger_offset;
-      for (; i < trigger_offset; ++i)
-        tick(i);
-
-      last_value_ = input(kTarget)->at(i);
+      i = input(kTriggerJump)->source->trigger_offset;
+      processSpan(target, run_seconds, dest, 0, i);
+      last_value_ = target[i];
     }
 
-    for (; i < buffer_size_; ++i)
-      tick(i);
+    processSpan(target, run_seconds, dest, i, buffer_size_);
   }
 
-  inline void LinearSlope::tick(int i) {
-    mopo_float target = input(kTarget)->at(i);
-    if (utils::closeToZero(input(kRunSeconds)->at(i)))
-      last_value_ = input(kTarget)->at(i);
-
-    mopo_float increment = 1.0 / (sample_rate_ * input(kRunSeconds)->at(0));
-    if (target <= last_value_)
-      last_value_ = utils::clamp(last_value_ - increment, target, last_value_);
-    else
-      last_value_ = utils::clamp(last_value_ + increment, last_value_, target);
-    output(0)->buffer[i] = last_value_;
+  inline void LinearSlope::processSpan(const mopo_float* target,
+                                       const mopo_float* run_seconds,
+                                       mopo_float* MOPO_RESTRICT dest,
+                                       int start, int end) {
+    mopo_float increment = 1.0 / (sample_rate_ * run_seconds[0]);
+    mopo_float value = last_value_;
+
+    for (int i = start; i < end; ++i) {
+      if (utils::closeToZero(run_seconds[i]))
+        value = target[i];
+
+      if (target[i] <= value)
+        value = utils::clamp(value - increment, target[i], value);
+      else
+        value = utils::clamp(value + increment, value, target[i]);
+      dest[i] = value;
+    }
+    last_value_ = value;
   }
 } // namespace mopo
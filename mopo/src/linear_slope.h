@@ -41,9 +41,11 @@ namespace mopo {
       }
 
       virtual void process() override;
-      void tick(int i);
 
     private:
+      void processSpan(const mopo_float* target, const mopo_float* run_seconds,
+                       mopo_float* MOPO_RESTRICT dest, int start, int end);
+
       mopo_float last_value_;
   };
 } // namespace mopo
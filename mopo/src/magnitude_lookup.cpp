@@ -14,9 +14,524 @@
  * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// Generated by tools/generate_lookups.cpp. Don't edit by hand.
+
 #include "magnitude_lookup.h"
 
 namespace mopo {
 
-  const MagnitudeLookupSingleton MagnitudeLookup::lookup_;
+  const mopo_float MagnitudeLookup::lookup_[MAGNITUDE_LOOKUP_RESOLUTION + 2] = {
+    0.001, 0.0010067752981368567, 0.0010135965009385568, 0.0010204639194228904,
+    0.0010273778667148859, 0.0010343386580610873, 0.0010413466108439274, 0.0010484020445962004,
+    0.0010555052810156298, 0.0010626566439795376, 0.0010698564595596107, 0.0010771050560367691,
+    0.0010844027639161341, 0.0010917499159420973, 0.0010991468471134933, 0.0011065938946988735,
+    0.0011140913982518839, 0.001121639699626748, 0.0011292391429938537, 0.0011368900748554458,
+    0.0011445928440614248, 0.0011523478018252537, 0.0011601553017399715, 0.0011680156997943148,
+    0.0011759293543889507, 0.0011838966263528173, 0.0011919178789595766, 0.0011999934779441778,
+    0.0012081237915195333, 0.0012163091903933079, 0.0012245500477848215, 0.0012328467394420659,
+    0.0012411996436588377, 0.0012496091412919868, 0.0012580756157787815, 0.0012665994531543925,
+    0.0012751810420694933, 0.0012838207738079819, 0.0012925190423048211, 0.0013012762441640009,
+    0.0013100927786766211, 0.0013189690478390985, 0.0013279054563714945, 0.0013369024117359702,
+    0.0013459603241553642, 0.0013550796066318972, 0.001364260674966003, 0.0013735039477752872,
+    0.0013828098465136144, 0.0013921787954903255, 0.0014016112218895825, 0.0014111075557898486,
+    0.0014206682301834961, 0.00143029368099655, 0.001439984347108564, 0.0014497406703726315,
+    0.0014595630956355328, 0.0014694520707580171, 0.0014794080466352243, 0.0014894314772172428,
+    0.0014995228195298087, 0.0015096825336951432, 0.0015199110829529348, 0.0015302089336814522,
+    0.0015405765554188256, 0.0015510144208844402, 0.001561523006000498, 0.0015721027899137107,
+    0.0015827542550171604, 0.0015934778869722804, 0.0016042741747310078, 0.0016151436105580686,
+    0.0016260866900534405, 0.0016371039121749254, 0.0016481957792609269, 0.0016593627970533269,
+    0.0016706054747205735, 0.001681924324880869, 0.0016933198636255701, 0.0017047926105426933,
+    0.0017163430887406322, 0.0017279718248719817, 0.0017396793491575799, 0.0017514661954106535,
+    0.0017633329010611888, 0.0017752800071804051, 0.0017873080585054555, 0.0017994176034642347,
+    0.0018116091942004151, 0.001823883386598592, 0.0018362407403096593, 0.0018486818187762981,
+    0.0018612071892586961, 0.0018738174228603831, 0.0018865130945543006, 0.0018992947832089885,
+    0.0019121630716150081, 0.0019251185465114856, 0.0019381617986128953, 0.0019512934226359622,
+    0.0019645140173268107, 0.001977824185488232, 0.0019912245340072028, 0.0020047156738825234,
+    0.0020182982202527093, 0.0020319727924240066, 0.0020457400138986629, 0.0020596005124033216,
+    0.0020735549199176794, 0.0020876038727032655, 0.0021017480113324893, 0.0021159879807178105,
+    0.0021303244301411816, 0.0021447580132836152, 0.0021592893882550267, 0.0021739192176242032,
+    0.0021886481684490521, 0.0022034769123069776, 0.0022184061253255403, 0.0022334364882132477,
+    0.0022485686862906292, 0.0022638034095214467, 0.0022791413525441897, 0.0022945832147037155,
+    0.0023101297000831605, 0.0023257815175360291, 0.0023415393807185293, 0.0023574040081220881,
+    0.0023733761231061364, 0.0023894564539310753, 0.0024056457337914977, 0.0024219447008495929,
+    0.0024383540982688291, 0.0024548746742478244, 0.0024715071820544752, 0.0024882523800602769,
+    0.002505111031774929, 0.0025220839058811306, 0.002539171776269646, 0.002556375422074565,
+    0.0025736956277088532, 0.0025911331829001029, 0.0026086888827265564, 0.0026263635276533325,
+    0.0026441579235689508, 0.002662072881822063, 0.0026801092192584486, 0.0026982677582582633,
+    0.0027165493267735314, 0.0027349547583658995, 0.0027534848922446437, 0.0027721405733049319,
+    0.0027909226521663499, 0.002809831985211684, 0.0028288694346259697, 0.0028480358684358021,
+    0.0028673321605489164, 0.0028867591907940329, 0.0029063178449609739, 0.0029260090148410518,
+    0.0029458335982677306, 0.0029657924991575639, 0.0029858866275514098, 0.0030061168996559245,
+    0.0030264842378853372, 0.003046989570903508, 0.0030676338336662729, 0.0030884179674640706,
+    0.0031093429199648649, 0.0031304096452573517, 0.0031516191038944625, 0.0031729722629371608,
+    0.0031944700959985373, 0.0032161135832882008, 0.0032379037116569732, 0.0032598414746418847,
+    0.0032819278725114776, 0.0033041639123113993, 0.0033265506079103524, 0.0033490889800462872,
+    0.0033717800563729658, 0.003394624871506797, 0.0034176244670740446, 0.0034407798917582876,
+    0.0034640922013482556, 0.0034875624587859468, 0.0035111917342151308, 0.0035349811050301057,
+    0.0035589316559248439, 0.0035830444789424283, 0.0036073206735248819, 0.0036317613465632601,
+    0.0036563676124481423, 0.003681140593120422, 0.0037060814181224988, 0.0037311912246497437,
+    0.0037564711576023734, 0.0037819223696376292, 0.0038075460212223721, 0.0038333432806859566,
+    0.0038593153242735246, 0.0038854633361996137, 0.0039117885087021926, 0.0039382920420969799,
+    0.0039649751448322017, 0.0039918390335436623, 0.004018884933110263, 0.0040461140767098069,
+    0.0040735277058752536, 0.0041011270705513005, 0.0041289134291514233, 0.0041568880486151918,
+    0.004185052204466101, 0.0042134071808696645, 0.0042419542706920339, 0.0042706947755588812,
+    0.0042996300059148134, 0.0043287612810830574, 0.0043580899293256814, 0.004387617287904092,
+    0.0044173447031400732, 0.0044472735304771083, 0.0044774051345422465, 0.0045077408892082588,
+    0.00453828217765635, 0.0045690303924391506, 0.00459998693554429, 0.0046311532184582444,
+    0.0046625306622307674, 0.0046941206975396124, 0.0047259247647558379, 0.0047579443140094088,
+    0.0047901808052553899, 0.0048226357083404389, 0.0048553105030699024, 0.0048882066792752081,
+    0.0049213257368818774, 0.004954669185977833, 0.0049882385468823353, 0.0050220353502152199,
+    0.0050560611369667666, 0.0050903174585678916, 0.0051248058769609367, 0.0051595279646708576,
+    0.0051944853048769574, 0.0052296794914850203, 0.0052651121292000376, 0.0053007848335993426,
+    0.0053366992312063122, 0.0053728569595644701, 0.0054092596673122051, 0.0054459090142579148,
+    0.0054828066714557129, 0.0055199543212815731, 0.0055573536575100864, 0.0055950063853916635,
+    0.0056329142217303148, 0.0056710788949618784, 0.0057095021452328821, 0.0057481857244798523,
+    0.0057871313965092335, 0.0058263409370777472, 0.0058658161339734229, 0.0059055587870970715,
+    0.0059455707085443949, 0.0059858537226885455, 0.0060264096662633743, 0.0060672403884471388,
+    0.0061083477509468525, 0.006149733628083116, 0.0061913999068756338, 0.0062333484871292168,
+    0.006275581281520449, 0.0063181002156848277, 0.006360907228304632, 0.006404004271197276,
+    0.0064473933094043485, 0.006491076321281139, 0.0065350552985869101, 0.0065793322465756759,
+    0.0066239091840876686, 0.0066687881436413264, 0.0067139711715260321, 0.0067594603278953759,
+    0.0068052576868611291, 0.0068513653365877497, 0.0068977853793876585, 0.0069445199318170538,
+    0.006991571124772466, 0.0070389411035878388, 0.0070866320281324224, 0.0071346460729092174,
+    0.0071829854271541317, 0.0072316522949357987, 0.0072806488952560731, 0.0073299774621512102,
+    0.0073796402447937259, 0.0074296395075949496, 0.0074799775303082761, 0.0075306566081331039,
+    0.0075816790518194966, 0.007633047187773535, 0.0076847633581633972, 0.0077368299210261475,
+    0.0077892492503752533, 0.0078420237363088334, 0.0078951557851186342, 0.0079486478193997422,
+    0.0080025022781610514, 0.0080567216169364683, 0.0081113083078968723, 0.0081662648399628366,
+    0.008221593718918117, 0.0082772974675238958, 0.0083333786256338197, 0.0083898397503097983,
+    0.0084466834159385995, 0.0085039122143492282, 0.0085615287549311025, 0.0086195356647530332,
+    0.0086779355886830046, 0.0087367311895087708, 0.0087959251480592693, 0.0088555201633268472,
+    0.008915518952590332, 0.00897592425153893, 0.0090367388143969482, 0.0090979654140493933,
+    0.0091596068421683895, 0.0092216659093404749, 0.0092841454451947445, 0.0093470482985318799,
+    0.0094103773374540328, 0.0094741354494956055, 0.0095383255417549016, 0.0096029505410266877,
+    0.0096680133939356337, 0.0097335170670706725, 0.0097994645471202596, 0.0098658588410085579,
+    0.0099327029760325342, 0.01, 0.010067752981368572, 0.010135965009385569,
+    0.0102046391942289, 0.010273778667148859, 0.010343386580610877, 0.010413466108439275,
+    0.010484020445961998, 0.010555052810156298, 0.010626566439795381, 0.010698564595596106,
+    0.010771050560367696, 0.010844027639161341, 0.010917499159420979, 0.010991468471134946,
+    0.01106593894698874, 0.011140913982518839, 0.011216396996267487, 0.011292391429938549,
+    0.011368900748554463, 0.011445928440614249, 0.011523478018252544, 0.011601553017399726,
+    0.011680156997943154, 0.011759293543889507, 0.01183896626352818, 0.011919178789595778,
+    0.011999934779441784, 0.012081237915195333, 0.012163091903933086, 0.012245500477848227,
+    0.012328467394420665, 0.012411996436588376, 0.012496091412919874, 0.012580756157787828,
+    0.012665994531543932, 0.012751810420694933, 0.012838207738079825, 0.012925190423048225,
+    0.013012762441640015, 0.013100927786766211, 0.01318969047839099, 0.013279054563714959,
+    0.013369024117359709, 0.013459603241553642, 0.01355079606631898, 0.013642606749660044,
+    0.013735039477752878, 0.013828098465136145, 0.013921787954903262, 0.01401611221889584,
+    0.014111075557898494, 0.014206682301834962, 0.014302936809965507, 0.014399843471085654,
+    0.014497406703726323, 0.014595630956355327, 0.014694520707580179, 0.014794080466352258,
+    0.014894314772172436, 0.014995228195298086, 0.01509682533695144, 0.015199110829529346,
+    0.015302089336814529, 0.015405765554188258, 0.015510144208844409, 0.015615230060004981,
+    0.015721027899137114, 0.015827542550171603, 0.015934778869722811, 0.016042741747310078,
+    0.016151436105580695, 0.016260866900534389, 0.016371039121749264, 0.016481957792609268,
+    0.016593627970533285, 0.016706054747205736, 0.016819243248808697, 0.016933198636255701,
+    0.01704792610542695, 0.017163430887406322, 0.017279718248719825, 0.017396793491575798,
+    0.017514661954106555, 0.01763332901061189, 0.017752800071804062, 0.017873080585054553,
+    0.017994176034642366, 0.018116091942004153, 0.018238833865985928, 0.018362407403096595,
+    0.018486818187762998, 0.01861207189258696, 0.018738174228603841, 0.018865130945543006,
+    0.018992947832089904, 0.019121630716150081, 0.019251185465114867, 0.019381617986128953,
+    0.019512934226359642, 0.019645140173268107, 0.01977824185488233, 0.019912245340072028,
+    0.020047156738825251, 0.020182982202527091, 0.020319727924240076, 0.020457400138986628,
+    0.020596005124033239, 0.020735549199176792, 0.020876038727032666, 0.021017480113324893,
+    0.021159879807178126, 0.021303244301411815, 0.021447580132836163, 0.021592893882550267,
+    0.021739192176242057, 0.021886481684490519, 0.02203476912306979, 0.022184061253255404,
+    0.022334364882132501, 0.022485686862906293, 0.022638034095214477, 0.022791413525441895,
+    0.022945832147037156, 0.023101297000831605, 0.0232578151753603, 0.02341539380718529,
+    0.023574040081220882, 0.023733761231061367, 0.023894564539310766, 0.024056457337914977,
+    0.024219447008495928, 0.024383540982688291, 0.024548746742478256, 0.024715071820544752,
+    0.024882523800602772, 0.02505111031774929, 0.025220839058811329, 0.025391717762696459,
+    0.025563754220745648, 0.025736956277088534, 0.025911331829001055, 0.026086888827265564,
+    0.026263635276533328, 0.026441579235689509, 0.026620728818220626, 0.026801092192584489,
+    0.026982677582582631, 0.027165493267735312, 0.027349547583658994, 0.027534848922446436,
+    0.02772140573304932, 0.027909226521663499, 0.028098319852116842, 0.028288694346259694,
+    0.028480358684358019, 0.028673321605489164, 0.028867591907940329, 0.02906317844960974,
+    0.029260090148410516, 0.029458335982677303, 0.02965792499157564, 0.029858866275514099,
+    0.030061168996559248, 0.030264842378853372, 0.030469895709035081, 0.030676338336662726,
+    0.030884179674640706, 0.031093429199648651, 0.031304096452573517, 0.031516191038944624,
+    0.031729722629371612, 0.031944700959985375, 0.032161135832882007, 0.032379037116569732,
+    0.032598414746418843, 0.032819278725114739, 0.033041639123113996, 0.033265506079103523,
+    0.033490889800462872, 0.033717800563729625, 0.033946248715067968, 0.034176244670740451,
+    0.034407798917582874, 0.034640922013482518, 0.03487562458785947, 0.035111917342151307,
+    0.035349811050301057, 0.0355893165592484, 0.035830444789424286, 0.036073206735248824,
+    0.036317613465632601, 0.036563676124481387, 0.036811405931204223, 0.037060814181224991,
+    0.037311912246497436, 0.037564711576023695, 0.037819223696376289, 0.038075460212223716,
+    0.038333432806859566, 0.038593153242735205, 0.038854633361996134, 0.039117885087021922,
+    0.039382920420969802, 0.039649751448321974, 0.039918390335436628, 0.04018884933110263,
+    0.040461140767098072, 0.040735277058752489, 0.041011270705513005, 0.041289134291514193,
+    0.04156888048615192, 0.041850522044660964, 0.04213407180869664, 0.042419542706920298,
+    0.042706947755588809, 0.04299630005914809, 0.043287612810830572, 0.043580899293256772,
+    0.043876172879040914, 0.044173447031400685, 0.044472735304771083, 0.044774051345422422,
+    0.045077408892082588, 0.045382821776563449, 0.045690303924391502, 0.045999869355442854,
+    0.046311532184582442, 0.046625306622307627, 0.046941206975396124, 0.047259247647558331,
+    0.047579443140094088, 0.047901808052553854, 0.048226357083404392, 0.04855310503069897,
+    0.04888206679275213, 0.04921325736881875, 0.049546691859778384, 0.049882385468823329,
+    0.050220353502152246, 0.050560611369667642, 0.050903174585678918, 0.051248058769609341,
+    0.051595279646708625, 0.05194485304876955, 0.052296794914850203, 0.052651121292000343,
+    0.053007848335993479, 0.0533669923120631, 0.053728569595644697, 0.054092596673122023,
+    0.0544590901425792, 0.054828066714557103, 0.055199543212815734, 0.055573536575100842,
+    0.055950063853916689, 0.056329142217303126, 0.056710788949618784, 0.057095021452328788,
+    0.057481857244798581, 0.057871313965092298, 0.058263409370777473, 0.058658161339734199,
+    0.059055587870970774, 0.059455707085443912, 0.059858537226885458, 0.060264096662633715,
+    0.060672403884471447, 0.061083477509468499, 0.061497336280831164, 0.061913999068756304,
+    0.062333484871292234, 0.062755812815204454, 0.063181002156848284, 0.063609072283046283,
+    0.064040042711972833, 0.064473933094043451, 0.06491076321281139, 0.065350552985869073,
+    0.065793322465756823, 0.066239091840876646, 0.066687881436413257, 0.067139711715260286,
+    0.067594603278953821, 0.068052576868611256, 0.068513653365877503, 0.06897785379387654,
+    0.069445199318170614, 0.069915711247724624, 0.070389411035878383, 0.070866320281324183,
+    0.071346460729092176, 0.071829854271541288, 0.072316522949357989, 0.0728064889525607,
+    0.073299774621512104, 0.073796402447937226, 0.074296395075949498, 0.074799775303082724,
+    0.075306566081331044, 0.075816790518194926, 0.076330471877735354, 0.076847633581633934,
+    0.077368299210261476, 0.077892492503752492, 0.078420237363088341, 0.078951557851186294,
+    0.079486478193997429, 0.080025022781610486, 0.080567216169364686, 0.081113083078968681,
+    0.081662648399628376, 0.082215937189181118, 0.082772974675238961, 0.083333786256338152,
+    0.083898397503097993, 0.084466834159385953, 0.085039122143492282, 0.08561528754931097,
+    0.086195356647530322, 0.086779355886830001, 0.087367311895087715, 0.087959251480592637,
+    0.088555201633268465, 0.089155189525903275, 0.08975924251538929, 0.09036738814396944,
+    0.090979654140493943, 0.091596068421683857, 0.092216659093404749, 0.0928414544519474,
+    0.093470482985318806, 0.094103773374540289, 0.094741354494956048, 0.095383255417548968,
+    0.096029505410266877, 0.096680133939356289, 0.097335170670706711, 0.097994645471202541,
+    0.098658588410085582, 0.0993270297603253, 0.10000000000000001, 0.10067752981368562,
+    0.10135965009385568, 0.102046391942289, 0.1027377866714886, 0.10343386580610867,
+    0.10413466108439275, 0.10484020445961999, 0.10555052810156298, 0.10626566439795371,
+    0.10698564595596106, 0.10771050560367686, 0.10844027639161341, 0.10917499159420968,
+    0.10991468471134934, 0.11065938946988729, 0.11140913982518838, 0.11216396996267475,
+    0.11292391429938538, 0.11368900748554452, 0.11445928440614249, 0.11523478018252532,
+    0.11601553017399724, 0.11680156997943154, 0.11759293543889517, 0.11838966263528181,
+    0.11919178789595776, 0.11999934779441784, 0.12081237915195342, 0.12163091903933086,
+    0.12245500477848224, 0.12328467394420665, 0.12411996436588386, 0.12496091412919874,
+    0.12580756157787826, 0.12665994531543931, 0.12751810420694942, 0.12838207738079824,
+    0.12925190423048222, 0.13012762441640016, 0.13100927786766223, 0.13189690478390992,
+    0.13279054563714954, 0.1336902411735971, 0.13459603241553653, 0.13550796066318979,
+    0.13642606749660041, 0.13735039477752878, 0.13828098465136154, 0.13921787954903261,
+    0.14016112218895838, 0.14111075557898492, 0.14206682301834972, 0.14302936809965508,
+    0.14399843471085649, 0.14497406703726323, 0.14595630956355338, 0.14694520707580178,
+    0.14794080466352252, 0.14894314772172434, 0.14995228195298099, 0.15096825336951439,
+    0.15199110829529344, 0.15302089336814528, 0.15405765554188269, 0.15510144208844409,
+    0.15615230060004978, 0.15721027899137113, 0.15827542550171617, 0.1593477886972281,
+    0.16042741747310074, 0.16151436105580694, 0.16260866900534401, 0.16371039121749262,
+    0.16481957792609264, 0.16593627970533278, 0.16706054747205731, 0.16819243248808696,
+    0.16933198636255697, 0.17047926105426942, 0.17163430887406317, 0.17279718248719828,
+    0.17396793491575793, 0.17514661954106545, 0.17633329010611884, 0.17752800071804059,
+    0.17873080585054549, 0.17994176034642356, 0.18116091942004148, 0.18238833865985929,
+    0.18362407403096589, 0.18486818187762991, 0.18612071892586957, 0.18738174228603841,
+    0.18865130945543002, 0.18992947832089893, 0.19121630716150076, 0.19251185465114867,
+    0.19381617986128949, 0.19512934226359632, 0.19645140173268102, 0.19778241854882331,
+    0.19912245340072021, 0.20047156738825242, 0.20182982202527086, 0.20319727924240077,
+    0.20457400138986623, 0.20596005124033226, 0.20735549199176787, 0.20876038727032667,
+    0.21017480113324888, 0.21159879807178117, 0.21303244301411808, 0.21447580132836164,
+    0.21592893882550263, 0.21739192176242045, 0.21886481684490516, 0.22034769123069789,
+    0.22184061253255399, 0.2233436488213249, 0.22485686862906287, 0.22638034095214477,
+    0.22791413525441889, 0.22945832147037143, 0.23101297000831597, 0.23257815175360302,
+    0.23415393807185286, 0.23574040081220871, 0.23733761231061359, 0.23894564539310767,
+    0.24056457337914969, 0.24219447008495915, 0.24383540982688284, 0.24548746742478258,
+    0.24715071820544746, 0.24882523800602757, 0.25051110317749281, 0.25220839058811317,
+    0.25391717762696453, 0.25563754220745638, 0.25736956277088524, 0.25911331829001044,
+    0.26086888827265559, 0.26263635276533315, 0.26441579235689505, 0.26620728818220613,
+    0.2680109219258448, 0.2698267758258262, 0.27165493267735308, 0.27349547583658979,
+    0.27534848922446448, 0.27721405733049326, 0.27909226521663516, 0.28098319852116849,
+    0.28288694346259707, 0.28480358684358026, 0.28673321605489177, 0.28867591907940338,
+    0.29063178449609756, 0.29260090148410522, 0.29458335982677319, 0.29657924991575646,
+    0.29858866275514118, 0.30061168996559257, 0.30264842378853385, 0.30469895709035089,
+    0.30676338336662745, 0.30884179674640716, 0.31093429199648664, 0.31304096452573527,
+    0.31516191038944641, 0.31729722629371615, 0.31944700959985395, 0.32161135832882015,
+    0.32379037116569753, 0.32598414746418852, 0.32819278725114764, 0.33041639123114003,
+    0.33265506079103546, 0.33490889800462881, 0.33717800563729644, 0.33946248715067978,
+    0.34176244670740469, 0.34407798917582888, 0.34640922013482539, 0.34875624587859477,
+    0.35111917342151333, 0.35349811050301067, 0.35589316559248424, 0.35830444789424293,
+    0.36073206735248842, 0.36317613465632609, 0.36563676124481409, 0.36811405931204227,
+    0.3706081418122501, 0.37311912246497447, 0.37564711576023718, 0.37819223696376303,
+    0.38075460212223744, 0.38333432806859574, 0.38593153242735229, 0.38854633361996149,
+    0.39117885087021947, 0.39382920420969808, 0.39649751448322001, 0.39918390335436638,
+    0.40188849331102661, 0.4046114076709808, 0.40735277058752517, 0.41011270705513014,
+    0.41289134291514218, 0.41568880486151932, 0.41850522044660993, 0.42134071808696655,
+    0.42419542706920321, 0.4270694775558882, 0.42996300059148118, 0.43287612810830584,
+    0.43580899293256797, 0.43876172879040926, 0.44173447031400714, 0.44472735304771088,
+    0.4477405134542245, 0.45077408892082604, 0.45382821776563481, 0.45690303924391518,
+    0.45999869355442885, 0.46311532184582455, 0.46625306622307655, 0.46941206975396138,
+    0.47259247647558367, 0.47579443140094102, 0.47901808052553885, 0.48226357083404403,
+    0.48553105030699001, 0.48882066792752094, 0.49213257368818752, 0.49546691859778347,
+    0.49882385468823337, 0.50220353502152215, 0.50560611369667652, 0.50903174585678879,
+    0.5124805876960935, 0.51595279646708592, 0.51944853048769557, 0.52296794914850164,
+    0.52651121292000347, 0.53007848335993446, 0.53366992312063111, 0.5372856959564466,
+    0.54092596673122029, 0.54459090142579158, 0.54828066714557111, 0.55199543212815694,
+    0.55573536575100846, 0.55950063853916643, 0.5632914221730313, 0.5671078894961874,
+    0.57095021452328798, 0.57481857244798529, 0.57871313965092308, 0.5826340937077743,
+    0.58658161339734205, 0.59055587870970727, 0.59455707085443921, 0.59858537226885411,
+    0.60264096662633726, 0.60672403884471393, 0.61083477509468509, 0.61497336280831116,
+    0.61913999068756309, 0.62333484871292177, 0.6275581281520447, 0.63181002156848221,
+    0.63609072283046297, 0.64040042711972778, 0.64473933094043467, 0.6491076321281134,
+    0.65350552985869126, 0.65793322465756821, 0.66239091840876663, 0.66687881436413265,
+    0.67139711715260342, 0.67594603278953824, 0.6805257686861127, 0.68513653365877503,
+    0.68977853793876609, 0.69445199318170614, 0.69915711247724632, 0.70389411035878391,
+    0.70866320281324247, 0.71346460729092176, 0.71829854271541294, 0.72316522949357986,
+    0.72806488952560766, 0.73299774621512104, 0.73796402447937226, 0.74296395075949495,
+    0.74799775303082783, 0.75306566081331039, 0.75816790518194932, 0.76330471877735351,
+    0.76847633581634001, 0.77368299210261471, 0.77892492503752497, 0.78420237363088341,
+    0.78951557851186371, 0.79486478193997423, 0.80025022781610489, 0.80567216169364686,
+    0.81113083078968762, 0.81662648399628368, 0.82215937189181132, 0.82772974675238953,
+    0.83333786256338238, 0.83898397503097988, 0.84466834159385962, 0.85039122143492274,
+    0.85615287549311059, 0.86195356647530319, 0.86779355886830012, 0.87367311895087718,
+    0.87959251480592726, 0.88555201633268465, 0.89155189525903289, 0.89759242515389293,
+    0.90367388143969529, 0.90979654140493937, 0.91596068421683863, 0.9221665909340474,
+    0.9284145445194748, 0.93470482985318804, 0.941037733745403, 0.94741354494956054,
+    0.95383255417549051, 0.96029505410266869, 0.96680133939356294, 0.97335170670706717,
+    0.97994645471202635, 0.98658588410085579, 0.99327029760325303, 1,
+    1.0067752981368572, 1.0135965009385568, 1.0204639194228899, 1.0273778667148858,
+    1.0343386580610876, 1.0413466108439273, 1.0484020445961999, 1.05550528101563,
+    1.062656643979538, 1.0698564595596107, 1.0771050560367685, 1.084402763916134,
+    1.0917499159420978, 1.0991468471134935, 1.1065938946988729, 1.1140913982518839,
+    1.1216396996267486, 1.1292391429938538, 1.1368900748554454, 1.1445928440614248,
+    1.1523478018252542, 1.1601553017399715, 1.1680156997943143, 1.1759293543889506,
+    1.1838966263528179, 1.1919178789595768, 1.1999934779441772, 1.2081237915195333,
+    1.2163091903933085, 1.2245500477848215, 1.2328467394420655, 1.2411996436588377,
+    1.2496091412919872, 1.2580756157787816, 1.266599453154392, 1.2751810420694933,
+    1.2838207738079823, 1.2925190423048212, 1.3012762441640002, 1.3100927786766212,
+    1.318969047839099, 1.3279054563714945, 1.3369024117359698, 1.3459603241553644,
+    1.3550796066318977, 1.3642606749660031, 1.3735039477752866, 1.3828098465136145,
+    1.392178795490326, 1.4016112218895826, 1.411107555789848, 1.4206682301834961,
+    1.4302936809965505, 1.439984347108564, 1.449740670372631, 1.4595630956355328,
+    1.4694520707580176, 1.4794080466352242, 1.4894314772172423, 1.4995228195298087,
+    1.5096825336951438, 1.5199110829529332, 1.5302089336814515, 1.5405765554188258,
+    1.5510144208844407, 1.5615230060004965, 1.5721027899137101, 1.5827542550171605,
+    1.593477886972281, 1.6042741747310048, 1.6151436105580679, 1.6260866900534388,
+    1.637103912174926, 1.6481957792609265, 1.6593627970533262, 1.6706054747205719,
+    1.6819243248808695, 1.6933198636255669, 1.7047926105426927, 1.7163430887406304,
+    1.7279718248719824, 1.7396793491575795, 1.751466195410653, 1.7633329010611869,
+    1.7752800071804058, 1.7873080585054522, 1.799417603464234, 1.8116091942004133,
+    1.8238833865985926, 1.8362407403096588, 1.8486818187762972, 1.8612071892586941,
+    1.8738174228603837, 1.8865130945542974, 1.8992947832089877, 1.9121630716150062,
+    1.9251185465114864, 1.9381617986128947, 1.9512934226359615, 1.9645140173268085,
+    1.9778241854882328, 1.9912245340071992, 2.0047156738825223, 2.0182982202527069,
+    2.0319727924240074, 2.0457400138986621, 2.0596005124033208, 2.0735549199176773,
+    2.0876038727032666, 2.1017480113324853, 2.1159879807178097, 2.1303244301411794,
+    2.1447580132836164, 2.1592893882550261, 2.1739192176242024, 2.18864816844905,
+    2.2034769123069786, 2.2184061253255365, 2.2334364882132469, 2.2485686862906271,
+    2.2638034095214472, 2.279141352544189, 2.2945832147037124, 2.310129700083158,
+    2.3257815175360297, 2.3415393807185252, 2.3574040081220851, 2.3733761231061381,
+    2.3894564539310803, 2.4056457337914972, 2.4219447008495933, 2.4383540982688308,
+    2.4548746742478293, 2.4715071820544745, 2.4882523800602776, 2.5051110317749306,
+    2.5220839058811357, 2.5391717762696451, 2.5563754220745656, 2.573695627708855,
+    2.5911331829001081, 2.6086888827265557, 2.6263635276533335, 2.6441579235689527,
+    2.6620728818220654, 2.6801092192584481, 2.6982677582582641, 2.7165493267735328,
+    2.7349547583659022, 2.7534848922446429, 2.7721405733049327, 2.7909226521663517,
+    2.8098319852116869, 2.8288694346259686, 2.8480358684358027, 2.8673321605489179,
+    2.8867591907940358, 2.9063178449609732, 2.9260090148410525, 2.9458335982677322,
+    2.9657924991575668, 2.9858866275514093, 3.0061168996559253, 3.0264842378853389,
+    3.0469895709035111, 3.0676338336662718, 3.0884179674640713, 3.1093429199648672,
+    3.1304096452573549, 3.1516191038944616, 3.1729722629371619, 3.1944700959985388,
+    3.2161135832882044, 3.2379037116569727, 3.2598414746418851, 3.281927872511476,
+    3.3041639123114028, 3.3265506079103515, 3.3490889800462882, 3.3717800563729643,
+    3.3946248715068004, 3.4176244670740439, 3.4407798917582886, 3.4640922013482536,
+    3.4875624587859506, 3.5111917342151302, 3.5349811050301065, 3.5589316559248418,
+    3.5830444789424321, 3.6073206735248813, 3.6317613465632612, 3.6563676124481406,
+    3.6811405931204257, 3.7060814181224977, 3.7311912246497445, 3.7564711576023715,
+    3.7819223696376332, 3.8075460212223708, 3.8333432806859573, 3.8593153242735223,
+    3.8854633361996176, 3.9117885087021911, 3.9382920420969811, 3.9649751448321995,
+    3.9918390335436666, 4.0188849331102618, 4.0461140767098085, 4.073527705875251,
+    4.1011270705513043, 4.1289134291514182, 4.1568880486151931, 4.1850522044660989,
+    4.2134071808696687, 4.2419542706920286, 4.2706947755588818, 4.2996300059148114,
+    4.3287612810830618, 4.3580899293256756, 4.3876172879040931, 4.4173447031400714,
+    4.447273530477112, 4.4774051345422405, 4.50774088920826, 4.5382821776563471,
+    4.5690303924391547, 4.5999869355442842, 4.6311532184582456, 4.6625306622307647,
+    4.694120697539617, 4.725924764755832, 4.7579443140094098, 4.790180805255388,
+    4.8226357083404441, 4.8553105030698962, 4.8882066792752088, 4.921325736881875,
+    4.9546691859778385, 4.9882385468823296, 5.0220353502152211, 5.0560611369667647,
+    5.0903174585678919, 5.1248058769609299, 5.1595279646708585, 5.194485304876955,
+    5.2296794914850206, 5.2651121292000305, 5.3007848335993444, 5.3366992312063095,
+    5.3728569595644702, 5.409259667312198, 5.4459090142579161, 5.4828066714557107,
+    5.5199543212815732, 5.5573536575100793, 5.5950063853916649, 5.6329142217303119,
+    5.6710788949618784, 5.7095021452328742, 5.7481857244798533, 5.7871313965092304,
+    5.8263409370777479, 5.8658161339734152, 5.9055587870970729, 5.9455707085443912,
+    5.985853722688546, 6.0264096662633673, 6.0672403884471402, 6.1083477509468498,
+    6.1497336280831165, 6.1913999068756258, 6.2333484871292182, 6.2755812815204459,
+    6.3181002156848276, 6.3609072283046233, 6.4040042711972784, 6.4473933094043456,
+    6.4910763212811391, 6.5350552985869017, 6.5793322465756772, 6.6239091840876654,
+    6.6687881436413265, 6.7139711715260235, 6.7594603278953773, 6.8052576868611263,
+    6.85136533658775, 6.8977853793876491, 6.9445199318170561, 6.991571124772463,
+    7.0389411035878391, 7.0866320281324136, 7.134646072909212, 7.1829854271541285,
+    7.2316522949357989, 7.2806488952560642, 7.3299774621512048, 7.3796402447937215,
+    7.42963950759495, 7.4799775303082665, 7.5306566081330981, 7.581679051819493,
+    7.6330471877735349, 7.6847633581633872, 7.7368299210261409, 7.7892492503752493,
+    7.8420237363088336, 7.8951557851186243, 7.9486478193997359, 8.0025022781610478,
+    8.0567216169364695, 8.1113083078968629, 8.1662648399628317, 8.221593718918113,
+    8.2772974675238959, 8.3333786256338094, 8.3898397503097932, 8.4466834159385957,
+    8.5039122143492278, 8.561528754931091, 8.619535664753025, 8.677935588682999,
+    8.736731189508772, 8.7959251480592577, 8.8555201633268403, 8.9155189525903289,
+    8.9759242515389293, 9.0367388143969372, 9.0979654140493871, 9.1596068421683849,
+    9.2216659093404747, 9.2841454451947332, 9.3470482985318721, 9.4103773374540296,
+    9.4741354494956056, 9.5383255417548902, 9.6029505410266793, 9.6680133939356274,
+    9.7335170670706717, 9.7994645471202464, 9.8658588410085493, 9.9327029760325303,
+    10, 10.067752981368558, 10.135965009385558, 10.2046391942289,
+    10.273778667148859, 10.343386580610861, 10.413466108439264, 10.484020445961999,
+    10.555052810156299, 10.626566439795365, 10.698564595596096, 10.771050560367685,
+    10.844027639161341, 10.917499159420963, 10.991468471134922, 11.06593894698873,
+    11.140913982518839, 11.216396996267468, 11.292391429938526, 11.368900748554452,
+    11.445928440614248, 11.523478018252526, 11.601553017399702, 11.680156997943142,
+    11.759293543889507, 11.838966263528162, 11.919178789595755, 11.999934779441771,
+    12.081237915195333, 12.163091903933067, 12.245500477848204, 12.328467394420652,
+    12.411996436588376, 12.496091412919855, 12.580756157787803, 12.665994531543918,
+    12.751810420694932, 12.838207738079804, 12.925190423048198, 13.012762441640001,
+    13.100927786766212, 13.189690478390972, 13.279054563714931, 13.369024117359716,
+    13.459603241553664, 13.550796066318981, 13.642606749660043, 13.735039477752885,
+    13.828098465136167, 13.921787954903261, 14.01611221889584, 14.1110755578985,
+    14.206682301834983, 14.302936809965507, 14.399843471085655, 14.49740670372633,
+    14.59563095635535, 14.694520707580178, 14.794080466352257, 14.894314772172443,
+    14.995228195298109, 15.09682533695144, 15.199110829529348, 15.302089336814538,
+    15.40576555418828, 15.510144208844409, 15.615230060004981, 15.721027899137123,
+    15.827542550171628, 15.934778869722811, 16.042741747310078, 16.151436105580704,
+    16.260866900534413, 16.371039121749263, 16.481957792609268, 16.593627970533287,
+    16.706054747205744, 16.819243248808696, 16.9331986362557, 17.047926105426949,
+    17.163430887406331, 17.279718248719828, 17.396793491575796, 17.514661954106554,
+    17.633329010611899, 17.75280007180406, 17.873080585054556, 17.994176034642365,
+    18.116091942004161, 18.238833865985928, 18.362407403096594, 18.486818187762999,
+    18.612071892586968, 18.738174228603839, 18.865130945543008, 18.992947832089904,
+    19.12163071615009, 19.251185465114865, 19.381617986128955, 19.512934226359643,
+    19.645140173268118, 19.778241854882332, 19.912245340072026, 20.047156738825251,
+    20.182982202527104, 20.319727924240077, 20.457400138986628, 20.596005124033237,
+    20.735549199176802, 20.876038727032668, 21.017480113324893, 21.159879807178129,
+    21.303244301411826, 21.447580132836165, 21.592893882550268, 21.739192176242057,
+    21.886481684490533, 22.03476912306979, 22.184061253255404, 22.334364882132501,
+    22.485686862906306, 22.638034095214476, 22.791413525441897, 22.945832147037155,
+    23.101297000831615, 23.257815175360303, 23.415393807185293, 23.574040081220883,
+    23.733761231061379, 23.894564539310768, 24.056457337914978, 24.219447008495926,
+    24.383540982688302, 24.548746742478258, 24.71507182054475, 24.882523800602769,
+    25.051110317749302, 25.220839058811318, 25.391717762696459, 25.563754220745651,
+    25.736956277088545, 25.911331829001043, 26.086888827265565, 26.263635276533329,
+    26.441579235689524, 26.620728818220613, 26.801092192584488, 26.982677582582632,
+    27.165493267735325, 27.349547583658982, 27.534848922446436, 27.72140573304932,
+    27.909226521663516, 28.098319852116827, 28.288694346259696, 28.48035868435802,
+    28.673321605489178, 28.867591907940316, 29.06317844960974, 29.260090148410516,
+    29.458335982677319, 29.657924991575623, 29.858866275514099, 30.061168996559246,
+    30.264842378853388, 30.469895709035065, 30.676338336662727, 30.884179674640706,
+    31.093429199648668, 31.304096452573503, 31.516191038944626, 31.729722629371608,
+    31.94470095998539, 32.161135832881996, 32.379037116569734, 32.598414746418847,
+    32.819278725114756, 33.041639123113981, 33.265506079103524, 33.490889800462874,
+    33.717800563729639, 33.946248715067952, 34.176244670740445, 34.40779891758288,
+    34.640922013482538, 34.875624587859448, 35.111917342151308, 35.349811050301057,
+    35.589316559248417, 35.830444789424263, 36.073206735248817, 36.317613465632604,
+    36.563676124481404, 36.811405931204199, 37.060814181224991, 37.311912246497435,
+    37.564711576023711, 37.81922369637627, 38.075460212223717, 38.333432806859562,
+    38.593153242735227, 38.854633361996115, 39.117885087021925, 39.382920420969803,
+    39.649751448322, 39.918390335436605, 40.188849331102631, 40.461140767098073,
+    40.735277058752509, 41.011270705512977, 41.289134291514195, 41.568880486151919,
+    41.850522044660991, 42.134071808696618, 42.419542706920296, 42.706947755588807,
+    42.996300059148112, 43.287612810830552, 43.58089929325677, 43.876172879040915,
+    44.173447031400713, 44.472735304771057, 44.774051345422421, 45.077408892082587,
+    45.382821776563475, 45.690303924391479, 45.999869355442854, 46.31153218458244,
+    46.625306622307647, 46.941206975396099, 47.259247647558333, 47.579443140094092,
+    47.901808052553875, 48.226357083404366, 48.553105030698973, 48.882066792752077,
+    49.213257368818745, 49.546691859778306, 49.882385468823308, 50.2203535021522,
+    50.56061136966764, 50.90317458567884, 51.248058769609315, 51.595279646708576,
+    51.944853048769552, 52.296794914850125, 52.651121292000319, 53.00784833599343,
+    53.366992312063097, 53.728569595644615, 54.092596673121996, 54.459090142579143,
+    54.828066714557103, 55.199543212815648, 55.57353657510081, 55.950063853916632,
+    56.329142217303122, 56.710788949618703, 57.095021452328758, 57.481857244798519,
+    57.871313965092298, 58.263409370777389, 58.658161339734171, 59.055587870970712,
+    59.455707085443912, 59.858537226885367, 60.264096662633683, 60.672403884471386,
+    61.083477509468494, 61.497336280831071, 61.913999068756269, 62.333484871292171,
+    62.755812815204457, 63.18100215684818, 63.609072283046252, 64.04004271197276,
+    64.47393309404346, 64.91076321281129, 65.350552985869044, 65.793322465756759,
+    66.239091840876654, 66.687881436413164, 67.139711715260248, 67.594603278953755,
+    68.052576868611254, 68.513653365877389, 68.977853793876506, 69.445199318170538,
+    69.91571124772463, 70.389411035878283, 70.86632028132415, 71.346460729092101,
+    71.829854271541279, 72.316522949357875, 72.806488952560656, 73.299774621512029,
+    73.796402447937226, 74.296395075949391, 74.799775303082683, 75.306566081331113,
+    75.816790518195049, 76.330471877735349, 76.847633581634014, 77.368299210261554,
+    77.892492503752607, 78.420237363088333, 78.951557851186379, 79.486478193997499,
+    80.025022781610602, 80.567216169364684, 81.113083078968771, 81.662648399628452,
+    82.215937189181247, 82.772974675238956, 83.333786256338243, 83.898397503098082,
+    84.466834159386082, 85.039122143492278, 85.615287549311063, 86.195356647530417,
+    86.779355886830132, 87.36731189508771, 87.959251480592727, 88.555201633268553,
+    89.155189525903424, 89.759242515389289, 90.367388143969535, 90.979654140494034,
+    91.596068421683995, 92.216659093404743, 92.841454451947499, 93.470482985318895,
+    94.103773374540438, 94.741354494956056, 95.383255417549066, 96.029505410266964,
+    96.680133939356438, 97.335170670706717, 97.994645471202645, 98.65858841008567,
+    99.327029760325445, 100, 100.67752981368568, 101.35965009385579,
+    102.04639194228915, 102.73778667148859, 103.43386580610871, 104.13466108439285,
+    104.84020445962015, 105.55052810156299, 106.26566439795376, 106.98564595596117,
+    107.71050560367702, 108.44027639161341, 109.17499159420974, 109.91468471134945,
+    110.65938946988746, 111.40913982518839, 112.1639699626748, 112.92391429938549,
+    113.68900748554469, 114.45928440614249, 115.23478018252538, 116.01553017399726,
+    116.8015699794316, 117.59293543889507, 118.38966263528174, 119.19178789595779,
+    119.9993477944179, 120.81237915195332, 121.63091903933079, 122.45500477848228,
+    123.28467394420672, 124.11996436588377, 124.96091412919867, 125.80756157787829,
+    126.65994531543937, 127.51810420694933, 128.38207738079819, 129.25190423048224,
+    130.12762441640021, 131.00927786766212, 131.89690478390983, 132.79054563714959,
+    133.69024117359717, 134.59603241553643, 135.50796066318972, 136.42606749660044,
+    137.35039477752886, 138.28098465136145, 139.21787954903255, 140.16112218895839,
+    141.11075557898499, 142.06682301834962, 143.02936809965499, 143.99843471085654,
+    144.9740670372633, 145.95630956355328, 146.9452070758017, 147.94080466352258,
+    148.94314772172444, 149.95228195298085, 150.96825336951431, 151.99110829529346,
+    153.02089336814538, 154.05765554188258, 155.101442088444, 156.15230060004981,
+    157.21027899137124, 158.27542550171603, 159.34778869722803, 160.42741747310077,
+    161.51436105580703, 162.60866900534387, 163.71039121749254, 164.81957792609268,
+    165.93627970533288, 167.06054747205718, 168.19243248808689, 169.33198636255702,
+    170.4792610542695, 171.63430887406304, 172.79718248719817, 173.96793491575798,
+    175.14661954106555, 176.33329010611871, 177.52800071804052, 178.73080585054555,
+    179.94176034642365, 181.16091942004132, 182.38833865985919, 183.62407403096594,
+    184.86818187762998, 186.1207189258694, 187.3817422860383, 188.65130945543007,
+    189.92947832089902, 191.21630716150062, 192.51185465114855, 193.81617986128953,
+    195.12934226359641, 196.45140173268086, 197.78241854882319, 199.12245340072027,
+    200.47156738825254, 201.82982202527072, 203.19727924240067, 204.57400138986628,
+    205.96005124033238, 207.35549199176771, 208.76038727032656, 210.17480113324893,
+    211.59879807178126, 213.03244301411792, 214.47580132836154, 215.92893882550266,
+    217.39192176242057, 218.86481684490499, 220.34769123069776, 221.84061253255405,
+    223.34364882132502, 224.85686862906272, 226.38034095214465, 227.91413525441897,
+    229.45832147037154, 231.01297000831579, 232.5781517536029, 234.15393807185293,
+    235.74040081220883, 237.33761231061342, 238.94564539310755, 240.56457337914975,
+    242.19447008495928, 243.83540982688265, 245.48746742478244, 247.15071820544753,
+    248.82523800602772, 250.51110317749263, 252.20839058811305, 253.91717762696459,
+    255.63754220745651, 257.36956277088507, 259.11331829001028, 260.86888827265562,
+    262.63635276533324, 264.41579235689483, 266.20728818220601, 268.01092192584485,
+    269.8267758258263, 271.65493267735286, 273.49547583658966, 275.34848922446434,
+    277.21405733049318, 279.0922652166347, 280.98319852116811, 282.88694346259695,
+    284.80358684358021, 286.73321605489133, 288.675919079403, 290.6317844960974,
+    292.60090148410518, 294.58335982677272, 296.57924991575607, 298.588662755141,
+    300.61168996559246, 302.64842378853342, 304.69895709035052, 306.76338336662729,
+    308.84179674640706, 310.93429199648619, 313.04096452573486, 315.16191038944623,
+    317.29722629371611, 319.4470095998534, 321.61135832881979, 323.79037116569731,
+    325.98414746418842, 328.19278725114708, 330.41639123113958, 332.65506079103523,
+    334.90889800462872, 337.17800563729588, 339.46248715067935, 341.76244670740448,
+    344.07798917582875, 346.40922013482486, 348.75624587859431, 351.1191734215131,
+    353.49811050301059, 355.89316559248363, 358.30444789424246, 360.73206735248823,
+    363.17613465632598, 365.6367612448135, 368.11405931204183, 370.60814181224987,
+    373.1191224649744, 375.64711576023655, 378.19223696376253, 380.7546021222372,
+    383.33432806859565, 385.93153242735167, 388.54633361996099, 391.17885087021921,
+    393.82920420969799, 396.49751448321933, 399.18390335436584, 401.88849331102631,
+    404.61140767098073, 407.3527705875245, 410.11270705512959, 412.89134291514193,
+    415.6888048615192, 418.50522044660926, 421.34071808696598, 424.19542706920339,
+    427.06947755588897, 429.96300059148132, 432.87612810830615, 435.80899293256812,
+    438.76172879040917, 441.73447031400735, 444.72735304771123, 447.74051345422464,
+    450.77408892082684, 453.82821776563497, 456.90303924391549, 459.998693554429,
+    463.11532184582444, 466.25306622307676, 469.4120697539617, 472.59247647558379,
+    475.79443140094185, 479.01808052553901, 482.2635708340444, 485.53105030699021,
+    488.82066792752079, 492.13257368818773, 495.46691859778383, 498.82385468823355,
+    502.20353502152301, 505.60611369667669, 509.0317458567892, 512.48058769609361,
+    515.9527964670857, 519.44853048769573, 522.96794914850204, 526.51121292000369,
+    530.07848335993538, 533.66992312063121, 537.28569595644694, 540.92596673122046,
+    544.59090142579146, 548.28066714557133, 551.99543212815729, 555.73536575100866,
+    559.50063853916754, 563.29142217303149, 567.10788949618791, 570.9502145232882,
+    574.81857244798516, 578.71313965092327, 582.6340937077747, 586.58161339734227,
+    590.5558787097084, 594.55707085443942, 598.5853722688546, 602.64096662633744,
+    606.72403884471385, 610.83477509468526, 614.97336280831166, 619.13999068756334,
+    623.33484871292296, 627.5581281520449, 631.81002156848274, 636.09072283046316,
+    640.40042711972762, 644.73933094043491, 649.10763212811389, 653.50552985869103,
+    657.93322465756887, 662.39091840876688, 666.87881436413261, 671.39711715260319,
+    675.94603278953753, 680.52576868611288, 685.13653365877497, 689.77853793876579,
+    694.45199318170683, 699.15711247724664, 703.89411035878391, 708.66320281324226,
+    713.46460729092098, 718.29854271541319, 723.16522949357989, 728.06488952560733,
+    732.99774621512177, 737.9640244793726, 742.96395075949499, 747.99775303082754,
+    753.06566081330959, 758.16790518194966, 763.30471877735351, 768.47633581633977,
+    773.68299210261546, 778.92492503752533, 784.20237363088336, 789.5155785118634,
+    794.86478193997345, 800.25022781610517, 805.6721616936469, 811.13083078968725,
+    816.62648399628449, 822.15937189181159, 827.72974675238959, 833.33786256338203,
+    838.98397503097908, 844.66834159385996, 850.39122143492284, 856.15287549311017,
+    861.95356647530411, 867.79355886830047, 873.6731189508771, 879.59251480592684,
+    885.55201633268371, 891.55189525903324, 897.59242515389292, 903.67388143969492,
+    909.79654140494029, 915.96068421683901, 922.16659093404746, 928.41454451947448,
+    934.70482985318711, 941.03773374540333, 947.41354494956056, 953.83255417549015,
+    960.29505410266972, 966.80133939356335, 973.35170670706714, 979.94645471202591,
+    986.58588410085474, 993.27029760325354, 1000, 1006.7752981368568,
+  };
 } // namespace mopo
@@ -33,38 +33,21 @@ namespace mopo {
 
   } // namespace
 
-  class MagnitudeLookupSingleton {
+  // Decibels to magnitude through a table from tools/generate_lookups.cpp.
+  class MagnitudeLookup {
     public:
-      MagnitudeLookupSingleton() {
-        for (int i = 0; i < MAGNITUDE_LOOKUP_RESOLUTION + 2; ++i) {
-          mopo_float t = (1.0 * i) / MAGNITUDE_LOOKUP_RESOLUTION;
-          mopo_float decibels = utils::interpolate(MIN_DB_LOOKUP, MAX_DB_LOOKUP, t);
-          magnitude_lookup_[i] = utils::dbToGain(decibels);
-        }
-      }
-
-      mopo_float magnitudeLookup(mopo_float decibels) const {
+      static mopo_float magnitudeLookup(mopo_float decibels) {
         mopo_float t = (decibels - MIN_DB_LOOKUP) / DB_RANGE;
         mopo_float index = MAGNITUDE_LOOKUP_RESOLUTION * utils::clamp(t, 0.0, 1.0);
         int int_index = index;
         mopo_float fraction = index - int_index;
 
-        return utils::interpolate(magnitude_lookup_[int_index],
-                                  magnitude_lookup_[int_index + 1], fraction);
-      }
-
-    private:
-      mopo_float magnitude_lookup_[MAGNITUDE_LOOKUP_RESOLUTION + 2];
-  };
-
-  class MagnitudeLookup {
-    public:
-      static mopo_float magnitudeLookup(mopo_float decibels) {
-        return lookup_.magnitudeLookup(decibels);
+        return utils::interpolate(lookup_[int_index],
+                                  lookup_[int_index + 1], fraction);
       }
 
     private:
-      static const MagnitudeLookupSingleton lookup_;
+      static const mopo_float lookup_[MAGNITUDE_LOOKUP_RESOLUTION + 2];
   };
 } // namespace mopo
 
@@ -14,9 +14,3213 @@
  * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// Generated by tools/generate_lookups.cpp. Don't edit by hand.
+
 #include "midi_lookup.h"
 
 namespace mopo {
 
-  const MidiLookupSingleton MidiLookup::lookup_;
+  const mopo_float MidiLookup::lookup_[MAX_CENTS + 2] = {
+    8.1757989155999997, 8.1805228064211359, 8.185249426656819, 8.1899787778840754,
+    8.1947108616808428, 8.199445679625974, 8.2041832332992293, 8.2089235242812819,
+    8.2136665541537237, 8.2184123244990541, 8.223160836900691, 8.2279120929429652,
+    8.2326660942111243, 8.2374228422913287, 8.2421823387706592, 8.246944585237113,
+    8.2517095832796024, 8.2564773344879594, 8.2612478404529348, 8.2660211027661976,
+    8.270797123020337, 8.2755759028088622, 8.2803574437262029, 8.285141747367712,
+    8.2899288153296595, 8.294718649209246, 8.2995112506045832, 8.3043066211147156,
+    8.3091047623396097, 8.3139056758801555, 8.318709363338165, 8.3235158263163811,
+    8.3283250664184703, 8.3331370852490245, 8.3379518844135649, 8.342769465518538,
+    8.3475898301713212, 8.3524129799802171, 8.3572389165544632, 8.3620676415042201,
+    8.3668991564405832, 8.3717334629755769, 8.3765705627221596, 8.3814104572942174,
+    8.3862531483065705, 8.3910986373749736, 8.3959469261161157, 8.4007980161476166,
+    8.4056519090880357, 8.4105086065568582, 8.4153681101745175, 8.4202304215623727,
+    8.4250955423427243, 8.4299634741388125, 8.4348342185748102, 8.4397077772758333,
+    8.4445841518679323, 8.4494633439781008, 8.4543453552342704, 8.4592301872653177,
+    8.4641178417010519, 8.4690083201722288, 8.4739016243105496, 8.4787977557486549,
+    8.4836967161201269, 8.4885985070594945, 8.4935031302022335, 8.498410587184754,
+    8.5033208796444235, 8.5082340092195512, 8.5131499775493928, 8.5180687862741458,
+    8.5229904370349683, 8.5279149314739549, 8.5328422712341538, 8.5377724579595586,
+    8.5427054932951219, 8.5476413788867376, 8.5525801163812503, 8.5575217074264653,
+    8.5624661536711333, 8.5674134567649567, 8.5723636183585903, 8.5773166401036498,
+    8.5822725236527013, 8.5872312706592613, 8.5921928827778071, 8.5971573616637738,
+    8.6021247089735429, 8.6070949263644643, 8.6120680154948381, 8.6170439780239292,
+    8.6220228156119525, 8.6270045299200913, 8.631989122610479, 8.6369765953462192,
+    8.6419669497913691, 8.6469601876109525, 8.6519563104709523, 8.656955320038314,
+    8.6619572179809463, 8.6669620059677239, 8.6719696856684809, 8.6769802587540212,
+    8.6819937268961134, 8.6870100917674886, 8.6920293550418481, 8.6970515183938577,
+    8.7020765834991529, 8.7071045520343375, 8.7121354256769763, 8.7171692061056181,
+    8.7222058949997709, 8.7272454940399111, 8.7322880049074953, 8.7373334292849467,
+    8.7423817688556582, 8.747433025303998, 8.7524872003153114, 8.7575442955759097,
+    8.7626043127730817, 8.7676672535950946, 8.7727331197311873, 8.7778019128715741,
+    8.7828736347074496, 8.7879482869309804, 8.7930258712353151, 8.7981063893145794,
+    8.8031898428638797, 8.8082762335792975, 8.8133655631578947, 8.818457833297721,
+    8.8235530456977962, 8.8286512020581291, 8.8337523040797112, 8.8388563534645144,
+    8.8439633519154928, 8.8490733011365847, 8.8541862028327163, 8.8593020587097957,
+    8.8644208704747189, 8.8695426398353643, 8.8746673685006012, 8.8797950581802869,
+    8.884925710585259, 8.8900593274273572, 8.8951959104193943, 8.9003354612751835,
+    8.9054779817095255, 8.9106234734382141, 8.9157719381780289, 8.9209233776467425,
+    8.9260777935631275, 8.9312351876469407, 8.9363955616189372, 8.9415589172008634,
+    8.9467252561154638, 8.9518945800864778, 8.9570668908386377, 8.9622421900976725,
+    8.9674204795903147, 8.9726017610442881, 8.9777860361883146, 8.98297330675212,
+    8.988163574466423, 8.9933568410629476, 8.9985531082744181, 9.0037523778345552,
+    9.0089546514780849, 9.014159930940739, 9.0193682179592436, 9.0245795142713341,
+    9.0297938216157512, 9.0350111417322339, 9.0402314763615337, 9.0454548272454023,
+    9.0506811961266003, 9.0559105847488937, 9.061142994857061, 9.0663784281968844,
+    9.0716168865151516, 9.0768583715596662, 9.0821028850792391, 9.0873504288236884,
+    9.0926010045438499, 9.097854613991565, 9.1031112589196894, 9.1083709410820948,
+    9.1136336622336636, 9.1188994241302872, 9.1241682285288785, 9.1294400771873629,
+    9.1347149718646836, 9.1399929143207963, 9.1452739063166764, 9.150557949614317,
+    9.1558450459767258, 9.1611351971679333, 9.1664284049529883, 9.1717246710979552,
+    9.1770239973699272, 9.1823263855370101, 9.1876318373683326, 9.1929403546340538,
+    9.1982519391053472, 9.2035665925544095, 9.2088843167544656, 9.2142051134797658,
+    9.2195289845055779, 9.2248559316082037, 9.2301859565649664, 9.2355190611542195,
+    9.2408552471553413, 9.2461945163487407, 9.2515368705158529, 9.2568823114391421,
+    9.2622308409021041, 9.2675824606892672, 9.272937172586186, 9.2782949783794493,
+    9.283655879856676, 9.2890198788065241, 9.2943869770186769, 9.2997571762838582,
+    9.3051304783938242, 9.310506885141363, 9.3158863983203055, 9.321269019725511,
+    9.3266547511528834, 9.3320435943993605, 9.3374355512629172, 9.3428306235425698,
+    9.3482288130383697, 9.3536301215514168, 9.3590345508838464, 9.3644421028388312,
+    9.3698527792205919, 9.3752665818343903, 9.3806835124865291, 9.3861035729843554,
+    9.3915267651362626, 9.3969530907516869, 9.4023825516411108, 9.4078151496160647,
+    9.41325088648912, 9.4186897640739016, 9.4241317841850787, 9.4295769486383723,
+    9.4350252592505477, 9.440476717839422, 9.4459313262238638, 9.451389086223795,
+    9.4568499996601822, 9.4623140683550488, 9.4677812941314716, 9.4732516788135772,
+    9.4787252242265492, 9.4842019321966227, 9.4896818045510933, 9.4951648431183084,
+    9.5006510497276704, 9.5061404262096421, 9.5116329743957433, 9.5171286961185508,
+    9.5226275932117002, 9.5281296675098872, 9.5336349208488684, 9.539143355065459,
+    9.5446549719975398, 9.5501697734840469, 9.5556877613649824, 9.561208937481414,
+    9.5667333036754698, 9.5722608617903404, 9.5777916136702892, 9.5833255611606383,
+    9.5888627061077756, 9.5944030503591602, 9.5999465957633152, 9.6054933441698349,
+    9.6110432974293776, 9.6165964573936762, 9.6221528259155313, 9.627712404848813,
+    9.6332751960484639, 9.6388412013704947, 9.6444104226719958, 9.6499828618111252,
+    9.6555585206471122, 9.6611374010402695, 9.6667195048519741, 9.672304833944688,
+    9.6778933901819393, 9.6834851754283449, 9.6890801915495857, 9.6946784404124315,
+    9.700279923884727, 9.7058846438353914, 9.711492602134431, 9.7171038006529304,
+    9.7227182412630508, 9.7283359258380422, 9.7339568562522327, 9.7395810343810325,
+    9.7452084621009387, 9.7508391412895303, 9.7564730738254717, 9.7621102615885142,
+    9.7677507064594913, 9.773394410320325, 9.7790413750540317, 9.7846916025447044,
+    9.7903450946775283, 9.7960018533387849, 9.8016618804158355, 9.8073251777971393,
+    9.8129917473722408, 9.8186615910317823, 9.8243347106674932, 9.830011108172199,
+    9.8356907854398195, 9.8413737443653648, 9.8470599868449433, 9.8527495147757609,
+    9.8584423300561106, 9.8641384345853922, 9.8698378302641014, 9.8755405189938266,
+    9.8812465026772589, 9.8869557832181876, 9.8926683625215013, 9.8983842424931954,
+    9.9041034250403559, 9.9098259120711774, 9.9155517054949573, 9.9212808072220948,
+    9.9270132191640919, 9.9327489432335554, 9.9384879813442009, 9.9442303354108414,
+    9.9499760073494077, 9.9557249990769261, 9.9614773125115388, 9.9672329495724927,
+    9.9729919121801434, 9.9787542022559563, 9.9845198217225111, 9.9902887725034919,
+    9.9960610565236951, 10.001836675709036, 10.007615631986539, 10.013397927284332,
+    10.019183563531676, 10.024972542658933, 10.030764866597581, 10.03656053728022,
+    10.042359556640562, 10.048161926613442, 10.053967649134803, 10.059776726141715,
+    10.065589159572365, 10.071404951366057, 10.077224103463221, 10.083046617805403,
+    10.088872496335275, 10.094701740996628, 10.100534353734377, 10.106370336494562,
+    10.112209691224345, 10.118052419872019, 10.123898524386993, 10.129748006719808,
+    10.135600868822136, 10.141457112646771, 10.147316740147634, 10.15317975327978,
+    10.159046153999389, 10.164915944263777, 10.170789126031384, 10.176665701261788,
+    10.182545671915694, 10.188429039954942, 10.194315807342505, 10.200205976042495,
+    10.20609954802015, 10.211996525241851, 10.217896909675112, 10.22380070328858,
+    10.229707908052049, 10.235618525936443, 10.241532558913827, 10.247450008957406,
+    10.253370878041528, 10.259295168141676, 10.265222881234477, 10.271154019297702,
+    10.277088584310262, 10.28302657825221, 10.288968003104749, 10.294912860850221,
+    10.300861153472118, 10.306812882955072, 10.312768051284866, 10.318726660448434,
+    10.324688712433851, 10.330654209230339, 10.336623152828277, 10.342595545219195,
+    10.348571388395763, 10.354550684351812, 10.360533435082322, 10.366519642583423,
+    10.372509308852402, 10.3785024358877, 10.38449902568891, 10.390499080256783,
+    10.396502601593223, 10.402509591701293, 10.408520052585214, 10.414533986250365,
+    10.42055139470328, 10.426572279951653, 10.432596644004345, 10.438624488871371,
+    10.444655816563907, 10.450690629094296, 10.456728928476037, 10.462770716723799,
+    10.468815995853411, 10.474864767881868, 10.480917034827332, 10.486972798709127,
+    10.493032061547749, 10.499094825364855, 10.505161092183275, 10.511230864027006,
+    10.517304142921217, 10.523380930892243, 10.529461229967591, 10.535545042175944,
+    10.541632369547148, 10.547723214112231, 10.553817577903391, 10.559915462953997,
+    10.566016871298599, 10.572121804972918, 10.578230266013851, 10.584342256459474,
+    10.590457778349043, 10.596576833722985, 10.60269942462291, 10.608825553091615,
+    10.61495522117306, 10.621088430912405, 10.627225184355977, 10.633365483551293,
+    10.639509330547051, 10.645656727393135, 10.651807676140608, 10.657962178841721,
+    10.664120237549914, 10.670281854319811, 10.676447031207219, 10.682615770269139,
+    10.688788073563758, 10.694963943150453, 10.701143381089787, 10.707326389443521,
+    10.7135129702746, 10.719703125647163, 10.725896857626545, 10.732094168279271,
+    10.738295059673062, 10.74449953387683, 10.750707592960689, 10.756919238995941,
+    10.763134474055091, 10.769353300211838, 10.775575719541084, 10.78180173411892,
+    10.788031346022649, 10.794264557330767, 10.800501370122969, 10.806741786480158,
+    10.812985808484434, 10.819233438219104, 10.825484677768674, 10.83173952921886,
+    10.837997994656577, 10.844260076169951, 10.850525775848316, 10.856795095782203,
+    10.863068038063362, 10.869344604784747, 10.875624798040519, 10.881908619926055,
+    10.888196072537937, 10.894487157973963, 10.900781878333135, 10.90708023571568,
+    10.913382232223029, 10.919687869957828, 10.925997151023946, 10.932310077526456,
+    10.938626651571655, 10.944946875267055, 10.951270750721385, 10.957598280044591,
+    10.963929465347846, 10.970264308743531, 10.976602812345256, 10.982944978267849,
+    10.989290808627363, 10.995640305541066, 11.001993471127459, 11.008350307506261,
+    11.014710816798418, 11.021075001126102, 11.027442862612707, 11.033814403382857,
+    11.040189625562405, 11.046568531278432, 11.052951122659243, 11.05933740183438,
+    11.06572737093461, 11.072121032091932, 11.07851838743958, 11.084919439112017,
+    11.091324189244942, 11.097732639975286, 11.104144793441215, 11.110560651782132,
+    11.116980217138673, 11.123403491652713, 11.129830477467365, 11.136261176726981,
+    11.142695591577148, 11.149133724164697, 11.155575576637696, 11.162021151145458,
+    11.168470449838532, 11.174923474868717, 11.181380228389049, 11.187840712553813,
+    11.194304929518532, 11.200772881439985, 11.207244570476186, 11.2137199987864,
+    11.220199168531144, 11.226682081872177, 11.233168740972509, 11.239659147996402,
+    11.24615330510937, 11.252651214478169, 11.259152878270815, 11.265658298656577,
+    11.272167477805974, 11.278680417890779, 11.285197121084021, 11.291717589559989,
+    11.298241825494216, 11.304769831063506, 11.311301608445913, 11.317837159820749,
+    11.324376487368589, 11.33091959327127, 11.337466479711876, 11.344017148874773,
+    11.350571602945571, 11.357129844111153, 11.363691874559661, 11.370257696480504,
+    11.376827312064355, 11.383400723503152, 11.389977932990103, 11.396558942719675,
+    11.403143754887612, 11.409732371690923, 11.416324795327885, 11.422921027998047,
+    11.429521071902231, 11.436124929242524, 11.442732602222289, 11.449344093046166,
+    11.455959403920065, 11.462578537051169, 11.469201494647939, 11.475828278920108,
+    11.482458892078695, 11.489093336335985, 11.49573161390555, 11.502373727002233,
+    11.509019677842169, 11.515669468642759, 11.522323101622696, 11.528980579001948,
+    11.535641903001769, 11.542307075844699, 11.548976099754556, 11.555648976956446,
+    11.562325709676763, 11.569006300143185, 11.575690750584673, 11.582379063231485,
+    11.58907124031516, 11.595767284068533, 11.602467196725719, 11.609170980522133,
+    11.615878637694481, 11.622590170480755, 11.629305581120247, 11.636024871853538,
+    11.642748044922506, 11.649475102570324, 11.656206047041461, 11.662940880581683,
+    11.669679605438054, 11.676422223858934, 11.683168738093983, 11.689919150394163,
+    11.696673463011736, 11.703431678200262, 11.710193798214608, 11.716959825310941,
+    11.72372976174673, 11.730503609780753, 11.737281371673086, 11.744063049685122,
+    11.750848646079548, 11.757638163120369, 11.764431603072888, 11.771228968203728,
+    11.778030260780808, 11.784835483073373, 11.791644637351968, 11.798457725888454,
+    11.805274750956004, 11.812095714829104, 11.818920619783553, 11.825749468096468,
+    11.832582262046282, 11.839419003912738, 11.846259695976906, 11.853104340521167,
+    11.859952939829217, 11.866805496186087, 11.87366201187811, 11.880522489192952,
+    11.887386930419597, 11.894255337848351, 11.901127713770842, 11.90800406048003,
+    11.914884380270186, 11.921768675436921, 11.928656948277165, 11.93554920108917,
+    11.942445436172529, 11.949345655828154, 11.956249862358289, 11.963158058066506,
+    11.970070245257716, 11.976986426238151, 11.983906603315379, 11.990830778798308,
+    11.997758954997174, 12.004691134223545, 12.011627318790334, 12.018567511011778,
+    12.025511713203461, 12.032459927682302, 12.039412156766559, 12.046368402775828,
+    12.053328668031046, 12.060292954854491, 12.067261265569783, 12.074233602501886,
+    12.081209967977102, 12.088190364323086, 12.095174793868829, 12.102163258944675,
+    12.109155761882304, 12.11615230501476, 12.123152890676417, 12.130157521203012,
+    12.13716619893162, 12.144178926200674, 12.151195705349959, 12.158216538720604,
+    12.165241428655099, 12.172270377497282, 12.179303387592348, 12.186340461286846,
+    12.193381600928683, 12.200426808867118, 12.207476087452774, 12.214529439037623,
+    12.221586865975002, 12.228648370619611, 12.235713955327506, 12.242783622456102,
+    12.249857374364177, 12.256935213411879, 12.264017141960711, 12.271103162373544,
+    12.278193277014617, 12.285287488249528, 12.292385798445249, 12.299488209970114,
+    12.306594725193829, 12.31370534648747, 12.320820076223479, 12.327938916775674,
+    12.335061870519235, 12.342188939830724, 12.349320127088077, 12.356455434670595,
+    12.36359486495896, 12.370738420335231, 12.377886103182835, 12.385037915886583,
+    12.392193860832666, 12.39935394040865, 12.406518157003479, 12.413686513007477,
+    12.420859010812356, 12.428035652811198, 12.435216441398483, 12.442401378970061,
+    12.449590467923175, 12.456783710656445, 12.463981109569886, 12.471182667064893,
+    12.478388385544253, 12.485598267412136, 12.492812315074106, 12.500030530937117,
+    12.507252917409506, 12.514479476901013, 12.521710211822763, 12.528945124587276,
+    12.536184217608463, 12.543427493301635, 12.550674954083496, 12.557926602372149,
+    12.565182440587085, 12.572442471149204, 12.579706696480798, 12.586975119005563,
+    12.594247741148591, 12.60152456533638, 12.608805593996822, 12.616090829559225,
+    12.623380274454288, 12.630673931114117, 12.637971801972231, 12.645273889463548,
+    12.652580196024392, 12.659890724092499, 12.667205476107011, 12.674524454508479,
+    12.681847661738868, 12.689175100241547, 12.696506772461303, 12.703842680844335,
+    12.711182827838252, 12.718527215892076, 12.725875847456251, 12.733228724982631,
+    12.740585850924489, 12.747947227736516, 12.755312857874815, 12.762682743796919,
+    12.770056887961774, 12.777435292829747, 12.784817960862627, 12.79220489452363,
+    12.799596096277384, 12.806991568589954, 12.814391313928821, 12.821795334762898,
+    12.829203633562518, 12.836616212799445, 12.844033074946871, 12.85145422247942,
+    12.858879657873139, 12.866309383605509, 12.873743402155446, 12.88118171600329,
+    12.888624327630824, 12.896071239521257, 12.903522454159237, 12.910977974030844,
+    12.918437801623602, 12.92590193942646, 12.933370389929818, 12.940843155625506,
+    12.948320239006799, 12.95580164256841, 12.963287368806492, 12.970777420218644,
+    12.978271799303903, 12.985770508562759, 12.993273550497134, 13.00078092761041,
+    13.008292642407403, 13.01580869739438, 13.02332909507906, 13.030853837970605,
+    13.038382928579635, 13.045916369418213, 13.053454162999858, 13.060996311839531,
+    13.068542818453663, 13.07609368536013, 13.083648915078259, 13.091208510128839,
+    13.098772473034114, 13.106340806317782, 13.113913512505004, 13.121490594122399,
+    13.129072053698041, 13.136657893761468, 13.144248116843686, 13.151842725477151,
+    13.159441722195792, 13.167045109534996, 13.174652890031622, 13.182265066223984,
+    13.189881640651871, 13.197502615856543, 13.205127994380714, 13.21275777876858,
+    13.220391971565805, 13.228030575319517, 13.235673592578324, 13.243321025892302,
+    13.250972877812998, 13.258629150893443, 13.26628984768813, 13.27395497075304,
+    13.281624522645622, 13.289298505924808, 13.296976923151007, 13.304659776886108,
+    13.312347069693473, 13.32003880413796, 13.327734982785893, 13.335435608205092,
+    13.343140682964851, 13.350850209635952, 13.358564190790668, 13.366282629002745,
+    13.374005526847428, 13.381732886901448, 13.38946471174302, 13.397201003951851,
+    13.404941766109141, 13.412687000797577, 13.420436710601342, 13.428190898106113,
+    13.435949565899055, 13.443712716568831, 13.451480352705602, 13.459252476901025,
+    13.46702909174825, 13.474810199841931, 13.482595803778219, 13.490385906154762,
+    13.498180509570714, 13.505979616626727, 13.513783229924957, 13.521591352069064,
+    13.529403985664215, 13.537221133317072, 13.545042797635816, 13.552868981230125,
+    13.560699686711192, 13.568534916691718, 13.576374673785905, 13.584218960609475,
+    13.592067779779658, 13.599921133915199, 13.607779025636347, 13.615641457564877,
+    13.623508432324073, 13.631379952538731, 13.63925602083517, 13.647136639841223,
+    13.655021812186245, 13.662911540501103, 13.670805827418192, 13.678704675571423,
+    13.68660808759623, 13.694516066129573, 13.70242861380993, 13.710345733277306,
+    13.718267427173235, 13.726193698140769, 13.734124548824491, 13.74205998187052,
+    13.749999999926493, 13.75794460564158, 13.765893801666483, 13.773847590653434,
+    13.781805975256198, 13.789768958130077, 13.797736541931901, 13.805708729320038,
+    13.813685522954392, 13.821666925496404, 13.829652939609051, 13.837643567956853,
+    13.845638813205865, 13.853638678023684, 13.86164316507945, 13.869652277043841,
+    13.87766601658908, 13.885684386388938, 13.893707389118727, 13.901735027455304,
+    13.909767304077073, 13.917804221663989, 13.92584578289755, 13.933891990460809,
+    13.941942847038368, 13.949998355316373, 13.958058517982533, 13.966123337726103,
+    13.97419281723789, 13.982266959210266, 13.990345766337146, 13.99842924131401,
+    14.00651738683789, 14.014610205607385, 14.022707700322641, 14.030809873685374,
+    14.038916728398855, 14.047028267167923, 14.05514449269897, 14.063265407699964,
+    14.07139101488043, 14.079521316951459, 14.08765631662571, 14.095796016617406,
+    14.103940419642344, 14.11208952841789, 14.120243345662971, 14.128401874098097,
+    14.136565116445341, 14.144733075428352, 14.152905753772353, 14.161083154204142,
+    14.169265279452093, 14.177452132246154, 14.185643715317848, 14.193840031400285,
+    14.202041083228146, 14.210246873537697, 14.218457405066783, 14.226672680554826,
+    14.23489270274284, 14.243117474373419, 14.251346998190741, 14.259581276940569,
+    14.267820313370251, 14.276064110228727, 14.284312670266521, 14.29256599623575,
+    14.300824090890117, 14.30908695698492, 14.317354597277047, 14.325627014524979,
+    14.333904211488791, 14.342186190930152, 14.350472955612327, 14.358764508300178,
+    14.367060851760167, 14.375361988760348, 14.383667922070382, 14.391978654461525,
+    14.400294188706633, 14.408614527580172, 14.416939673858202, 14.425269630318391,
+    14.433604399740013, 14.441943984903945, 14.450288388592677, 14.458637613590298,
+    14.46699166268251, 14.475350538656624, 14.483714244301563, 14.492082782407859,
+    14.50045615576766, 14.508834367174723, 14.517217419424417, 14.525605315313737,
+    14.533998057641281, 14.542395649207275, 14.550798092813556, 14.559205391263582,
+    14.567617547362431, 14.576034563916801, 14.584456443735014, 14.59288318962701,
+    14.601314804404357, 14.609751290880247, 14.618192651869494, 14.626638890188541,
+    14.63509000865546, 14.643546010089945, 14.65200689731333, 14.660472673148567,
+    14.668943340420247, 14.677418901954589, 14.685899360579448, 14.694384719124312,
+    14.702874980420301, 14.711370147300176, 14.719870222598331, 14.728375209150798,
+    14.736885109795248, 14.745399927370991, 14.753919664718982, 14.762444324681811,
+    14.770973910103711, 14.779508423830563, 14.788047868709894, 14.796592247590864,
+    14.805141563324293, 14.813695818762643, 14.822255016760018, 14.830819160172183,
+    14.839388251856542, 14.847962294672159, 14.856541291479743, 14.865125245141659,
+    14.873714158521924, 14.882308034486215, 14.890906875901859, 14.899510685637841,
+    14.908119466564804, 14.916733221555052, 14.925351953482544, 14.933975665222905,
+    14.942604359653416, 14.951238039653026, 14.959876708102341, 14.968520367883636,
+    14.977169021880851, 14.985822672979594, 14.994481324067133, 15.003144978032411,
+    15.011813637766041, 15.020487306160296, 15.029165986109138, 15.037849680508183,
+    15.04653839225473, 15.05523212424775, 15.06393087938789, 15.072634660577465,
+    15.081343470720482, 15.090057312722616, 15.098776189491218, 15.107500103935326,
+    15.116229058965656, 15.124963057494606, 15.133702102436256, 15.14244619670637,
+    15.151195343222399, 15.159949544903476, 15.168708804670423, 15.177473125445747,
+    15.186242510153647, 15.195016961720013, 15.203796483072416, 15.212581077140133,
+    15.221370746854118, 15.230165495147032, 15.23896532495322, 15.247770239208734,
+    15.256580240851308, 15.265395332820384, 15.274215518057099, 15.28304079950429,
+    15.291871180106492, 15.300706662809947, 15.309547250562593, 15.318392946314075,
+    15.327243753015736, 15.336099673620639, 15.344960711083536, 15.353826868360898,
+    15.362698148410896, 15.371574554193419, 15.380456088670055, 15.389342754804117,
+    15.39823455556062, 15.407131493906293, 15.416033572809583, 15.42494079524065,
+    15.433853164171369, 15.442770682575336, 15.451693353427862, 15.460621179705976,
+    15.469554164388429, 15.478492310455694, 15.487435620889965, 15.49638409867516,
+    15.505337746796918, 15.514296568242608, 15.523260566001319, 15.532229743063869,
+    15.541204102422812, 15.550183647072418, 15.559168380008698, 15.568158304229387,
+    15.577153422733957, 15.586153738523606, 15.595159254601276, 15.604169973971636,
+    15.613185899641097, 15.6222070346178, 15.631233381911628, 15.640264944534207,
+    15.649301725498898, 15.658343727820801, 15.667390954516765, 15.676443408605378,
+    15.68550109310697, 15.694564011043621, 15.703632165439156, 15.712705559319145,
+    15.721784195710905, 15.730868077643507, 15.739957208147768, 15.74905159025626,
+    15.758151227003301, 15.767256121424969, 15.776366276559092, 15.785481695445252,
+    15.794602381124793, 15.803728336640814, 15.812859565038169, 15.821996069363474,
+    15.831137852665105, 15.840284917993198, 15.849437268399653, 15.858594906938134,
+    15.867757836664067, 15.876926060634645, 15.886099581908827, 15.895278403547341,
+    15.904462528612678, 15.913651960169103, 15.922846701282657, 15.93204675502114,
+    15.941252124454133, 15.950462812652987, 15.959678822690831, 15.968900157642567,
+    15.978126820584876, 15.987358814596213, 15.996596142756815, 16.005838808148695,
+    16.01508681385565, 16.024340162963263, 16.033598858558889, 16.042862903731674,
+    16.052132301572549, 16.061407055174225, 16.070687167631213, 16.079972642039795,
+    16.089263481498055, 16.098559689105862, 16.107861267964875, 16.117168221178545,
+    16.126480551852122, 16.135798263092642, 16.145121358008943, 16.154449839711656,
+    16.163783711313208, 16.173122975927829, 16.182467636671539, 16.191817696662174,
+    16.201173159019355, 16.210534026864515, 16.219900303320884, 16.22927199151351,
+    16.238649094569233, 16.2480316156167, 16.257419557786378, 16.266812924210527,
+    16.276211718023223, 16.285615942360362, 16.29502560035964, 16.304440695160572,
+    16.313861229904482, 16.323287207734513, 16.332718631795622, 16.342155505234587,
+    16.351597831199999, 16.361045612842272, 16.370498853313638, 16.379957555768151,
+    16.389421723361689, 16.398891359251948, 16.408366466598455, 16.417847048562564,
+    16.427333108307447, 16.436824648998108, 16.446321673801382, 16.45582418588593,
+    16.465332188422249, 16.474845684582657, 16.484364677541318, 16.493889170474226,
+    16.503419166559205, 16.512954668975919, 16.52249568090587, 16.532042205532395,
+    16.541594246040674, 16.551151805617724, 16.560714887452406, 16.570283494735424,
+    16.579857630659319, 16.589437298418488, 16.599022501209166, 16.608613242229431,
+    16.618209524679219, 16.627811351760311, 16.63741872667633, 16.647031652632762,
+    16.656650132836941, 16.666274170498049, 16.67590376882713, 16.685538931037076,
+    16.695179660342642, 16.704825959960434, 16.714477833108926, 16.72413528300844,
+    16.733798312881166, 16.743466925951157, 16.753141125444319, 16.762820914588435,
+    16.772506296613141, 16.782197274749951, 16.791893852232231, 16.801596032295233,
+    16.811303818176071, 16.821017213113716, 16.830736220349035, 16.840460843124745,
+    16.850191084685449, 16.859926948277625, 16.869668437149617, 16.879415554551667,
+    16.889168303735865, 16.898926687956205, 16.908690710468541, 16.918460374530632,
+    16.928235683402104, 16.938016640344458, 16.947803248621103, 16.95759551149731,
+    16.967393432240254, 16.977197014118989, 16.987006260404463, 16.996821174369508,
+    17.006641759288847, 17.016468018439106, 17.026299955098786, 17.036137572548292,
+    17.045980874069937, 17.05582986294791, 17.065684542468308, 17.075544915919117,
+    17.085410986590244, 17.095282757773475, 17.105160232762501, 17.115043414852934,
+    17.124932307342267, 17.13482691352991, 17.144727236717181, 17.1546332802073,
+    17.164545047305403, 17.174462541318523, 17.184385765555618, 17.194314723327548,
+    17.204249417947086, 17.214189852728929, 17.224136030989676, 17.234087956047858,
+    17.244045631223905, 17.254009059840183, 17.263978245220958, 17.273953190692438,
+    17.283933899582742, 17.293920375221905, 17.303912620941905, 17.313910640076628,
+    17.323914435961893, 17.333924011935448, 17.343939371336962, 17.353960517508042,
+    17.363987453792227, 17.374020183534977, 17.384058710083696, 17.394103036787715,
+    17.404153166998309, 17.414209104068672, 17.424270851353953, 17.43433841221124,
+    17.444411789999538, 17.454490988079822, 17.464576009814991, 17.474666858569893,
+    17.484763537711316, 17.494866050607996, 17.504974400630623, 17.515088591151819,
+    17.525208625546163, 17.535334507190189, 17.545466239462371, 17.555603825743148,
+    17.565747269414896, 17.575896573861961, 17.58605174247063, 17.596212778629159,
+    17.606379685727759, 17.616552467158595, 17.626731126315789, 17.636915666595442,
+    17.647106091395592, 17.657302404116258, 17.667504608159422, 17.677712706929029,
+    17.687926703830986, 17.698146602273169, 17.708372405665433, 17.718604117419591,
+    17.728841740949438, 17.739085279670729, 17.749334737001206, 17.759590116360574,
+    17.769851421170522, 17.780118654854714, 17.790391820838789, 17.800670922550367,
+    17.810955963419051, 17.821246946876432, 17.831543876356058, 17.841846755293485,
+    17.852155587126255, 17.862470375293881, 17.872791123237874, 17.883117834401727,
+    17.893450512230928, 17.903789160172956, 17.914133781677272, 17.924484380195345,
+    17.934840959180629, 17.945203522088576, 17.955572072376629, 17.965946613504233,
+    17.976327148932846, 17.986713682125895, 17.997106216548836, 18.00750475566911,
+    18.01790930295617, 18.028319861881478, 18.038736435918487, 18.049159028542672,
+    18.059587643231502, 18.070022283464468, 18.080462952723067, 18.090909654490801,
+    18.101362392253201, 18.111821169497787, 18.122285989714126, 18.132756856393769,
+    18.1432337730303, 18.153716743119332, 18.164205770158475, 18.174700857647377,
+    18.1852020090877, 18.19570922798313, 18.206222517839382, 18.21674188216419,
+    18.227267324467327, 18.237798848260571, 18.248336457057757, 18.258880154374726,
+    18.269429943729364, 18.279985828641593, 18.290547812633353, 18.301115899228634,
+    18.311690091953452, 18.322270394335867, 18.332856809905977, 18.34344934219591,
+    18.354047994739854, 18.36465277107402, 18.375263674736665, 18.385880709268108,
+    18.396503878210694, 18.407133185108819, 18.417768633508931, 18.428410226959532,
+    18.439057969011156, 18.449711863216407, 18.460371913129936, 18.471038122308439,
+    18.481710494310686, 18.492389032697481, 18.503073741031702, 18.513764622878284,
+    18.524461681804208, 18.535164921378538, 18.545874345172372, 18.556589956758899,
+    18.567311759713352, 18.578039757613045, 18.588773954037354, 18.599514352567716,
+    18.610260956787648, 18.621013770282726, 18.631772796640611, 18.642538039451026,
+    18.653309502305767, 18.664087188798721, 18.674871102525834, 18.68566124708514,
+    18.696457626076739, 18.707260243102834, 18.718069101767693, 18.728884205677662,
+    18.739705558441184, 18.750533163668781, 18.761367024973055, 18.772207145968711,
+    18.783053530272522, 18.793906181503377, 18.804765103282222, 18.815630299232129,
+    18.82650177297824, 18.837379528147803, 18.848263568370161, 18.859153897276745,
+    18.870050518501095, 18.880953435678844, 18.891862652447728, 18.90277817244759,
+    18.913699999320364, 18.924628136710098, 18.935562588262943, 18.946503357627154,
+    18.957450448453098, 18.968403864393245, 18.979363609102187, 18.990329686236617,
+    19.001302099455337, 19.012280852419284, 19.023265948791483, 19.034257392237102,
+    19.0452551864234, 19.056259335019774, 19.067269841697737, 19.078286710130918,
+    19.08930994399508, 19.100339546968094, 19.111375522729965, 19.122417874962828,
+    19.133466607350936, 19.144521723580684, 19.155583227340578, 19.166651122321277,
+    19.177725412215551, 19.18880610071832, 19.19989319152663, 19.21098668833967,
+    19.222086594858755, 19.233192914787352, 19.244305651831063, 19.255424809697626,
+    19.266550392096924, 19.277682402740989, 19.288820845343992, 19.29996572362225,
+    19.311117041294224, 19.322274802080535, 19.333439009703948, 19.344609667889372,
+    19.355786780363882, 19.36697035085669, 19.378160383099171, 19.389356880824863,
+    19.400559847769451, 19.411769287670783, 19.422985204268862, 19.434207601305861,
+    19.445436482526102, 19.456671851676084, 19.467913712504465, 19.479162068762061,
+    19.490416924201877, 19.501678282579061, 19.51294614765094, 19.524220523177028,
+    19.535501412918979, 19.546788820640653, 19.558082750108063, 19.569383205089409,
+    19.580690189355057, 19.592003706677566, 19.603323760831671, 19.614650355594275,
+    19.625983494744485, 19.637323182063565, 19.648669421334986, 19.660022216344398,
+    19.671381570879639, 19.68274748873073, 19.694119973689887, 19.705499029551522,
+    19.716884660112221, 19.728276869170784, 19.739675660528203, 19.75108103798765,
+    19.762493005354518, 19.773911566436375, 19.785336725043003, 19.796768484986391,
+    19.808206850080708, 19.819651824142355, 19.831103410989915, 19.842561614444186,
+    19.854026438328184, 19.865497886467111, 19.876975962688402, 19.888460670821683,
+    19.899952014698815, 19.911449998153852, 19.922954625023078, 19.934465899144985,
+    19.945983824360287, 19.957508404511913, 19.969039643445022, 19.98057754500698,
+    19.992122113047394, 20.003673351418072, 20.015231263973078, 20.026795854568665,
+    20.038367127063353, 20.049945085317866, 20.061529733195162, 20.07312107456044,
+    20.084719113281125, 20.096323853226885, 20.107935298269606, 20.119553452283427,
+    20.13117831914473, 20.142809902732115, 20.154448206926443, 20.166093235610806,
+    20.177744992670547, 20.189403481993256, 20.201068707468753, 20.212740672989124,
+    20.224419382448691, 20.236104839744037, 20.247797048773986, 20.259496013439616,
+    20.271201737644272, 20.282914225293538, 20.294633480295268, 20.306359506559559,
+    20.318092307998775, 20.329831888527554, 20.341578252062767, 20.35333140252358,
+    20.365091343831388, 20.376858079909884, 20.388631614685011, 20.40041195208499,
+    20.4121990960403, 20.423993050483702, 20.435793819350224, 20.44760140657716,
+    20.459415816104098, 20.471237051872887, 20.483065117827653, 20.494900017914816,
+    20.506741756083056, 20.518590336283353, 20.530445762468958, 20.542308038595401,
+    20.554177168620523, 20.56605315650442, 20.577936006209502, 20.589825721700443,
+    20.601722306944236, 20.613625765910143, 20.625536102569733, 20.637453320896871,
+    20.649377424867701, 20.661308418460678, 20.673246305656559, 20.685191090438387,
+    20.697142776791527, 20.709101368703625, 20.721066870164641, 20.733039285166846,
+    20.745018617704805, 20.757004871775401, 20.768998051377821, 20.780998160513565,
+    20.793005203186446, 20.805019183402585, 20.817040105170427, 20.829067972500727,
+    20.841102789406559, 20.853144559903306, 20.86519328800869, 20.877248977742742,
+    20.889311633127814, 20.901381258188593, 20.913457856952075, 20.925541433447599,
+    20.937631991706823, 20.949729535763737, 20.961834069654667, 20.973945597418254,
+    20.986064123095499, 20.99818965072971, 21.010322184366551, 21.022461728054015,
+    21.034608285842431, 21.046761861784486, 21.058922459935182, 21.071090084351884,
+    21.083264739094297, 21.095446428224463, 21.107635155806783, 21.119830925907994,
+    21.132033742597198, 21.144243609945836, 21.156460532027697, 21.168684512918947,
+    21.180915556698082, 21.193153667445969, 21.205398849245821, 21.217651106183226,
+    21.229910442346121, 21.242176861824809, 21.254450368711954, 21.266730967102585,
+    21.279018661094099, 21.29131345478627, 21.303615352281216, 21.315924357683443,
+    21.328240475099829, 21.340563708639625, 21.352894062414439, 21.365231540538279,
+    21.37757614712752, 21.389927886300903, 21.402286762179575, 21.414652778887042,
+    21.427025940549196, 21.439406251294326, 21.451793715253089, 21.464188336558546,
+    21.476590119346124, 21.488999067753664, 21.501415185921378, 21.513838477991879,
+    21.526268948110182, 21.538706600423676, 21.551151439082169, 21.56360346823784,
+    21.576062692045298, 21.588529114661533, 21.601002740245939, 21.613483572960316,
+    21.625971616968869, 21.638466876438205, 21.650969355537349, 21.663479058437716,
+    21.675995989313154, 21.688520152339901, 21.701051551696633, 21.713590191564407,
+    21.726136076126721, 21.738689209569493, 21.751249596081038, 21.763817239852113,
+    21.776392145075874, 21.788974315947925, 21.801563756666273, 21.814160471431361,
+    21.826764464446057, 21.839375739915656, 21.851994302047892, 21.864620155052911,
+    21.877253303143309, 21.88989375053411, 21.902541501442766, 21.915196560089182,
+    21.927858930695692, 21.940528617487061, 21.953205624690511, 21.965889956535698,
+    21.978581617254726, 21.991280611082132, 22.003986942254915, 22.016700615012525,
+    22.029421633596836, 22.042150002252203, 22.054885725225414, 22.067628806765718,
+    22.08037925112481, 22.093137062556863, 22.105902245318486, 22.11867480366876,
+    22.13145474186922, 22.144242064183864, 22.157036774879156, 22.169838878224038,
+    22.182648378489883, 22.195465279950575, 22.208289586882429, 22.221121303564264,
+    22.233960434277346, 22.246806983305426, 22.259660954934734, 22.272522353453962,
+    22.285391183154299, 22.298267448329394, 22.311151153275389, 22.324042302290916,
+    22.336940899677064, 22.349846949737433, 22.362760456778098, 22.375681425107626,
+    22.388609859037068, 22.401545762879969, 22.414489140952373, 22.427439997572801,
+    22.440398337062287, 22.453364163744354, 22.466337481945018, 22.479318295992805,
+    22.492306610218737, 22.505302428956337, 22.518305756541629, 22.53131659731315,
+    22.544334955611948, 22.557360835781559, 22.570394242168046, 22.583435179119977,
+    22.596483650988432, 22.609539662127013, 22.622603216891825, 22.635674319641499,
+    22.648752974737178, 22.66183918654254, 22.674932959423753, 22.688034297749546,
+    22.701143205891146, 22.714259688222306, 22.727383749119326, 22.740515392961008,
+    22.753654624128707, 22.766801447006308, 22.779955865980206, 22.793117885439351,
+    22.806287509775224, 22.819464743381847, 22.83264959065577, 22.845842055996094,
+    22.859042143804462, 22.872249858485045, 22.885465204444582, 22.898688186092333,
+    22.911918807840131, 22.925157074102337, 22.938402989295874, 22.95165655784022,
+    22.964917784157389, 22.978186672671967, 22.991463227811099, 23.004747454004466,
+    23.018039355684337, 23.031338937285518, 23.044646203245392, 23.057961158003895,
+    23.071283806003539, 23.084614151689397, 23.097952199509109, 23.111297953912892,
+    23.124651419353526, 23.138012600286366, 23.151381501169347, 23.164758126462971,
+    23.178142480630324, 23.191534568137065, 23.204934393451438, 23.218341961044267,
+    23.231757275388961, 23.245180340961515, 23.258611162240495, 23.272049743707079,
+    23.285496089845012, 23.298950205140645, 23.312412094082923, 23.325881761163366,
+    23.339359210876108, 23.352844447717867, 23.366337476187965, 23.379838300788325,
+    23.393346926023469, 23.406863356400525, 23.420387596429215, 23.433919650621881,
+    23.44745952349346, 23.461007219561505, 23.474562743346176, 23.488126099370245,
+    23.501697292159101, 23.515276326240738, 23.528863206145772, 23.542457936407455,
+    23.556060521561616, 23.569670966146745, 23.583289274703937, 23.596915451776905,
+    23.610549501912008, 23.624191429658207, 23.637841239567106, 23.651498936192937,
+    23.665164524092564, 23.678838007825476, 23.692519391953812, 23.706208681042334,
+    23.719905879658434, 23.733610992372174, 23.747324023756221, 23.761044978385904,
+    23.774773860839193, 23.788510675696703, 23.802255427541688, 23.81600812096006,
+    23.829768760540372, 23.843537350873842, 23.857313896554327, 23.871098402178344,
+    23.884890872345057, 23.898691311656307, 23.912499724716579, 23.926316116133012,
+    23.940140490515432, 23.953972852476301, 23.967813206630762, 23.981661557596617,
+    23.995517909994348, 24.009382268447091, 24.023254637580663, 24.037135022023556,
+    24.051023426406921, 24.064919855364607, 24.078824313533119, 24.092736805551652,
+    24.106657336062092, 24.120585909708982, 24.134522531139567, 24.148467205003772,
+    24.162419935954205, 24.176380728646173, 24.190349587737657, 24.204326517889349,
+    24.218311523764608, 24.232304610029516, 24.246305781352834, 24.26031504240602,
+    24.27433239786324, 24.288357852401347, 24.302391410699919, 24.316433077441207,
+    24.330482857310194, 24.344540754994565, 24.358606775184697, 24.372680922573693,
+    24.386763201857367, 24.400853617734235, 24.414952174905547, 24.429058878075246,
+    24.443173731950008, 24.457296741239222, 24.471427910655013, 24.485567244912204,
+    24.499714748728355, 24.513870426823757, 24.528034283921421, 24.542206324747092,
+    24.556386554029235, 24.570574976499056, 24.584771596890498, 24.598976419940229,
+    24.613189450387662, 24.627410692974941, 24.641640152446957, 24.655877833551347,
+    24.670123741038466, 24.684377879661451, 24.698640254176155, 24.71291086934119,
+    24.727189729917921, 24.741476840670458, 24.75577220636567, 24.770075831773166,
+    24.784387721665336, 24.7987078808173, 24.813036314006954, 24.827373026014953,
+    24.841718021624708, 24.856071305622397, 24.870432882796965, 24.884802757940118,
+    24.899180935846349, 24.913567421312887, 24.927962219139772, 24.942365334129786,
+    24.95677677108851, 24.971196534824273, 24.985624630148209, 25.000061061874234,
+    25.014505834819012, 25.028958953802029, 25.043420423645525, 25.057890249174545,
+    25.072368435216926, 25.086854986603271, 25.101349908166995, 25.115853204744297,
+    25.13036488117417, 25.144884942298408, 25.159413392961596, 25.173950238011127,
+    25.188495482297181, 25.20304913067276, 25.217611187993644, 25.232181659118446,
+    25.246760548908576, 25.261347862228234, 25.275943603944462, 25.290547778927095,
+    25.305160392048784, 25.319781448184997, 25.334410952214022, 25.349048909016961,
+    25.363695323477735, 25.378350200483094, 25.393013544922606, 25.407685361688667,
+    25.422365655676504, 25.437054431784148, 25.451751694912502, 25.466457449965262,
+    25.481171701848975, 25.495894455473032, 25.510625715749629, 25.525365487593842,
+    25.540113775923547, 25.554870585659494, 25.569635921725254, 25.584409789047253,
+    25.599192192554767, 25.613983137179908, 25.628782627857642, 25.643590669525796,
+    25.658407267125032, 25.67323242559889, 25.688066149893743, 25.702908444958844,
+    25.717759315746278, 25.732618767211019, 25.747486804310892, 25.76236343200658,
+    25.777248655261648, 25.792142479042514, 25.807044908318474, 25.821955948061689,
+    25.836875603247201, 25.85180387885292, 25.866740779859636, 25.881686311251016,
+    25.896640478013598, 25.911603285136817, 25.926574737612984, 25.941554840437288,
+    25.956543598607809, 25.971541017125517, 25.986547100994269, 26.001561855220821,
+    26.016585284814802, 26.031617394788761, 26.046658190158119, 26.061707675941214,
+    26.07676585715927, 26.091832738836427, 26.106908325999715, 26.121992623679063,
+    26.137085636907329, 26.152187370720259, 26.167297830156517, 26.182417020257677,
+    26.197544946068223, 26.212681612635564, 26.227827025010008, 26.242981188244798,
+    26.258144107396081, 26.273315787522936, 26.288496233687372, 26.303685450954301,
+    26.318883444391588, 26.334090219069992, 26.34930578006324, 26.364530132447968,
+    26.379763281303742, 26.395005231713085, 26.410255988761428, 26.42551555753716,
+    26.44078394313161, 26.456061150639034, 26.471347185156649, 26.486642051784603,
+    26.501945755626, 26.517258301786885, 26.53257969537626, 26.547909941506081,
+    26.563249045291244, 26.57859701184962, 26.593953846302014, 26.609319553772213,
+    26.624694139386946, 26.640077608275917, 26.65546996557179, 26.670871216410184,
+    26.686281365929705, 26.701700419271905, 26.717128381581333, 26.73256525800549,
+    26.748011053694857, 26.763465773802899, 26.778929423486041, 26.794402007903699,
+    26.809883532218283, 26.825374001595154, 26.840873421202687, 26.856381796212226,
+    26.871899131798106, 26.887425433137661, 26.902960705411203, 26.918504953802049,
+    26.9340581834965, 26.949620399683862, 26.965191607556438, 26.980771812309523,
+    26.996361019141428, 27.011959233253453, 27.027566459849918, 27.043182704138129,
+    27.058807971328427, 27.074442266634144, 27.090085595271631, 27.105737962460253,
+    27.121399373422385, 27.137069833383432, 27.15274934757181, 27.168437921218949,
+    27.184135559559316, 27.199842267830398, 27.215558051272698, 27.231282915129754,
+    27.247016864648142, 27.262759905077463, 27.278512041670339, 27.294273279682447,
+    27.31004362437249, 27.325823081002206, 27.341611654836385, 27.357409351142845,
+    27.373216175192464, 27.389032132259146, 27.404857227619861, 27.420691466554612,
+    27.436534854346466, 27.452387396281537, 27.468249097648982, 27.484119963741044,
+    27.499999999852985, 27.515889211283156, 27.531787603332965, 27.547695181306867,
+    27.563611950512399, 27.579537916260154, 27.595473083863798, 27.611417458640076,
+    27.627371045908781, 27.643333850992807, 27.659305879218103, 27.67528713591371,
+    27.691277626411729, 27.707277356047367, 27.723286330158899, 27.739304554087681,
+    27.75533203317816, 27.771368772777876, 27.787414778237451, 27.803470054910608,
+    27.819534608154147, 27.835608443327981, 27.8516915657951, 27.867783980921622,
+    27.883885694076735, 27.899996710632745, 27.916117035965065, 27.932246675452205,
+    27.948385634475784, 27.964533918420532, 27.980691532674289, 27.996858482628021,
+    28.013034773675781, 28.029220411214773, 28.045415400645282, 28.061619747370745,
+    28.077833456797709, 28.094056534335841, 28.110288985397943, 28.126530815399928,
+    28.142782029760863, 28.159042633902917, 28.175312633251416, 28.191592033234812,
+    28.207880839284687, 28.22417905683578, 28.240486691325941, 28.256803748196194,
+    28.273130232890683, 28.289466150856704, 28.305811507544711, 28.322166308408285,
+    28.338530558904186, 28.354904264492308, 28.371287430635697, 28.387680062800573,
+    28.404082166456291, 28.420493747075398, 28.436914810133565, 28.453345361109648,
+    28.46978540548568, 28.486234948746837, 28.502693996381485, 28.519162553881138,
+    28.535640626740499, 28.552128220457455, 28.568625340533039, 28.585131992471503,
+    28.601648181780234, 28.618173913969844, 28.634709194554095, 28.651254029049955,
+    28.667808422977583, 28.684372381860303, 28.700945911224654, 28.717529016600356,
+    28.734121703520334, 28.750723977520696, 28.767335844140764, 28.78395730892305,
+    28.800588377413266, 28.81722905516034, 28.833879347716405, 28.850539260636783,
+    28.867208799480025, 28.883887969807891, 28.900576777185361, 28.917275227180596,
+    28.933983325365016, 28.950701077313248, 28.967428488603126, 28.984165564815722,
+    29.00091231153532, 29.017668734349442, 29.034434838848835, 29.051210630627473,
+    29.067996115282565, 29.084791298414551, 29.101596185627116, 29.118410782527164,
+    29.135235094724862, 29.152069127833602, 29.168912887470029, 29.185766379254023,
+    29.202629608808714, 29.219502581760491, 29.236385303738988, 29.253277780377083,
+    29.270180017310921, 29.287092020179891, 29.304013794626659, 29.320945346297133,
+    29.337886680840494, 29.354837803909181, 29.371798721158896, 29.388769438248623,
+    29.405749960840602, 29.422740294600352, 29.439740445196662, 29.456750418301596,
+    29.473770219590499, 29.490799854741983, 29.50783932943796, 29.524888649363621,
+    29.541947820207422, 29.55901684766113, 29.576095737419788, 29.593184495181728,
+    29.610283126648586, 29.627391637525282, 29.644510033520039, 29.661638320344366,
+    29.678776503713085, 29.695924589344319, 29.713082582959487, 29.730250490283318,
+    29.747428317043848, 29.764616068972433, 29.781813751803718, 29.799021371275682,
+    29.816238933129608, 29.833466443110101, 29.850703906965091, 29.867951330445809,
+    29.885208719306835, 29.902476079306052, 29.919753416204678, 29.937040735767273,
+    29.954338043761702, 29.971645345959189, 29.988962648134265, 30.006289956064823,
+    30.023627275532082, 30.040974612320593, 30.05833197221828, 30.075699361016365,
+    30.09307678450946, 30.1104642484955, 30.127861758775776, 30.145269321154931,
+    30.162686941440963, 30.180114625445231, 30.197552378982436, 30.215000207870649,
+    30.232458117931312, 30.249926114989211, 30.267404204872513, 30.28489239341274,
+    30.302390686444795, 30.319899089806952, 30.337417609340843, 30.354946250891494,
+    30.372485020307295, 30.390033923440029, 30.407592966144833, 30.425162154280262,
+    30.442741493708237, 30.460330990294064, 30.477930649906444, 30.495540478417468,
+    30.513160481702617, 30.530790665640769, 30.548431036114199, 30.566081599008584,
+    30.583742360212984, 30.601413325619895, 30.619094501125186, 30.636785892628147,
+    30.654487506031479, 30.672199347241278, 30.689921422167078, 30.707653736721795,
+    30.725396296821788, 30.743149108386838, 30.76091217734011, 30.778685509608238,
+    30.79646911112124, 30.814262987812583, 30.832067145619167, 30.849881590481296,
+    30.867706328342742, 30.885541365150672, 30.903386706855724, 30.921242359411952,
+    30.939108328776857, 30.956984620911392, 30.97487124177993, 30.992768197350323,
+    31.010675493593837, 31.028593136485213, 31.046521132002638, 31.064459486127738,
+    31.082408204845628, 31.100367294144835, 31.118336760017392, 31.136316608458774,
+    31.154306845467911, 31.172307477047216, 31.190318509202552, 31.208339947943276,
+    31.226371799282195, 31.244414069235596, 31.262466763823255, 31.280529889068415,
+    31.298603450997796, 31.316687455641603, 31.334781909033527, 31.352886817210756,
+    31.371002186213939, 31.389128022087245, 31.407264330878313, 31.425411118638287,
+    31.44356839142181, 31.461736155287014, 31.479914416295539, 31.498103180512519,
+    31.516302454006606, 31.534512242849939, 31.552732553118179, 31.570963390890505,
+    31.589204762249587, 31.607456673281629, 31.625719130076337, 31.643992138726944,
+    31.66227570533021, 31.680569835986393, 31.698874536799305, 31.717189813876267,
+    31.735515673328138, 31.75385212126929, 31.772199163817653, 31.790556807094681,
+    31.808925057225355, 31.82730392033821, 31.845693402565313, 31.864093510042277,
+    31.882504248908266, 31.900925625305973, 31.919357645381663, 31.937800315285134,
+    31.956253641169752, 31.974717629192426, 31.993192285513626, 32.011677616297391,
+    32.030173627711299, 32.048680325926526, 32.067197717117779, 32.085725807463348,
+    32.104264603145097, 32.12281411034845, 32.141374335262427, 32.159945284079591,
+    32.178526962996109, 32.197119378211724, 32.21572253592975, 32.23433644235709,
+    32.252961103704244, 32.271596526185284, 32.290242716017886, 32.308899679423313,
+    32.327567422626416, 32.346245951855657, 32.364935273343079, 32.383635393324347,
+    32.402346318038703, 32.42106805372903, 32.439800606641768, 32.45854398302702,
+    32.477298189138466, 32.4960632312334, 32.514839115572755, 32.533625848421046,
+    32.552423436046446, 32.571231884720724, 32.590051200719287, 32.608881390321145,
+    32.627722459808957, 32.646574415469026, 32.665437263591244, 32.684311010469173,
+    32.703195662399999, 32.722091225684544, 32.740997706627269, 32.759915111536301,
+    32.778843446723378, 32.797782718503896, 32.81673293319691, 32.835694097125128,
+    32.854666216614895, 32.873649297996209, 32.892643347602764, 32.911648371771861,
+    32.93066437684449, 32.949691369165315, 32.968729355082637, 32.987778340948459,
+    33.006838333118402, 33.025909337951838, 33.044991361811739, 33.064084411064783,
+    33.083188492081348, 33.102303611235449, 33.121429774904811, 33.140566989470848,
+    33.159715261318638, 33.178874596836984, 33.198045002418326, 33.217226484458863,
+    33.236419049358439, 33.255622703520615, 33.27483745335266, 33.294063305265524,
+    33.313300265673881, 33.332548340996091, 33.35180753765426, 33.371077862074159,
+    33.390359320685278, 33.409651919920869, 33.428955666217853, 33.448270566016888,
+    33.467596625762326, 33.486933851902315, 33.506282250888638, 33.525641829176863,
+    33.545012593226282, 33.564394549499902, 33.58378770446447, 33.603192064590466,
+    33.622607636352143, 33.642034426227433, 33.661472440698063, 33.680921686249491,
+    33.700382169370904, 33.719853896555243, 33.739336874299234, 33.758831109103333,
+    33.778336607471729, 33.797853375912403, 33.817381420937082, 33.836920749061271,
+    33.8564713668042, 33.876033280688915, 33.895606497242206, 33.91519102299462,
+    33.934786864480508, 33.954394028237978, 33.974012520808934, 33.993642348739009,
+    34.013283518577694, 34.032936036878212, 34.052599910197564, 34.072275145096583,
+    34.091961748139873, 34.111659725895827, 34.131369084936608, 34.151089831838235,
+    34.170821973180495, 34.190565515546943, 34.210320465525001, 34.230086829705868,
+    34.24986461468454, 34.26965382705982, 34.289454473434361, 34.309266560414606,
+    34.329090094610798, 34.348925082637045, 34.368771531111236, 34.388629446655088,
+    34.408498835894171, 34.428379705457857, 34.44827206197936, 34.46817591209571,
+    34.48809126244781, 34.508018119680365, 34.527956490441909, 34.547906381384877,
+    34.567867799165484, 34.587840750443817, 34.607825241883802, 34.627821280153256,
+    34.647828871923785, 34.667848023870889, 34.687878742673924, 34.707921035016085,
+    34.727974907584453, 34.748040367069954, 34.768117420167393, 34.788206073575438,
+    34.808306333996612, 34.828418208137343, 34.848541702707912, 34.868676824422472,
+    34.888823579999077, 34.908981976159644, 34.929152019629989, 34.94933371713978,
+    34.969527075422633, 34.989732101215999, 35.009948801261238, 35.030177182303639,
+    35.050417251092327, 35.070669014380385, 35.090932478924742, 35.111207651486296,
+    35.131494538829799, 35.151793147723915, 35.17210348494126, 35.192425557258318,
+    35.212759371455512, 35.23310493431719, 35.253462252631579, 35.273831333190884,
+    35.294212182791178, 35.314604808232517, 35.335009216318852, 35.35542541385805,
+    35.375853407661971, 35.396293204546339, 35.416744811330865, 35.437208234839183,
+    35.457683481898876, 35.478170559341457, 35.498669474002405, 35.519180232721148,
+    35.539702842341043, 35.560237309709422, 35.580783641677577, 35.601341845100734,
+    35.621911926838109, 35.642493893752857, 35.663087752712116, 35.683693510586977,
+    35.704311174252503, 35.724940750587763, 35.745582246475749, 35.766235668803461,
+    35.786901024461855, 35.807578320345911, 35.828267563354551, 35.848968760390683,
+    35.869681918361259, 35.890407044177152, 35.911144144753251, 35.931893227008466,
+    35.952654297865692, 35.973427364251798, 35.994212433097665, 36.015009511338221,
+    36.035818605912347, 36.056639723762949, 36.077472871836974, 36.098318057085343,
+    36.119175286463012, 36.140044566928928, 36.160925905446135, 36.181819308981609,
+    36.202724784506401, 36.223642338995575, 36.244571979428251, 36.265513712787531,
+    36.286467546060599, 36.307433486238665, 36.328411540316957, 36.349401715294754,
+    36.3704040181754, 36.39141845596626, 36.412445035678758, 36.433483764328379,
+    36.454534648934654, 36.475597696521149, 36.496672914115507, 36.517760308749452,
+    36.538859887458734, 36.559971657283178, 36.581095625266705, 36.602231798457268,
+    36.62338018390691, 36.644540788671733, 36.665713619811953, 36.686898684391821,
+    36.708095989479702, 36.72930554214804, 36.750527349473337, 36.771761418536208,
+    36.793007756421389, 36.814266370217638, 36.835537267017877, 36.856820453919056,
+    36.878115938022312, 36.899423726432822, 36.920743826259866, 36.942076244616878,
+    36.963420988621372, 36.98477806539497, 37.006147482063405, 37.027529245756568,
+    37.048923363608424, 37.070329842757069, 37.091748690344744, 37.113179913517797,
+    37.134623519426697, 37.156079515226089, 37.177547908074708, 37.19902870513544,
+    37.220521913575297, 37.242027540565452, 37.263545593281229, 37.285076078902044,
+    37.306619004611534, 37.328174377597442, 37.349742205051676, 37.371322494170279,
+    37.392915252153479, 37.414520486205674, 37.436138203535386, 37.457768411355325,
+    37.479411116882368, 37.501066327337554, 37.522734049946109, 37.544414291937422,
+    37.56610706054505, 37.587812363006748, 37.609530206564443, 37.631260598464266,
+    37.65300354595648, 37.674759056295606, 37.696527136740322, 37.718307794553496,
+    37.740101037002191, 37.761906871357688, 37.783725304895462, 37.805556344895173,
+    37.827399998640729, 37.849256273420195, 37.871125176525879, 37.893006715254309,
+    37.914900896906197, 37.936807728786491, 37.958727218204366, 37.980659372473234,
+    38.002604198910682, 38.024561704838561, 38.046531897582966, 38.068514784474203,
+    38.090510372846808, 38.112518670039549, 38.134539683395474, 38.15657342026185,
+    38.178619887990152, 38.200679093936188, 38.22275104545993, 38.244835749925663,
+    38.266933214701872, 38.289043447161369, 38.311166454681164, 38.333302244642546,
+    38.355450824431102, 38.377612201436641, 38.399786383053254, 38.42197337667934,
+    38.44417318971751, 38.466385829574712, 38.488611303662118, 38.510849619395252,
+    38.533100784193856, 38.555364805481972, 38.577641690687983, 38.599931447244501,
+    38.622234082588456, 38.644549604161071, 38.666878019407896, 38.689219335778752,
+    38.711573560727757, 38.733940701713379, 38.756320766198343, 38.778713761649726,
+    38.801119695538901, 38.823538575341566, 38.845970408537731, 38.868415202611715,
+    38.890872965052203, 38.913343703352176, 38.935827425008931, 38.958324137524123,
+    38.980833848403755, 39.003356565158121, 39.02589229530188, 39.048441046354057,
+    39.071002825837965, 39.0935776412813, 39.116165500216127, 39.138766410178818,
+    39.161380378710113, 39.184007413355133, 39.206647521663342, 39.229300711188557,
+    39.251966989488963, 39.274646364127129, 39.297338842669973, 39.320044432688796,
+    39.342763141759278, 39.365494977461459, 39.38823994737978, 39.410998059103036,
+    39.433769320224442, 39.456553738341576, 39.479351321056399, 39.502162075975299,
+    39.524986010709036, 39.547823132872743, 39.570673450086005, 39.593536969972781,
+    39.616413700161424, 39.639303648284702, 39.662206821979829, 39.685123228888379,
+    39.70805287665636, 39.730995772934222, 39.753951925376803, 39.776921341643373,
+    39.799904029397624, 39.822899996307704, 39.845909250046162, 39.868931798289964,
+    39.891967648720573, 39.915016809023825, 39.938079286890051, 39.96115509001396,
+    39.984244226094788, 40.007346702836152, 40.030462527946149, 40.053591709137329,
+    40.076734254126713, 40.099890170635724, 40.123059466390323, 40.14624214912088,
+    40.169438226562264, 40.192647706453762, 40.215870596539212, 40.23910690456686,
+    40.262356638289454, 40.285619805464229, 40.308896413852885, 40.332186471221625,
+    40.355489985341094, 40.378806963986513, 40.402137414937513, 40.425481345978241,
+    40.448838764897381, 40.472209679488074, 40.495594097547965, 40.518992026879232,
+    40.542403475288545, 40.565828450587084, 40.589266960590528, 40.612719013119118,
+    40.636184615997557, 40.659663777055101, 40.683156504125535, 40.706662805047159,
+    40.730182687662783, 40.753716159819767, 40.777263229370021, 40.800823904169988,
+    40.824398192080601, 40.847986100967404, 40.871587638700447, 40.895202813154313,
+    40.918831632208196, 40.942474103745774, 40.966130235655314, 40.989800035829624,
+    41.013483512166111, 41.037180672566706, 41.060891524937908, 41.084616077190802,
+    41.108354337241046, 41.132106313008848, 41.155872012418996, 41.179651443400886,
+    41.203444613888472, 41.227251531820279, 41.251072205139465, 41.274906641793741,
+    41.298754849735396, 41.322616836921355, 41.346492611313117, 41.370382180876781,
+    41.394285553583046, 41.418202737407249, 41.44213374032929, 41.466078570333686,
+    41.490037235409609, 41.514009743550801, 41.537996102755649, 41.561996321027124,
+    41.586010406372893, 41.610038366805178, 41.634080210340855, 41.658135945001455,
+    41.682205578813118, 41.706289119806627, 41.730386576017381, 41.754497955485483,
+    41.778623266255629, 41.802762516377179, 41.82691571390415, 41.851082866895204,
+    41.875263983413646, 41.899459071527474, 41.923668139309335, 41.947891194836515,
+    41.972128246190991, 41.99637930145942, 42.020644368733102, 42.044923456108023,
+    42.069216571684862, 42.093523723568971, 42.117844919870372, 42.142180168703767,
+    42.166529478188593, 42.190892856448933, 42.215270311613558, 42.239661851815988,
+    42.264067485194396, 42.288487219891664, 42.312921064055395, 42.337369025837894,
+    42.361831113396171, 42.386307334891931, 42.410797698491642, 42.435302212366459,
+    42.459820884692235, 42.484353723649619, 42.508900737423907, 42.533461934205178,
+    42.558037322188198, 42.582626909572539, 42.60723070456244, 42.631848715366878,
+    42.656480950199658, 42.681127417279249, 42.705788124828871, 42.730463081076557,
+    42.755152294255041, 42.779855772601813, 42.804573524359142, 42.829305557774084,
+    42.8540518810984, 42.878812502588644, 42.903587430506178, 42.928376673117093,
+    42.953180238692255, 42.97799813550732, 43.002830371842755, 43.027676955983765,
+    43.052537896220358, 43.077413200847353, 43.102302878164338, 43.127206936475673,
+    43.152125384090596, 43.177058229323066, 43.202005480491884, 43.226967145920625,
+    43.251943233937737, 43.276933752876417, 43.301938711074691, 43.326958116875431,
+    43.351991978626309, 43.377040304679809, 43.402103103393259, 43.427180383128814,
+    43.45227215225345, 43.477378419138979, 43.502499192162077, 43.527634479704226,
+    43.552784290151756, 43.57794863189585, 43.603127513332545, 43.628320942862729,
+    43.653528928892108, 43.678751479831313, 43.703988604095791, 43.729240310105816,
+    43.754506606286618, 43.77978750106822, 43.805083002885539, 43.830393120178357,
+    43.855717861391376, 43.881057234974129, 43.906411249381016, 43.931779913071395,
+    43.957163234509451, 43.982561222164271, 44.00797388450983, 44.033401230025049,
+    44.05884326719368, 44.084300004504399, 44.109771450450829, 44.135257613531437,
+    44.160758502249614, 44.186274125113727, 44.211804490636972, 44.237349607337528,
+    44.262909483738433, 44.288484128367728, 44.314073549758319, 44.339677756448069,
+    44.365296756979767, 44.39093055990115, 44.416579173764866, 44.442242607128527,
+    44.467920868554693, 44.493613966610859, 44.519321909869461, 44.545044706907923,
+    44.570782366308599, 44.596534896658781, 44.622302306550779, 44.648084604581832,
+    44.673881799354135, 44.699693899474859, 44.725520913556196, 44.751362850215259,
+    44.777219718074129, 44.803091525759939, 44.828978281904746, 44.854879995145609,
+    44.880796674124568, 44.906728327488707, 44.932674963890044, 44.958636591985602,
+    44.984613220437474, 45.010604857912675, 45.036611513083251, 45.062633194626301,
+    45.088669911223896, 45.114721671563125, 45.140788484336085, 45.166870358239954,
+    45.192967301976871, 45.219079324254018, 45.24520643378365, 45.271348639282998,
+    45.297505949474363, 45.323678373085073, 45.349865918847506, 45.376068595499099,
+    45.402286411782285, 45.428519376444612, 45.454767498238652, 45.481030785922023,
+    45.507309248257414, 45.533602894012617, 45.559911731960419, 45.586235770878694,
+    45.612575019550448, 45.638929486763701, 45.665299181311532, 45.691684111992188,
+    45.718084287608924, 45.744499716970097, 45.770930408889157, 45.797376372184665,
+    45.823837615680269, 45.850314148204667, 45.876805978591747, 45.90331311568044,
+    45.929835568314786, 45.956373345343934, 45.982926455622199, 46.009494908008939,
+    46.036078711368667, 46.062677874571037, 46.089292406490785, 46.115922316007783,
+    46.142567612007078, 46.169228303378794, 46.195904399018225, 46.222595907825777,
+    46.249302838707052, 46.276025200572739, 46.302763002338686, 46.329516252925941,
+    46.356284961260648, 46.383069136274138, 46.409868786902877, 46.436683922088534,
+    46.46351455077793, 46.490360681923022, 46.51722232448099, 46.544099487414158,
+    46.570992179690016, 46.597900410281291, 46.624824188165846, 46.651763522326739,
+    46.678718421752208, 46.705688895435735, 46.732674952375937, 46.759676601576643,
+    46.786693852046938, 46.813726712801049, 46.840775192858437, 46.867839301243755,
+    46.894919046986921, 46.922014439123018, 46.949125486692346, 46.97625219874049,
+    47.003394584318201, 47.030552652481468, 47.057726412291544, 47.084915872814911,
+    47.112121043123238, 47.139341932293483, 47.166578549407873, 47.193830903553817,
+    47.221099003824008, 47.248382859316415, 47.275682479134211, 47.30299787238588,
+    47.330329048185121, 47.357676015650952, 47.385038783907632, 47.412417362084661,
+    47.439811759316868, 47.467221984744349, 47.494648047512449, 47.522089956771808,
+    47.549547721678387, 47.577021351393412, 47.604510855083369, 47.63201624192012,
+    47.659537521080757, 47.687074701747676, 47.714627793108654, 47.742196804356688,
+    47.769781744690121, 47.797382623312608, 47.824999449433157, 47.852632232266032,
+    47.880280981030857, 47.907945704952603, 47.935626413261524, 47.963323115193241,
+    47.991035819988696, 48.018764536894182, 48.046509275161334, 48.074270044047104,
+    48.102046852813842, 48.129839710729215, 48.15764862706623, 48.185473611103305,
+    48.213314672124184, 48.241171819417971, 48.269045062279126, 48.296934410007545,
+    48.324839871908416, 48.352761457292338, 48.380699175475314, 48.408653035778698,
+    48.436623047529224, 48.464609220059032, 48.492611562705669, 48.520630084812048,
+    48.548664795726474, 48.576715704802695, 48.604782821399837, 48.632866154882407,
+    48.660965714620389, 48.68908150998913, 48.717213550369401, 48.745361845147379,
+    48.773526403714733, 48.801707235468477, 48.829904349811088, 48.858117756150492,
+    48.886347463900016, 48.914593482478459, 48.942855821310019, 48.971134489824408,
+    48.999429497456717, 49.027740853647508, 49.056068567842843, 49.084412649494183,
+    49.112773108058462, 49.141149952998113, 49.169543193780996, 49.197952839880465,
+    49.226378900775316, 49.254821385949882, 49.283280304893921, 49.31175566710268,
+    49.340247482076933, 49.368755759322902, 49.397280508352317, 49.425821738682373,
+    49.454379459835842, 49.482953681340923, 49.511544412731332, 49.540151663546332,
+    49.568775443330672, 49.597415761634608, 49.626072628013908, 49.654746052029907,
+    49.683436043249422, 49.712142611244786, 49.740865765593931, 49.769605515880244,
+    49.798361871692691, 49.827134842625775, 49.855924438279544, 49.884730668259579,
+    49.913553542177006, 49.942393069648546, 49.971249260296425, 50.000122123748461,
+    50.029011669638024, 50.057917907604057, 50.086840847291057, 50.115780498349089,
+    50.144736870433853, 50.173709973206549, 50.202699816333983, 50.231706409488595,
+    50.26072976234834, 50.289769884596808, 50.318826785923193, 50.347900476022254,
+    50.37699096459437, 50.406098261345512, 50.435222375987287, 50.464363318236899,
+    50.493521097817144, 50.522695724456469, 50.551887207888925, 50.581095557854198,
+    50.610320784097567, 50.639562896369995, 50.66882190442805, 50.698097818033908,
+    50.72739064695547, 50.756700400966189, 50.786027089845206, 50.815370723377335,
+    50.844731311353009, 50.87410886356831, 50.903503389824998, 50.932914899930523,
+    50.962343403697957, 50.991788910946049, 51.021251431499259, 51.050730975187683,
+    51.080227551847102, 51.10974117131898, 51.139271843450508, 51.168819578094521,
+    51.198384385109527, 51.227966274359815, 51.257565255715285, 51.287181339051585,
+    51.316814534250064, 51.34646485119778, 51.3761322997875, 51.405816889917681,
+    51.435518631492556, 51.465237534422045, 51.494973608621777, 51.524726864013161,
+    51.554497310523296, 51.584284958085036, 51.614089816636941, 51.643911896123377,
+    51.673751206494408, 51.703607757705832, 51.733481559719273, 51.763372622502033,
+    51.793280956027203, 51.823206570273634, 51.853149475225969, 51.883109680874583,
+    51.91308719721561, 51.943082034251034, 51.973094201988545, 52.003123710441635,
+    52.033170569629604, 52.063234789577521, 52.093316380316246, 52.123415351882421,
+    52.15353171431854, 52.183665477672861, 52.213816651999423, 52.243985247358125,
+    52.274171273814659, 52.304374741440526, 52.334595660313035, 52.364834040515355,
+    52.395089892136454, 52.42536322527112, 52.455654050020016, 52.485962376489596,
+    52.516288214792155, 52.546631575045872, 52.576992467374744, 52.607370901908617,
+    52.637766888783162, 52.668180438139984, 52.698611560126494, 52.729060264895928,
+    52.759526562607483, 52.790010463426171, 52.820511977522862, 52.851031115074321,
+    52.88156788626322, 52.912122301278075, 52.942694370313291, 52.973284103569206,
+    53.003891511252, 53.034516603573763, 53.06515939075252, 53.095819883012162,
+    53.126498090582494, 53.157194023699233, 53.187907692604028, 53.218639107544433,
+    53.249388278773885, 53.280155216551833, 53.310939931143579, 53.341742432820375,
+    53.372562731859396, 53.40340083854381, 53.434256763162672, 53.465130516010973,
+    53.496022107389713, 53.526931547605798, 53.557858846972067, 53.588804015807398,
+    53.619767064436566, 53.650748003190316, 53.681746842405367, 53.712763592424452,
+    53.743798263596219, 53.774850866275315, 53.805921410822407, 53.837009907604099,
+    53.868116366993007, 53.899240799367718, 53.930383215112876, 53.961543624619054,
+    53.992722038282849, 54.023918466506906, 54.055132919699837, 54.086365408276272,
+    54.117615942656855, 54.148884533268287, 54.18017119054327, 54.211475924920499,
+    54.24279874684477, 54.274139666766878, 54.305498695143612, 54.336875842437898,
+    54.368271119118631, 54.399684535660803, 54.431116102545381, 54.462565830259507,
+    54.494033729296291, 54.525519810154918, 54.557024083340679, 54.588546559364893,
+    54.620087248744987, 54.651646162004411, 54.683223309672769, 54.714818702285697,
+    54.746432350384922, 54.778064264518292, 54.809714455239721, 54.841382933109216,
+    54.873069708692931, 54.904774792563074, 54.936498195297972, 54.968239927482081,
+    54.99999999970597, 55.031778422566319, 55.063575206665924, 55.095390362613735,
+    55.127223901024799, 55.159075832520315, 55.190946167727596, 55.222834917280153,
+    55.254742091817569, 55.286667701985607, 55.318611758436205, 55.350574271827419,
+    55.382555252823451, 55.414554712094734, 55.446572660317798, 55.47860910817537,
+    55.510664066356313, 55.542737545555752, 55.57482955647491, 55.606940109821203,
+    55.639069216308293, 55.671216886655962, 55.703383131590208, 55.735567961843238,
+    55.76777138815347, 55.799993421265505, 55.832234071930124, 55.864493350904411,
+    55.896771268951568, 55.929067836841057, 55.961383065348578, 55.993716965256041,
+    56.026069547351568, 56.058440822429539, 56.090830801290565, 56.123239494741497,
+    56.155666913595411, 56.188113068671683, 56.220577970795887, 56.253061630799863,
+    56.285564059521718, 56.318085267805834, 56.350625266502838, 56.383184066469617,
+    56.415761678569375, 56.44835811367156, 56.480973382651896, 56.513607496392389,
+    56.546260465781366, 56.578932301713415, 56.611623015089414, 56.64433261681657,
+    56.677061117808378, 56.70980852898461, 56.742574861271393, 56.775360125601146,
+    56.808164332912597, 56.840987494150781, 56.873829620267131, 56.906690722219309,
+    56.939570810971354, 56.972469897493674, 57.005387992762969, 57.038325107762283,
+    57.071281253480997, 57.104256440914909, 57.137250681066092, 57.170263984942991,
+    57.203296363560469, 57.236347827939689, 57.269418389108182, 57.30250805809991,
+    57.335616845955165, 57.368744763720613, 57.401891822449301, 57.435058033200711,
+    57.468243407040674, 57.501447955041385, 57.534671688281527, 57.5679146178461,
+    57.60117675482654, 57.634458110320679, 57.667758695432809, 57.701078521273573,
+    57.734417598960043, 57.767775939615781, 57.801153554370721, 57.834550454361185,
+    57.867966650730033, 57.901402154626496, 57.934856977206266, 57.96833112963143,
+    58.00182462307064, 58.035337468698891, 58.068869677697663, 58.102421261254946,
+    58.13599223056513, 58.169582596829109, 58.203192371254225, 58.236821565054328,
+    58.270470189449732, 58.304138255667198, 58.337825774940057, 58.371532758508046,
+    58.40525921761742, 58.439005163520982, 58.472770607477976, 58.506555560754173,
+    58.540360034621834, 58.574184040359782, 58.608027589253325, 58.641890692594259,
+    58.675773361680989, 58.709675607818362, 58.7435974423178, 58.777538876497239,
+    58.811499921681204, 58.845480589200712, 58.879480890393317, 58.913500836603191,
+    58.947540439180997, 58.981599709483973, 59.01567865887592, 59.049777298727243,
+    59.083895640414852, 59.118033695322254, 59.152191474839576, 59.186368990363462,
+    59.220566253297164, 59.254783275050563, 59.289020067040077, 59.323276640688739,
+    59.357553007426162, 59.391849178688638, 59.426165165918981, 59.460500980566628,
+    59.494856634087697, 59.529232137944867, 59.563627503607449, 59.598042742551364,
+    59.632477866259215, 59.666932886220216, 59.701407813930167, 59.735902660891618,
+    59.77041743861367, 59.804952158612096, 59.839506832409356, 59.874081471534545,
+    59.908676087523411, 59.943290691918371, 59.977925296268531, 60.012579912129652,
+    60.04725455106415, 60.081949224641185, 60.11666394443656, 60.151398722032738,
+    60.18615356901892, 60.220928496991, 60.255723517551559, 60.290538642309855,
+    60.325373882881927, 60.360229250890463, 60.395104757964859, 60.430000415741297,
+    60.464916235862624, 60.49985222997843, 60.534808409745018, 60.56978478682548,
+    60.604781372889597, 60.639798179613898, 60.674835218681686, 60.709892501782988,
+    60.744970040614596, 60.780067846880044, 60.815185932289666, 60.850324308560538,
+    60.885482987416466, 60.920661980588129, 60.955861299812888, 60.991080956834921,
+    61.026320963405233, 61.061581331281538, 61.096862072228404, 61.132163198017153,
+    61.167484720425968, 61.202826651239796, 61.238189002250358, 61.273571785256294,
+    61.308975012062959, 61.344398694482564, 61.379842844334135, 61.41530747344359,
+    61.450792593643591, 61.486298216773662, 61.52182435468022, 61.557371019216475,
+    61.592938222242488, 61.628525975625166, 61.664134291238334, 61.699763180962606,
+    61.735412656685476, 61.771082730301345, 61.806773413711454, 61.842484718823897,
+    61.878216657553715, 61.913969241822784, 61.949742483559874, 61.985536394700638,
+    62.021350987187674, 62.057186272970434, 62.093042264005263, 62.128918972255477,
+    62.164816409691255, 62.200734588289684, 62.236673520034785, 62.272633216917548,
+    62.308613690935829, 62.344614954094418, 62.380637018405103, 62.416679895886553,
+    62.452743598564375, 62.488828138471192, 62.52493352764651, 62.561059778136837,
+    62.597206901995584, 62.633374911283205, 62.669563818067068, 62.705773634421497,
+    62.742004372427878, 62.778256044174491, 62.814528661756633, 62.850822237276574,
+    62.887136782843619, 62.923472310574034, 62.959828832591064, 62.996206361025038,
+    63.032604908013212, 63.069024485699863, 63.105465106236359, 63.141926781781009,
+    63.178409524499187, 63.21491334656325, 63.251438260152675, 63.287984277453901,
+    63.324551410660405, 63.361139671972786, 63.397749073598611, 63.434379627752541,
+    63.471031346656261, 63.50770424253858, 63.544398327635314, 63.581113614189356,
+    63.617850114450711, 63.65460784067642, 63.69138680513062, 63.728187020084555,
+    63.765008497816531, 63.801851250611954, 63.838715290763318, 63.875600630570268,
+    63.912507282339512, 63.949435258384845, 63.986384571027251, 64.023355232594781,
+    64.060347255422613, 64.097360651853052, 64.134395434235557, 64.171451614926696,
+    64.20852920629018, 64.245628220696901, 64.282748670524853, 64.319890568159195,
+    64.357053925992219, 64.394238756423448, 64.4314450718595, 64.468672884714181,
+    64.505922207408489, 64.543193052370569, 64.580485432035772, 64.617799358846625,
+    64.655134845252832, 64.692491903711314, 64.729870546686158, 64.767270786648695,
+    64.804692636077419, 64.842136107458046, 64.879601213283536, 64.917087966054041,
+    64.954596378276932, 64.9921264624668, 65.02967823114551, 65.067251696842106,
+    65.104846872092892, 65.142463769441449, 65.180102401438575, 65.217762780642275,
+    65.255444919617915, 65.293148830938051, 65.330874527182502, 65.368622020938346,
+    65.406391324799998, 65.444182451369088, 65.481995413254538, 65.519830223072603,
+    65.557686893446757, 65.595565437007792, 65.63346586639382, 65.671388194250255,
+    65.70933243322979, 65.747298595992419, 65.785286695205528, 65.823296743543722,
+    65.86132875368898, 65.89938273833063, 65.937458710165274, 65.975556681896919,
+    66.013676666236805, 66.051818675903675, 66.089982723623478, 66.128168822129567,
+    66.166376984162696, 66.204607222470898, 66.242859549809623, 66.281133978941696,
+    66.319430522637276, 66.357749193673968, 66.396090004836651, 66.434452968917725,
+    66.472838098716878, 66.51124540704123, 66.54967490670532, 66.588126610531049,
+    66.626600531347762, 66.665096681992182, 66.70361507530852, 66.742155724148319,
+    66.780718641370555, 66.819303839841737, 66.857911332435705, 66.896541132033775,
+    66.935193251524652, 66.973867703804629, 67.012564501777277, 67.051283658353725,
+    67.090025186452564, 67.128789098999803, 67.16757540892894, 67.206384129180933,
+    67.245215272704286, 67.284068852454865, 67.322944881396126, 67.361843372498981,
+    67.400764338741809, 67.439707793110486, 67.478673748598467, 67.517662218206667,
+    67.556673214943459, 67.595706751824807, 67.634762841874164, 67.673841498122542,
+    67.712942733608401, 67.752066561377831, 67.791212994484411, 67.830382045989239,
+    67.869573728961015, 67.908788056475956, 67.948025041617868, 67.987284697478017,
+    68.026567037155388, 68.065872073756424, 68.105199820395129, 68.144550290193166,
+    68.183923496279746, 68.223319451791653, 68.262738169873217, 68.302179663676469,
+    68.341643946360989, 68.381131031093886, 68.420640931050002, 68.460173659411737,
+    68.49972922936908, 68.539307654119639, 68.578908946868722, 68.618533120829213,
+    68.658180189221596, 68.69785016527409, 68.737543062222471, 68.777258893310176,
+    68.816997671788343, 68.856759410915714, 68.896544123958719, 68.936351824191419,
+    68.97618252489562, 69.01603623936073, 69.055912980883818, 69.095812762769754,
+    69.135735598330967, 69.175681500887634, 69.215650483767604, 69.255642560306512,
+    69.29565774384757, 69.335696047741777, 69.375757485347847, 69.41584207003217,
+    69.455949815168907, 69.496080734139909, 69.536234840334785, 69.576412147150876,
+    69.616612667993223, 69.656836416274686, 69.697083405415825, 69.737353648844945,
+    69.777647159998153, 69.817963952319289, 69.858304039259977, 69.89866743427956,
+    69.939054150845266, 69.979464202431998, 70.019897602522477, 70.060354364607278,
+    70.100834502184654, 70.141338028760771, 70.181864957849484, 70.222415302972593,
+    70.262989077659597, 70.303586295447829, 70.344206969882521, 70.384851114516636,
+    70.425518742911024, 70.46620986863438, 70.506924505263157, 70.547662666381768,
+    70.588424365582355, 70.629209616465033, 70.670018432637704, 70.710850827716101,
+    70.751706815323942, 70.792586409092678, 70.83348962266173, 70.874416469678366,
+    70.915366963797752, 70.956341118682914, 70.99733894800481, 71.038360465442295,
+    71.079405684682087, 71.120474619418843, 71.161567283355154, 71.202683690201468,
+    71.243823853676219, 71.284987787505713, 71.326175505424231, 71.367387021173954,
+    71.408622348505006, 71.449881501175526, 71.491164492951498, 71.532471337606921,
+    71.57380204892371, 71.615156640691822, 71.656535126709102, 71.697937520781366,
+    71.739363836722518, 71.780814088354305, 71.822288289506503, 71.863786454016932,
+    71.905308595731384, 71.946854728503595, 71.988424866195331, 72.030019022676441,
+    72.071637211824694, 72.113279447525898, 72.154945743673949, 72.196636114170687,
+    72.238350572926024, 72.280089133857857, 72.321851810892269, 72.363638617963218,
+    72.405449569012802, 72.447284677991149, 72.489143958856502, 72.531027425575061,
+    72.572935092121199, 72.61486697247733, 72.656823080633913, 72.698803430589507,
+    72.740808036350799, 72.78283691193252, 72.824890071357515, 72.866967528656758,
+    72.909069297869308, 72.951195393042298, 72.993345828231014, 73.035520617498904,
+    73.077719774917469, 73.119943314566356, 73.162191250533411, 73.204463596914536,
+    73.24676036781382, 73.289081577343467, 73.331427239623906, 73.373797368783642,
+    73.416191978959404, 73.458611084296081, 73.501054698946675, 73.543522837072416,
+    73.586015512842778, 73.628532740435276, 73.671074534035753, 73.713640907838112,
+    73.756231876044623, 73.798847452865644, 73.841487652519731, 73.884152489233756,
+    73.926841977242745, 73.96955613078994, 74.012294964126809, 74.055058491513137,
+    74.097846727216847, 74.140659685514137, 74.183497380689488, 74.226359827035594,
+    74.269247038853393, 74.312159030452179, 74.355095816149415, 74.39805741027088,
+    74.441043827150594, 74.484055081130904, 74.527091186562458, 74.570152157804088,
+    74.613238009223068, 74.656348755194884, 74.699484410103352, 74.742644988340558,
+    74.785830504306958, 74.829040972411349, 74.872276407070771, 74.915536822710649,
+    74.958822233764735, 75.002132654675108, 75.045468099892219, 75.088828583874843,
+    75.132214121090101, 75.175624726013496, 75.219060413128886, 75.262521196928532,
+    75.30600709191296, 75.349518112591213, 75.393054273480644, 75.436615589106992,
+    75.480202074004382, 75.523813742715376, 75.567450609790924, 75.611112689790346,
+    75.654799997281458, 75.698512546840391, 75.742250353051759, 75.786013430508618,
+    75.829801793812393, 75.873615457572981, 75.917454436408732, 75.961318744946468,
+    76.005208397821363, 76.049123409677122, 76.093063795165932, 76.137029568948407,
+    76.181020745693615, 76.225037340079098, 76.269079366790947, 76.3131468405237,
+    76.357239775980304, 76.401358187872376, 76.445502090919859, 76.489671499851326,
+    76.533866429403744, 76.578086894322738, 76.622332909362328, 76.666604489285092,
+    76.710901648862205, 76.755224402873282, 76.799572766106508, 76.843946753358679,
+    76.888346379435021, 76.932771659149424, 76.977222607324236, 77.021699238790504,
+    77.066201568387712, 77.110729610963944, 77.155283381375966, 77.199862894489002,
+    77.244468165176912, 77.289099208322142, 77.333756038815793, 77.378438671557504,
+    77.423147121455514, 77.467881403426759, 77.512641532396685, 77.557427523299452,
+    77.602239391077802, 77.647077150683131, 77.691940817075462, 77.736830405223429,
+    77.781745930104407, 77.826687406704352, 77.871654850017862, 77.916648275048246,
+    77.96166769680751, 78.006713130316243, 78.051784590603759, 78.096882092708114,
+    78.14200565167593, 78.1871552825626, 78.232331000432254, 78.277532820357635,
+    78.322760757420227, 78.368014826710265, 78.413295043326684, 78.458601422377114,
+    78.503933978977926, 78.549292728254258, 78.594677685339946, 78.640088865377592,
+    78.685526283518556, 78.730989954922919, 78.776479894759561, 78.821996118206073,
+    78.867538640448885, 78.913107476683152, 78.958702642112797, 79.004324151950598,
+    79.049972021418071, 79.095646265745486, 79.14134690017201, 79.187073939945563,
+    79.232827400322847, 79.278607296569405, 79.324413643959659, 79.370246457776759,
+    79.416105753312721, 79.461991545868443, 79.507903850753607, 79.553842683286746,
+    79.599808058795247, 79.645799992615409, 79.691818500092324, 79.737863596579928,
+    79.783935297441147, 79.830033618047651, 79.876158573780103, 79.922310180027921,
+    79.968488452189575, 80.014693405672304, 80.060925055892298, 80.107183418274658,
+    80.153468508253425, 80.199780341271449, 80.246118932780647, 80.29248429824176,
+    80.338876453124527, 80.385295412907524, 80.431741193078423, 80.47821380913372,
+    80.524713276578908, 80.571239610928458, 80.61779282770577, 80.664372942443251,
+    80.710979970682189, 80.757613927973026, 80.804274829875027, 80.850962691956482,
+    80.897677529794763, 80.944419358976148, 80.99118819509593, 81.037984053758464,
+    81.084806950577089, 81.131656901174168, 81.178533921181057, 81.225438026238237,
+    81.272369231995114, 81.319327554110203, 81.366313008251069, 81.413325610094319,
+    81.460365375325566, 81.507432319639534, 81.554526458740042, 81.601647808339976,
+    81.648796384161201, 81.695972201934808, 81.743175277400894, 81.790405626308626,
+    81.837663264416392, 81.884948207491547, 81.932260471310627, 81.979600071659249,
+    82.026967024332222, 82.074361345133411, 82.121783049875816, 82.169232154381604,
+    82.216708674482092, 82.264212626017695, 82.311744024837992, 82.359302886801771,
+    82.406889227776944, 82.454503063640558, 82.50214441027893, 82.549813283587483,
+    82.597509699470791, 82.645233673842711, 82.692985222626234, 82.740764361753563,
+    82.788571107166092, 82.836405474814498, 82.884267480658579, 82.932157140667371,
+    82.980074470819218, 83.028019487101602, 83.075992205511298, 83.123992642054247,
+    83.172020812745785, 83.220076733610355, 83.26816042068171, 83.316271890002909,
+    83.364411157626236, 83.412578239613254, 83.460773152034761, 83.508995910970967,
+    83.557246532511257, 83.605525032754358, 83.653831427808299, 83.702165733790409,
+    83.750527966827292, 83.798918143054948, 83.84733627861867, 83.89578238967303,
+    83.944256492381982, 83.99275860291884, 84.041288737466203, 84.089846912216046,
+    84.138433143369724, 84.187047447137942, 84.235689839740743, 84.284360337407534,
+    84.333058956377187, 84.381785712897866, 84.430540623227117, 84.479323703631977,
+    84.528134970388791, 84.576974439783328, 84.62584212811079, 84.674738051675789,
+    84.723662226792342, 84.772614669783863, 84.821595396983284, 84.870604424732917,
+    84.919641769384469, 84.968707447299238, 85.017801474847815, 85.066923868410356,
+    85.116074644376397, 85.165253819145079, 85.21446140912488, 85.263697430733757,
+    85.312961900399316, 85.362254834558499, 85.411576249657742, 85.460926162153115,
+    85.510304588510081, 85.559711545203626, 85.609147048718285, 85.658611115548169,
+    85.708103762196799, 85.757625005177289, 85.807174861012356, 85.856753346234186,
+    85.90636047738451, 85.955996271014641, 86.00566074368551, 86.055353911967529,
+    86.105075792440715, 86.154826401694706, 86.204605756328675, 86.254413872951346,
+    86.304250768181191, 86.354116458646132, 86.404010960983769, 86.45393429184125,
+    86.503886467875475, 86.553867505752834, 86.603877422149381, 86.653916233750863,
+    86.703983957252618, 86.754080609359619, 86.804206206786517, 86.854360766257628,
+    86.904544304506899, 86.954756838277959, 87.004998384324153, 87.055268959408451,
+    87.105568580303512, 87.155897263791701, 87.20625502666509, 87.256641885725458,
+    87.307057857784216, 87.357502959662625, 87.407977208191582, 87.458480620211631,
+    87.509013212573237, 87.559575002136441, 87.610166005771077, 87.660786240356714,
+    87.711435722782753, 87.762114469948258, 87.812822498762031, 87.86355982614279,
+    87.914326469018903, 87.965122444328543, 88.015947769019661, 88.066802460050098,
+    88.11768653438736, 88.168600009008799, 88.219542900901658, 88.270515227062873,
+    88.321517004499228, 88.372548250227453, 88.423608981273944, 88.474699214675056,
+    88.525818967476866, 88.576968256735455, 88.628147099516639, 88.679355512896137,
+    88.730593513959533, 88.781861119802301, 88.833158347529732, 88.884485214257055,
+    88.935841737109385, 88.987227933221718, 89.038643819738923, 89.090089413815846,
+    89.141564732617198, 89.193069793317562, 89.244604613101558, 89.296169209163665,
+    89.347763598708269, 89.399387798949718, 89.451041827112391, 89.502725700430517,
+    89.554439436148257, 89.606183051519878, 89.657956563809492, 89.709759990291218,
+    89.761593348249136, 89.813456654977415, 89.865349927780088, 89.917273183971204,
+    89.969226440874948, 90.02120971582535, 90.073223026166502, 90.125266389252602,
+    90.177339822447792, 90.229443343126249, 90.281576968672169, 90.333740716479909,
+    90.385934603953743, 90.438158648508036, 90.490412867567301, 90.542697278565996,
+    90.595011898948727, 90.647356746170146, 90.699731837695012, 90.752137190998198,
+    90.80457282356457, 90.857038752889224, 90.909534996477305, 90.962061571844046,
+    91.014618496514828, 91.067205788025234, 91.119823463920838, 91.172471541757389,
+    91.225150039100896, 91.277858973527401, 91.330598362623064, 91.383368223984377,
+    91.436168575217849, 91.488999433940194, 91.541860817778314, 91.59475274436933,
+    91.647675231360537, 91.700628296409334, 91.753611957183494, 91.80662623136088,
+    91.859671136629572, 91.912746690687868, 91.965852911244397, 92.018989816017879,
+    92.072157422737334, 92.125355749142074, 92.178584812981569, 92.231844632015566,
+    92.285135224014155, 92.338456606757589, 92.39180879803645, 92.445191815651555,
+    92.498605677414105, 92.552050401145479, 92.605526004677372, 92.659032505851883,
+    92.712569922521297, 92.766138272548275, 92.819737573805753, 92.873367844177068,
+    92.92702910155586, 92.980721363846044, 93.03444464896198, 93.088198974828316,
+    93.141984359380032, 93.195800820562582, 93.249648376331692, 93.303527044653478,
+    93.357436843504416, 93.41137779087147, 93.465349904751875, 93.519353203153287,
+    93.573387704093875, 93.627453425602098, 93.681550385716875, 93.735678602487511,
+    93.789838093973842, 93.844028878246036, 93.898250973384691, 93.952504397480979,
+    94.006789168636402, 94.061105304962936, 94.115452824583087, 94.169831745629821,
+    94.224242086246477, 94.278683864586966, 94.333157098815747, 94.387661807107634,
+    94.442198007648017, 94.49676571863283, 94.551364958268422, 94.605995744771761,
+    94.660658096370241, 94.715352031301904, 94.770077567815264, 94.824834724169321,
+    94.879623518633736, 94.934443969488697, 94.989296095024898, 95.044179913543616,
+    95.099095443356774, 95.154042702786825, 95.209021710166738, 95.264032483840239,
+    95.319075042161515, 95.374149403495352, 95.429255586217309, 95.484393608713376,
+    95.539563489380242, 95.594765246625215, 95.649998898866315, 95.705264464532064,
+    95.760561962061715, 95.815891409905205, 95.871252826523047, 95.926646230386481,
+    95.982071639977391, 96.037529073788363, 96.093018550322668, 96.148540088094208,
+    96.204093705627685, 96.259679421458429, 96.31529725413246, 96.37094722220661,
+    96.426629344248369, 96.482343638835943, 96.538090124558252, 96.593868820015089,
+    96.649679743816833, 96.705522914584677, 96.761398350950628, 96.817306071557397,
+    96.873246095058448, 96.929218440118063, 96.985223125411338, 97.041260169624096,
+    97.097329591452947, 97.153431409605389, 97.209565642799674, 97.265732309764815,
+    97.321931429240777, 97.37816301997826, 97.434427100738802, 97.490723690294757,
+    97.547052807429466, 97.603414470936954, 97.659808699622175, 97.716235512300983,
+    97.772694927800032, 97.829186964956918, 97.885711642620038, 97.942268979648816,
+    97.998858994913434, 98.055481707295016, 98.112137135685686, 98.168825298988367,
+    98.225546216116925, 98.282299905996226, 98.339086387561991, 98.395905679760929,
+    98.452757801550632, 98.509642771899763, 98.566560609787842, 98.623511334205361,
+    98.680494964153866, 98.737511518645803, 98.794561016704634, 98.851643477364746,
+    98.908758919671683, 98.965907362681847, 99.023088825462665, 99.080303327092665,
+    99.137550886661344, 99.194831523269215, 99.252145256027816, 99.309492104059814,
+    99.366872086498844, 99.424285222489573, 99.481731531187862, 99.539211031760487,
+    99.596723743385382, 99.654269685251549, 99.711848876559088, 99.769461336519157,
+    99.827107084354012, 99.884786139297091, 99.942498520592849, 100.00024424749692,
+    100.05802333927605, 100.11583581520811, 100.17368169458211, 100.23156099669818,
+    100.28947374086771, 100.3474199464131, 100.40539963266797, 100.46341281897719,
+    100.52145952469668, 100.57953976919362, 100.63765357184639, 100.69580095204451,
+    100.75398192918874, 100.81219652269102, 100.87044475197457, 100.9287266364738,
+    100.98704219563429, 101.04539144891294, 101.10377441577785, 101.1621911157084,
+    101.22064156819513, 101.27912579273999, 101.3376438088561, 101.39619563606782,
+    101.45478129391094, 101.51340080193238, 101.57205417969041, 101.63074144675467,
+    101.68946262270602, 101.74821772713662, 101.80700677965, 101.86582979986105,
+    101.92468680739591, 101.9835778218921, 102.04250286299852, 102.10146195037537,
+    102.1604551036942, 102.21948234263796, 102.27854368690102, 102.33763915618904,
+    102.39676877021905, 102.45593254871963, 102.51513051143057, 102.57436267810317,
+    102.63362906850013, 102.69292970239556, 102.752264599575, 102.81163377983536,
+    102.87103726298511, 102.93047506884409, 102.98994721724355, 103.04945372802632,
+    103.10899462104659, 103.16856991617007, 103.22817963327388, 103.28782379224675,
+    103.34750241298882, 103.40721551541166, 103.46696311943855, 103.52674524500407,
+    103.58656191205441, 103.64641314054727, 103.70629895045194, 103.76621936174917,
+    103.82617439443122, 103.88616406850207, 103.94618840397709, 104.00624742088327,
+    104.06634113925921, 104.12646957915504, 104.18663276063249, 104.24683070376484,
+    104.30706342863708, 104.36733095534572, 104.42763330399885, 104.48797049471625,
+    104.54834254762932, 104.60874948288105, 104.66919132062607, 104.72966808103071,
+    104.79017978427291, 104.85072645054224, 104.91130810004003, 104.97192475297919,
+    105.03257642958431, 105.09326315009174, 105.15398493474949, 105.21474180381723,
+    105.27553377756632, 105.33636087627997, 105.39722312025299, 105.45812052979186,
+    105.51905312521497, 105.58002092685234, 105.64102395504572, 105.70206223014864,
+    105.76313577252644, 105.82424460255615, 105.88538874062658, 105.94656820713841,
+    106.007783022504, 106.06903320714753, 106.13031878150504, 106.19163976602432,
+    106.25299618116499, 106.31438804739847, 106.37581538520806, 106.43727821508887,
+    106.49877655754777, 106.56031043310367, 106.62187986228716, 106.68348486564075,
+    106.74512546371879, 106.80680167708762, 106.86851352632534, 106.93026103202195,
+    106.99204421477943, 107.0538630952116, 107.11571769394413, 107.1776080316148,
+    107.23953412887313, 107.30149600638063, 107.36349368481073, 107.4255271848489,
+    107.48759652719244, 107.54970173255063, 107.61184282164481, 107.6740198152082,
+    107.73623273398601, 107.79848159873544, 107.86076643022575, 107.92308724923811,
+    107.9854440765657, 108.04783693301381, 108.11026583939967, 108.17273081655254,
+    108.23523188531371, 108.29776906653657, 108.36034238108654, 108.422951849841,
+    108.48559749368954, 108.54827933353376, 108.61099739028722, 108.6737516848758,
+    108.73654223823726, 108.79936907132161, 108.86223220509076, 108.92513166051901,
+    108.98806745859258, 109.05103962030984, 109.11404816668136, 109.17709311872979,
+    109.24017449748997, 109.30329232400882, 109.36644661934554, 109.42963740457139,
+    109.49286470076984, 109.55612852903658, 109.61942891047944, 109.68276586621843,
+    109.74613941738586, 109.80954958512615, 109.87299639059594, 109.93647985496416,
+    109.99999999941194, 110.06355684513264, 110.12715041333185, 110.19078072522747,
+    110.2544478020496, 110.31815166504063, 110.38189233545519, 110.44566983456031,
+    110.50948418363514, 110.57333540397121, 110.63722351687241, 110.70114854365484,
+    110.7651105056469, 110.82910942418947, 110.8931453206356, 110.95721821635074,
+    111.02132813271263, 111.0854750911115, 111.14965911294982, 111.21388021964241,
+    111.27813843261659, 111.34243377331192, 111.40676626318042, 111.47113592368648,
+    111.53554277630694, 111.59998684253101, 111.66446814386025, 111.72898670180882,
+    111.79354253790314, 111.85813567368211, 111.92276613069716, 111.98743393051208,
+    112.05213909470314, 112.11688164485908, 112.18166160258113, 112.24647898948299,
+    112.31133382719082, 112.37622613734337, 112.44115594159177, 112.50612326159973,
+    112.57112811904344, 112.63617053561167, 112.70125053300568, 112.76636813293923,
+    112.83152335713875, 112.89671622734312, 112.96194676530379, 113.02721499278478,
+    113.09252093156273, 113.15786460342683, 113.22324603017883, 113.28866523363314,
+    113.35412223561676, 113.41961705796922, 113.48514972254279, 113.55072025120229,
+    113.61632866582519, 113.68197498830156, 113.74765924053426, 113.81338144443862,
+    113.87914162194271, 113.94493979498735, 114.01077598552594, 114.07665021552457,
+    114.14256250696199, 114.20851288182982, 114.27450136213218, 114.34052796988598,
+    114.40659272712094, 114.47269565587938, 114.53883677821636, 114.60501611619982,
+    114.67123369191033, 114.73748952744123, 114.8037836448986, 114.87011606640142,
+    114.93648681408135, 115.00289591008277, 115.06934337656305, 115.1358292356922,
+    115.20235350965308, 115.26891622064136, 115.33551739086562, 115.40215704254715,
+    115.46883519792009, 115.53555187923156, 115.60230710874144, 115.66910090872237,
+    115.73593330146007, 115.80280430925299, 115.86971395441253, 115.93666225926286,
+    116.00364924614128, 116.07067493739778, 116.13773935539533, 116.20484252250989,
+    116.27198446113026, 116.33916519365822, 116.40638474250845, 116.47364313010866,
+    116.54094037889946, 116.6082765113344, 116.67565154988011, 116.74306551701609,
+    116.81051843523484, 116.87801032704196, 116.94554121495595, 117.01311112150835,
+    117.08072006924367, 117.14836808071956, 117.21605517850665, 117.28378138518852,
+    117.35154672336198, 117.41935121563672, 117.4871948846356, 117.55507775299448,
+    117.62299984336241, 117.69096117840142, 117.75896178078663, 117.82700167320638,
+    117.89508087836199, 117.96319941896795, 118.03135731775184, 118.09955459745449,
+    118.1677912808297, 118.23606739064451, 118.30438294967915, 118.37273798072692,
+    118.44113250659433, 118.50956655010113, 118.57804013408015, 118.64655328137748,
+    118.71510601485232, 118.78369835737728, 118.85233033183796, 118.92100196113326,
+    118.98971326817539, 119.05846427588973, 119.1272550072149, 119.19608548510273,
+    119.26495573251843, 119.33386577244043, 119.40281562786033, 119.47180532178324,
+    119.54083487722734, 119.60990431722419, 119.67901366481871, 119.74816294306909,
+    119.81735217504682, 119.88658138383674, 119.95585059253706, 120.0251598242593,
+    120.0945091021283, 120.16389844928237, 120.23332788887312, 120.30279744406548,
+    120.37230713803784, 120.441856993982, 120.51144703510312, 120.58107728461971,
+    120.65074776576385, 120.72045850178093, 120.79020951592972, 120.86000083148259,
+    120.92983247172525, 120.99970445995686, 121.06961681949004, 121.13956957365096,
+    121.20956274577919, 121.2795963592278, 121.34967043736337, 121.41978500356598,
+    121.48994008122919, 121.56013569376009, 121.63037186457933, 121.70064861712108,
+    121.77096597483293, 121.84132396117626, 121.91172259962578, 121.98216191366984,
+    122.05264192681047, 122.12316266256308, 122.19372414445681, 122.26432639603431,
+    122.33496944085194, 122.40565330247959, 122.47637800450072, 122.54714357051259,
+    122.61795002412592, 122.68879738896513, 122.75968568866827, 122.83061494688718,
+    122.90158518728718, 122.97259643354732, 123.04364870936044, 123.11474203843295,
+    123.18587644448498, 123.25705195125033, 123.32826858247667, 123.39952636192521,
+    123.47082531337095, 123.54216546060269, 123.61354682742291, 123.68496943764779,
+    123.75643331510743, 123.82793848364557, 123.89948496711975, 123.97107278940128,
+    124.04270197437535, 124.11437254594087, 124.18608452801053, 124.25783794451095,
+    124.32963281938251, 124.40146917657937, 124.47334704006957, 124.5452664338351,
+    124.61722738187166, 124.68922990818884, 124.76127403681021, 124.83335979177311,
+    124.90548719712875, 124.97765627694238, 125.04986705529302, 125.12211955627367,
+    125.19441380399117, 125.26674982256641, 125.33912763613414, 125.41154726884299,
+    125.48400874485576, 125.55651208834898, 125.62905732351327, 125.70164447455315,
+    125.77427356568724, 125.84694462114807, 125.91965766518213, 125.99241272205008,
+    126.06520981602642, 126.13804897139973, 126.21093021247272, 126.28385356356202,
+    126.35681904899837, 126.4298266931265, 126.50287652030535, 126.5759685549078,
+    126.64910282132081, 126.72227934394557, 126.79549814719722, 126.86875925550508,
+    126.94206269331252, 127.01540848507716, 127.08879665527063, 127.16222722837871,
+    127.23570022890142, 127.30921568135284, 127.38277361026124, 127.45637404016911,
+    127.53001699563306, 127.60370250122391, 127.67743058152664, 127.75120126114054,
+    127.82501456467902, 127.89887051676969, 127.9727691420545, 128.04671046518956,
+    128.12069451084523, 128.1947213037061, 128.26879086847111, 128.34290322985339,
+    128.41705841258036, 128.4912564413938, 128.56549734104971, 128.63978113631839,
+    128.71410785198444, 128.7884775128469, 128.862890143719, 128.93734576942836,
+    129.01184441481698, 129.08638610474114, 129.16097086407154, 129.23559871769325,
+    129.31026969050566, 129.38498380742263, 129.45974109337232, 129.53454157329739,
+    129.60938527215484, 129.68427221491609, 129.75920242656707, 129.83417593210808,
+    129.90919275655386, 129.9842529249336, 130.05935646229102, 130.13450339368421,
+    130.20969374418578, 130.2849275388829, 130.36020480287715, 130.43552556128455,
+    130.51088983923583, 130.5862976618761, 130.661749054365, 130.73724404187669,
+    130.8127826496, 130.88836490273818, 130.96399082650913, 131.03966044614523,
+    131.11537378689346, 131.19113087401556, 131.26693173278764, 131.34277638850051,
+    131.41866486645958, 131.49459719198489, 131.57057339041108, 131.64659348708742,
+    131.72265750737796, 131.79876547666126, 131.87491742033055, 131.95111336379384,
+    132.02735333247367, 132.10363735180741, 132.17996544724693, 132.25633764425913,
+    132.33275396832539, 132.4092144449418, 132.48571909961925, 132.56226795788342,
+    132.63886104527452, 132.71549838734791, 132.7921800096733, 132.86890593783545,
+    132.94567619743376, 133.02249081408252, 133.0993498134107, 133.17625322106207,
+    133.2532010626955, 133.33019336398436, 133.40723015061704, 133.48431144829664,
+    133.56143728274114, 133.63860767968353, 133.71582266487138, 133.79308226406752,
+    133.8703865030493, 133.94773540760926, 134.02512900355455, 134.10256731670751,
+    134.18005037290516, 134.25757819799955, 134.33515081785782, 134.41276825836187,
+    134.49043054540857, 134.56813770490973, 134.64588976279231, 134.72368674499799,
+    134.80152867748356, 134.87941558622097, 134.95734749719693, 135.03532443641333,
+    135.11334642988692, 135.19141350364964, 135.2695256837483, 135.34768299624506,
+    135.4258854672168, 135.50413312275566, 135.58242598896882, 135.66076409197848,
+    135.73914745792206, 135.81757611295188, 135.89605008323571, 135.97456939495603,
+    136.05313407431078, 136.13174414751285, 136.21039964079029, 136.28910058038639,
+    136.36784699255946, 136.44663890358325, 136.52547633974643, 136.60435932735294,
+    136.68328789272198, 136.76226206218783, 136.84128186210006, 136.92034731882342,
+    136.9994584587381, 137.07861530823928, 137.15781789373744, 137.23706624165843,
+    137.31636037844325, 137.39570033054824, 137.47508612444489, 137.55451778662035,
+    137.63399534357669, 137.71351882183143, 137.79308824791744, 137.8727036483829,
+    137.9523650497913, 138.03207247872143, 138.11182596176764, 138.19162552553951,
+    138.27147119666193, 138.35136300177527, 138.43130096753526, 138.511285120613,
+    138.59131548769511, 138.67139209548355, 138.75151497069569, 138.83168414006434,
+    138.91189963033784, 138.99216146827987, 139.07246968066954, 139.15282429430169,
+    139.23322533598645, 139.31367283254937, 139.39416681083165, 139.47470729768992,
+    139.55529431999636, 139.63592790463855, 139.7166080785199, 139.79733486855912,
+    139.87810830169053, 139.958928404864, 140.03979520504501, 140.12070872921458,
+    140.20166900436928, 140.28267605752151, 140.36372991569897, 140.44483060594519,
+    140.52597815531919, 140.60717259089571, 140.6884139397651, 140.76970222903324,
+    140.85103748582205, 140.93241973726876, 141.01384901052631, 141.09532533276354,
+    141.17684873116477, 141.25841923293004, 141.34003686527535, 141.4217016554322,
+    141.50341363064788, 141.58517281818536, 141.66697924532346, 141.74883293935676,
+    141.83073392759542, 141.9126822373658, 141.99467789600962, 142.07672093088459,
+    142.15881136936417, 142.24094923883774, 142.32313456671034, 142.40536738040291,
+    142.48764770735241, 142.56997557501143, 142.65235101084846, 142.73477404234791,
+    142.81724469701007, 142.89976300235108, 142.98232898590294, 143.06494267521381,
+    143.14760409784742, 143.23031328138364, 143.3130702534182, 143.39587504156282,
+    143.47872767344509, 143.56162817670855, 143.64457657901301, 143.72757290803386,
+    143.81061719146277, 143.89370945700719, 143.97684973239072, 144.06003804535291,
+    144.14327442364933, 144.2265588950518, 144.3098914873479, 144.39327222834137,
+    144.47670114585205, 144.56017826771577, 144.64370362178448, 144.72727723592638,
+    144.8108991380256, 144.8945693559823, 144.978287917713, 145.06205485115018,
+    145.14587018424245, 145.2297339449546, 145.3136461612678, 145.39760686117901,
+    145.4816160727016, 145.56567382386504, 145.64978014271506, 145.73393505731357,
+    145.81813859573856, 145.90239078608457, 145.98669165646203, 146.07104123499781,
+    146.15543954983494, 146.23988662913277, 146.32438250106685, 146.40892719382904,
+    146.49352073562758, 146.57816315468693, 146.66285447924781, 146.74759473756728,
+    146.83238395791886, 146.91722216859219, 147.00210939789329, 147.08704567414483,
+    147.17203102568556, 147.25706548087055, 147.34214906807151, 147.42728181567628,
+    147.51246375208919, 147.59769490573123, 147.68297530503946, 147.76830497846751,
+    147.85368395448549, 147.93911226157988, 148.02458992825368, 148.11011698302622,
+    148.19569345443364, 148.28131937102827, 148.36699476137898, 148.45271965407119,
+    148.53849407770684, 148.62431806090441, 148.7101916322988, 148.7961148205417,
+    148.88208765430119, 148.96811016226181, 149.05418237312492, 149.1403043156082,
+    149.22647601844616, 149.31269751038974, 149.39896882020665, 149.48528997668112,
+    149.57166100861392, 149.6580819448227, 149.74455281414157, 149.83107364542133,
+    149.91764446752944, 150.00426530935022, 150.09093619978444, 150.17765716774969,
+    150.2644282421802, 150.35124945202702, 150.43812082625783, 150.52504239385701,
+    150.61201418382592, 150.69903622518243, 150.78610854696129, 150.87323117821398,
+    150.96040414800879, 151.0476274854307, 151.13490121958179, 151.22222537958069,
+    151.30959999456292, 151.39702509368078, 151.48450070610357, 151.57202686101726,
+    151.65960358762473, 151.74723091514593, 151.83490887281746, 151.92263748989294,
+    152.01041679564273, 152.0982468193543, 152.18612759033192, 152.27405913789676,
+    152.36204149138717, 152.4500746801582, 152.53815873358189, 152.6262936810474,
+    152.71447955196066, 152.80271637574478, 152.89100418183969, 152.9793429997026,
+    153.06773285880749, 153.15617378864548, 153.24466581872466, 153.33320897857024,
+    153.42180329772447, 153.51044880574653, 153.59914553221302, 153.68789350671736,
+    153.77669275887004, 153.86554331829885, 153.95444521464853, 154.04339847758098,
+    154.13240313677539, 154.22145922192789, 154.31056676275193, 154.399725788978,
+    154.48893633035382, 154.57819841664434, 154.66751207763153, 154.75687734311498,
+    154.84629424291103, 154.93576280685352, 155.02528306479337, 155.11485504659893,
+    155.20447878215566, 155.29415430136621, 155.38388163415087, 155.47366081044686,
+    155.56349186020881, 155.6533748134087, 155.74330970003575, 155.83329655009658,
+    155.92333539361496, 156.01342626063246, 156.10356918120752, 156.19376418541623,
+    156.28401130335186, 156.37431056512526, 156.46466200086456, 156.55506564071521,
+    156.64552151484045, 156.73602965342053, 156.82659008665337, 156.91720284475423,
+    157.00786795795591, 157.09858545650857, 157.18935537067986, 157.28017773075518,
+    157.37105256703711, 157.46197990984584, 157.55295978951912, 157.6439922364122,
+    157.73507728089771, 157.82621495336625, 157.91740528422559, 158.0086483039012,
+    158.09994404283614, 158.19129253149103, 158.28269380034405, 158.37414787989104,
+    158.46565480064564, 158.55721459313881, 158.64882728791932, 158.74049291555352,
+    158.83221150662547, 158.92398309173694, 159.01580770150716, 159.10768536657343,
+    159.19961611759049, 159.29159998523082, 159.38363700018465, 159.47572719315991,
+    159.56787059488235, 159.66006723609527, 159.75231714756015, 159.84462036005584,
+    159.93697690437915, 160.02938681134461, 160.12185011178465, 160.21436683654937,
+    160.30693701650679, 160.3995606825429, 160.49223786556129, 160.58496859648352,
+    160.67775290624905, 160.77059082581511, 160.86348238615682, 160.95642761826741,
+    161.04942655315782, 161.14247922185692, 161.23558565541154, 161.3287458848865,
+    161.42195994136443, 161.51522785594599, 161.60854965975, 161.70192538391296,
+    161.79535505958953, 161.8888387179523, 161.98237639019189, 162.07596810751699,
+    162.16961390115412, 162.26331380234831, 162.35706784236211, 162.45087605247647,
+    162.54473846399023, 162.63865510822046, 162.73262601650222, 162.82665122018858,
+    162.92073075065107, 163.01486463927907, 163.10905291748008, 163.20329561667995,
+    163.29759276832243, 163.39194440386967, 163.48635055480173, 163.58081125261725,
+    163.67532652883278, 163.76989641498309, 163.86452094262125, 163.95920014331855,
+    164.0539340486645, 164.14872269026679, 164.24356609975163, 164.33846430876321,
+    164.43341734896418, 164.52842525203539, 164.62348804967601, 164.71860577360351,
+    164.81377845555386, 164.90900612728112, 165.00428882055786, 165.09962656717497,
+    165.19501939894161, 165.29046734768548, 165.38597044525241, 165.4815287235071,
+    165.57714221433218, 165.672810949629, 165.76853496131716, 165.8643142813348,
+    165.96014894163849, 166.05603897420318, 166.15198441102254, 166.24798528410849,
+    166.34404162549157, 166.44015346722071, 166.53632084136345, 166.63254378000588,
+    166.72882231525242, 166.82515647922642, 166.92154630406952, 167.01799182194193,
+    167.11449306502251, 167.21105006550877, 167.30766285561666, 167.40433146758076,
+    167.50105593365458, 167.5978362861099, 167.69467255723734, 167.79156477934606,
+    167.88851298476402, 167.98551720583762, 168.08257747493238, 168.17969382443209,
+    168.27686628673945, 168.37409489427588, 168.47137967948149, 168.56872067481513,
+    168.66611791275434, 168.76357142579567, 168.86108124645423, 168.95864740726395,
+    169.05626994077758, 169.15394887956671, 169.25168425622164, 169.34947610335152,
+    169.44732445358463, 169.54522933956773, 169.64319079396657, 169.74120884946583,
+    169.839283538769, 169.93741489459853, 170.03560294969557, 170.13384773682066,
+    170.23214928875279, 170.33050763829016, 170.42892281824976, 170.52739486146757,
+    170.62592380079869, 170.72450966911694, 170.82315249931548, 170.92185232430623,
+    171.02060917702016, 171.11942309040725, 171.21829409743663, 171.31722223109639,
+    171.41620752439354, 171.51525001035458, 171.61434972202471, 171.71350669246837,
+    171.81272095476902, 171.91199254202934, 172.01132148737096, 172.11070782393503,
+    172.21015158488143, 172.30965280338941, 172.40921151265735, 172.50882774590275,
+    172.60850153636244, 172.70823291729224, 172.80802192196748, 172.9078685836825,
+    173.00777293575095, 173.10773501150567, 173.20775484429882, 173.30783246750178,
+    173.40796791450518, 173.50816121871918, 173.60841241357303, 173.70872153251526,
+    173.8090886090138, 173.90951367655597, 174.00999676864836, 174.11053791881685,
+    174.21113716060697, 174.3117945275834, 174.41251005333018, 174.51328377145092,
+    174.61411571556849, 174.71500591932531, 174.81595441638308, 174.91696124042326,
+    175.01802642514647, 175.11915000427288, 175.22033201154215, 175.32157248071348,
+    175.42287144556548, 175.52422893989646, 175.62564499752406, 175.72711965228558,
+    175.82865293803781, 175.93024488865709, 176.03189553803938, 176.13360492010014,
+    176.23537306877466, 176.3372000180176, 176.43908580180332, 176.54103045412575,
+    176.64303400899854, 176.74509650045496, 176.84721796254786, 176.94939842935005,
+    177.05163793495373, 177.15393651347091, 177.25629419903328, 177.35871102579233,
+    177.46118702791912, 177.56372223960454, 177.66631669505941, 177.76897042851411,
+    177.87168347421877, 177.97445586644344, 178.07728763947787, 178.18017882763175,
+    178.28312946523434, 178.38613958663512, 178.48920922620312, 178.59233841832733,
+    178.69552719741654, 178.79877559789949, 178.90208365422484, 179.00545140086098,
+    179.10887887229651, 179.21236610303976, 179.31591312761898, 179.41951998058244,
+    179.52318669649833, 179.62691330995477, 179.73069985556012, 179.83454636794241,
+    179.9384528817499, 180.0424194316507, 180.14644605233306, 180.25053277850526,
+    180.35467964489555, 180.45888668625244, 180.56315393734434, 180.66748143295982,
+    180.77186920790749, 180.87631729701613, 180.98082573513466, 181.08539455713193,
+    181.1900237978974, 181.29471349234029, 181.39946367539002, 181.5042743819964,
+    181.6091456471292, 181.7140775057785, 181.81906999295455, 181.92412314368804,
+    182.02923699302966, 182.13441157605047, 182.23964692784168, 182.34494308351483,
+    182.45030007820185, 182.55571794705475, 182.66119672524613, 182.76673644796875,
+    182.8723371504357, 182.97799886788039, 183.08372163555669, 183.1895054887386,
+    183.29535046272102, 183.40125659281867, 183.50722391436699, 183.61325246272176,
+    183.71934227325914, 183.82549338137579, 183.93170582248874, 184.0379796320357,
+    184.14431484547467, 184.25071149828415, 184.35716962596314, 184.46368926403119,
+    184.57027044802837, 184.67691321351512, 184.78361759607284, 184.89038363130311,
+    184.99721135482821, 185.10410080229096, 185.2110520093548, 185.31806501170382,
+    185.42513984504254, 185.53227654509649, 185.63947514761151, 185.74673568835414,
+    185.85405820311172, 185.96144272769214, 186.06888929792402, 186.17639794965658,
+    186.28396871876006, 186.39160164112516, 186.49929675266338, 186.60705408930696,
+    186.71487368700889, 186.822755581743, 186.93069980950369, 187.03870640630657,
+    187.14677540818775, 187.2549068512042, 187.36310077143375, 187.47135720497508,
+    187.57967618794763, 187.68805775649201, 187.79650194676938, 187.90500879496196,
+    188.0135783372728, 188.12221060992593, 188.23090564916623, 188.33966349125959,
+    188.4484841724929, 188.55736772917393, 188.66631419763149, 188.77532361421527,
+    188.88439601529609, 188.99353143726572, 189.10272991653679, 189.21199148954346,
+    189.32131619274048, 189.43070406260381, 189.54015513563053, 189.6496694483387,
+    189.75924703726753, 189.86888793897734, 189.97859219004974, 190.08835982708723,
+    190.19819088671355, 190.30808540557365, 190.41804342033353, 190.52806496768054,
+    190.63815008432294, 190.7482988069907, 190.85851117243462, 190.96878721742675,
+    191.07912697876048, 191.18953049325052, 191.29999779773257, 191.41052892906407,
+    191.52112392412343, 191.63178281981041, 191.74250565304609, 191.85329246077296,
+    191.96414327995484, 192.07505814757667, 192.18603710064528, 192.29708017618842,
+    192.40818741125537, 192.51935884291686, 192.63059450826498, 192.74189444441328,
+    192.85325868849665, 192.96468727767183, 193.0761802491165, 193.18773764003018,
+    193.29935948763367, 193.41104582916941, 193.52279670190131, 193.63461214311474,
+    193.74649219011684, 193.85843688023613, 193.97044625082268, 194.08252033924819,
+    194.19465918290595, 194.30686281921083, 194.41913128559926, 194.53146461952963,
+    194.64386285848155, 194.75632603995652, 194.8688542014776, 194.98144738058957,
+    195.09410561485899, 195.20682894187385, 195.31961739924435, 195.43247102460197,
+    195.54538985560006, 195.65837392991384, 195.77142328524013, 195.88453795929757,
+    195.99771798982681, 196.11096341459003, 196.22427427137137, 196.33765059797673,
+    196.45109243223391, 196.56459981199251, 196.67817277512393, 196.7918113595218,
+    196.90551560310126, 197.01928554379953, 197.13312121957568, 197.24702266841081,
+    197.36098992830782, 197.47502303729155, 197.58912203340918, 197.70328695472949,
+    197.81751783934337, 197.93181472536369, 198.04617765092539, 198.16060665418539,
+    198.27510177332263, 198.38966304653837, 198.50429051205563, 198.61898420811963,
+    198.73374417299769, 198.8485704449792, 198.96346306237578, 199.07842206352092,
+    199.19344748677076, 199.3085393705031, 199.42369775311818, 199.53892267303831,
+    199.65421416870811, 199.76957227859413, 199.88499704118564, 200.00048849499385,
+    200.1160466785521, 200.23167163041623, 200.34736338916423, 200.46312199339647,
+    200.57894748173536, 200.69483989282614, 200.81079926533593, 200.92682563795438,
+    201.04291904939336, 201.15907953838729, 201.27530714369283, 201.39160190408896,
+    201.50796385837742, 201.62439304538205, 201.74088950394915, 201.85745327294759,
+    201.97408439126863, 202.09078289782593, 202.20754883155564, 202.32438223141673,
+    202.44128313639027, 202.55825158547998, 202.6752876177122, 202.79239127213572,
+    202.90956258782194, 203.0268016038647, 203.14410835938082, 203.26148289350934,
+    203.37892524541203, 203.49643545427324, 203.61401355930008, 203.73165959972215,
+    203.84937361479177, 203.9671556437842, 204.08500572599704, 204.20292390075073,
+    204.32091020738841, 204.43896468527601, 204.55708737380198, 204.675278312378,
+    204.79353754043811, 204.91186509743926, 205.03026102286114, 205.1487253562064,
+    205.26725813700031, 205.38585940479106, 205.50452919914991, 205.62326755967072,
+    205.74207452597022, 205.86095013768818, 205.97989443448716, 206.0989074560527,
+    206.21798924209313, 206.33713983234009, 206.45635926654776, 206.57564758449351,
+    206.69500482597763, 206.81443103082339, 206.93392623887715, 207.05349049000807,
+    207.17312382410876, 207.29282628109453, 207.41259790090388, 207.53243872349833,
+    207.6523487888625, 207.77232813700419, 207.89237680795412, 208.01249484176654,
+    208.13268227851842, 208.25293915831008, 208.37326552126498, 208.49366140752974,
+    208.6141268572741, 208.73466191069139, 208.85526660799769, 208.9759409894325,
+    209.09668509525864, 209.2174989657621, 209.3383826412522, 209.45933616206136,
+    209.58035956854576, 209.70145290108448, 209.82261620008006, 209.94384950595838,
+    210.06515285916868, 210.18652630018354, 210.30796986949892, 210.42948360763438,
+    210.55106755513265, 210.67272175255994, 210.79444624050598, 210.91624105958377,
+    211.03810625043002, 211.1600418537046, 211.28204791009139, 211.40412446029728,
+    211.52627154505288, 211.6484892051123, 211.77077748125322, 211.89313641427688,
+    212.01556604500792, 212.13806641429505, 212.26063756301008, 212.38327953204865,
+    212.50599236232998, 212.62877609479699, 212.7516307704162, 212.87455643017768,
+    212.99755311509554, 213.12062086620733, 213.24375972457432, 213.3669697312815,
+    213.49025092743767, 213.61360335417518, 213.73702705265063, 213.86052206404389,
+    213.98408842955885, 214.10772619042319, 214.23143538788835, 214.35521606322968,
+    214.47906825774618, 214.60299201276121, 214.72698736962147, 214.85105436969781,
+    214.97519305438487, 215.09940346510135, 215.22368564328968, 215.34803963041634,
+    215.47246546797197, 215.59696319747087, 215.7215328604515, 215.84617449847622,
+    215.97088815313145, 216.09567386602771, 216.22053167879929, 216.345461633105,
+    216.47046377062742, 216.59553813307315, 216.72068476217308, 216.84590369968205,
+    216.97119498737914, 217.0965586670674, 217.22199478057445, 217.34750336975159,
+    217.47308447647453, 217.59873814264321, 217.72446441018161, 217.85026332103797,
+    217.97613491718511, 218.10207924061967, 218.22809633336271, 218.35418623745957,
+    218.48034899497995, 218.6065846480177, 218.73289323869099, 218.8592748091427,
+    218.98572940153969, 219.11225705807317, 219.23885782095888, 219.36553173243692,
+    219.49227883477181, 219.61909917025221, 219.74599278119183, 219.87295970992832,
+    219.99999999882388, 220.12711369026528, 220.25430082666375, 220.381561450455,
+    220.50889560409914, 220.6363033300812, 220.76378467091038, 220.89133966912061,
+    221.01896836727028, 221.14667080794251, 221.27444703374488, 221.40229708730962,
+    221.5302210112938, 221.65821884837894, 221.78629064127119, 221.91443643270148,
+    222.04265626542534, 222.17095018222309, 222.29931822589958, 222.42776043928481,
+    222.55627686523317, 222.68486754662385, 222.81353252636083, 222.94227184737301,
+    223.07108555261382, 223.19997368506193, 223.3289362877205, 223.45797340361764,
+    223.58708507580627, 223.71627134736428, 223.84553226139437, 223.97486786102411,
+    224.10427818940622, 224.23376328971815, 224.36332320516226, 224.49295797896599,
+    224.62266765438173, 224.75245227468679, 224.88231188318346, 225.01224652319939,
+    225.14225623808687, 225.27234107122334, 225.40250106601135, 225.53273626587855,
+    225.66304671427758, 225.79343245468618, 225.9238935306075, 226.05442998556956,
+    226.18504186312546, 226.31572920685366, 226.44649206035771, 226.57733046726636,
+    226.70824447123346, 226.83923411593844, 226.97029944508557, 227.10144050240459,
+    227.23265733165039, 227.36394997660321, 227.49531848106844, 227.62676288887715,
+    227.75828324388542, 227.8898795899747, 228.02155197105188, 228.15330043104913,
+    228.28512501392407, 228.41702576365955, 228.54900272426428, 228.68105593977197,
+    228.81318545424188, 228.94539131175875, 229.07767355643279, 229.21003223239973,
+    229.34246738382058, 229.47497905488237, 229.6075672897972, 229.74023213280284,
+    229.8729736281627, 230.00579182016563, 230.13868675312619, 230.27165847138434,
+    230.4047070193061, 230.53783244128272, 230.67103478173124, 230.80431408509429,
+    230.93767039584026, 231.07110375846324, 231.20461421748277, 231.33820181744474,
+    231.47186660292013, 231.60560861850598, 231.73942790882506, 231.87332451852581,
+    232.00729849228262, 232.14134987479551, 232.27547871079065, 232.40968504501978,
+    232.54396892226052, 232.67833038731644, 232.81276948501696, 232.94728626021725,
+    233.08188075779887, 233.21655302266879, 233.35130309976023, 233.48613103403218,
+    233.62103687046977, 233.75602065408401, 233.89108242991185, 234.02622224301663,
+    234.16144013848734, 234.29673616143913, 234.4321103570133, 234.56756277037709,
+    234.70309344672401, 234.83870243127336, 234.97438976927114, 235.11015550598896,
+    235.24599968672482, 235.38192235680285, 235.51792356157335, 235.65400334641282,
+    235.7901617567239, 235.92639883793584, 236.06271463550368, 236.19910919490897,
+    236.33558256165941, 236.47213478128907, 236.60876589935836, 236.74547596145376,
+    236.88226501318866, 237.01913310020225, 237.15608026816031, 237.29310656275496,
+    237.43021202970476, 237.56739671475449, 237.70466066367584, 237.84200392226651,
+    237.97942653635079, 238.11692855177947, 238.2545100144298, 238.39217097020551,
+    238.5299114650368, 238.66773154488078, 238.80563125572067, 238.94361064356647,
+    239.08166975445468, 239.21980863444844, 239.35802732963751, 239.4963258861381,
+    239.63470435009359, 239.77316276767348, 239.91170118507412, 240.05031964851861,
+    240.18901820425668, 240.32779689856483, 240.46665577774615, 240.60559488813087,
+    240.74461427607568, 240.883713987964, 241.02289407020623, 241.1621545692395,
+    241.30149553152779, 241.44091700356179, 241.58041903185944, 241.72000166296519,
+    241.8596649434505, 241.99940891991372, 242.13923363898016, 242.279139147302,
+    242.41912549155833, 242.55919271845559, 242.69934087472674, 242.83957000713195,
+    242.97988016245839, 243.12027138752026, 243.26074372915861, 243.40129723424207,
+    243.54193194966587, 243.68264792235252, 243.82344519925155, 243.96432382733977,
+    244.10528385362099, 244.24632532512607, 244.38744828891353, 244.52865279206861,
+    244.66993888170387, 244.81130660495919, 244.95275600900155, 245.09428714102526,
+    245.23590004825172, 245.37759477793017, 245.51937137733654, 245.66122989377436,
+    245.80317037457436, 245.94519286709473, 246.08729741872096, 246.22948407686582,
+    246.37175288896987, 246.51410390250066, 246.65653716495333, 246.79905272385042,
+    246.94165062674196, 247.08433092120546, 247.2270936548457, 247.36993887529559,
+    247.51286663021486, 247.65587696729114, 247.79896993423949, 247.94214557880261,
+    248.08540394875064, 248.22874509188165, 248.37216905602105, 248.51567588902191,
+    248.65926563876502, 248.80293835315874, 248.94669408013922, 249.09053286767011,
+    249.23445476374326, 249.37845981637767, 249.52254807362041, 249.66671958354621,
+    249.81097439425758, 249.95531255388485, 250.09973411058598, 250.24423911254726,
+    250.38882760798234, 250.53349964513282, 250.67825527226827, 250.82309453768607,
+    250.9680174897116, 251.11302417669788, 251.25811464702647, 251.4032889491063,
+    251.54854713137448, 251.69388924229614, 251.83931533036434, 251.98482544410021,
+    252.13041963205276, 252.27609794279945, 252.42186042494544, 252.56770712712404,
+    252.71363809799675, 252.85965338625309, 253.00575304061078, 253.15193710981552,
+    253.29820564264162, 253.44455868789115, 253.59099629439444, 253.73751851101017,
+    253.88412538662513, 254.03081697015423, 254.17759331054117, 254.32445445675742,
+    254.47140045780284, 254.61843136270568, 254.76554722052256, 254.9127480803383,
+    255.06003399126604, 255.20740500244773, 255.35486116305327, 255.50240252228107,
+    255.65002912935805, 255.79774103353944, 255.94553828410909, 256.09342093037907,
+    256.2413890216904, 256.38944260741221, 256.53758173694223, 256.68580645970678,
+    256.83411682516078, 256.98251288278772, 257.13099468209936, 257.27956227263667,
+    257.42821570396887, 257.57695502569379, 257.725780287438, 257.87469153885678,
+    258.02368882963401, 258.17277220948222, 258.32194172814309, 258.4711974353865,
+    258.62053938101133, 258.76996761484526, 258.91948218674469, 259.06908314659466,
+    259.21877054430956, 259.36854442983218, 259.51840485313414, 259.66835186421616,
+    259.81838551310773, 259.96850584986726, 260.11871292458193, 260.26900678736837,
+    260.41938748837157, 260.56985507776579, 260.7204096057543, 260.87105112256921,
+    261.02177967847177, 261.17259532375215, 261.32349810872989, 261.47448808375339,
+    261.62556529919999, 261.77672980547635, 261.92798165301826, 262.07932089229047,
+    262.23074757378691, 262.38226174803111, 262.53386346557528, 262.68555277700102,
+    262.83732973291916, 262.98919438396979, 263.14114678082217, 263.29318697417483,
+    263.44531501475592, 263.59753095332252, 263.74983484066109, 263.90222672758767,
+    264.05470666494733, 264.20727470361481, 264.35993089449386, 264.51267528851827,
+    264.66550793665078, 264.81842888988359, 264.97143819923849, 265.12453591576684,
+    265.27772209054905, 265.43099677469581, 265.5843600193466, 265.7378118756709,
+    265.89135239486751, 266.04498162816503, 266.19869962682139, 266.35250644212414,
+    266.50640212539099, 266.66038672796873, 266.81446030123408, 266.96862289659327,
+    267.12287456548228, 267.27721535936706, 267.43164532974276, 267.58616452813504,
+    267.74077300609861, 267.89547081521852, 268.05025800710911, 268.20513463341501,
+    268.36010074581031, 268.5151563959991, 268.67030163571565, 268.82553651672373,
+    268.98086109081714, 269.13627540981946, 269.29177952558462, 269.44737348999598,
+    269.60305735496712, 269.75883117244194, 269.91469499439387, 270.07064887282667,
+    270.22669285977383, 270.38282700729928, 270.5390513674966, 270.69536599249011,
+    270.8517709344336, 271.00826624551132, 271.16485197793764, 271.32152818395696,
+    271.47829491584412, 271.63515222590377, 271.79210016647141, 271.94913878991207,
+    272.10626814862155, 272.2634882950257, 272.42079928158057, 272.57820116077278,
+    272.73569398511893, 272.8932778071665, 273.05095267949287, 273.20871865470588,
+    273.36657578544396, 273.52452412437566, 273.68256372420012, 273.84069463764683,
+    273.99891691747621, 274.15723061647856, 274.31563578747489, 274.47413248331685,
+    274.6327207568865, 274.79140066109647, 274.95017224888977, 275.1090355732407,
+    275.26799068715337, 275.42703764366286, 275.58617649583488, 275.74540729676579,
+    275.90473009958259, 276.06414495744286, 276.22365192353527, 276.38325105107901,
+    276.54294239332387, 276.70272600355054, 276.86260193507053, 277.02257024122599,
+    277.18263097539023, 277.34278419096711, 277.50302994139139, 277.66336828012868,
+    277.82379926067568, 277.98432293655975, 278.14493936133908, 278.30564858860339,
+    278.46645067197289, 278.62734566509874, 278.7883336216633, 278.94941459537984,
+    279.11058863999273, 279.2718558092771, 279.43321615703979, 279.59466973711824,
+    279.75621660338106, 279.91785680972799, 280.07959041009002, 280.24141745842917,
+    280.40333800873856, 280.56535211504303, 280.72745983139794, 280.88966121189037,
+    281.05195631063839, 281.21434518179143, 281.3768278795302, 281.53940445806649,
+    281.70207497164409, 281.86483947453752, 282.02769802105263, 282.19065066552707,
+    282.35369746232954, 282.51683846586008, 282.6800737305507, 282.8434033108644,
+    283.00682726129577, 283.17034563637071, 283.33395849064692, 283.49766587871352,
+    283.66146785519084, 283.8253644747316, 283.98935579201924, 284.15344186176918,
+    284.31762273872835, 284.48189847767549, 284.64626913342067, 284.81073476080581,
+    284.97529541470482, 285.13995115002285, 285.30470202169693, 285.46954808469582,
+    285.63448939402014, 285.79952600470216, 285.96465797180588, 286.12988535042763,
+    286.29520819569484, 286.46062656276729, 286.62614050683641, 286.79175008312563,
+    286.95745534689019, 287.1232563534171, 287.28915315802601, 287.45514581606773,
+    287.62123438292554, 287.78741891401438, 287.95369946478144, 288.12007609070582,
+    288.28654884729866, 288.45311779010359, 288.6197829746958, 288.78654445668275,
+    288.95340229170409, 289.12035653543154, 289.28740724356896, 289.45455447185276,
+    289.62179827605121, 289.7891387119646, 289.95657583542601, 290.12410970230036,
+    290.29174036848491, 290.45946788990921, 290.6272923225356, 290.79521372235803,
+    290.9632321454032, 291.13134764773008, 291.29956028543012, 291.46787011462715,
+    291.63627719147712, 291.80478157216913, 291.97338331292406, 292.14208246999561,
+    292.31087909966988, 292.47977325826554, 292.6487650021337, 292.81785438765809,
+    292.98704147125517, 293.15632630937387, 293.32570895849562, 293.49518947513457,
+    293.66476791583773, 293.83444433718438, 294.00421879578658, 294.17409134828966,
+    294.34406205137111, 294.5141309617411, 294.68429813614301, 294.85456363135256,
+    295.02492750417838, 295.19538981146246, 295.36595061007893, 295.53660995693502,
+    295.70736790897098, 295.87822452315976, 296.04917985650735, 296.22023396605243,
+    296.39138690886728, 296.56263874205655, 296.73398952275795, 296.90543930814238,
+    297.07698815541369, 297.24863612180883, 297.4203832645976, 297.59222964108341,
+    297.76417530860238, 297.93622032452362, 298.10836474624983, 298.28060863121641,
+    298.45295203689233, 298.62539502077948, 298.79793764041329, 298.97057995336223,
+    299.14332201722783, 299.3161638896454, 299.48910562828314, 299.66214729084265,
+    299.83528893505888, 300.00853061870043, 300.18187239956887, 300.35531433549937,
+    300.5288564843604, 300.70249890405404, 300.87624165251566, 301.05008478771401,
+    301.22402836765184, 301.39807245036485, 301.57221709392257, 301.74646235642797,
+    301.92080829601758, 302.09525497086139, 302.26980243916358, 302.44445075916138,
+    302.61919998912583, 302.79405018736156, 302.96900141220715, 303.14405372203453,
+    303.31920717524946, 303.49446183029187, 303.66981774563493, 303.84527497978587,
+    304.02083359128545, 304.1964936387086, 304.37225518066384, 304.54811827579351,
+    304.72408298277435, 304.90014936031639, 305.07631746716379, 305.2525873620948,
+    305.42895910392133, 305.60543275148956, 305.78200836367938, 305.95868599940519,
+    306.13546571761498, 306.31234757729095, 306.48933163744931, 306.66641795714048,
+    306.84360659544893, 307.02089761149307, 307.19829106442603, 307.37578701343472,
+    307.55338551774008, 307.73108663659769, 307.90889042929706, 308.08679695516196,
+    308.26480627355079, 308.44291844385577, 308.62113352550386, 308.79945157795601,
+    308.97787266070765, 309.15639683328868, 309.33502415526306, 309.51375468622996,
+    309.69258848582206, 309.87152561370704, 310.05056612958674, 310.22971009319787,
+    310.40895756431132, 310.58830860273241, 310.76776326830174, 310.94732162089372,
+    311.12698372041763, 311.30674962681741, 311.4866194000715, 311.66659310019315,
+    311.84667078722993, 312.02685252126491, 312.20713836241504, 312.38752837083246,
+    312.56802260670372, 312.74862113025051, 312.92932400172913, 313.11013128143043,
+    313.29104302968091, 313.47205930684106, 313.65318017330674, 313.83440568950846,
+    314.01573591591182, 314.19717091301715, 314.37871074135973, 314.56035546151037,
+    314.74210513407422, 314.92395981969167, 315.10591957903824, 315.28798447282441,
+    315.47015456179543, 315.65242990673249, 315.83481056845119, 316.01729660780239,
+    316.19988808567228, 316.38258506298206, 316.5653876006881, 316.74829575978208,
+    316.93130960129128, 317.11442918627762, 317.29765457583864, 317.48098583110703,
+    317.66442301325094, 317.84796618347389, 318.03161540301431, 318.21537073314687,
+    318.39923223518099, 318.58319997046164, 318.7672740003693, 318.95145438631982,
+    319.1357411897647, 319.32013447219055, 319.5046342951203, 319.68924072011168,
+    319.8739538087583, 320.05877362268922, 320.24370022356931, 320.42873367309875,
+    320.61387403301359, 320.7991213650858, 320.98447573112259, 321.16993719296704,
+    321.35550581249811, 321.54118165163021, 321.72696477231364, 321.91285523653482,
+    322.09885310631563, 322.28495844371383, 322.47117131082308, 322.657491769773,
+    322.84391988272887, 323.03045571189199, 323.21709931949999, 323.40385076782593,
+    323.59071011917905, 323.77767743590459, 323.96475278038378, 324.15193621503397,
+    324.33922780230824, 324.52662760469661, 324.71413568472423, 324.90175210495295,
+    325.08947692798046, 325.27731021644092, 325.46525203300445, 325.65330244037716,
+    325.84146150130215, 326.02972927855814, 326.21810583496017, 326.4065912333599,
+    326.59518553664486, 326.78388880773934, 326.97270110960346, 327.1616225052345,
+    327.35065305766557, 327.53979282996619, 327.72904188524251, 327.91840028663711,
+    328.107868097329, 328.29744538053359, 328.48713219950326, 328.67692861752641,
+    328.86683469792837, 329.05685050407078, 329.24697609935203, 329.43721154720703,
+    329.62755691110772, 329.81801225456223, 330.00857764111572, 330.19925313434993,
+    330.39003879788322, 330.58093469537096, 330.77194089050482, 330.96305744701419,
+    331.15428442866437, 331.34562189925799, 331.53706992263432, 331.7286285626696,
+    331.92029788327699, 332.11207794840635, 332.30396882204508, 332.49597056821699,
+    332.68808325098314, 332.88030693444142, 333.0726416827269, 333.26508756001175,
+    333.45764463050483, 333.65031295845284, 333.84309260813905, 334.03598364388387,
+    334.22898613004503, 334.42210013101754, 334.61532571123331, 334.80866293516152,
+    335.00211186730917, 335.19567257221979, 335.38934511447468, 335.58312955869212,
+    335.77702596952804, 335.97103441167525, 336.16515494986476, 336.35938764886419,
+    336.5537325734789, 336.74818978855177, 336.94275935896297, 337.13744134963025,
+    337.33223582550869, 337.52714285159135, 337.72216249290847, 337.91729481452791,
+    338.11253988155516, 338.30789775913343, 338.50336851244327, 338.69895220670304,
+    338.89464890716926, 339.09045867913545, 339.28638158793314, 339.48241769893167,
+    339.67856707753799, 339.87482978919707, 340.0712058993912, 340.26769547364131,
+    340.46429857750559, 340.66101527658032, 340.85784563649952, 341.05478972293514,
+    341.25184760159738, 341.44901933823388, 341.64630499863097, 341.84370464861246,
+    342.04121835404032, 342.23884618081451, 342.43658819487325, 342.63444446219279,
+    342.83241504878708, 343.03050002070916, 343.22869944404943, 343.42701338493674,
+    343.62544190953804, 343.82398508405868, 344.02264297474193, 344.22141564787006,
+    344.42030316976286, 344.61930560677882, 344.8184230253147, 345.0176554918055,
+    345.21700307272488, 345.41646583458447, 345.61604384393496, 345.815737167365,
+    346.0155458715019, 346.21547002301133, 346.41550968859764, 346.61566493500357,
+    346.81593582901036, 347.01632243743836, 347.21682482714607, 347.41744306503051,
+    347.6181772180276, 347.81902735311195, 348.01999353729673, 348.22107583763369,
+    348.42227432121393, 348.6235890551668, 348.82502010666036, 349.02656754290183,
+    349.22823143113698, 349.43001183865061, 349.63190883276616, 349.83392248084652,
+    350.03605285029295, 350.23830000854576, 350.44066402308431, 350.64314496142697,
+    350.84574289113095, 351.04845787979292, 351.25128999504813, 351.45423930457116,
+    351.65730587607561, 351.86048977731417, 352.06379107607876, 352.26720984020028,
+    352.47074613754933, 352.67440003603519, 352.87817160360663, 353.08206090825149,
+    353.28606801799708, 353.49019300090993, 353.69443592509572, 353.89879685870011,
+    354.10327586990746, 354.30787302694182, 354.51258839806655, 354.71742205158466,
+    354.92237405583825, 355.12744447920909, 355.33263339011881, 355.53794085702822,
+    355.74336694843754, 355.94891173288687, 356.15457527895575, 356.3603576552635,
+    356.56625893046868, 356.77227917327025, 356.97841845240623, 357.18467683665466,
+    357.39105439483308, 357.59755119579899, 357.80416730844968, 358.01090280172195,
+    358.21775774459303, 358.42473220607951, 358.63182625523797, 358.83903996116487,
+    359.04637339299666, 359.25382661990955, 359.46139971112024, 359.66909273588482,
+    359.87690576349979, 360.0848388633014, 360.29289210466612, 360.50106555701052,
+    360.70935928979111, 360.91777337250488, 361.12630787468868, 361.33496286591964,
+    361.54373841581497, 361.75263459403226, 361.96165147026932, 362.17078911426387,
+    362.38004759579479, 362.58942698468059, 362.79892735078005, 363.00854876399279,
+    363.21829129425839, 363.42815501155701, 363.63813998590911, 363.84824628737607,
+    364.05847398605931, 364.26882315210094, 364.47929385568335, 364.68988616702967,
+    364.9006001564037, 365.11143589410949, 365.32239345049226, 365.53347289593751,
+    365.7446743008714, 365.95599773576077, 366.16744327111337, 366.37901097747721,
+    366.59070092544204, 366.80251318563734, 367.01444782873398, 367.22650492544352,
+    367.43868454651829, 367.65098676275159, 367.86341164497748, 368.0759592640714,
+    368.28862969094934, 368.50142299656829, 368.71433925192628, 368.92737852806238,
+    369.14054089605673, 369.35382642703024, 369.56723519214569, 369.78076726260622,
+    369.99442270965642, 370.20820160458192, 370.4221040187096, 370.63613002340765,
+    370.85027969008507, 371.06455309019299, 371.27895029522301, 371.49347137670827,
+    371.70811640622344, 371.92288545538429, 372.13777859584803, 372.35279589931315,
+    372.56793743752013, 372.78320328225033, 372.99859350532677, 373.21410817861391,
+    373.42974737401778, 373.64551116348599, 373.86139961900739, 374.07741281261315,
+    374.2935508163755, 374.50981370240839, 374.7262015428675, 374.94271440995016,
+    375.15935237589525, 375.37611551298403, 375.59300389353876, 375.81001758992392,
+    376.02715667454561, 376.24442121985186, 376.46181129833246, 376.67932698251917,
+    376.89696834498579, 377.11473545834787, 377.33262839526299, 377.55064722843053,
+    377.76879203059218, 377.98706287453143, 378.20545983307358, 378.42398297908693,
+    378.64263238548097, 378.86140812520762, 379.08031027126106, 379.2993388966774,
+    379.51849407453506, 379.73777587795468, 379.95718438009948, 380.17671965417446,
+    380.39638177342709, 380.6161708111473, 380.83608684066706, 381.05612993536107,
+    381.27630016864589, 381.49659761398141, 381.71702234486924, 381.9375744348535,
+    382.15825395752097, 382.37906098650103, 382.59999559546515, 382.82105785812814,
+    383.04224784824686, 383.26356563962082, 383.48501130609219, 383.70658492154593,
+    383.92828655990968, 384.15011629515334, 384.37207420129056, 384.59416035237683,
+    384.81637482251074, 385.03871768583372, 385.26118901652995, 385.48378888882655,
+    385.7065173769933, 385.92937455534366, 386.15236049823301, 386.37547528006036,
+    386.59871897526733, 386.82209165833882, 387.04559340380263, 387.26922428622947,
+    387.49298438023368, 387.71687376047225, 387.94089250164535, 388.16504067849638,
+    388.3893183658119, 388.61372563842167, 388.83826257119853, 389.06292923905926,
+    389.28772571696311, 389.51265207991304, 389.73770840295521, 389.96289476117914,
+    390.18821122971798, 390.4136578837477, 390.6392347984887, 390.86494204920393,
+    391.09077971120013, 391.31674785982767, 391.54284657048026, 391.76907591859515,
+    391.99543597965362, 392.22192682918006, 392.44854854274274, 392.67530119595347,
+    392.90218486446781, 393.12919962398502, 393.35634555024785, 393.5836227190436,
+    393.81103120620253, 394.03857108759905, 394.26624243915137, 394.49404533682161,
+    394.72197985661563, 394.9500460745831, 395.17824406681837, 395.40657390945898,
+    395.63503567868673, 395.86362945072739, 396.09235530185077, 396.32121330837077,
+    396.55020354664526, 396.77932609307675, 397.00858102411127, 397.23796841623926,
+    397.46748834599538, 397.6971408899584, 397.92692612475156, 398.15684412704184,
+    398.38689497354153, 398.6170787410062, 398.84739550623635, 399.07784534607663,
+    399.30842833741622, 399.53914455718825, 399.76999408237128, 400.00097698998769,
+    400.23209335710419, 400.46334326083246, 400.69472677832846, 400.92624398679294,
+    401.15789496347071, 401.38967978565228, 401.62159853067186, 401.85365127590876,
+    402.08583809878672, 402.31815907677458, 402.55061428738566, 402.78320380817792,
+    403.01592771675485, 403.2487860907641, 403.4817790078983, 403.71490654589519,
+    403.94816878253727, 404.18156579565186, 404.41509766311128, 404.64876446283347,
+    404.88256627278054, 405.11650317095996, 405.3505752354244, 405.58478254427143,
+    405.81912517564388, 406.0536032077294, 406.28821671876165, 406.52296578701868,
+    406.75785049082407, 406.99287090854648, 407.22802711860015, 407.4633191994443,
+    407.69874722958355, 407.93431128756839, 408.17001145199407, 408.40584780150147,
+    408.64182041477682, 408.87792937055201, 409.11417474760395, 409.350556624756,
+    409.58707508087622, 409.82373019487852, 410.06052204572228, 410.2974507124128,
+    410.53451627400062, 410.77171880958213, 411.00905839829983, 411.24653511934144,
+    411.48414905194045, 411.72190027537636, 411.95978886897433, 412.1978149121054,
+    412.43597848418625, 412.67427966468017, 412.91271853309553, 413.15129516898702,
+    413.39000965195527, 413.62886206164677, 413.8678524777543, 414.10698098001615,
+    414.34624764821751, 414.58565256218907, 414.82519580180775, 415.06487744699666,
+    415.30469757772499, 415.54465627400839, 415.78475361590824, 416.02498968353308,
+    416.26536455703683, 416.50587831662017, 416.74653104252997, 416.98732281505949,
+    417.2282537145482, 417.46932382138277, 417.71053321599538, 417.951881978865,
+    418.19337019051727, 418.43499793152421, 418.67676528250439, 418.91867232412272,
+    419.16071913709152, 419.40290580216896, 419.64523240016013, 419.88769901191677,
+    420.13030571833735, 420.37305260036709, 420.61593973899784, 420.85896721526876,
+    421.10213511026529, 421.34544350511987, 421.58889248101195, 421.83248211916754,
+    422.07621250086004, 422.3200837074092, 422.56409582018279, 422.80824892059456,
+    423.05254309010576, 423.2969784102246, 423.54155496250644, 423.78627282855376,
+    424.03113209001583, 424.27613282859011, 424.52127512602016, 424.76655906409729,
+    425.01198472465995, 425.25755218959398, 425.5032615408324, 425.74911286035535,
+    425.99510623019108, 426.24124173241466, 426.48751944914864, 426.733939462563,
+    426.98050185487534, 427.22720670835037, 427.47405410530126, 427.72104412808778,
+    427.9681768591177, 428.21545238084639, 428.46287077577671, 428.71043212645935,
+    428.95813651549236, 429.20598402552241, 429.45397473924294, 429.70210873939561,
+    429.95038610876975, 430.19880693020269, 430.44737128657937, 430.69607926083268,
+    430.94493093594394, 431.19392639494174, 431.44306572090301, 431.69234899695243,
+    431.94177630626291, 432.19134773205542, 432.44106335759858, 432.69092326621001,
+    432.94092754125484, 433.1910762661463, 433.44136952434616, 433.69180739936411,
+    433.94238997475827, 434.1931173341348, 434.4439895611489, 434.69500673950319,
+    434.94616895294905, 435.19747628528643, 435.44892882036322, 435.70052664207594,
+    435.95226983437021, 436.20415848123935, 436.45619266672543, 436.70837247491914,
+    436.9606979899599, 437.2131692960354, 437.46578647738198, 437.71854961828541,
+    437.97145880307937, 438.22451411614634, 438.47771564191777, 438.73106346487384,
+    438.98455766954362, 439.23819834050443, 439.49198556238366, 439.74591941985665,
+    439.99999999764776, 440.25422738053055, 440.5086016533275, 440.76312290090999,
+    441.01779120819828, 441.27260666016241, 441.52756934182077, 441.78267933824122,
+    442.03793673454055, 442.29334161588503, 442.54889406748975, 442.80459417461924,
+    443.06044202258761, 443.31643769675787, 443.57258128254239, 443.82887286540296,
+    444.08531253085067, 444.34190036444619, 444.59863645179917, 444.85552087856962,
+    445.11255373046635, 445.3697350932477, 445.62706505272166, 445.88454369474601,
+    446.14217110522765, 446.39994737012387, 446.65787257544099, 446.91594680723529,
+    447.17417015161254, 447.43254269472857, 447.69106452278874, 447.94973572204822,
+    448.20855637881243, 448.46752657943631, 448.72664641032452, 448.98591595793198,
+    449.24533530876346, 449.50490454937358, 449.76462376636692, 450.02449304639879,
+    450.28451247617375, 450.54468214244667, 450.80500213202271, 451.06547253175711,
+    451.32609342855517, 451.58686490937237, 451.847787061215, 452.10885997113911,
+    452.37008372625093, 452.63145841370732, 452.89298412071543, 453.15466093453273,
+    453.41648894246691, 453.67846823187688, 453.94059889017115, 454.20288100480917,
+    454.46531466330077, 454.72789995320642, 454.99063696213688, 455.25352577775431,
+    455.51656648777083, 455.77975917994939, 456.04310394210376, 456.30660086209826,
+    456.57025002784815, 456.8340515273191, 457.09800544852857, 457.36211187954393,
+    457.62637090848375, 457.89078262351751, 458.15534711286557, 458.42006446479945,
+    458.68493476764115, 458.94995810976474, 459.21513457959441, 459.48046426560569,
+    459.74594725632539, 460.01158364033125, 460.27737350625239, 460.54331694276868,
+    460.8094140386122, 461.07566488256543, 461.34206956346247, 461.60862817018858,
+    461.87534079168051, 462.14220751692648, 462.40922843496554, 462.67640363488948,
+    462.94373320584026, 463.21121723701197, 463.47885581765013, 463.74664903705161,
+    464.01459698456523, 464.28269974959102, 464.5509574215813, 464.81937009003957,
+    465.08793784452104, 465.35666077463287, 465.62553897003392, 465.89457252043451,
+    466.16376151559774, 466.43310604533758, 466.70260619952046, 466.97226206806437,
+    467.24207374093953, 467.51204130816802, 467.78216485982369, 468.05244448603327,
+    468.32288027697467, 468.59347232287826, 468.8642207140266, 469.13512554075419,
+    469.40618689344802, 469.67740486254672, 469.94877953854228, 470.22031101197791,
+    470.49199937344963, 470.76384471360569, 471.03584712314671, 471.30800669282564,
+    471.58032351344781, 471.85279767587167, 472.12542927100736, 472.39821838981794,
+    472.67116512331881, 472.94426956257814, 473.21753179871672, 473.49095192290753,
+    473.76453002637732, 474.03826620040451, 474.31216053632062, 474.58621312550991,
+    474.86042405940952, 475.13479342950899, 475.40932132735168, 475.68400784453303,
+    475.95885307270157, 476.23385710355893, 476.5090200288596, 476.78434194041103,
+    477.05982293007361, 477.33546308976156, 477.61126251144134, 477.88722128713295,
+    478.16333950890936, 478.43961726889688, 478.71605465927502, 478.99265177227619,
+    479.26940870018717, 479.54632553534697, 479.82340237014824, 480.10063929703722,
+    480.37803640851337, 480.65559379712965, 480.93331155549231, 481.21118977626173,
+    481.48922855215136, 481.767427975928, 482.04578814041247, 482.32430913847901,
+    482.60299106305558, 482.88183400712359, 483.16083806371887, 483.44000332593038,
+    483.71932988690099, 483.99881783982744, 484.27846727796032, 484.55827829460401,
+    484.83825098311667, 485.11838543691118, 485.39868174945349, 485.67914001426391,
+    485.95976032491677, 486.24054277504052, 486.52148745831721, 486.80259446848413,
+    487.08386389933173, 487.36529584470503, 487.6468903985031, 487.92864765467954,
+    488.21056770724198, 488.49265065025213, 488.77489657782706, 489.05730558413723,
+    489.33987776340774, 489.62261320991837, 489.90551201800309, 490.18857428205052,
+    490.47180009650344, 490.75518955586034, 491.03874275467308, 491.32245978754872,
+    491.60634074914873, 491.89038573418946, 492.17459483744193, 492.45896815373163,
+    492.74350577793973, 493.02820780500133, 493.31307432990667, 493.59810544770085,
+    493.88330125348392, 494.16866184241093, 494.45418730969141, 494.73987775059118,
+    495.02573326042972, 495.31175393458227, 495.59793986847899, 495.88429115760522,
+    496.17080789750128, 496.4574901837633, 496.7443381120421, 497.03135177804381,
+    497.31853127753004, 497.60587670631747, 497.89338816027845, 498.18106573534021,
+    498.46890952748652, 498.75691963275534, 499.04509614724083, 499.33343916709242,
+    499.62194878851517, 499.9106251077697, 500.19946822117197, 500.48847822509452,
+    500.77765521596467, 501.06699929026564, 501.35651054453655, 501.64618907537215,
+    501.9360349794232, 502.22604835339575, 502.51622929405295, 502.80657789821259,
+    503.09709426274895, 503.38777848459227, 503.67863066072869, 503.96965088820042,
+    504.26083926410553, 504.55219588559891, 504.84372084989087, 505.13541425424808,
+    505.4272761959935, 505.71930677250617, 506.01150608122157, 506.30387421963104,
+    506.59641128528324, 506.88911737578229, 507.18199258878889, 507.47503702202033,
+    507.76825077325026, 508.06163394030847, 508.35518662108234, 508.64890891351484,
+    508.94280091560569, 509.23686272541136, 509.53109444104513, 509.82549616067661,
+    510.12006798253208, 510.41481000489546, 510.70972232610654, 511.00480504456215,
+    511.30005825871609, 511.59548206707888, 511.89107656821818, 512.18684186075814,
+    512.48277804338079, 512.77888521482441, 513.07516347388446, 513.37161291941356,
+    513.66823365032155, 513.96502576557543, 514.26198936419871, 514.55912454527333,
+    514.85643140793775, 515.15391005138758, 515.451560574876, 515.74938307771356,
+    516.04737765926802, 516.34554441896444, 516.64388345628618, 516.942394870773,
+    517.24107876202265, 517.53993522969051, 517.83896437348938, 518.13816629318933,
+    518.43754108861913, 518.73708885966437, 519.03680970626829, 519.33670372843233,
+    519.63677102621546, 519.93701169973451, 520.23742584916386, 520.53801357473674,
+    520.83877497674314, 521.13971015553159, 521.4408192115086, 521.74210224513843,
+    522.04355935694355, 522.3451906475043, 522.64699621745979, 522.94897616750677,
+    523.25113059839998, 523.5534596109527, 523.85596330603653, 524.15864178458094,
+    524.46149514757383, 524.76452349606222, 525.06772693115056, 525.37110555400204,
+    525.67465946583832, 525.97838876793958, 526.28229356164434, 526.58637394834966,
+    526.89063002951184, 527.19506190664504, 527.49966968132219, 527.80445345517535,
+    528.10941332989466, 528.41454940722963, 528.71986178898771, 529.02535057703653,
+    529.33101587330157, 529.63685777976718, 529.94287639847698, 530.24907183153368,
+    530.5554441810981, 530.86199354939163, 531.16872003869321, 531.4756237513418,
+    531.78270478973502, 532.08996325633007, 532.39739925364279, 532.70501288424828,
+    533.01280425078198, 533.32077345593746, 533.62892060246816, 533.93724579318655,
+    534.24574913096455, 534.55443071873412, 534.86329065948553, 535.17232905627009,
+    535.48154601219721, 535.79094163043703, 536.10051601421821, 536.41026926683003,
+    536.72020149162063, 537.0303127919982, 537.34060327143129, 537.65107303344746,
+    537.96172218163429, 538.27255081963892, 538.58355905116923, 538.89474697999196,
+    539.20611470993424, 539.51766234488389, 539.82938998878774, 540.14129774565333,
+    540.45338571954767, 540.76565401459857, 541.07810273499319, 541.39073198498022,
+    541.70354186886721, 542.01653249102264, 542.32970395587529, 542.64305636791391,
+    542.95658983168823, 543.27030445180753, 543.58420033294283, 543.89827757982414,
+    544.2125362972431, 544.52697659005139, 544.84159856316114, 545.15640232154556,
+    545.47138797023786, 545.786555614333, 546.10190535898573, 546.41743730941175,
+    546.73315157088791, 547.04904824875132, 547.36512744840024, 547.68138927529367,
+    547.99783383495242, 548.31446123295711, 548.63127157494978, 548.9482649666337,
+    549.265441513773, 549.58280132219295, 549.90034449777954, 550.21807114648141,
+    550.53598137430674, 550.85407528732571, 551.17235299166975, 551.49081459353158,
+    551.80946019916519, 552.12828991488573, 552.44730384707054, 552.76650210215803,
+    553.08588478664774, 553.40545200710108, 553.72520387014106, 554.04514048245198,
+    554.36526195078045, 554.68556838193422, 555.00605988278278, 555.32673656025736,
+    555.64759852135137, 555.9686458731195, 556.28987872267817, 556.61129717720678,
+    556.93290134394579, 557.25469133019749, 557.5766672433266, 557.89882919075967,
+    558.22117727998545, 558.5437116185542, 558.86643231407959, 559.18933947423648,
+    559.51243320676213, 559.83571361945599, 560.15918082018004, 560.48283491685834,
+    560.80667601747712, 561.13070423008605, 561.45491966279587, 561.77932242378074,
+    562.10391262127678, 562.42869036358286, 562.75365575906039, 563.07880891613297,
+    563.40414994328819, 563.72967894907504, 564.05539604210526, 564.38130133105415,
+    564.70739492465907, 565.03367693172015, 565.36014746110141, 565.68680662172881,
+    566.01365452259154, 566.34069127274142, 566.66791698129384, 566.99533175742704,
+    567.32293571038167, 567.6507289494632, 567.97871158403848, 568.30688372353836,
+    568.63524547745669, 568.96379695535097, 569.29253826684135, 569.62146952161163,
+    569.95059082940963, 570.27990230004571, 570.60940404339385, 570.93909616939163,
+    571.26897878804027, 571.59905200940432, 571.92931594361175, 572.25977070085526,
+    572.59041639138968, 572.92125312553458, 573.25228101367281, 573.58350016625127,
+    573.91491069378037, 574.24651270683421, 574.57830631605202, 574.91029163213545,
+    575.24246876585107, 575.57483782802876, 575.90739892956287, 576.24015218141164,
+    576.57309769459732, 576.90623558020718, 577.23956594939159, 577.5730889133655,
+    577.90680458340819, 578.24071307086308, 578.57481448713793, 578.90910894370552,
+    579.24359655210242, 579.57827742392919, 579.91315167085202, 580.24821940460072,
+    580.58348073696982, 580.91893577981841, 581.25458464507119, 581.59042744471606,
+    581.92646429080639, 582.26269529546016, 582.59912057086024, 582.93574022925429,
+    583.27255438295424, 583.60956314433827, 583.94676662584811, 584.28416493999123,
+    584.62175819933975, 584.95954651653108, 585.2975300042674, 585.63570877531617,
+    585.97408294251034, 586.31265261874773, 586.65141791699125, 586.99037895026913,
+    587.32953583167546, 587.66888867436876, 588.00843759157317, 588.34818269657933,
+    588.68812410274222, 589.02826192348221, 589.36859627228603, 589.70912726270512,
+    590.04985500835676, 590.39077962292492, 590.73190122015785, 591.07321991387005,
+    591.41473581794196, 591.75644904631952, 592.0983597130147, 592.44046793210487,
+    592.78277381773455, 593.1252774841131, 593.4679790455159, 593.81087861628475,
+    594.15397631082737, 594.49727224361766, 594.84076652919521, 595.18445928216681,
+    595.52835061720475, 595.87244064904723, 596.21672949249967, 596.56121726243282,
+    596.90590407378465, 597.25079004155896, 597.59587528082659, 597.94115990672447,
+    598.28664403445566, 598.63232777929079, 598.97821125656628, 599.32429458168531,
+    599.67057787011777, 600.01706123740087, 600.36374479913775, 600.71062867099874,
+    601.05771296872081, 601.40499780810808, 601.75248330503132, 602.10016957542803,
+    602.44805673530368, 602.7961449007297, 603.14443418784515, 603.49292471285594,
+    603.84161659203517, 604.19050994172278, 604.53960487832717, 604.88890151832277,
+    605.23839997825166, 605.58810037472313, 605.9380028244143, 606.28810744406906,
+    606.63841435049892, 606.98892366058374, 607.33963549126986, 607.69054995957174,
+    608.0416671825709, 608.39298727741721, 608.74451036132768, 609.09623655158703,
+    609.4481659655487, 609.80029872063278, 610.15263493432758, 610.5051747241896,
+    610.85791820784266, 611.21086550297912, 611.56401672735876, 611.91737199881038,
+    612.27093143522995, 612.6246951545819, 612.97866327489862, 613.33283591428096,
+    613.68721319089786, 614.04179522298614, 614.39658212885206, 614.75157402686943,
+    615.10677103548016, 615.46217327319539, 615.81778085859412, 616.17359391032392,
+    616.52961254710158, 616.88583688771155, 617.24226705100773, 617.59890315591201,
+    617.95574532141529, 618.31279366657736, 618.67004831052611, 619.02750937245992,
+    619.38517697164411, 619.74305122741407, 620.10113225917348, 620.45942018639573,
+    620.81791512862264, 621.17661720546482, 621.53552653660347, 621.89464324178743,
+    622.25396744083525, 622.61349925363481, 622.97323880014301, 623.33318620038631,
+    623.69334157445985, 624.05370504252983, 624.41427672483007, 624.77505674166491,
+    625.13604521340744, 625.49724226050103, 625.85864800345826, 626.22026256286085,
+    626.58208605936181, 626.94411861368212, 627.30636034661347, 627.66881137901692,
+    628.03147183182364, 628.39434182603429, 628.75742148271945, 629.12071092302074,
+    629.48421026814844, 629.84791963938335, 630.21183915807649, 630.57596894564881,
+    630.94030912359085, 631.30485981346499, 631.66962113690238, 632.03459321560479,
+    632.39977617134457, 632.76517012596412, 633.1307752013762, 633.49659151956416,
+    633.86261920258255, 634.22885837255524, 634.59530915167727, 634.96197166221407,
+    635.32884602650188, 635.69593236694777, 636.06323080602863, 636.43074146629374,
+    636.79846447036198, 637.16639994092327, 637.5345480007386, 637.90290877263965,
+    638.2714823795294, 638.64026894438109, 639.00926859024059, 639.37848144022337,
+    639.7479076175166, 640.11754724537843, 640.48740044713861, 640.8574673461975,
+    641.22774806602717, 641.59824273017159, 641.96895146224517, 642.33987438593408,
+    642.71101162499622, 643.08236330326042, 643.45392954462727, 643.82571047306965,
+    644.19770621263126, 644.56991688742767, 644.94234262164616, 645.31498353954601,
+    645.68783976545774, 646.06091142378398, 646.43419863899999, 646.80770153565186,
+    647.1814202383581, 647.55535487180919, 647.92950556076755, 648.30387243006794,
+    648.67845560461649, 649.05325520939323, 649.42827136944845, 649.8035042099059,
+    650.17895385596091, 650.55462043288185, 650.93050406600889, 651.30660488075432,
+    651.6829230026043, 652.05945855711627, 652.43621166992034, 652.81318246671981,
+    653.19037107328973, 653.56777761547869, 653.94540221920693, 654.32324501046901,
+    654.70130611533114, 655.07958565993238, 655.45808377048502, 655.83680057327422,
+    656.21573619465801, 656.59489076106718, 656.97426439900653, 657.35385723505283,
+    657.73366939585674, 658.11370100814156, 658.49395219870405, 658.87442309441406,
+    659.25511382221543, 659.63602450912447, 660.01715528223144, 660.39850626869986,
+    660.78007759576644, 661.16186939074191, 661.54388178100965, 661.92611489402839,
+    662.30856885732874, 662.69124379851598, 663.07413984526863, 663.4572571253392,
+    663.84059576655397, 664.2241558968127, 664.60793764409016, 664.99194113643398,
+    665.37616650196628, 665.76061386888284, 666.14528336545379, 666.5301751200235,
+    666.91528926100966, 667.30062591690569, 667.68618521627809, 668.07196728776773,
+    668.45797226009006, 668.84420026203509, 669.23065142246662, 669.61732587032304,
+    670.00422373461834, 670.39134514443958, 670.77869022894936, 671.16625911738424,
+    671.55405193905608, 671.9420688233505, 672.33030989972951, 672.71877529772837,
+    673.10746514695779, 673.49637957710354, 673.88551871792595, 674.2748826992605,
+    674.66447165101738, 675.0542857031827, 675.44432498581693, 675.83458962905581,
+    676.22507976311033, 676.61579551826685, 677.00673702488655, 677.39790441340608,
+    677.78929781433851, 678.1809173582709, 678.57276317586627, 678.96483539786334,
+    679.35713415507598, 679.74965957839413, 680.14241179878229, 680.53539094728262,
+    680.92859715501118, 681.32203055316063, 681.71569127299904, 682.10957944587028,
+    682.50369520319475, 682.89803867646776, 683.29260999726193, 683.68740929722492,
+    684.08243670808065, 684.47769236162901, 684.8731763897465, 685.26888892438558,
+    685.66483009757417, 686.06100004141831, 686.45739888809885, 686.85402676987349,
+    687.25088381907608, 687.64797016811735, 688.04528594948385, 688.44283129574012,
+    688.84060633952572, 689.23861121355765, 689.6368460506294, 690.035310983611,
+    690.43400614544976, 690.83293166916894, 691.23208768786992, 691.63147433473,
+    692.0310917430038, 692.43094004602267, 692.83101937719528, 693.23132987000713,
+    693.63187165802071, 694.03264487487672, 694.43364965429214, 694.83488613006102,
+    695.23635443605519, 695.6380547062239, 696.03998707459345, 696.44215167526738,
+    696.84454864242787, 697.24717811033361, 697.65004021332072, 698.05313508580366,
+    698.45646286227395, 698.86002367730123, 699.26381766553232, 699.66784496169305,
+    700.07210570058589, 700.47660001709153, 700.88132804616862, 701.28628992285394,
+    701.69148578226191, 702.09691575958584, 702.50257999009625, 702.90847860914232,
+    703.31461175215122, 703.72097955462834, 704.12758215215752, 704.53441968040056,
+    704.94149227509865, 705.34880007207039, 705.75634320721326, 706.16412181650298,
+    706.57213603599416, 706.98038600181985, 707.38887185019144, 707.79759371740022,
+    708.20655173981493, 708.61574605388364, 709.02517679613311, 709.43484410316933,
+    709.84474811167649, 710.25488895841818, 710.66526678023763, 711.07588171405644,
+    711.48673389687508, 711.89782346577374, 712.30915055791149, 712.720715310527,
+    713.13251786093736, 713.5445583465405, 713.95683690481246, 714.36935367330932,
+    714.78210878966615, 715.19510239159797, 715.60833461689936, 716.02180560344391,
+    716.43551548918606, 716.84946441215902, 717.26365251047594, 717.67807992232974,
+    718.09274678599331, 718.50765323981909, 718.92279942224047, 719.33818547176963,
+    719.75381152699958, 720.1696777266028, 720.58578420933225, 721.00213111402104,
+    721.41871857958222, 721.83554674500976, 722.25261574937736, 722.66992573183927,
+    723.08747683162994, 723.50526918806452, 723.92330294053863, 724.34157822852774,
+    724.76009519158958, 725.17885396936117, 725.5978547015601, 726.01709752798558,
+    726.43658258851679, 726.85631002311402, 727.27627997181821, 727.69649257475214,
+    728.11694797211862, 728.53764630420187, 728.9585877113667, 729.37977233405934,
+    729.8012003128074, 730.22287178821898, 730.64478690098451, 731.06694579187501,
+    731.48934860174279, 731.91199547152155, 732.33488654222674, 732.75802195495442,
+    733.18140185088407, 733.60502637127468, 734.02889565746796, 734.45300985088704,
+    734.87736909303658, 735.30197352550317, 735.72682328995495, 736.1519185281428,
+    736.57725938189867, 737.00284599313659, 737.42867850385255, 737.85475705612475,
+    738.28108179211347, 738.70765285406048, 739.13447038429138, 739.56153452521244,
+    739.98884541931284, 740.41640320916383, 740.84420803741921, 741.27226004681529,
+    741.70055938017015, 742.12910618038597, 742.55790059044602, 742.98694275341654,
+    743.41623281244688, 743.84577091076858, 744.27555719169607, 744.7055917986263,
+    745.13587487504026, 745.56640656450065, 745.99718701065353, 746.42821635722783,
+    746.85949474803556, 747.29102232697198, 747.72279923801477, 748.15482562522629,
+    748.587101632751, 749.01962740481679, 749.452403085735, 749.88542881990031,
+    750.31870475179051, 750.75223102596806, 751.18600778707753, 751.62003517984783,
+    752.05431334909122, 752.48884243970372, 752.92362259666493, 753.35865396503834,
+    753.79393668997159, 754.22947091669573, 754.66525679052597, 755.10129445686107,
+    755.53758406118436, 755.97412574906286, 756.41091966614715, 756.84796595817386,
+    757.28526477096193, 757.72281625041524, 758.16062054252211, 758.5986777933548,
+    759.03698814907011, 759.47555175590935, 759.91436876019895, 760.35343930834892,
+    760.79276354685419, 761.2323416222946, 761.67217368133413, 762.11225987072214,
+    762.55260033729178, 762.99319522796281, 763.43404468973847, 763.875148869707,
+    764.31650791504194, 764.75812197300206, 765.19999119093029, 765.64211571625628,
+    766.08449569649372, 766.52713127924164, 766.97002261218438, 767.41316984309185,
+    767.85657311981936, 768.30023259030668, 768.74414840258112, 769.18832070475366,
+    769.63274964502148, 770.07743537166743, 770.52237803305991, 770.9675777776531,
+    771.41303475398661, 771.85874911068731, 772.30472099646602, 772.75095056012071,
+    773.19743795053466, 773.64418331667764, 774.09118680760525, 774.53844857245895,
+    774.98596876046736, 775.43374752094451, 775.8817850032907, 776.33008135699276,
+    776.77863673162381, 777.22745127684334, 777.67652514239705, 778.12585847811852,
+    778.57545143392622, 779.02530415982608, 779.47541680591041, 779.92578952235829,
+    780.37642245943596, 780.82731576749541, 781.2784695969774, 781.72988409840787,
+    782.18155942240026, 782.63349571965534, 783.08569314096053, 783.5381518371903,
+    783.99087195930724, 784.44385365836013, 784.89709708548548, 785.35060239190693,
+    785.80436972893563, 786.25839924797003, 786.7126911004957, 787.16724543808721,
+    787.62206241240506, 788.07714217519811, 788.53248487830274, 788.98809067364323,
+    789.44395971323127, 789.9000921491662, 790.35648813363673, 790.81314781891797,
+    791.27007135737347, 791.72725890145477, 792.18471060370155, 792.64242661674155,
+    793.10040709329053, 793.55865218615349, 794.01716204822253, 794.47593683247851,
+    794.93497669199076, 795.39428177991681, 795.85385224950312, 796.31368825408367,
+    796.77378994708306, 797.23415748201239, 797.69479101247271, 798.15569069215326,
+    798.61685667483243, 799.0782891143765, 799.53998816474257, 800.00195397997538,
+    800.46418671420838, 800.92668652166492, 801.38945355665692, 801.85248797358588,
+    802.31578992694142, 802.77935957130455, 803.24319706134372, 803.70730255181752,
+    804.17167619757345, 804.63631815354915, 805.10122857477131, 805.56640761635583,
+    806.03185543350969, 806.4975721815282, 806.96355801579659, 807.42981309179038,
+    807.89633756507453, 808.36313159130373, 808.83019532622257, 809.29752892566694,
+    809.76513254556107, 810.23300634191992, 810.7011504708488, 811.16956508854287,
+    811.63825035128775, 812.10720641545879, 812.57643343752329, 813.04593157403735,
+    813.51570098164814, 813.98574181709296, 814.45605423720031, 814.9266383988886,
+    815.39749445916709, 815.86862257513678, 816.34002290398814, 816.81169560300293,
+    817.28364082955363, 817.75585874110402, 818.22834949520791, 818.70111324951199,
+    819.17415016175244, 819.64746038975704, 820.12104409144456, 820.59490142482559,
+    821.06903254800125, 821.54343761916425, 822.01811679659966, 822.49307023868289,
+    822.9682981038809, 823.44380055075271, 823.91957773794866, 824.3956298242108,
+    824.8719569683725, 825.34855932936034, 825.82543706619106, 826.30259033797404,
+    826.78001930391054, 827.25772412329354, 827.7357049555086, 828.21396196003229,
+    828.69249529643503, 829.17130512437814, 829.6503916036155, 830.12975489399332,
+    830.60939515544999, 831.08931254801678, 831.56950723181649, 832.04997936706616,
+    832.53072911407367, 833.01175663324034, 833.49306208505993, 833.97464563011897,
+    834.4565074290964, 834.93864764276555, 835.42106643199077, 835.90376395773001,
+    836.38674038103454, 836.86999586304842, 837.35353056500878, 837.83734464824545,
+    838.32143827418304, 838.80581160433792, 839.29046480032025, 839.77539802383353,
+    840.26061143667471, 840.74610520073418, 841.23187947799568, 841.71793443053753,
+    842.20427022053059, 842.69088701023975, 843.17778496202391, 843.66496423833507,
+    844.15242500172008, 844.64016741481839, 845.12819164036557, 845.61649784118913,
+    846.10508618021152, 846.59395682044919, 847.08310992501288, 847.57254565710753,
+    848.06226418003166, 848.55226565718021, 849.04255025204031, 849.53311812819459,
+    850.02396944931991, 850.51510437918796, 851.0065230816648, 851.49822572071071,
+    851.99021246038217, 852.48248346482933, 852.97503889829727, 853.467878925126,
+    853.96100370975068, 854.45441341670073, 854.94810821060253, 855.44208825617557,
+    855.93635371823541, 856.43090476169277, 856.92574155155341, 857.4208642529187,
+    857.91627303098471, 858.41196805104482, 858.90794947848588, 859.40421747879122,
+    859.9007722175395, 860.39761386040539, 860.89474257315874, 861.39215852166535,
+    861.88986187188789, 862.38785278988348, 862.88613144180601, 863.38469799390487,
+    863.88355261252582, 864.38269546411084, 864.88212671519716, 865.38184653242001,
+    865.88185508250967, 866.38215253229259, 866.88273904869232, 867.38361479872822,
+    867.88477994951654, 868.38623466826959, 868.88797912229779, 869.39001347900637,
+    869.8923379058981, 870.39495257057285, 870.89785764072644, 871.40105328415189,
+    871.90453966874043, 872.40831696247869, 872.91238533345086, 873.41674494983829,
+    873.92139597991979, 874.42633859207081, 874.93157295476396, 875.43709923657082,
+    875.94291760615874, 876.44902823229268, 876.95543128383554, 877.46212692974768,
+    877.96911533908724, 878.47639668100885, 878.98397112476732, 879.4918388397133,
+    879.99999999529552, 880.5084547610611, 881.01720330665501, 881.52624580181998,
+    882.03558241639655, 882.54521332032482, 883.05513868364153, 883.56535867648245,
+    884.0758734690811, 884.58668323177005, 885.09778813497951, 885.60918834923848,
+    886.12088404517522, 886.63287539351575, 887.14516256508477, 887.65774573080591,
+    888.17062506170134, 888.68380072889238, 889.19727290359833, 889.71104175713924,
+    890.22510746093269, 890.7394701864954, 891.25413010544332, 891.76908738949203,
+    892.28434221045529, 892.79989474024774, 893.31574515088198, 893.83189361447057,
+    894.34834030322509, 894.86508538945714, 895.38212904557747, 895.89947144409643,
+    896.41711275762486, 896.93505315887262, 897.45329282064904, 897.97183191586396,
+    898.49067061752692, 899.00980909874716, 899.52924753273385, 900.04898609279758,
+    900.56902495234749, 901.08936428489335, 901.61000426404541, 902.13094506351422,
+    902.65218685711034, 903.17372981874473, 903.69557412243, 904.21771994227822,
+    904.74016745250185, 905.26291682741464, 905.78596824143085, 906.30932186906546,
+    906.83297788493383, 907.35693646375375, 907.88119778034229, 908.40576200961834,
+    908.93062932660155, 909.45579990641284, 909.98127392427375, 910.50705155550861,
+    911.03313297554166, 911.55951835989879, 912.08620788420751, 912.61320172419653,
+    913.14050005569629, 913.66810305463821, 914.19601089705714, 914.72422375908786,
+    915.2527418169675, 915.78156524703502, 916.31069422573114, 916.8401289295989,
+    917.36986953528231, 917.89991621952947, 918.43026915918881, 918.96092853121138,
+    919.49189451265079, 920.02316728066251, 920.55474701250478, 921.08663388553737,
+    921.61882807722441, 922.15132976513087, 922.68413912692495, 923.21725634037716,
+    923.75068158336103, 924.28441503385295, 924.81845686993108, 925.35280726977896,
+    925.88746641168052, 926.42243447402393, 926.95771163530026, 927.49329807410322,
+    928.02919396913046, 928.56539949918204, 929.1019148431626, 929.63874018007914,
+    930.17587568904207, 930.71332154926574, 931.25107794006783, 931.78914504086902,
+    932.32752303119548, 932.86621209067516, 933.40521239904092, 933.94452413612873,
+    934.48414748187906, 935.02408261633605, 935.56432971964739, 936.10488897206653,
+    936.64576055394934, 937.18694464575651, 937.7284414280532, 938.27025108150838,
+    938.81237378689605, 939.35480972509345, 939.89755907708457, 940.44062202395583,
+    940.98399874689926, 941.52768942721139, 942.07169424629342, 942.61601338565129,
+    943.16064702689562, 943.70559535174334, 944.25085854201473, 944.79643677963588,
+    945.34233024663763, 945.88853912515629, 946.43506359743344, 946.98190384581505,
+    947.52906005275463, 948.07653240080901, 948.62432107264124, 949.17242625101983,
+    949.72084811881905, 950.26958685901798, 950.81864265470335, 951.36801568906606,
+    951.91770614540314, 952.46771420711787, 953.01804005771919, 953.56868388082205,
+    954.11964586014722, 954.67092617952312, 955.22252502288268, 955.77444257426589,
+    956.32667901781872, 956.87923453779376, 957.43210931855003, 957.98530354455238,
+    958.53881740037434, 959.09265107069393, 959.64680474029649, 960.20127859407444,
+    960.75607281702673, 961.31118759425931, 961.86662311098462, 962.42237955252347,
+    962.97845710430272, 963.534855951856, 964.09157628082494, 964.64861827695802,
+    965.20598212611117, 965.76366801424717, 966.32167612743774, 966.88000665186075,
+    967.43865977380199, 967.99763567965488, 968.55693455592063, 969.11655658920802,
+    969.67650196623333, 970.23677087382237, 970.79736349890698, 971.35828002852782,
+    971.91952064983354, 972.48108555008105, 973.04297491663442, 973.60518893696826,
+    974.16772779866346, 974.73059168941006, 975.29378079700621, 975.85729530935907,
+    976.42113541448396, 976.98530130050426, 977.54979315565413, 978.11461116827445,
+    978.67975552681548, 979.24522641983674, 979.81102403600619, 980.37714856410105,
+    980.94360019300689, 981.51037911172068, 982.07748550934616, 982.64491957509745,
+    983.21268149829746, 983.78077146837893, 984.34918967488386, 984.91793630746326,
+    985.48701155587946, 986.05641561000266, 986.62614865981334, 987.19621089540169,
+    987.76660250696784, 988.33732368482185, 988.90837461938281, 989.47975550118235,
+    990.05146652085944, 990.62350786916454, 991.19587973695798, 991.76858231521044,
+    992.34161579500255, 992.9149803675266, 993.4886762240842, 994.06270355608763,
+    994.63706255506008, 995.21175341263495, 995.7867763205569, 996.36213147068042,
+    996.93781905497303, 997.51383926551068, 998.09019229448165, 998.66687833418484,
+    999.24389757703034, 999.82125021553941, 1000.3989364423439, 1000.976956450189,
+    1001.5553104319293, 1002.1339985805313, 1002.7130210890731, 1003.2923781507443,
+    1003.8720699588464, 1004.4520967067915, 1005.0324585881059, 1005.6131557964252,
+    1006.1941885254979, 1006.7755569691845, 1007.3572613214574, 1007.9393017764008,
+    1008.5216785282111, 1009.1043917711978, 1009.6874416997817, 1010.2708285084962,
+    1010.854552391987, 1011.4386135450123, 1012.0230121624431, 1012.6077484392621,
+    1013.1928225705665, 1013.7782347515646, 1014.3639851775778, 1014.9500740440407,
+    1015.5365015465005, 1016.1232678806169, 1016.7103732421647, 1017.2978178270297,
+    1017.8856018312114, 1018.4737254508227, 1019.0621888820903, 1019.6509923213532,
+    1020.2401359650642, 1020.8296200097909, 1021.4194446522131, 1022.0096100891243,
+    1022.6001165174322, 1023.1909641341578, 1023.7821531364364, 1024.3736837215163,
+    1024.9655560867616, 1025.5577704296488, 1026.1503269477689, 1026.7432258388271,
+    1027.3364673006431, 1027.9300515311509, 1028.5239787283974, 1029.1182490905467,
+    1029.7128628158755, 1030.3078201027752, 1030.903121149752, 1031.4987661554271,
+    1032.094755318536, 1032.6910888379289, 1033.2877669125724, 1033.884789741546,
+    1034.4821575240453, 1035.079870459381, 1035.6779287469788, 1036.2763325863787,
+    1036.8750821772383, 1037.4741777193287, 1038.0736194125366, 1038.6734074568647,
+    1039.2735420524309, 1039.874023399469, 1040.4748516983277, 1041.0760271494735,
+    1041.6775499534863, 1042.2794203110632, 1042.8816384230172, 1043.4842044902769,
+    1044.0871187138871, 1044.6903812950086, 1045.2939924349196, 1045.8979523350135,
+    1046.5022611968, 1047.1069192219054, 1047.7119266120731, 1048.3172835691619,
+    1048.9229902951477, 1049.5290469921244, 1050.1354538623011, 1050.7422111080041,
+    1051.3493189316766, 1051.9567775358792, 1052.5645871232887, 1053.1727478966993,
+    1053.7812600590237, 1054.3901238132901, 1054.9993393626444, 1055.6089069103507,
+    1056.2188266597893, 1056.8290988144593, 1057.4397235779754, 1058.0507011540731,
+    1058.6620317466031, 1059.2737155595344, 1059.885752796954, 1060.4981436630674,
+    1061.1108883621962, 1061.7239870987833, 1062.3374400773864, 1062.9512475026836,
+    1063.56540957947, 1064.1799265126601, 1064.7947985072856, 1065.4100257684966,
+    1066.025608501564, 1066.6415469118749, 1067.2578412049363, 1067.8744915863731,
+    1068.4914982619291, 1069.1088614374682, 1069.7265813189711, 1070.3446581125402,
+    1070.9630920243944, 1071.5818832608741, 1072.2010320284364, 1072.8205385336601,
+    1073.4404029832413, 1074.0606255839964, 1074.6812065428626, 1075.3021460668949,
+    1075.9234443632686, 1076.5451016392778, 1077.1671181023385, 1077.7894939599839,
+    1078.4122294198685, 1079.0353246897678, 1079.6587799775755, 1080.2825954913067,
+    1080.9067714390953, 1081.5313080291971, 1082.1562054699864, 1082.7814639699604,
+    1083.4070837377344, 1084.0330649820453, 1084.6594079117506, 1085.2861127358278,
+    1085.9131796633765, 1086.5406089036151, 1087.1684006658857, 1087.7965551596483,
+    1088.4250725944862, 1089.0539531801028, 1089.6831971263223, 1090.3128046430911,
+    1090.9427759404757, 1091.573111228666, 1092.2038107179715, 1092.8348746188235,
+    1093.4663031417758, 1094.0980964975026, 1094.7302548968005, 1095.3627785505873,
+    1095.9956676699048, 1096.6289224659142, 1097.2625431498996, 1097.8965299332674,
+    1098.530883027546, 1099.1656026443859, 1099.8006889955591, 1100.4361422929628,
+    1101.0719627486135, 1101.7081505746514, 1102.3447059833395, 1102.9816291870632,
+    1103.6189203983304, 1104.2565798297715, 1104.8946076941411, 1105.5330042043161,
+    1106.1717695732955, 1106.8109040142022, 1107.4504077402821, 1108.090280964904,
+    1108.7305239015609, 1109.3711367638684, 1110.0121197655656, 1110.6534731205147,
+    1111.2951970427027, 1111.937291746239, 1112.5797574453563, 1113.2225943544136,
+    1113.8658026878916, 1114.509382660395, 1115.1533344866532, 1115.7976583815193,
+    1116.4423545599709, 1117.0874232371084, 1117.7328646281592, 1118.378678948473,
+    1119.0248664135243, 1119.671427238912, 1120.3183616403601, 1120.9656698337167,
+    1121.6133520349542, 1122.2614084601721, 1122.9098393255917, 1123.5586448475615,
+    1124.2078252425536, 1124.8573807271657, 1125.5073115181208, 1126.1576178322659,
+    1126.8082998865764, 1127.4593578981501, 1128.1107920842105, 1128.7626026621083,
+    1129.4147898493181, 1130.0673538634403, 1130.7202949222028, 1131.3736132434576,
+    1132.0273090451831, 1132.6813825454828, 1133.3358339625877, 1133.9906635148541,
+    1134.6458714207633, 1135.3014578989264, 1135.957423168077, 1136.6137674470767,
+    1137.2704909549134, 1137.9275939107019, 1138.5850765336827, 1139.2429390432233,
+    1139.9011816588193, 1140.5598046000914, 1141.2188080867877, 1141.8781923387833,
+    1142.5379575760805, 1143.1981040188086, 1143.8586318872235, 1144.5195414017105,
+    1145.1808327827794, 1145.8425062510692, 1146.5045620273456, 1147.1670003325025,
+    1147.8298213875607, 1148.4930254136684, 1149.156612632104, 1149.8205832642709,
+    1150.4849375317021, 1151.1496756560575, 1151.8147978591257, 1152.4803043628233,
+    1153.1461953891946, 1153.8124711604144, 1154.4791318987832, 1155.146177826731,
+    1155.8136091668164, 1156.4814261417262, 1157.1496289742759, 1157.818217887411,
+    1158.4871931042048, 1159.1565548478584, 1159.826303341704, 1160.4964388092014,
+    1161.1669614739396, 1161.8378715596368, 1162.5091692901424, 1163.1808548894321,
+    1163.8529285816128, 1164.5253905909203, 1165.1982411417205, 1165.8714804585086,
+    1166.5451087659085, 1167.2191262886765, 1167.8935332516962, 1168.5683298799825,
+    1169.2435163986795, 1169.9190930330622, 1170.5950600085348, 1171.2714175506323,
+    1171.9481658850207, 1172.6253052374955, 1173.3028358339825, 1173.9807579005383,
+    1174.6590716633509, 1175.3377773487375, 1176.0168751831463, 1176.6963653931587,
+    1177.3762482054844, 1178.0565238469644, 1178.7371925445721, 1179.4182545254102,
+    1180.0997100167135, 1180.7815592458498, 1181.4638024403157, 1182.1464398277401,
+    1182.8294716358839, 1183.512898092639, 1184.1967194260294, 1184.8809358642097,
+    1185.5655476354691, 1186.2505549682262, 1186.9359580910318, 1187.6217572325695,
+    1188.3079526216547, 1188.9945444872353, 1189.6815330583904, 1190.3689185643336,
+    1191.0567012344095, 1191.7448812980945, 1192.4334589849993, 1193.1224345248656,
+    1193.8118081475693, 1194.5015800831179, 1195.1917505616532, 1195.8823198134489,
+    1196.5732880689113, 1197.2646555585816, 1197.9564225131326, 1198.6485891633706,
+    1199.3411557402355, 1200.0341224748017, 1200.7274895982755, 1201.4212573419975,
+    1202.1154259374416, 1202.8099956162162, 1203.5049666100626, 1204.2003391508561,
+    1204.8961134706074, 1205.5922898014594, 1206.2888683756903, 1206.9858494257119,
+    1207.6832331840703, 1208.3810198834456, 1209.0792097566543, 1209.7778030366455,
+    1210.4767999565033, 1211.1762007494463, 1211.8760056488286, 1212.5762148881381,
+    1213.2768287009978, 1213.9778473211675, 1214.6792709825397, 1215.3810999191435,
+    1216.0833343651418, 1216.7859745548344, 1217.4890207226554, 1218.1924731031741,
+    1218.8963319310974, 1219.6005974412656, 1220.3052698686552, 1221.0103494483792,
+    1221.7158364156853, 1222.4217310059582, 1223.1280334547175, 1223.8347439976208,
+    1224.5418628704599, 1225.2493903091638, 1225.9573265497972, 1226.6656718285619,
+    1227.3744263817957, 1228.0835904459723, 1228.7931642577041, 1229.5031480537389,
+    1230.2135420709603, 1230.9243465463908, 1231.6355617171882, 1232.3471878206478,
+    1233.0592250942032, 1233.7716737754231, 1234.4845341020155, 1235.197806311824,
+    1235.9114906428306, 1236.6255873331547, 1237.3400966210522, 1238.0550187449198,
+    1238.7703539432882, 1239.4861024548281, 1240.202264518347, 1240.9188403727915,
+    1241.6358302572453, 1242.3532344109296, 1243.0710530732069, 1243.7892864835749,
+    1244.5079348816705, 1245.2269985072696, 1245.946477600286, 1246.6663724007726,
+    1247.3866831489197, 1248.1074100850597, 1248.8285534496601, 1249.5501134833298,
+    1250.2720904268149, 1250.9944845210021, 1251.7172960069165, 1252.4405251257217,
+    1253.1641721187236, 1253.8882372273642, 1254.6127206932269, 1255.3376227580338,
+    1256.0629436636473, 1256.7886836520686, 1257.5148429654389, 1258.2414218460415,
+    1258.9684205362969, 1259.6958392787667, 1260.423678316153, 1261.1519378912976,
+    1261.8806182471817, 1262.60971962693, 1263.3392422738048, 1264.0691864312096,
+    1264.7995523426891, 1265.5303402519282, 1266.2615504027524, 1266.9931830391283,
+    1267.7252384051651, 1268.4577167451105, 1269.1906183033545, 1269.9239433244281,
+    1270.6576920530038, 1271.3918647338955, 1272.1264616120573, 1272.8614829325875,
+    1273.596928940724, 1274.3327998818465, 1275.0690960014772, 1275.8058175452793,
+    1276.5429647590588, 1277.2805378887622, 1278.0185371804812, 1278.7569628804467,
+    1279.4958152350332, 1280.2350944907569, 1280.9748008942772, 1281.714934692395,
+    1282.4554961320543, 1283.1964854603432, 1283.9379029244903, 1284.6797487718682,
+    1285.4220232499924, 1286.1647266065208, 1286.9078590892545, 1287.6514209461393,
+    1288.3954124252625, 1289.1398337748553, 1289.8846852432923, 1290.629967079092,
+    1291.3756795309155, 1292.121822847568, 1292.868397278, 1293.6154030713037,
+    1294.3628404767162, 1295.1107097436184, 1295.8590111215351, 1296.6077448601359,
+    1297.356911209233, 1298.1065104187865, 1298.8565427388969, 1299.6070084198118,
+    1300.3579077119218, 1301.1092408657637, 1301.8610081320178, 1302.6132097615086,
+    1303.3658460052086, 1304.1189171142325, 1304.8724233398407, 1305.6263649334396,
+    1306.3807421465795, 1307.1355552309574, 1307.8908044384139, 1308.646490020938,
+    1309.4026122306623, 1310.1591713198648, 1310.91616754097, 1311.6736011465484,
+    1312.431472389316, 1313.1897815221344, 1313.9485287980131, 1314.7077144701057,
+    1315.4673387917135, 1316.2274020162831, 1316.9879043974081, 1317.7488461888281,
+    1318.5102276444309, 1319.2720490182489, 1320.0343105644629, 1320.7970125373997,
+    1321.5601551915329, 1322.3237387814838, 1323.0877635620193, 1323.8522297880568,
+    1324.6171377146575, 1325.382487597032, 1326.1482796905373, 1326.9145142506784,
+    1327.6811915331079, 1328.4483117936254, 1329.2158752881803, 1329.983882272868,
+    1330.7523330039326, 1331.5212277377657, 1332.2905667309076, 1333.060350240047,
+    1333.8305785220193, 1334.6012518338114, 1335.3723704325562, 1336.1439345755355,
+    1336.9159445201801, 1337.6884005240702, 1338.4613028449332, 1339.2346517406461,
+    1340.0084474692367, 1340.7826902888792, 1341.5573804578987, 1342.3325182347685,
+    1343.1081038781122, 1343.884137646701, 1344.660619799459, 1345.4375505954567,
+    1346.2149302939156, 1346.9927591542071, 1347.7710374358519, 1348.549765398521,
+    1349.3289433020348, 1350.1085714063654, 1350.8886499716339, 1351.6691792581116,
+    1352.4501595262207, 1353.2315910365337, 1354.0134740497731, 1354.7958088268122,
+    1355.578595628677, 1356.3618347165418, 1357.1455263517325, 1357.9296707957267,
+    1358.714268310152, 1359.4993191567883, 1360.2848235975648, 1361.0707818945652,
+    1361.8571943100224, 1362.6440611063213, 1363.4313825459981, 1364.2191588917406,
+    1365.0073904063895, 1365.7960773529355, 1366.5852199945239, 1367.3748185944498,
+    1368.1648734161613, 1368.955384723258, 1369.746352779493, 1370.5377778487712,
+    1371.3296601951483, 1372.1220000828366, 1372.9147977761977, 1373.708053539747,
+    1374.5017676381522, 1375.2959403362347, 1376.0905718989677, 1376.8856625914802,
+    1377.6812126790514, 1378.4772224271153, 1379.2736921012588, 1380.070621967222,
+    1380.8680122908995, 1381.6658633383379, 1382.4641753757398, 1383.26294866946,
+    1384.0621834860076, 1384.8618800920453, 1385.6620387543906, 1386.4626597400143,
+    1387.2637433160414, 1388.0652897497534, 1388.8672993085843, 1389.669772260122,
+    1390.4727088721104, 1391.2761094124478, 1392.0799741491869, 1392.8843033505348,
+    1393.6890972848557, 1394.4943562206672, 1395.3000804266414, 1396.1062701716073,
+    1396.9129257245479, 1397.7200473546025, 1398.5276353310646, 1399.3356899233861,
+    1400.1442114011718, 1400.9532000341831, 1401.7626560923372, 1402.5725798457079,
+    1403.3829715645238, 1404.1938315191717, 1405.0051599801925, 1405.8169572182846,
+    1406.6292235043024, 1407.4419591092567, 1408.255164304315, 1409.0688393608011,
+    1409.8829845501973, 1410.6976001441408, 1411.5126864144265, 1412.328243633006,
+    1413.1442720719883, 1413.9607720036397, 1414.7777437003829, 1415.5951874348004,
+    1416.4131034796299, 1417.2314921077673, 1418.0503535922662, 1418.8696882063387,
+    1419.689496223353, 1420.5097779168364, 1421.3305335604753, 1422.1517634281129,
+    1422.9734677937502, 1423.7956469315475, 1424.618301115823, 1425.441430621054,
+    1426.2650357218747, 1427.089116693081, 1427.9136738096249, 1428.7387073466186,
+    1429.5642175793323, 1430.3902047831959, 1431.2166692337987, 1432.0436112068878,
+    1432.8710309783721, 1433.698928824318, 1434.5273050209519, 1435.3561598446595,
+    1436.1854935719866, 1437.0153064796382, 1437.8455988444809, 1438.6763709435393,
+    1439.5076230539992, 1440.3393554532056, 1441.1715684186645, 1442.0042622280421,
+    1442.8374371591644, 1443.6710934900195, 1444.5052314987547, 1445.3398514636785,
+    1446.1749536632599, 1447.010538376129, 1447.8466058810773, 1448.6831564570555,
+    1449.5201903831792, 1450.3577079387223, 1451.1957094031202, 1452.0341950559712,
+    1452.8731651770336, 1453.712620046228, 1454.5525599436364, 1455.3929851495043,
+    1456.2338959442372, 1457.0752926084037, 1457.9171754227334, 1458.7595446681187,
+    1459.6024006256148, 1460.445743576438, 1461.289573801969, 1462.13389158375,
+    1462.9786972034856, 1463.8239909430431, 1464.6697730844535, 1465.5160439099088,
+    1466.3628037017681, 1467.2100527425494, 1468.0577913149359, 1468.9060197017741,
+    1469.7547381860732, 1470.6039470510063, 1471.4536465799099, 1472.3038370562856,
+    1473.1545187637973, 1474.0056919862732, 1474.8573570077051, 1475.7095141122495,
+    1476.5621635842269, 1477.415305708121, 1478.2689407685828, 1479.1230690504249,
+    1479.9776908386257, 1480.8328064183277, 1481.6884160748384, 1482.5445200936306,
+    1483.4011187603403, 1484.2582123607719, 1485.115801180892, 1485.9738855068331,
+    1486.8324656248938, 1487.6915418215372, 1488.5511143833921, 1489.4111835972526,
+    1490.2717497500805, 1491.1328131290013, 1491.9943740213071, 1492.8564327144557,
+    1493.7189894960711, 1494.582044653944, 1495.4455984760295, 1496.3096512504526,
+    1497.174203265502, 1498.0392548096336, 1498.90480617147, 1499.7708576398006,
+    1500.637409503581, 1501.5044620519361, 1502.3720155741551, 1503.2400703596957,
+    1504.1086266981824, 1504.9776848794074, 1505.8472451933299, 1506.7173079300767,
+    1507.5878733799432, 1508.4589418333915, 1509.3305135810519, 1510.2025889137221,
+    1511.0751681223687, 1511.9482514981257, 1512.8218393322943, 1513.6959319163477,
+    1514.5705295419239, 1515.4456325008305, 1516.3212410850442, 1517.1973555867096,
+    1518.0739762981402, 1518.9511035118187, 1519.8287375203979, 1520.7068786166978,
+    1521.5855270937084, 1522.4646832445892, 1523.3443473626683, 1524.2245197414443,
+    1525.1052006745836, 1525.9863904559256, 1526.8680893794769, 1527.750297739414,
+    1528.6330158300839, 1529.5162439460041, 1530.3999823818606, 1531.2842314325126,
+    1532.1689913929874, 1533.0542625584833, 1533.9400452243688, 1534.8263396861837,
+    1535.7131462396387, 1536.6004651806134, 1537.4882968051622, 1538.3766414095073,
+    1539.265499290043, 1540.1548707433349, 1541.0447560661198, 1541.9351555553062,
+    1542.8260695079732, 1543.7174982213746, 1544.609441992932, 1545.5019011202414,
+    1546.3948759010693, 1547.2883666333553, 1548.1823736152105, 1549.0768971449179,
+    1549.9719375209347, 1550.867495041889, 1551.7635700065814, 1552.6601627139855,
+    1553.5572734632476, 1554.4549025536867, 1555.3530502847941, 1556.251716956237,
+    1557.1509028678524, 1558.0506083196522, 1558.9508336118208, 1559.8515790447166,
+    1560.7528449188719, 1561.6546315349908, 1562.5569391939548, 1563.4597681968157,
+    1564.3631188448005, 1565.2669914393107, 1566.1713862819211, 1567.0763036743806,
+    1567.9817439186145, 1568.8877073167203, 1569.794194170971, 1570.7012047838139,
+    1571.6087394578713, 1572.5167984959401, 1573.4253822009914, 1574.3344908761744,
+    1575.2441248248101, 1576.1542843503962, 1577.0649697566055, 1577.9761813472865,
+    1578.8879194264625, 1579.8001842983324, 1580.7129762672735, 1581.6262956378359,
+    1582.5401427147469, 1583.4545178029095, 1584.3694212074031, 1585.2848532334831,
+    1586.2008141865811, 1587.117304372307, 1588.0343240964451, 1588.951873664957,
+    1589.8699533839815, 1590.7885635598336, 1591.7077044990062, 1592.6273765081673,
+    1593.5475798941661, 1594.4683149640248, 1595.3895820249454, 1596.3113813843065,
+    1597.2337133496649, 1598.156578228753, 1599.0799763294851, 1600.0039079599508,
+    1600.9283734284168, 1601.8533730433298, 1602.7789071133138, 1603.7049759471718,
+    1604.6315798538828, 1605.5587191426091, 1606.4863941226874, 1607.414605103635,
+    1608.3433523951469, 1609.2726363070983, 1610.2024571495426, 1611.1328152327117,
+    1612.0637108670194, 1612.9951443630564, 1613.9271160315932, 1614.8596261835808,
+    1615.7926751301491, 1616.7262631826075, 1617.6603906524451, 1618.5950578513339,
+    1619.5302650911221, 1620.4660126838398, 1621.4023009416976, 1622.3391301770857,
+    1623.2765007025755, 1624.2144128309176, 1625.1528668750466, 1626.0918631480747,
+    1627.0314019632963, 1627.9714836341859, 1628.9121084744006, 1629.8532767977772,
+    1630.7949889183342, 1631.7372451502736, 1632.6800458079763, 1633.6233912060059,
+    1634.5672816591073, 1635.511717482208, 1636.4566989904158, 1637.402226499024,
+    1638.3483003235049, 1639.2949207795141, 1640.2420881828891, 1641.1898028496512,
+    1642.1380650960025, 1643.0868752383285, 1644.0362335931993, 1644.9861404773658,
+    1645.9365962077618, 1646.8876011015054, 1647.8391554758973, 1648.7912596484216,
+    1649.743913936745, 1650.6971186587207, 1651.6508741323821, 1652.6051806759481,
+    1653.5600386078211, 1654.5154482465871, 1655.4714099110172, 1656.4279239200646,
+    1657.3849905928701, 1658.3426102487563, 1659.300783207231, 1660.2595097879866,
+    1661.2187903109, 1662.1786250960336, 1663.139014463633, 1664.0999587341323,
+    1665.0614582281473, 1666.0235132664807, 1666.9861241701199, 1667.9492912602379,
+    1668.9130148581928, 1669.8772952855311, 1670.8421328639815, 1671.80752791546,
+    1672.7734807620691, 1673.7399917260968, 1674.7070611300176, 1675.6746892964909,
+    1676.6428765483661, 1677.6116232086758, 1678.5809296006405, 1679.5507960476671,
+    1680.5212228733494, 1681.4922104014684, 1682.4637589559914, 1683.4358688610751,
+    1684.4085404410612, 1685.3817740204795, 1686.3555699240478, 1687.3299284766701,
+    1688.3048500034402, 1689.2803348296368, 1690.2563832807311, 1691.2329956823783,
+    1692.210172360423, 1693.1879136408984, 1694.1662198500258, 1695.1450913142151,
+    1696.1245283600633, 1697.1045313143604, 1698.0851005040806, 1699.0662362563892,
+    1700.0479388986398, 1701.0302087583759, 1702.0130461633296, 1702.9964514414214,
+    1703.9804249207643, 1704.9649669296587, 1705.9500777965945, 1706.935757850252,
+    1707.9220074195014, 1708.9088268334015, 1709.8962164212051, 1710.8841765123511,
+    1711.8727074364708, 1712.8618095233855, 1713.8514831031068, 1714.8417285058374,
+    1715.8325460619694, 1716.8239361020896, 1717.8158989569718, 1718.8084349575824,
+    1719.801544435079, 1720.7952277208108, 1721.7894851463175, 1722.7843170433307,
+    1723.7797237437758, 1724.775705579767, 1725.772262883612, 1726.7693959878097,
+    1727.7671052250516, 1728.7653909282217, 1729.7642534303943, 1730.76369306484,
+    1731.7637101650193, 1732.7643050645852, 1733.7654780973846, 1734.7672295974564,
+    1735.7695598990331, 1736.7724693365392, 1737.7759582445956, 1738.7800269580127,
+    1739.7846758117962, 1740.7899051411457, 1741.7957152814529, 1742.8021065683038,
+    1743.8090793374809, 1744.8166339249574, 1745.8247706669017, 1746.8334898996766,
+    1747.8427919598396, 1748.8526771841416, 1749.8631459095279, 1750.8741984731416,
+    1751.8858352123175, 1752.8980564645854, 1753.9108625676711, 1754.9242538594954,
+    1755.9382306781745, 1756.9527933620177, 1757.9679422495346, 1758.9836776794266,
+    1759.999999990591, 1761.0169095221222, 1762.03440661331, 1763.05249160364,
+    1764.0711648327931, 1765.0904266406496, 1766.1102773672831, 1767.1307173529649,
+    1768.1517469381622, 1769.1733664635401, 1770.195576269959, 1771.218376698477,
+    1772.2417680903504, 1773.2657507870315, 1774.2903251301695, 1775.3154914616118,
+    1776.3412501234027, 1777.3676014577848, 1778.3945458071967, 1779.4220835142785,
+    1780.4502149218654, 1781.4789403729908, 1782.5082602108866, 1783.5381747789841,
+    1784.5686844209106, 1785.5997894804955, 1786.631490301764, 1787.6637872289411,
+    1788.6966806064502, 1789.7301707789143, 1790.7642580911549, 1791.7989428881929,
+    1792.8342255152497, 1793.8701063177452, 1794.9065856412981, 1795.9436638317279,
+    1796.9813412350538, 1798.0196181974943, 1799.0584950654677, 1800.0979721855952,
+    1801.138049904695, 1802.1787285697867, 1803.2200085280908, 1804.2618901270284,
+    1805.3043737142207, 1806.3474596374895, 1807.39114824486, 1808.4354398845564,
+    1809.4803349050037, 1810.5258336548293, 1811.5719364828617, 1812.6186437381309,
+    1813.6659557698677, 1814.7138729275075, 1815.7623955606846, 1816.8115240192367,
+    1817.8612586532031, 1818.9115998128257, 1819.9625478485475, 1821.0141031110172,
+    1822.0662659510833, 1823.1190367197976, 1824.172415768415, 1825.2264034483931,
+    1826.2810001113926, 1827.3362061092764, 1828.3920217941143, 1829.4484475181757,
+    1830.505483633935, 1831.56313049407, 1832.6213884514623, 1833.6802578591978,
+    1834.7397390705646, 1835.7998324390589, 1836.8605383183776, 1837.9218570624228,
+    1838.9837890253016, 1840.046334561325, 1841.1094940250096, 1842.1732677710747,
+    1843.2376561544488, 1844.3026595302617, 1845.3682782538499, 1846.4345126807543,
+    1847.5013631667221, 1848.5688300677059, 1849.6369137398622, 1850.7056145395579,
+    1851.774932823361, 1852.8448689480479, 1853.9154232706005, 1854.9865961482064,
+    1856.0583879382609, 1857.1307989983641, 1858.2038296863252, 1859.2774803601583,
+    1860.3517513780841, 1861.4266430985315, 1862.5021558801357, 1863.578290081738,
+    1864.655046062391, 1865.7324241813503, 1866.8104247980818, 1867.8890482722575,
+    1868.9682949637581, 1870.0481652326721, 1871.1286594392948, 1872.2097779441331,
+    1873.2915211078987, 1874.373889291513, 1875.4568828561064, 1876.5405021630168,
+    1877.6247475737921, 1878.7096194501869, 1879.7951181541691, 1880.8812440479117,
+    1881.9679974937985, 1883.0553788544228, 1884.1433884925868, 1885.2320267713026,
+    1886.3212940537912, 1887.4111907034867, 1888.5017170840295, 1889.5928735592718,
+    1890.6846604932753, 1891.7770782503126, 1892.8701271948669, 1893.9638076916301,
+    1895.0581201055093, 1896.153064801618, 1897.2486421452825, 1898.3448525020397,
+    1899.4416962376381, 1900.539173718036, 1901.6372853094067, 1902.7360313781321,
+    1903.8354122908063, 1904.9354284142357, 1906.0360801154384, 1907.1373677616441,
+    1908.2392917202944, 1909.3418523590462, 1910.4450500457654, 1911.5488851485318,
+    1912.6533580356374, 1913.7584690755875, 1914.8642186371001, 1915.9706070891048,
+    1917.0776348007487, 1918.1853021413879, 1919.293609480593, 1920.4025571881489,
+    1921.5121456340535, 1922.6223751885186, 1923.7332462219692, 1924.8447591050469,
+    1925.9569142086054, 1927.069711903712, 1928.1831525616499, 1929.297236553916,
+    1930.4119642522223, 1931.5273360284943, 1932.6433522548755, 1933.7600133037215,
+    1934.877319547604, 1935.9952713593098, 1937.1138691118413, 1938.233113178416,
+    1939.3530039324667, 1940.4735417476447, 1941.594726997814, 1942.7165600570556,
+    1943.8390412996671, 1944.9621711001621, 1946.0859498332688, 1947.2103778739365,
+    1948.3354555973269, 1949.4611833788201, 1950.5875615940124, 1951.7145906187181,
+    1952.8422708289679, 1953.9706026010085, 1955.0995863113083, 1956.2292223365489,
+    1957.359511053631, 1958.4904528396735, 1959.6220480720124, 1960.7542971282021,
+    1961.8872003860138, 1963.0207582234414, 1964.1549710186923, 1965.2898391501949,
+    1966.4253629965949, 1967.5615429367579, 1968.6983793497677, 1969.8358726149265,
+    1970.9740231117589, 1972.1128312200053, 1973.2522973196267, 1974.3924217908034,
+    1975.5332050139357, 1976.6746473696437, 1977.8167492387656, 1978.9595110023647,
+    1980.1029330417189, 1981.2470157383291, 1982.391759473916, 1983.5371646304209,
+    1984.6832315900051, 1985.8299607350532, 1986.9773524481684, 1988.1254071121753,
+    1989.2741251101202, 1990.4235068252699, 1991.5735526411138, 1992.7242629413608,
+    1993.8756381099461, 1995.0276785310214, 1996.1803845889633, 1997.3337566683697,
+    1998.4877951540607, 1999.6425004310788, 2000.7978728846879, 2001.9539129003781,
+    2003.1106208638587, 2004.2679971610626, 2005.4260421781462, 2006.5847563014886,
+    2007.7441399176928, 2008.904193413583, 2010.0649171762118, 2011.2263115928504,
+    2012.3883770509958, 2013.5511139383691, 2014.7145226429147, 2015.8786035528017,
+    2017.0433570564221, 2018.2087835423956, 2019.3748833995635, 2020.5416570169923,
+    2021.709104783974, 2022.8772270900247, 2024.0460243248863, 2025.2154968785242,
+    2026.385645141133, 2027.5564695031292, 2028.7279703551555, 2029.9001480880813,
+    2031.073003093001, 2032.2465357612339, 2033.4207464843294, 2034.5956356540594,
+    2035.7712036624227, 2036.9474509016454, 2038.1243777641805, 2039.3019846427064,
+    2040.4802719301283, 2041.6592400195818, 2042.8388893044262, 2044.0192201782486,
+    2045.2002330348644, 2046.3819282683155, 2047.5643062728727, 2048.7473674430325,
+    2049.9311121735232, 2051.1155408592977, 2052.3006538955378, 2053.4864516776543,
+    2054.6729346012862, 2055.8601030623017, 2057.0479574567948, 2058.2364981810933,
+    2059.425725631751, 2060.6156402055503, 2061.806242299504, 2062.9975323108542,
+    2064.1895106370721, 2065.3821776758577, 2066.5755338251447, 2067.769579483092,
+    2068.9643150480906, 2070.1597409187621, 2071.3558574939575, 2072.5526651727573,
+    2073.7501643544765, 2074.9483554386575, 2076.1472388250731, 2077.3468149137293,
+    2078.5470841048618, 2079.748046798938, 2080.9497033966554, 2082.152054298947,
+    2083.3550999069726, 2084.5588406221264, 2085.7632768460344, 2086.9684089805537,
+    2088.1742374277742, 2089.3807625900172, 2090.5879848698391, 2091.7959046700271,
+    2093.0045223935999, 2094.2138384438099, 2095.4238532241461, 2096.6345671383224,
+    2097.8459805902967, 2099.0580939842489, 2100.2709077246036, 2101.4844222160082,
+    2102.6986378633524, 2103.9135550717583, 2105.129174246576, 2106.3454957933996,
+    2107.5625201180474, 2108.7802476265811, 2109.9986787252888, 2111.2178138207,
+    2112.4376533195787, 2113.6581976289172, 2114.8794471559522, 2116.1014023081461,
+    2117.3240634932072, 2118.5474311190687, 2119.771505593907, 2120.9962873261347,
+    2122.2217767243924, 2123.4479741975674, 2124.6748801547728, 2125.9024950053686,
+    2127.1308191589401, 2128.3598530253189, 2129.5895970145712, 2130.8200515369931,
+    2132.0512170031293, 2133.2830938237498, 2134.515682409874, 2135.7489831727462,
+    2136.9829965238573, 2138.2177228749365, 2139.4531626379421, 2140.6893162250813,
+    2141.9261840487889, 2143.1637665217468, 2144.4020640568729, 2145.6410770673187,
+    2146.8808059664825, 2148.1212511679928, 2149.3624130857265, 2150.6042921337898,
+    2151.8468887265353, 2153.0902032785557, 2154.3342362046756, 2155.5789879199679,
+    2156.824458839737, 2158.0706493795369, 2159.317559955151, 2160.565190982612,
+    2161.8135428781907, 2163.0626160583929, 2164.3124109399741, 2165.5629279399209,
+    2166.8141674754702, 2168.0661299640906, 2169.3188158234998, 2170.5722254716557,
+    2171.8263593267516, 2173.0812178072315, 2174.3368013317713, 2175.5931103192979,
+    2176.8501451889724, 2178.1079063602042, 2179.3663942526446, 2180.6256092861809,
+    2181.8855518809532, 2183.146222457332, 2184.4076214359443, 2185.669749237647,
+    2186.9326062835503, 2188.1961929950053, 2189.4605097935996, 2190.725557101176,
+    2191.9913353398097, 2193.2578449318298, 2194.5250862997991, 2195.7930598665334,
+    2197.061766055092, 2198.3312052887704, 2199.60137799112, 2200.8722845859256,
+    2202.1439254972283, 2203.4163011493029, 2204.6894119666777, 2205.9632583741263,
+    2207.2378407966594, 2208.5131596595443, 2209.7892153882822, 2211.0660084086335,
+    2212.343539146591, 2213.6218080284029, 2214.9008154805642, 2216.1805619298079,
+    2217.4610478031232, 2218.7422735277369, 2220.0242395311325, 2221.3069462410294,
+    2222.5903940854041, 2223.874583492478, 2225.1595148907127, 2226.4451887088285,
+    2227.7316053757831, 2229.0187653207913, 2230.3066689733064, 2231.5953167630373,
+    2232.8847091199418, 2234.1748464742168, 2235.4657292563197, 2236.7573578969459,
+    2238.0497328270471, 2239.3428544778239, 2240.6367232807188, 2241.9313396674333,
+    2243.2267040699085, 2244.5228169203456, 2245.8196786511835, 2247.1172896951216,
+    2248.4156504851071, 2249.7147614543301, 2251.0146230362416, 2252.3152356645319,
+    2253.6165997731541, 2254.9187157963001, 2256.2215841684197, 2257.5252053242166,
+    2258.8295796986349, 2260.1347077268824, 2261.4405898444056, 2262.7472264869166,
+    2264.0546180903661, 2265.3627650909643, 2266.6716679251754, 2267.9813270297068,
+    2269.291742841529, 2270.6029157978528, 2271.9148463361553, 2273.2275348941535,
+    2274.5409819098254, 2275.8551878214039, 2277.1701530673636, 2278.4858780864479,
+    2279.8023633176385, 2281.1196092001842, 2282.4376161735754, 2283.7563846775652,
+    2285.0759151521611, 2286.3962080376159, 2287.7172637744484, 2289.039082803421,
+    2290.3616655655601, 2291.6850125021383, 2293.0091240546899, 2294.3340006650051,
+    2295.6596427751201, 2296.9860508273382, 2298.3132252642081, 2299.6411665285436,
+    2300.9698750634043, 2302.2993513121137, 2303.6295957182515, 2304.9606087256452,
+    2306.2923907783907, 2307.6249423208287, 2308.9582637975677, 2310.292355653462,
+    2311.6272183336314, 2312.9628522834523, 2314.2992579485517, 2315.6364357748239,
+    2316.9743862084097, 2318.3131096957186, 2319.6526066834081, 2320.9928776184015,
+    2322.3339229478793, 2323.6757431192736, 2325.0183385802861, 2326.3617097788642,
+    2327.7058571632269, 2329.0507811818406, 2330.3964822834396, 2331.7429609170172,
+    2333.090217531817, 2334.4382525773544, 2335.7870665033925, 2337.1366597599631,
+    2338.487032797359, 2339.8381860661229, 2341.1901200170696, 2342.5428351012647,
+    2343.8963317700427, 2345.2506104749909, 2346.6056716679636, 2347.9615158010765,
+    2349.3181433267, 2350.675554697475, 2352.0337503662927, 2353.3927307863187,
+    2354.7524964109689, 2356.1130476939275, 2357.4743850891441, 2358.8365090508191,
+    2360.1994200334284, 2361.5631184916997, 2362.9276048806328, 2364.2928796554802,
+    2365.658943271766, 2367.0257961852781, 2368.3934388520574, 2369.7618717284208,
+    2371.1310952709382, 2372.5011099364538, 2373.8719161820636, 2375.2435144651372,
+    2376.6159052433095, 2377.9890889744693, 2379.3630661167822, 2380.7378371286673,
+    2382.1134024688204, 2383.4897625961889, 2384.8669179699973, 2386.2448690497313,
+    2387.6236162951373, 2389.0031601662372, 2390.3835011233064, 2391.7646396268992,
+    2393.1465761378226, 2394.5293111171618, 2395.9128450262651, 2397.2971783267399,
+    2398.6823114804724, 2400.0682449496035, 2401.4549791965528, 2402.842514683995,
+    2404.2308518748819, 2405.6199912324323, 2407.0099332201239, 2408.4006783017135,
+    2409.7922269412147, 2411.1845796029202, 2412.5777367513806, 2413.9716988514219,
+    2415.3664663681407, 2416.7620397668911, 2418.15841951331, 2419.5556060732911,
+    2420.953599913008, 2422.3524014988925, 2423.7520112976554, 2425.1524297762762,
+    2426.5536574019957, 2427.9556946423368, 2429.3585419650794, 2430.7621998382883,
+    2432.1666687302836, 2433.5719491096675, 2434.9780414453107, 2436.3849462063481,
+    2437.7926638621962, 2439.2011948825311, 2440.610539737309, 2442.0206988967584,
+    2443.4316728313688, 2444.8434620119165, 2446.256066909435, 2447.6694879952429,
+    2449.0837257409198, 2450.4987806183258, 2451.9146530995945, 2453.331343657122,
+    2454.7488527635915, 2456.1671808919446, 2457.5863285154096, 2459.0062961074777,
+    2460.4270841419193, 2461.8486930927816, 2463.2711234343751, 2464.694375641297,
+    2466.1184501884063, 2467.543347550848, 2468.9690682040309, 2470.3956126236462,
+    2471.8229812856612, 2473.2511746663081, 2474.6801932421063, 2476.1100374898397,
+    2477.5407078865778, 2478.9722049096563, 2480.4045290366926, 2481.8376807455829,
+    2483.2716605144892, 2484.7064688218611, 2486.1421061464139, 2487.5785729671516,
+    2489.015869763341, 2490.4539970145374, 2491.892955200572, 2493.3327448015434,
+    2494.7733662978412, 2496.2148201701193, 2497.6571068993221, 2499.1002269666596,
+    2500.5441808536284, 2501.9889690420041, 2503.4345920138317, 2504.8810502514452,
+    2506.3283442374473, 2507.7764744547303, 2509.2254413864539, 2510.6752455160663,
+    2512.1258873272945, 2513.5773673041354, 2515.0296859308796, 2516.482843692083,
+    2517.9368410725951, 2519.3916785575334, 2520.8473566323046, 2522.3038757825952,
+    2523.7612364943634, 2525.2194392538618, 2526.6784845476095, 2528.138372862421,
+    2529.5991046853783, 2531.0606805038547, 2532.5231008055048, 2533.9863660782567,
+    2535.450476810332, 2536.9154334902209, 2538.3812366067104, 2539.8478866488563,
+    2541.3153841060061, 2542.7837294677911, 2544.2529232241145, 2545.7229658651763,
+    2547.1938578814479, 2548.6655997636913, 2550.1381920029544, 2551.6116350905572,
+    2553.0859295181176, 2554.5610757775244, 2556.0370743609642, 2557.5139257608935,
+    2558.9916304700646, 2560.4701889815137, 2561.9496017885526, 2563.42986938479,
+    2564.9109922641087, 2566.3929709206882, 2567.8758058489807, 2569.359497543735,
+    2570.8440464999849, 2572.3294532130403, 2573.8157181785105, 2575.3028418922786,
+    2576.7908248505269, 2578.2796675497107, 2579.7693704865833, 2581.259934158184,
+    2582.7513590618296, 2584.2436456951377, 2585.7367945559999, 2587.2308061426093,
+    2588.7256809534324, 2590.2214194872354, 2591.7180222430702, 2593.2154897202699,
+    2594.7138224184673, 2596.2130208375729, 2597.7130854777956, 2599.2140168396236,
+    2600.7158154238423, 2602.2184817315274, 2603.7220162640333, 2605.2264195230186,
+    2606.7316920104172, 2608.2378342284665, 2609.7448466796814, 2611.2527298668774,
+    2612.7614842931589, 2614.2711104619129, 2615.7816088768295, 2617.292980041876,
+    2618.8052244613259, 2620.3183426397295, 2621.8323350819383, 2623.3472022930969,
+    2624.8629447786307, 2626.3795630442701, 2627.8970575960261, 2629.4154289402131,
+    2630.9346775834269, 2632.4548040325644, 2633.9758087948162, 2635.4976923776562,
+    2637.0204552888631, 2638.5440980364979, 2640.068621128928, 2641.5940250747994,
+    2643.1203103830644, 2644.6474775629677, 2646.1755271240386, 2647.7044595761149,
+    2649.2342754293149, 2650.7649751940653, 2652.2965593810745, 2653.829028501355,
+    2655.3623830662159, 2656.8966235872508, 2658.4317505763624, 2659.9677645457359,
+    2661.5046660078633, 2663.0424554755314, 2664.5811334618138, 2666.120700480094,
+    2667.6611570440386, 2669.202503667625, 2670.7447408651124, 2672.2878691510691,
+    2673.8318890403602, 2675.3768010481385, 2676.9226056898665, 2678.4693034812922,
+    2680.0168949384747, 2681.5653805777583, 2683.1147609157956, 2684.665036469537,
+    2686.2162077562225, 2687.7682752934038, 2689.3212395989181, 2690.8751011909148,
+    2692.4298605878312, 2693.9855183084123, 2695.5420748717038, 2697.0995307970406,
+    2698.6578866040709, 2700.2171428127308, 2701.7772999432696, 2703.3383585162233,
+    2704.90031905244, 2706.4631820730674, 2708.0269480995448, 2709.5916176536261,
+    2711.157191257354, 2712.7236694330854, 2714.2910527034651, 2715.8593415914515,
+    2717.4285366203039, 2718.9986383135747, 2720.569647195131, 2722.1415637891305,
+    2723.714388620047, 2725.2881222126425, 2726.8627650919943, 2728.4383177834811,
+    2730.0147808127772, 2731.5921547058729, 2733.1704399890477, 2734.7496371889015,
+    2736.3297468323226, 2737.9107694465147, 2739.492705558986, 2741.0755556975405,
+    2742.6593203902985, 2744.2440001656732, 2745.8295955523972, 2747.4161070794939,
+    2749.0035352763025, 2750.5918806724694, 2752.1811437979354, 2753.7713251829618,
+    2755.3624253581029, 2756.954444854232, 2758.5473842025176, 2760.1412439344422,
+    2761.736024581799, 2763.3317266766758, 2764.928350751481, 2766.52589733892,
+    2768.1243669720166, 2769.7237601840907, 2771.3240775087793, 2772.9253194800285,
+    2774.5274866320829, 2776.1305794995087, 2777.7345986171686, 2779.3395445202423,
+    2780.9454177442208, 2782.5522188248938, 2784.1599482983738, 2785.7686067010695,
+    2787.3781945697133, 2788.9887124413344, 2790.6001608532811, 2792.2125403432146,
+    2793.8258514490944, 2795.4400947092049, 2797.0552706621293, 2798.6713798467736,
+    2800.2884228023436, 2801.9064000683638, 2803.5253121846745, 2805.1451596914139,
+    2806.765943129049, 2808.3876630383434, 2810.0103199603868, 2811.6339144365693,
+    2813.2584470086031, 2814.8839182185134, 2816.5103286086287, 2818.1376787216041,
+    2819.7659691003946, 2821.3952002882834, 2823.0253728288531, 2824.6564872660101,
+    2826.2885441439767, 2827.9215440072776, 2829.5554874007671, 2831.1903748696009,
+    2832.8262069592615, 2834.4629842155346, 2836.1007071845306, 2837.7393764126773,
+    2839.3789924467042, 2841.0195558336741, 2842.6610671209505, 2844.3035268562276,
+    2845.9469355875003, 2847.5912938630931, 2849.236602231646, 2850.8828612421062,
+    2852.5300714437508, 2854.178233386162, 2855.8273476192517, 2857.4774146932373,
+    2859.1284351586628, 2860.7804095663919, 2862.4333384675961, 2864.087222413777,
+    2865.7420619567442, 2867.3978576486379, 2869.0546100419037, 2870.7123196893172,
+    2872.3709871439733, 2874.0306129592764, 2875.6911976889633, 2877.3527418870785,
+    2879.0152461080002, 2880.6787109064112, 2882.3431368373272, 2884.0085244560842,
+    2885.6748743183289, 2887.3421869800409, 2889.0104629975094, 2890.6797029273584,
+    2892.3499073265198, 2894.0210767522562, 2895.6932117621545, 2897.3663129141109,
+    2899.0403807663606, 2900.7154158774447, 2902.3914188062386, 2904.0683901119423,
+    2905.7463303540653, 2907.4252400924561, 2909.1051198872728, 2910.7859702990104,
+    2912.4677918884745, 2914.1505852168057, 2915.8343508454668, 2917.5190893362355,
+    2919.2048012512296, 2920.8914871528759, 2922.5791476039399, 2924.2677831675001,
+    2925.9573944069693, 2927.6479818860862, 2929.3395461689051, 2931.0320878198195,
+    2932.7256074035363, 2934.4201054851005, 2936.1155826298718, 2937.8120394035464,
+    2939.5094763721463, 2941.2078941020109, 2942.9072931598216, 2944.6076741125712,
+    2946.3090375275965, 2948.0113839725464, 2949.7147140154084, 2951.419028224499,
+    2953.1243271684521, 2954.8306114162438, 2956.5378815371655, 2958.2461381008516,
+    2959.9553816772514, 2961.6656128366535, 2963.3768321496768, 2965.0890401872593,
+    2966.8022375206824, 2968.5164247215439, 2970.2316023617859, 2971.9477710136662,
+    2973.6649312497857, 2975.3830836430743, 2977.1022287667824, 2978.822367194507,
+    2980.543499500161, 2982.2656262580049, 2983.9887480426141, 2985.7128654289095,
+    2987.4379789921422, 2989.1640893078861, 2990.8911969520609, 2992.6193025009052,
+    2994.3484065310063, 2996.0785096192672, 2997.8096123429382, 2999.5417152796012,
+    3001.274819007162, 3003.0089241038741, 3004.7440311483101, 3006.4801407193931,
+    3008.2172533963649, 3009.955369758813, 3011.6944903866597, 3013.4346158601534,
+    3015.1757467598882, 3016.9178836667829, 3018.6610271621057, 3020.4051778274443,
+    3022.1503362447356, 3023.8965029962515, 3025.6436786645886, 3027.3918638326973,
+    3029.1410590838477, 3030.8912650016591, 3032.6424821700884, 3034.3947111734169,
+    3036.1479525962804, 3037.9022070236374, 3039.6574750407976, 3041.4137572333957,
+    3043.1710541874149, 3044.9293664891784, 3046.6886947253347, 3048.4490394828886,
+    3050.2104013491671, 3051.9727809118535, 3053.7361787589539, 3055.5005954788262,
+    3057.2660316601678, 3059.032487892006, 3060.799964763723, 3062.5684628650251,
+    3064.3379827859767, 3066.1085251169666, 3067.8800904487357, 3069.6526793723674,
+    3071.4262924792752, 3073.2009303612285, 3074.9765936103245, 3076.7532828190165,
+    3078.5309985800859, 3080.3097414866679, 3082.0895121322396, 3083.8703111106106,
+    3085.6521390159492, 3087.4349964427493, 3089.2188839858659, 3091.0038022404829,
+    3092.7897518021368, 3094.5767332667106, 3096.3647472304192, 3098.1537942898376,
+    3099.9438750418694, 3101.7349900837798, 3103.5271400131628, 3105.3203254279692,
+    3107.1145469264952, 3108.9098051073715, 3110.7061005695905, 3112.5034339124741,
+    3114.3018057357067, 3116.1012166393043, 3117.9016672236394, 3119.7031580894331,
+    3121.505689837742, 3123.3092630699834, 3125.1138783879096, 3126.9195363936333,
+    3128.726237689601, 3130.5339828786191, 3132.3427725638421, 3134.1526073487612,
+    3135.9634878372308, 3137.7754146334405, 3139.5883883419442, 3141.4024095676277,
+    3143.2174789157407, 3145.0335969918801, 3146.8507644019828, 3148.6689817523506,
+    3150.4882496496202, 3152.3085687007942, 3154.129939513211, 3155.9523626945702,
+    3157.7758388529251, 3159.6003685966648, 3161.4259525345492, 3163.2525912756719,
+    3165.0802854294921, 3166.9090356058191, 3168.7388424148044, 3170.5697064669662,
+    3172.4016283731621, 3174.2346087446158, 3176.0686481928901, 3177.9037473299122,
+    3179.739906767963, 3181.5771271196654, 3183.4154089980125, 3185.2547530163347,
+    3187.0951597883341, 3188.9366299280496, 3190.779164049889, 3192.622762768613,
+    3194.4674266993275, 3196.3131564575078, 3198.1599526589703, 3200.0078159199034,
+    3201.8567468568335, 3203.7067460866579, 3205.5578142266277, 3207.4099518943408,
+    3209.2631597077675, 3211.1174382852182, 3212.9727882453767, 3214.8292102072701,
+    3216.686704790292, 3218.5452726141966, 3220.404914299083, 3222.2656304654251,
+    3224.1274217340388, 3225.9902887261146, 3227.8542320631864, 3229.7192523671597,
+    3231.5853502602981, 3233.4525263652131, 3235.3207813048925, 3237.1901157026678,
+    3239.0605301822461, 3240.9320253676797, 3242.8046018833934, 3244.6782603541715,
+    3246.5530014051492, 3248.428825661837, 3250.3057337500932, 3252.1837262961517,
+    3254.0628039265926, 3255.9429672683696, 3257.8242169488012, 3259.7065535955521,
+    3261.5899778366702, 3263.4744903005471, 3265.3600916159544, 3267.2467824120117,
+    3269.1345633182127, 3271.0234349644161, 3272.9133979808316, 3274.8044529980502,
+    3276.6966006470097, 3278.58984155903, 3280.4841763657782, 3282.3796056993006,
+    3284.276130192005, 3286.173750476657, 3288.0724671864009, 3289.9722809547316,
+    3291.8731924155254, 3293.7752022030108, 3295.6783109517928, 3297.5825192968432,
+    3299.48782787349, 3301.3942373174432, 3303.3017482647642, 3305.2103613518939,
+    3307.1200772156421, 3309.0308964931723, 3310.9428198220344, 3312.8558478401292,
+    3314.7699811857419, 3316.6852204975125, 3318.6015664144597, 3320.5190195759733,
+    3322.4375806217981, 3324.3572501920671, 3326.278028927266, 3328.1999174682664,
+    3330.1229164562947, 3332.0470265329591, 3333.9722483402397, 3335.8985825204741,
+    3337.8260297163879, 3339.7545905710622, 3341.6842657279649, 3343.61505583092,
+    3345.5469615241359, 3347.4799834521937, 3349.4141222600333, 3351.3493785929836,
+    3353.2857530967322, 3355.2232464173535, 3357.161859201281, 3359.1015920953323,
+    3361.0424457466988, 3362.9844208029349, 3364.9275179119845, 3366.8717377221501,
+    3368.8170808821246, 3370.763548040959, 3372.7111398480929, 3374.6598569533403,
+    3376.609700006878, 3378.5606696592763, 3380.5127665614623, 3382.4659913647583,
+    3384.4203447208461, 3386.3758272817945, 3388.3324397000515, 3390.2901826284283,
+    3392.2490567201289, 3394.2090626287209, 3396.1702010081631, 3398.1324725127783,
+    3400.0958777972778, 3402.0604175167518, 3404.0260923266569, 3405.9929028828446,
+    3407.9608498415287, 3409.9299338593191, 3411.9001555931891, 3413.8715157005017,
+    3415.8440148390027, 3417.8176536668029, 3419.7924328424119, 3421.7683530247023,
+    3423.7454148729439, 3425.7236190467711, 3427.7029662062114, 3429.6834570116748,
+    3431.6650921239388, 3433.6478722041811, 3435.6317979139435, 3437.6168699151667,
+    3439.603088870158, 3441.5904554416193, 3443.5789702926349, 3445.5686340866614,
+    3447.5594474875534, 3449.5514111595339, 3451.5445257672218, 3453.5387919756195,
+    3455.534210450101, 3457.5307818564434, 3459.5285068607886, 3461.5273861296823,
+    3463.5274203300387, 3465.5286101291681, 3467.5309561947693, 3469.5344591949106,
+    3471.5391197980662, 3473.5449386730784, 3475.5519164891934, 3477.5600539160255,
+    3479.5693516235906, 3481.5798102822914, 3483.5914305629035, 3485.6042131366103,
+    3487.6181586749617, 3489.6332678499166, 3491.6495413338034, 3493.6669797993513,
+    3495.6855839196792, 3497.7053543682814, 3499.7262918190586, 3501.7483969462833,
+    3503.7716704246368, 3505.7961129291707, 3507.8217251353403, 3509.8485077189907,
+    3511.8764613563467, 3513.9055867240377, 3515.9358844990693, 3517.967355358855,
+    3519.9999999811821, 3522.0338190442426, 3524.06881322662, 3526.1049832072781,
+    3528.142329665588, 3530.1808532812993, 3532.2205547345689, 3534.2614347059298,
+    3536.3034938763226, 3538.3467329270802, 3540.3911525399158, 3542.4367533969557,
+    3544.4835361807009, 3546.5315015740648, 3548.5806502603391, 3550.6309829232209,
+    3552.6825002468054, 3554.7352029155672, 3556.7890916143956, 3558.844167028557,
+    3560.9004298437326, 3562.9578807459816, 3565.0165204217715, 3567.0763495579681,
+    3569.1373688418212, 3571.1995789609932, 3573.2629806035279, 3575.3275744578846,
+    3577.3933612129003, 3579.4603415578263, 3581.5285161823099, 3583.5978857763857,
+    3585.6684510305022, 3587.7402126354905, 3589.8131712825984, 3591.8873276634558,
+    3593.9626824701054, 3596.0392363949886, 3598.1169901309354, 3600.1959443711926,
+    3602.27609980939, 3604.3574571395711, 3606.4400170561817, 3608.5237802540546,
+    3610.6087474284413, 3612.6949192749789, 3614.7822964897223, 3616.8708797691129,
+    3618.9606698100051, 3621.0516673096586, 3623.1438729657211, 3625.2372874762618,
+    3627.3319115397353, 3629.4277458550168, 3631.5247911213692, 3633.6230480384711,
+    3635.7225173064062, 3637.8231996256491, 3639.9250956970973, 3642.0282062220344,
+    3644.1325319021694, 3646.2380734395952, 3648.3448315368278, 3650.4528068967861,
+    3652.5620002227829, 3654.6724122185551, 3656.7840435882285, 3658.8968950363537,
+    3661.01096726787, 3663.1262609881378, 3665.2427769029246, 3667.3605157183933,
+    3669.4794781411319, 3671.5996648781179, 3673.7210766367575, 3675.8437141248455,
+    3677.9675780506009, 3680.09266912265, 3682.2189880500168, 3684.3465355421517,
+    3686.4753123088976, 3688.6053190605257, 3690.7365565076998, 3692.8690253615059,
+    3695.0027263334441, 3697.1376601354091, 3699.2738274797271, 3701.4112290791159,
+    3703.5498656467244, 3705.6897378960957, 3707.8308465411988, 3709.9731922964129,
+    3712.11677587652, 3714.2615979967304, 3716.4076593726504, 3718.5549607203188,
+    3720.7035027561683, 3722.8532861970607, 3725.0043117602713, 3727.1565801634761,
+    3729.3100921247842, 3731.4648483627006, 3733.620849596166, 3735.7780965445149,
+    3737.936589927514, 3740.0963304653442, 3742.2573188785896, 3744.4195558882684,
+    3746.5830422157974, 3748.7477785830288, 3750.9137657122128, 3753.0810043260312,
+    3755.2494951475842, 3757.4192389003738, 3759.5902363083405, 3761.7624880958233,
+    3763.9359949875948, 3766.1107577088455, 3768.2867769851714, 3770.4640535426051,
+    3772.6425881075825, 3774.8223814069756, 3777.0034341680589, 3779.1857471185413,
+    3781.3693209865505, 3783.5541565006229, 3785.7402543897338, 3787.9276153832602,
+    3790.1162402110212, 3792.3061296032361, 3794.4972842905627, 3796.6897050040793,
+    3798.8833924752735, 3801.0783474360742, 3803.2745706188134, 3805.4720627562665,
+    3807.6708245816126, 3809.8708568284692, 3812.0721602308768, 3814.2747355232859,
+    3816.4785834405911, 3818.6837047180925, 3820.890100091533, 3823.0977702970636,
+    3825.3067160712726, 3827.5169381511751, 3829.7284372741979, 3831.9412141782122,
+    3834.1552696014974, 3836.370604282778, 3838.587218961186, 3840.8051143762955,
+    3843.0242912681069, 3845.244750377035, 3847.4664924439408, 3849.6895182100939,
+    3851.9138284172132, 3854.139423807424, 3856.366305123297, 3858.5944731078321,
+    3860.8239285044419, 3863.054672056991, 3865.286704509751, 3867.5200266074453,
+    3869.7546390952079, 3871.9905427186172, 3874.2277382236825, 3876.4662263568298,
+    3878.7060078649356, 3880.9470834952895, 3883.1894539956302, 3885.4331201141113,
+    3887.6780825993319, 3889.9243422003242, 3892.1718996665377, 3894.4207557478753,
+    3896.6709111946539, 3898.9223667576425, 3901.1751231880248, 3903.429181237434,
+    3905.6845416579358, 3907.941205202017, 3910.1991726226188, 3912.4584446730978,
+    3914.7190221072642, 3916.980905679347, 3919.244096144022, 3921.5085942564042,
+    3923.7744007720275, 3926.0415164468855, 3928.3099420373846, 3930.5796783003871,
+    3932.8507259931898, 3935.1230858735134, 3937.3967586995354, 3939.6717452298531,
+    3941.9480462235206, 3944.2256624400106, 3946.5045946392511, 3948.7848435816068,
+    3951.0664100278686, 3953.3492947392874, 3955.6334984775312, 3957.9190220047317,
+    3960.2058660834377, 3962.4940314766559, 3964.7835189478319, 3967.0743292608395,
+    3969.3664631800125, 3971.6599214701064, 3973.9547048963395, 3976.2508142243505,
+    3978.5482502202372, 3980.8470136505398, 3983.1471052822253, 3985.4485258827249,
+    3987.7512762198921, 3990.0553570620455, 3992.3607691779266, 3994.6675133367366,
+    3996.9755903081214, 3999.2850008621554, 4001.5957457693785, 4003.9078258007562,
+    4006.2212417277196, 4008.5359943221251, 4010.8520843562897, 4013.1695126029772,
+    4015.4882798353829, 4017.8083868271688, 4020.1298343524236, 4022.4526231857035,
+    4024.7767541019916, 4027.1022278767359, 4029.4290452858295, 4031.7572071056011,
+    4034.0867141128465, 4036.4175670847912, 4038.7497667991292, 4041.0833140339846,
+    4043.4182095679453, 4045.7544541800494, 4048.0920486497698, 4050.4309937570506,
+    4052.7712902822659, 4055.1129390062606, 4057.4559407103111, 4059.8002961761604,
+    4062.1460061860021, 4064.4930715224677, 4066.8414929686614, 4069.1912713081188,
+    4071.5424073248478, 4073.8949018032908, 4076.2487555283583, 4078.6039692854129,
+    4080.9605438602566, 4083.3184800391664, 4085.6777786088523, 4088.0384403564999,
+    4090.4004660697287, 4092.7638565366287, 4095.1286125457455, 4097.4947348860651,
+    4099.8622243470481, 4102.2310817185953, 4104.6013077910729, 4106.9729033553085,
+    4109.3458692025706, 4111.7202061246035, 4114.0959149135897, 4116.4729963621894,
+    4118.851451263502, 4121.2312804110979, 4123.612484599008, 4125.9950646217058,
+    4128.3790212741442, 4130.7643553517155, 4133.1510676502912, 4135.539158966184,
+    4137.9286300961794, 4140.3194818375241, 4142.7117149879123, 4145.1053303455174,
+    4147.500328708953, 4149.8967108773177, 4152.2944776501463, 4154.6936298274568,
+    4157.0941682097236, 4159.4960935978734, 4161.8994067933136, 4164.3041085978939,
+    4166.7101998139478, 4169.1176812442527, 4171.526553692066, 4173.9368179611074,
+    4176.3484748555456, 4178.7615251800362, 4181.1759697396783, 4183.5918093400569,
+    4186.0090447871999, 4188.4276768876198, 4190.8477064482922, 4193.2691342766448,
+    4195.6919611805934, 4198.1161879684978, 4200.5418154492072, 4202.9688444320163,
+    4205.3972757267047, 4207.8271101435166, 4210.258348493152, 4212.6909915867991,
+    4215.1250402360947, 4217.5604952531621, 4219.9973574505775, 4222.4356276414001,
+    4224.8753066391573, 4227.3163952578343, 4229.7588943119044, 4232.2028046162923,
+    4234.6481269864144, 4237.0948622381375, 4239.543011187814, 4241.9925746522695,
+    4244.4435534487848, 4246.8959483951348, 4249.3497603095457, 4251.8049900107371,
+    4254.2616383178802, 4256.7197060506378, 4259.1791940291423, 4261.6401030739862,
+    4264.1024340062586, 4266.5661876474996, 4269.031364819748, 4271.4979663454924,
+    4273.9659930477146, 4276.435445749873, 4278.9063252758842, 4281.3786324501625,
+    4283.8523680975777, 4286.3275330434935, 4288.8041281137457, 4291.2821541346375,
+    4293.761611932965, 4296.2425023359856, 4298.7248261714531, 4301.2085842675797,
+    4303.6937774530707, 4306.1804065571114, 4308.6684724093511, 4311.1579758399357,
+    4313.6489176794739, 4316.1412987590738, 4318.6351199103019, 4321.1303819652239,
+    4323.6270857563813, 4326.1252321167858, 4328.6248218799483, 4331.1258558798418,
+    4333.6283349509404, 4336.1322599281812, 4338.6376316469996, 4341.1444509433113,
+    4343.6527186535031, 4346.162435614463, 4348.6736026635426, 4351.1862206385958,
+    4353.7002903779448, 4356.2158127204084, 4358.7327885052891, 4361.2512185723617,
+    4363.7711037619065, 4366.292444914664, 4368.8152428718886, 4371.339498475294,
+    4373.8652125671006, 4376.3923859900106, 4378.9210195871992, 4381.4511142023521,
+    4383.9826706796193, 4386.5156898636596, 4389.0501725995982, 4391.5861197330669,
+    4394.123532110184, 4396.6624105775409, 4399.20275598224, 4401.7445691718513,
+    4404.2878509944567, 4406.8326022986057, 4409.3788239333553, 4411.9265167482527,
+    4414.4756815933188, 4417.0263193190885, 4419.5784307765643, 4422.132016817267,
+    4424.6870782931819, 4427.2436160568059, 4429.8016309611285, 4432.3611238596159,
+    4434.9220956062463, 4437.4845470554737, 4440.048479062265, 4442.6138924820589,
+    4445.1807881708082, 4447.749166984956, 4450.3190297814253, 4452.890377417657,
+    4455.4632107515663, 4458.0375306415826, 4460.6133379466128, 4463.1906335260746,
+    4465.7694182398836, 4468.3496929484336, 4470.9314585126394, 4473.5147157938918,
+    4476.0994656540943, 4478.6857089556479, 4481.2734465614376, 4483.8626793348667,
+    4486.4534081398169, 4489.0456338406912, 4491.639357302367, 4494.2345793902432,
+    4496.8313009702142, 4499.4295229086601, 4502.0292460724831, 4504.6304713290638,
+    4507.2331995463082, 4509.8374315926003, 4512.4431683368393, 4515.0504106484332,
+    4517.6591593972698, 4520.2694154537649, 4522.8811796888112, 4525.4944529738332,
+    4528.1092361807323, 4530.7255301819287, 4533.3433358503507, 4535.9626540594136,
+    4538.5834856830579, 4541.2058315957056, 4543.8296926723106, 4546.4550697883069,
+    4549.0819638196508, 4551.7103756428078, 4554.3403061347271, 4556.9717561728958,
+    4559.6047266352771, 4562.2392184003684, 4564.8752323471508, 4567.5127693551303,
+    4570.1518303043222, 4572.7924160752318, 4575.4345275488968, 4578.078165606842,
+    4580.7233311311202, 4583.3700250042766, 4586.0182481093798, 4588.6680013300102,
+    4591.3192855502402, 4593.9721016546764, 4596.6264505284162, 4599.2823330570873,
+    4601.9397501268086, 4604.5987026242274, 4607.259191436503, 4609.9212174512904,
+    4612.5847815567813, 4615.2498846416574, 4617.9165275951354, 4620.584711306924,
+    4623.2544366672628, 4625.9257045669046, 4628.5985158971034, 4631.2728715496478,
+    4633.9487724168193, 4636.6262193914372, 4639.3052133668161, 4641.985755236803,
+    4644.6678458957585, 4647.3514862385473, 4650.0366771605723, 4652.7234195577284,
+    4655.4117143264539, 4658.1015623636813, 4660.7929645668792, 4663.4859218340343,
+    4666.1804350636339, 4668.8765051547089, 4671.5741330067849, 4674.2733195199262,
+    4676.974065594718, 4679.6763721322459, 4682.3802400341392, 4685.0856702025294,
+    4687.7926635400854, 4690.5012209499819, 4693.2113433359273, 4695.9230316021531,
+    4698.6362866534, 4701.3511093949501, 4704.0675007325854, 4706.7854615726374,
+    4709.5049928219378, 4712.2260953878549, 4714.9487701782882, 4717.6730181016383,
+    4720.3988400668568, 4723.1262369833994, 4725.8552097612655, 4728.5857593109604,
+    4731.317886543532, 4734.0515923705561, 4736.7868777041149, 4739.5237434568417,
+    4742.2621905418764, 4745.0022198729075, 4747.7438323641272, 4750.4870289302744,
+    4753.231810486619, 4755.9781779489385, 4758.7261322335644, 4761.4756742573345,
+    4764.2268049376407, 4766.9795251923779, 4769.7338359399946, 4772.4897380994626,
+    4775.2472325902745, 4778.0063203324744, 4780.7670022466127, 4783.5292792537984,
+    4786.2931522756453, 4789.0586222343236, 4791.8256900525303, 4794.5943566534797,
+    4797.3646229609449, 4800.1364898992069, 4802.9099583931056, 4805.68502936799,
+    4808.4617037497637, 4811.2399824648646, 4814.0198664402478, 4816.8013566034269,
+    4819.5844538824294, 4822.3691592058403, 4825.1554735027612, 4827.9433977028439,
+    4830.7329327362813, 4833.5240795337822, 4836.3168390266201, 4839.1112121465821,
+    4841.907199826016, 4844.704802997785, 4847.5040225953107, 4850.3048595525524,
+    4853.1073148039914, 4855.9113892846735, 4858.7170839301589, 4861.5243996765766,
+    4864.3333374605672, 4867.1438982193349, 4869.9560828906215, 4872.7698924126962,
+    4875.5853277243923, 4878.4023897650623, 4881.2210794746179, 4884.0413977935168,
+    4886.8633456627376, 4889.6869240238329, 4892.5121338188701, 4895.3389759904858,
+    4898.1674514818396, 4900.9975612366516, 4903.829306199189, 4906.6626873142441,
+    4909.4977055271829, 4912.3343617838891, 4915.1726570308192, 4918.0125922149555,
+    4920.8541682838386, 4923.6973861855631, 4926.5422468687502, 4929.3887512825941,
+    4932.2369003768126, 4935.086695101696, 4937.9381364080618, 4940.7912252472925,
+    4943.6459625713223, 4946.5023493326162, 4949.3603864842125, 4952.2200749796793,
+    4955.0814157731556, 4957.9444098193126, 4960.8090580733851, 4963.6753614911659,
+    4966.5433210289784, 4969.4129376437222, 4972.2842122928278, 4975.1571459343031,
+    4978.031739526682, 4980.9079940290749, 4983.7859104011441, 4986.6654896030868,
+    4989.5467325956824, 4992.4296403402386, 4995.3142137986442, 4998.2004539333193,
+    5001.0883617072568, 5003.9779380840082, 5006.8691840276633, 5009.7621005028905,
+    5012.6566884748945, 5015.5529489094606, 5018.4508827729078, 5021.3504910321326,
+    5024.2517746545891, 5027.1547346082707, 5030.0593718617592, 5032.9656873841659,
+    5035.8736821451903, 5038.7833571150668, 5041.6947132646092, 5044.6077515651905,
+    5047.5224729887268, 5050.4388785077235, 5053.356969095219, 5056.2767457248419,
+    5059.1982093707566, 5062.1213610077093, 5065.0462016110096, 5067.9727321565133,
+    5070.900953620664, 5073.8308669804419, 5076.7624732134209, 5079.6957732977125,
+    5082.6307682120123, 5085.5674589355822, 5088.505846448229, 5091.4459317303526,
+    5094.3877157628958, 5097.3311995273825, 5100.2763840059088, 5103.2232701811145,
+    5106.1718590362352, 5109.1221515550487, 5112.0741487219284, 5115.0278515217869,
+    5117.9832609401292, 5120.9403779630275, 5123.8992035771053, 5126.85973876958,
+    5129.8219845282174, 5132.7859418413764, 5135.7516116979614, 5138.7189950874699,
+    5141.6880929999697, 5144.6589064260806, 5147.6314363570209, 5150.6056837845572,
+    5153.5816497010537, 5156.5593350994213, 5159.5387409731666, 5162.519868316368,
+    5165.5027181236592, 5168.4872913902755, 5171.4735891119999, 5174.4616122852185,
+    5177.4513619068648, 5180.4428389744708, 5183.4360444861404, 5186.4309794405399,
+    5189.4276448369346, 5192.4260416751458, 5195.4261709555913, 5198.4280336792472,
+    5201.4316308476846, 5204.4369634630548, 5207.4440325280666, 5210.4528390460373,
+    5213.4633840208344, 5216.4756684569329, 5219.4896933593627, 5222.5054597337548,
+    5225.5229685863178, 5228.5422209238259, 5231.563217753659, 5234.5859600837521,
+    5237.6104489226518, 5240.636685279459, 5243.6646701638765, 5246.6944045861937,
+    5249.7258895572613, 5252.7591260885401, 5255.7941151920522, 5258.8308578804263,
+    5261.8693551668539, 5264.9096080651289, 5267.9516175896324, 5270.9953847553124,
+    5274.0409105777262, 5277.0881960729957, 5280.1372422578561, 5283.1880501495989,
+    5286.2406207661288, 5289.2949551259353, 5292.3510542480772, 5295.4089191522298,
+    5298.4685508586299, 5301.5299503881306, 5304.5931187621491, 5307.6580570027099,
+    5310.7247661324318, 5313.7932471745016, 5316.8635011527249, 5319.9355290914718,
+    5323.0093320157266, 5326.0849109510627, 5329.1622669236276, 5332.241400960188,
+    5335.3223140880773, 5338.40500733525, 5341.4894817302247, 5344.5757383021382,
+    5347.6637780807205, 5350.7536020962771, 5353.845211379733, 5356.9386069625843,
+    5360.0337898769494, 5363.1307611555167, 5366.2295218315912, 5369.3300729390739,
+    5372.432415512445, 5375.5365505868076, 5378.6424791978361, 5381.7502023818297,
+    5384.8597211756623, 5387.9710366168247, 5391.0841497434076, 5394.1990615940813,
+    5397.3157732081418, 5400.4342856254616, 5403.5545998865391, 5406.6767170324465,
+    5409.8006381048799, 5412.9263641461348, 5416.0538961990896, 5419.1832353072523,
+    5422.3143825147081, 5425.4473388661709, 5428.5821054069302, 5431.7186831829031,
+    5434.8570732406079, 5437.9972766271494, 5441.139294390262, 5444.283127578261,
+    5447.428777240094, 5450.576244425285, 5453.7255301839887, 5456.8766355669622,
+    5460.0295616255544, 5463.1843094117457, 5466.3408799780955, 5469.499274377803,
+    5472.6594936646452, 5475.8215388930294, 5478.985411117972, 5482.151111395081,
+    5485.318640780597, 5488.4880003313465, 5491.6591911047944, 5494.8322141589879,
+    5498.007070552605, 5501.1837613449388, 5504.3622875958708, 5507.5426503659237,
+    5510.7248507162058, 5513.9088897084639, 5517.0947684050352, 5520.2824878688843,
+    5523.4720491635981, 5526.6634533533515, 5529.8567015029621, 5533.05179467784,
+    5536.2487339440331, 5539.4475203681814, 5542.6481550175586, 5545.850638960057,
+    5549.0549732641657, 5552.2611589990174, 5555.4691972343371, 5558.6790890404845,
+    5561.8908354884416, 5565.1044376497875, 5568.3198965967476, 5571.5372134021391,
+    5574.7563891394266, 5577.9774248826689, 5581.2003217065621, 5584.4250806864293,
+    5587.6517028981889, 5590.8801894184098, 5594.1105413242585, 5597.3427596935471,
+    5600.5768456046872, 5603.8128001367277, 5607.050624369349, 5610.2903193828279,
+    5613.531886258098, 5616.7753260766867, 5620.0206399207736, 5623.2678288731386,
+    5626.5168940172061, 5629.7678364370267, 5633.0206572172574, 5636.2753574432081,
+    5639.5319382007892, 5642.7904005765668, 5646.0507456577061, 5649.3129745320202,
+    5652.5770882879533, 5655.8430880145552, 5659.1109748015342, 5662.3807497392017,
+    5665.6524139185231, 5668.9259684310691, 5672.2014143690612, 5675.4787528253546,
+    5678.7579848934083, 5682.0391116673482, 5685.322134241901, 5688.6070537124551,
+    5691.8938711750006, 5695.1825877261863, 5698.4732044632919, 5701.7657224842123,
+    5705.0601428875016, 5708.356466772324, 5711.6546952385033, 5714.9548293864746,
+    5718.2568703173256, 5721.5608191327838, 5724.8666769351921, 5728.174444827554,
+    5731.4841239134885, 5734.7957152972758, 5738.1092200838075, 5741.4246393786343,
+    5744.7419742879465, 5748.0612259185527, 5751.3823953779265, 5754.7054837741571,
+    5758.0304922160003, 5761.3574218128224, 5764.6862736746543, 5768.0170489121683,
+    5771.3497486366578, 5774.6843739600808, 5778.0209259950188, 5781.3594058547169,
+    5784.6998146530395, 5788.0421535045125, 5791.3864235243091, 5794.7326258282219,
+    5798.0807615327212, 5801.4308317548894, 5804.7828376124771, 5808.1367802238847,
+    5811.4926607081306, 5814.8504801849122, 5818.2102397745457, 5821.5719405980208,
+    5824.935583776949, 5828.3011704336113, 5831.6687016909336, 5835.0381786724711,
+    5838.4096025024592, 5841.7829743057518, 5845.1582952078797, 5848.5355663350001,
+    5851.9147888139387, 5855.2959637721724, 5858.6790923378103, 5862.064175639639,
+    5865.4512148070726, 5868.840210970201, 5872.2311652597436, 5875.6240788070927,
+    5879.0189527442926, 5882.4157882040217, 5885.8145863196432, 5889.2153482251424,
+    5892.618075055193, 5896.0227679450927, 5899.4294280308168, 5902.838056448998,
+    5906.2486543369041, 5909.6612228324875, 5913.075763074331, 5916.4922762017031,
+    5919.9107633545027, 5923.331225673307, 5926.7536642993537, 5930.1780803745187,
+    5933.6044750413648, 5937.0328494430878, 5940.4632047235718, 5943.8955420273323,
+    5947.3298624995714, 5950.7661672861486, 5954.2044575335649, 5957.644734389014,
+    5961.0869990003221, 5964.5312525160098, 5967.9774960852283, 5971.425730857819,
+    5974.8759579842845, 5978.3281786157722, 5981.7823939041218, 5985.2386050018104,
+    5988.6968130620126, 5992.1570192385343, 5995.6192246858764, 5999.0834305592025,
+    6002.549638014324, 6006.0178482077481, 6009.4880622966202, 6012.9602814387863,
+    6016.4345067927297, 6019.9107395176261, 6023.3889807733194, 6026.8692317203067,
+    6030.3514935197763, 6033.8357673335659, 6037.3220543242114, 6040.8103556548886,
+    6044.3006724894713, 6047.7930059925029, 6051.2873573291772, 6054.7837276653945,
+    6058.2821181676954, 6061.7825300033182, 6065.2849643401769, 6068.7894223468338,
+    6072.2959051925609, 6075.8044140472748, 6079.3149500815953, 6082.8275144667914,
+    6086.3421083748299, 6089.8587329783568, 6093.3773894506694, 6096.8980789657771,
+    6100.4208026983342, 6103.9455618237071, 6107.4723575179078, 6111.0011909576524,
+    6114.5320633203355, 6118.0649757840119, 6121.599929527446, 6125.1369257300503,
+    6128.6759655719534, 6132.2170502339332, 6135.7601808974714, 6139.3053587447348,
+    6142.8525849585503, 6146.4018607224571, 6149.9531872206489, 6153.506565638033,
+    6157.0619971601718, 6160.6194829733358, 6164.1790242644793, 6167.7406222212212,
+    6171.3042780318983, 6174.8699928854985, 6178.4377679717318, 6182.0076044809657,
+    6185.5795036042737, 6189.1534665334211, 6192.7294944608384, 6196.3075885796752,
+    6199.8877500837389, 6203.4699801675597, 6207.0542800263256, 6210.6406508559385,
+    6214.2290938529904, 6217.8196102147431, 6221.412201139181, 6225.0068678249481,
+    6228.6036114714134, 6232.2024332786086, 6235.8033344472788, 6239.4063161788663,
+    6243.011379675484, 6246.6185261399669, 6250.2277567758192, 6253.8390727872666,
+    6257.452475379202, 6261.0679657572382, 6264.6855451276842, 6268.3052146975224,
+    6271.9269756744616, 6275.550829266881, 6279.1767766838884, 6282.8048191352555,
+    6286.4349578314814, 6290.0671939837603, 6293.7015288039656, 6297.3379635047013,
+    6300.9764992992405, 6304.6171374015885, 6308.2598790264219, 6311.9047253891404,
+    6315.5516777058501, 6319.2007371933296, 6322.8519050690984, 6326.5051825513438,
+    6330.1605708589841, 6333.8180712116382, 6337.4776848296087, 6341.1394129339324,
+    6344.8032567463242, 6348.4692174892316, 6352.1372963857802, 6355.8074946598244,
+    6359.479813535926, 6363.1542542393308, 6366.830817996025, 6370.5095060326694,
+    6374.1903195766681, 6377.8732598560991, 6381.558328099778, 6385.2455255372261,
+    6388.9348533986549, 6392.6263129150157, 6396.3199053179405, 6400.0156318398067,
+    6403.713493713667, 6407.4134921733157, 6411.1156284532553, 6414.8199037886816,
+    6418.526319415535, 6422.2348765704364, 6425.9455764907534, 6429.6584204145402,
+    6433.3734095805839, 6437.0905452283932, 6440.809828598166, 6444.5312609308503,
+    6448.2548434680775, 6451.9805774522292, 6455.7084641263727, 6459.4385047343194,
+    6463.1707005205963, 6466.9050527304262, 6470.6415626097851, 6474.3802314053355,
+    6478.1210603644922, 6481.8640507353593, 6485.6092037667868, 6489.3565207083429,
+    6493.1060028102984, 6496.857651323674, 6500.6114675001863, 6504.3674525923034,
+    6508.1256078531851, 6511.8859345367391, 6515.6484338976024, 6519.4131071911042,
+    6523.1799556733404, 6526.9489806010943, 6530.7201832319088, 6534.4935648240235,
+    6538.2691266364254, 6542.0468699288322, 6545.8267959616633, 6549.6089059961005,
+    6553.3932012940195, 6557.17968311806, 6560.9683527315565, 6564.7592113986011,
+    6568.55226038401, 6572.347500953314, 6576.1449343728018, 6579.9445619094631,
+    6583.7463848310508, 6587.5504044060217, 6591.3566219035856, 6595.1650385936864,
+    6598.97565574698, 6602.7884746348864, 6606.6034965295285, 6610.4207227037878,
+    6614.2401544312843, 6618.0617929863447, 6621.8856396440688, 6625.7116956802583,
+    6629.5399623714839, 6633.3704409950251, 6637.2031328289195, 6641.0380391519466,
+    6644.8751612435963, 6648.7145003841342, 6652.5560578545319, 6656.3998349365329,
+    6660.2458329125893, 6664.0940530659182, 6667.9444966804795, 6671.7971650409481,
+    6675.6520594327758, 6679.5091811421244, 6683.3685314559298, 6687.2301116618401,
+    6691.0939230482718, 6694.9599669043873, 6698.8282445200666, 6702.6987571859672,
+    6706.5715061934643, 6710.446492834707, 6714.323718402562, 6718.2031841906646,
+    6722.0848914933977, 6725.9688416058698, 6729.855035823969, 6733.7434754443002,
+    6737.6341617642493, 6741.527096081918, 6745.4222796961858, 6749.3197139066806,
+    6753.2194000137561, 6757.1213393185526, 6761.0255331229246, 6764.9319827295167,
+    6768.8406894416921, 6772.751654563589, 6776.664879400103, 6780.5803652568566,
+    6784.4981134402578, 6788.4181252574417, 6792.3404020163262, 6796.2649450255567,
+    6800.1917555945556, 6804.1208350335037, 6808.0521846533138, 6811.9858057656893,
+    6815.9216996830573, 6819.8598677186383, 6823.8003111863782, 6827.7430314010035,
+    6831.6880296780055, 6835.6353073336059, 6839.5848656848239, 6843.5367060494045,
+    6847.4908297458878, 6851.4472380935422, 6855.4059324124228, 6859.3669140233496,
+    6863.3301842478777, 6867.2957444083622, 6871.263595827887, 6875.2337398303334,
+    6879.206177740316, 6883.1809108832385, 6887.1579405852699, 6891.1372681733228,
+    6895.1188949751067, 6899.1028223190679, 6903.0890515344436, 6907.0775839512389,
+    6911.068420900202, 6915.0615637128867, 6919.0570137215773, 6923.0547722593647,
+    6927.0548406600774, 6931.0572202583362, 6935.0619123895385, 6939.0689183898212,
+    6943.0782395961323, 6947.0898773461568, 6951.1038329783869, 6955.120107832051,
+    6959.1387032471812, 6963.1596205645828, 6967.182861125807, 6971.2084262732205,
+    6975.2363173499234, 6979.2665356998332, 6983.2990826676069, 6987.3339595987027,
+    6991.3711678393583, 6995.4107087365628, 6999.4525836381172, 7003.4967938925665,
+    7007.5433408492736, 7011.5922258583414, 7015.6434502706807, 7019.6970154379815,
+    7023.7529227126934, 7027.8111734480754, 7031.8717689981386, 7035.93471071771,
+    7039.9999999623642, 7044.0676380884852, 7048.13762645324, 7052.2099664145562,
+    7056.284659331176, 7060.3617065625986, 7064.4411094691377, 7068.5228694118596,
+    7072.6069877526452, 7076.6934658541604, 7080.7823050798315, 7084.8735067939115,
+    7088.9670723614017, 7093.0630031481296, 7097.1613005206782, 7101.2619658464419,
+    7105.3650004936108, 7109.4704058311345, 7113.5781832287912, 7117.6883340571139,
+    7121.8008596874652, 7125.9157614919632, 7130.0330408435429, 7134.1526991159362,
+    7138.2747376836423, 7142.3991579219864, 7146.5259612070558, 7150.6551489157691,
+    7154.7867224258007, 7158.9206831156525, 7163.0570323646198, 7167.1957715527715,
+    7171.3369020610044, 7175.480425270981, 7179.6263425651969, 7183.7746553269117,
+    7187.9253649402108, 7192.0784727899772, 7196.2339802618708, 7200.3918887423852,
+    7204.5521996187799, 7208.7149142791422, 7212.8800341123633, 7217.0475605081092,
+    7221.2174948568827, 7225.3898385499579, 7229.5645929794446, 7233.7417595382258,
+    7237.9213396200103, 7242.1033346193171, 7246.2877459314423, 7250.4745749525237,
+    7254.6638230794706, 7258.8554917100337, 7263.0495822427383, 7267.2460960769422,
+    7271.4450346128124, 7275.6463992512981, 7279.8501913941946, 7284.0564124440689,
+    7288.2650638043388, 7292.4761468791903, 7296.6896630736555, 7300.9056137935722,
+    7305.1240004455658, 7309.3448244371102, 7313.5680871764571, 7317.7937900727075,
+    7322.02193453574, 7326.2525219762756, 7330.4855538058491, 7334.7210314367867,
+    7338.9589562822639, 7343.1993297562358, 7347.442153273515, 7351.687428249691,
+    7355.9351561012018, 7360.1853382453, 7364.4379761000337, 7368.6930710843035,
+    7372.9506246177953, 7377.2106381210515, 7381.4731130153996, 7385.7380507230118,
+    7390.0054526668882, 7394.2753202708182, 7398.5476549594541, 7402.8224581582317,
+    7407.0997312934487, 7411.3794757921914, 7415.6616930823975, 7419.9463845928258,
+    7424.23355175304, 7428.5231959934608, 7432.8153187453008, 7437.1099214406377,
+    7441.4070055123366, 7445.7065723941214, 7450.0086235205426, 7454.3131603269521,
+    7458.6201842495684, 7462.9296967254013, 7467.2416991923319, 7471.5561930890299,
+    7475.873179855028, 7480.1926609306884, 7484.5146377571791, 7488.8391117765368,
+    7493.1660844315948, 7497.4955571660576, 7501.8275314244256, 7506.1620086520625,
+    7510.4989902951684, 7514.8384778007476, 7519.1804726166811, 7523.5249761916466,
+    7527.8719899751895, 7532.2215154176911, 7536.5735539703428, 7540.9281070852103,
+    7545.2851762151649, 7549.6447628139513, 7554.0068683361178, 7558.3714942370825,
+    7562.738641973101, 7567.1083130012457, 7571.4805087794675, 7575.8552307665204,
+    7580.2324804220425, 7584.6122592064721, 7588.9945685811253, 7593.3794100081586,
+    7597.7667849505469, 7602.1566948721484, 7606.5491412376268, 7610.944125512533,
+    7615.3416491632252, 7619.7417136569384, 7624.1443204617535, 7628.5494710465719,
+    7632.9571668811823, 7637.367409436185, 7641.780200183066, 7646.1955405941271,
+    7650.6134321425452, 7655.0338763023501, 7659.4568745483957, 7663.8824283564245,
+    7668.3105392029947, 7672.741208565556, 7677.1744379223719, 7681.610228752591,
+    7686.0485825362139, 7690.4895007540699, 7694.9329848878815, 7699.3790364201877,
+    7703.8276568344263, 7708.278847614848, 7712.732610246594, 7717.1889462156641,
+    7721.6478570088839, 7726.1093441139819, 7730.5734090195019, 7735.0400532148906,
+    7739.5092781904159, 7743.9810854372345, 7748.4554764473651, 7752.9324527136596,
+    7757.4120157298712, 7761.8941669905789, 7766.3789079912603, 7770.8662402282225,
+    7775.3561651986638, 7779.8486844006484, 7784.3437993330754, 7788.8415114957506,
+    7793.3418223893077, 7797.844733515285, 7802.3502463760497, 7806.858362474868,
+    7811.3690833158716, 7815.8824104040341, 7820.3983452452376, 7824.9168893461956,
+    7829.4380442145284, 7833.9618113586939, 7838.488192288044, 7843.0171885128084,
+    7847.5488015440551, 7852.0830328937709, 7856.6198840747693, 7861.1593566007741,
+    7865.7014519863797, 7870.2461717470269, 7874.7935173990709, 7879.3434904597061,
+    7883.8960924470412, 7888.4513248800213, 7893.0091892785022, 7897.5696871632135,
+    7902.1328200557373, 7906.6985894785748, 7911.2669969550625, 7915.8380440094634,
+    7920.4117321668755, 7924.9880629533118, 7929.5670378956638, 7934.148658521679,
+    7938.732926360025, 7943.3198429402128, 7947.9094097926791, 7952.501628448701,
+    7957.0965004404743, 7961.6940273010796, 7966.2942105644506, 7970.8970517654498,
+    7975.5025524397843, 7980.1107141240909, 7984.7215383558532, 7989.3350266734733,
+    7993.9511806162427, 7998.5700017243107, 8003.191491538757, 8007.8156516015124,
+    8012.4424834554393, 8017.0719886442503, 8021.7041687125793, 8026.3390252059544,
+    8030.9765596707657, 8035.6167736543375, 8040.2596687048472, 8044.905246371407,
+    8049.5535082039833, 8054.2044557534718, 8058.858090571659, 8063.5144142112022,
+    8068.173428225693, 8072.8351341695825, 8077.4995335982585, 8082.1666280679692,
+    8086.8364191358905, 8091.5089083600988, 8096.1840972995396, 8100.8619875141012,
+    8105.5425805645318, 8110.2258780125212, 8114.9118814206222, 8119.6005923523207,
+    8124.2920123720041, 8128.9861430449355, 8133.6829859373229, 8138.3825426162375,
+    8143.0848146496955, 8147.7898036065817, 8152.4975110567166, 8157.2079385708257,
+    8161.9210877205132, 8166.6369600783328, 8171.3555572177047, 8176.0768807129998,
+    8180.8009321394575, 8185.5277130732575, 8190.2572250914909, 8194.9894697721302,
+    8199.7244486940963, 8204.4621634371906, 8209.2026155821459, 8213.945806710617,
+    8218.6917384051412, 8223.4404122492069, 8228.1918298271794, 8232.9459927243788,
+    8237.702902527004, 8242.4625608221959, 8247.224969198016, 8251.9901292434115,
+    8256.7580425482884, 8261.528710703431, 8266.3021353005824, 8271.078317932368,
+    8275.8572601923588, 8280.6389636750482, 8285.4234299758245, 8290.2106606910347,
+    8295.000657417906, 8299.7934217546353, 8304.5889553002926, 8309.3872596549136,
+    8314.1883364194473, 8318.9921871957467, 8323.7988135866271, 8328.6082171957878,
+    8333.4203996278957, 8338.2353624885054, 8343.0531073841321, 8347.8736359222148,
+    8352.6969497110913, 8357.5230503600724, 8362.3519394793566, 8367.1836186801138,
+    8372.0180895743997, 8376.8553537752396, 8381.6954128965845, 8386.5382685532895,
+    8391.3839223611867, 8396.2323759369956, 8401.0836308984144, 8405.9376888640327,
+    8410.7945514534094, 8415.6542202870332, 8420.5166969863039, 8425.3819831735982,
+    8430.2500804721894, 8435.1209905063242, 8439.994714901155, 8444.8712552828001,
+    8449.7506132783146, 8454.6327905156686, 8459.5177886238089, 8464.4056092325845,
+    8469.2962539728287, 8474.1897244762749, 8479.0860223756281, 8483.9851493045389,
+    8488.8871068975695, 8493.7918967902697, 8498.6995206190913, 8503.6099800214743,
+    8508.5232766357603, 8513.4394121012756, 8518.3583880582846, 8523.2802061479724,
+    8528.2048680125172, 8533.1323752949993, 8538.062729639496, 8542.9959326909848,
+    8547.9319860954292, 8552.870891499746, 8557.8126505517685, 8562.757264900325,
+    8567.7047361951554, 8572.6550660869871, 8577.6082562274914, 8582.564308269275,
+    8587.52322386593, 8592.4850046719712, 8597.4496523429061, 8602.4171685351594,
+    8607.3875549061413, 8612.3608131142228, 8617.3369448187022, 8622.3159516798714,
+    8627.2978353589479, 8632.2825975181477, 8637.2702398206038, 8642.2607639304479,
+    8647.2541715127627, 8652.2504642335716, 8657.2496437598966, 8662.2517117596835,
+    8667.2566699018807, 8672.2645198563623, 8677.2752632939992, 8682.2889018866226,
+    8687.3054373070063, 8692.324871228926, 8697.3472053270852, 8702.3724412771917,
+    8707.4005807558897, 8712.4316254408168, 8717.4655770105783, 8722.5024371447234,
+    8727.542207523813, 8732.5848898293279, 8737.6304857437772, 8742.678996950588,
+    8747.7304251342011, 8752.7847719800211, 8757.8420391743985, 8762.9022284047041,
+    8767.9653413592387, 8773.0313797273193, 8778.1003451991965, 8783.1722394661338,
+    8788.247064220368, 8793.3248211550817, 8798.40551196448, 8803.4891383437025,
+    8808.5757019889134, 8813.6652045972114, 8818.7576478667106, 8823.8530334965053,
+    8828.9513631866375, 8834.0526386381771, 8839.1568615531287, 8844.2640336345339,
+    8849.3741565863638, 8854.4872321136118, 8859.6032619222569, 8864.7222477192317,
+    8869.8441912124927, 8874.9690941109475, 8880.0969581245299, 8885.2277849641177,
+    8890.3615763416165, 8895.498333969912, 8900.6380595628507, 8905.7807548353139,
+    8910.9264215031326, 8916.0750612831653, 8921.2266758932255, 8926.3812670521493,
+    8931.5388364797673, 8936.6993858968672, 8941.8629170252789, 8947.0294315877836,
+    8952.1989313081885, 8957.3714179112958, 8962.5468931228752, 8967.7253586697334,
+    8972.9068162796339, 8978.0912676813823, 8983.278714604734, 8988.4691587804864,
+    8993.6626019404284, 8998.8590458173203, 9004.0584921449663, 9009.2609426581275,
+    9014.4663990926165, 9019.6748631852006, 9024.8863366736787, 9030.1008212968663,
+    9035.3183187945397, 9040.5388309075297, 9045.7623593776225, 9050.9889059476664,
+    9056.2184723614646, 9061.4510603638573, 9066.6866717007015, 9071.9253081188272,
+    9077.1669713661158, 9082.4116631914112, 9087.6593853446211, 9092.9101395766138,
+    9098.1639276393016, 9103.4207512856156, 9108.6806122694543, 9113.9435123457915,
+    9119.2094532705541, 9124.4784368007367, 9129.7504646943016, 9135.0255387102607,
+    9140.3036606086443, 9145.5848321504636, 9150.8690550977935, 9156.1563312136841,
+    9161.4466622622404, 9166.7400500085532, 9172.0364962187596, 9177.3360026600203,
+    9182.6385711004805, 9187.9442033093528, 9193.2529010568323, 9198.5646661141745,
+    9203.8795002536172, 9209.1974052484547, 9214.518382873006, 9219.8424349025809,
+    9225.1695631135626, 9230.4997692833149, 9235.8330551902709, 9241.1694226138479,
+    9246.5088733345256, 9251.8514091338093, 9257.1970317942069, 9262.5457430992956,
+    9267.8975448336387, 9273.2524387828744, 9278.6104267336323, 9283.971510473606,
+    9289.3356917915171, 9294.7029724770946, 9300.0733543211445, 9305.4468391154569,
+    9310.8234286529078, 9316.2031247273626, 9321.5859291337583, 9326.9718436680687,
+    9332.3608701272678, 9337.7530103094177, 9343.1482660135698, 9348.5466390398524,
+    9353.948131189436, 9359.3527442644918, 9364.7604800682784, 9370.1713404050588,
+    9375.5853270801708, 9381.0024418999637, 9386.4226866718545, 9391.8460632043061,
+    9397.2725733068, 9402.7022187899001, 9408.1350014651707, 9413.5709231452747,
+    9419.0099856438756, 9424.4521907757098, 9429.8975403565764, 9435.3460362032765,
+    9440.7976801337136, 9446.2524739667988, 9451.7104195225311, 9457.1715186219208,
+    9462.6357730870641, 9468.1031847411123, 9473.5737554082298, 9479.0474869136833,
+    9484.5243810837528, 9490.004439745815, 9495.4876647282545, 9500.9740578605488,
+    9506.463620973238, 9511.9563558978771, 9517.4522644671288, 9522.951348514669,
+    9528.4536098752815, 9533.9590503847558, 9539.4676718799892, 9544.9794761989251,
+    9550.494465180549, 9556.0126406649488, 9561.5340044932254, 9567.0585585075969,
+    9572.5863045512906, 9578.1172444686472, 9583.6513801050605, 9589.1887133069595,
+    9594.7292459218897, 9600.2729797984139, 9605.8199167862113, 9611.3700587359799,
+    9616.9234074995275, 9622.4799649297292, 9628.0397328804956, 9633.6027132068539,
+    9639.1689077648589, 9644.7383184116807, 9650.3109470055224, 9655.8867954056877,
+    9661.4658654725627, 9667.0481590675645, 9672.6336780532401, 9678.2224242931643,
+    9683.8143996520321, 9689.40960599557, 9695.0080451906215, 9700.6097191051049,
+    9706.2146296079827, 9711.8227785693471, 9717.4341678603178, 9723.0487993531533,
+    9728.6666749211345, 9734.2877964386698, 9739.9121657812429, 9745.5397848253924,
+    9751.1706554487846, 9756.8047795301245, 9762.4421589492358, 9768.0827955870336,
+    9773.7266913254753, 9779.3738480476659, 9785.0242676377402, 9790.6779519809716,
+    9796.3349029636793, 9801.9951224733031, 9807.658612398378, 9813.3253746284881,
+    9818.9954110543658, 9824.6687235677782, 9830.3453140616384, 9836.025184429911,
+    9841.7083365676772, 9847.3947723711262, 9853.0844937375005, 9858.7775025651881,
+    9864.4738007536253, 9870.173390203392, 9875.8762728161237, 9881.5824504945849,
+    9887.2919251426447, 9893.0046986652324, 9898.7207729684251, 9904.4401499593587,
+    9910.1628315463113, 9915.8888196386251, 9921.6181161467703, 9927.3507229823317,
+    9933.0866420579569, 9938.8258752874444, 9944.5684245856555, 9950.3142918686062,
+    9956.0634790533641, 9961.8159880581497, 9967.5718208022881, 9973.3309792061737,
+    9979.0934651913649, 9984.8592806804772, 9990.6284275972885, 9996.4009078666386,
+    10002.176723414514, 10007.955876168016, 10013.738368055327, 10019.524201005781,
+    10025.313376949789, 10031.105897818921, 10036.901765545816, 10042.700982064265,
+    10048.503549309178, 10054.309469216541, 10060.118743723518, 10065.931374768332,
+    10071.747364290381, 10077.566714230134, 10083.389426529218, 10089.215503130381,
+    10095.044945977454, 10100.877757015447, 10106.713938190438, 10112.553491449684,
+    10118.396418741513, 10124.242722015419, 10130.092403222019, 10135.945464313027,
+    10141.801907241328, 10147.661733960884, 10153.524946426842, 10159.391546595425,
+    10165.261536424025, 10171.134917871164, 10177.011692896458, 10182.891863460705,
+    10188.775431525792, 10194.662399054765, 10200.552768011818, 10206.446540362229,
+    10212.34371807247, 10218.244303110097, 10224.148297443857, 10230.055703043574,
+    10235.966521880258, 10241.880755926055, 10247.798407154211, 10253.71947753916,
+    10259.643969056435, 10265.571883682753, 10271.503223395923, 10277.43799017494,
+    10283.376185999939, 10289.317812852161, 10295.262872714042, 10301.211367569114,
+    10307.163299402107, 10313.118670198843, 10319.077481946333, 10325.039736632736,
+    10331.005436247318, 10336.974582780551, 10342.947178224, 10348.923224570437,
+    10354.90272381373, 10360.885677948942, 10366.872088972281, 10372.86195888108,
+    10378.855289673869, 10384.852083350292, 10390.852341911183, 10396.856067358494,
+    10402.863261695369, 10408.87392692611, 10414.888065056133, 10420.905678092075,
+    10426.926768041669, 10432.951336913866, 10438.979386718725, 10445.01091946751,
+    10451.045937172636, 10457.084441847652, 10463.126435507318, 10469.171920167504,
+    10475.220897845304, 10481.273370558918, 10487.329340327753, 10493.388809172387,
+    10499.451779114523, 10505.51825217708, 10511.588230384104, 10517.661715760853,
+    10523.738710333708, 10529.819216130258, 10535.903235179265, 10541.990769510625,
+    10548.081821155452, 10554.176392145991, 10560.274484515712, 10566.376100299198,
+    10572.481241532258, 10578.589910251871, 10584.702108496154, 10590.81783830446,
+    10596.93710171726, 10603.059900776261, 10609.186237524298, 10615.31611400542,
+    10621.449532264864, 10627.586494349003, 10633.72700230545, 10639.871058182944,
+    10646.018664031453, 10652.169821902125, 10658.324533847255, 10664.482801920376,
+    10670.644628176155, 10676.8100146705, 10682.978963460449, 10689.151476604276,
+    10695.327556161441, 10701.507204192554, 10707.690422759466, 10713.877213925169,
+    10720.067579753899, 10726.261522311033, 10732.459043663182, 10738.660145878148,
+    10744.86483102489, 10751.073101173615, 10757.284958395672, 10763.500404763659,
+    10769.719442351325, 10775.942073233649, 10782.168299486815, 10788.398123188163,
+    10794.631546416284, 10800.868571250923, 10807.109199773078, 10813.353434064893,
+    10819.60127620976, 10825.85272829227, 10832.107792398179, 10838.366470614505,
+    10844.628765029416, 10850.894677732342, 10857.16421081386, 10863.437366365806,
+    10869.714146481216, 10875.994553254299, 10882.278588780524, 10888.566255156522,
+    10894.857554480188, 10901.15248885057, 10907.451060367977, 10913.753271133924,
+    10920.059123251109, 10926.368618823491, 10932.681759956191, 10938.998548755606,
+    10945.31898732929, 10951.643077786059, 10957.970822235944, 10964.302222790162,
+    10970.637281561194, 10976.976000662693, 10983.318382209589, 10989.664428317976,
+    10996.01414110521, 11002.367522689878, 11008.724575191742, 11015.085300731847,
+    11021.449701432412, 11027.817779416928, 11034.18953681007, 11040.564975737769,
+    11046.944098327196, 11053.326906706703, 11059.713403005924, 11066.10358935568,
+    11072.497467888066, 11078.895040736363, 11085.296310035117, 11091.701277920114,
+    11098.109946528331, 11104.522317998035, 11110.938394468674, 11117.358178080969,
+    11123.781670976883, 11130.208875299575, 11136.639793193495, 11143.074426804278,
+    11149.512778278853, 11155.954849765338, 11162.400643413124, 11168.850161372859,
+    11175.303405796378, 11181.76037883682, 11188.221082648517, 11194.685519387094,
+    11201.153691209374, 11207.625600273455, 11214.101248738698, 11220.580638765656,
+    11227.063772516196, 11233.550652153373, 11240.041279841547, 11246.535657746277,
+    11253.033788034412, 11259.535672874053, 11266.041314434515, 11272.550714886416,
+    11279.063876401578, 11285.580801153134, 11292.101491315412, 11298.62594906404,
+    11305.154176575907, 11311.68617602911, 11318.221949603068, 11324.761499478403,
+    11331.304827837046, 11337.851936862138, 11344.402828738122, 11350.957505650709,
+    11357.515969786817, 11364.078223334696, 11370.644268483802, 11377.21410742491,
+    11383.787742350001, 11390.365175452373, 11396.946408926584, 11403.531444968425,
+    11410.120285775003, 11416.712933544648, 11423.309390477007, 11429.909658772949,
+    11436.513740634651, 11443.121638265568, 11449.733353870384, 11456.348889655108,
+    11462.968247826977, 11469.591430594552, 11476.218440167615, 11482.849278757269,
+    11489.483948575893, 11496.122451837105, 11502.764790755853, 11509.410967548314,
+    11516.060984432001, 11522.714843625645, 11529.372547349309, 11536.034097824337,
+    11542.699497273316, 11549.368747920164, 11556.041851990038, 11562.718811709434,
+    11569.399629306079, 11576.084307009025, 11582.772847048618, 11589.465251656444,
+    11596.161523065442, 11602.861663509779, 11609.565675224954, 11616.273560447769,
+    11622.985321416261, 11629.700960369824, 11636.420479549091, 11643.143881196042,
+    11649.871167553898, 11656.602340867223, 11663.337403381867, 11670.076357344942,
+    11676.819205004918, 11683.565948611504, 11690.316590415759, 11697.07113267,
+    11703.829577627877, 11710.591927544345, 11717.358184675621, 11724.128351279278,
+    11730.902429614145, 11737.680421940402, 11744.462330519487, 11751.248157614185,
+    11758.037905488585, 11764.831576408043, 11771.629172639286, 11778.430696450285,
+    11785.236150110386, 11792.045535890185, 11798.858856061634, 11805.676112897996,
+    11812.497308673808, 11819.322445664975, 11826.151526148662, 11832.984552403406,
+    11839.821526709005, 11846.662451346614, 11853.507328598707, 11860.356160749037,
+    11867.20895008273, 11874.065698886176, 11880.926409447144, 11887.791084054665,
+    11894.659724999143, 11901.532334572297, 11908.40891506713, 11915.289468778028,
+    11922.173998000644, 11929.06250503202, 11935.954992170457, 11942.851461715638,
+    11949.751915968569, 11956.656357231544, 11963.564787808244, 11970.477210003621,
+    11977.393626124025, 11984.314038477069, 11991.238449371753, 11998.166861118405,
+    12005.099276028648, 12012.035696415496, 12018.97612459324, 12025.920562877573,
+    12032.869013585459, 12039.821479035252, 12046.777961546639, 12053.738463440613,
+    12060.702987039553, 12067.671534667132, 12074.644108648423, 12081.620711309777,
+    12088.601344978943, 12095.586011985006, 12102.574714658354, 12109.567455330789,
+    12116.564236335391, 12123.565060006636, 12130.569928680354, 12137.578844693668,
+    12144.591810385122, 12151.60882809455, 12158.629900163191, 12165.655028933583,
+    12172.68421674966, 12179.717465956714, 12186.754778901339, 12193.796157931554,
+    12200.841605396668, 12207.891123647414, 12214.944715035816, 12222.002381915305,
+    12229.064126640671, 12236.129951568024, 12243.199859054892, 12250.273851460101,
+    12257.351931143907, 12264.434100467866, 12271.520361794943, 12278.61071748947,
+    12285.705169917101, 12292.803721444914, 12299.906374441298, 12307.013131276066,
+    12314.123994320344, 12321.238965946672, 12328.358048528959, 12335.481244442442,
+    12342.608556063797, 12349.739985770997, 12356.875535943464, 12364.015208961931,
+    12371.159007208547, 12378.306933066842, 12385.458988921677, 12392.61517715935,
+    12399.775500167478, 12406.939960335119, 12414.108560052651, 12421.281301711877,
+    12428.458187705981, 12435.639220429486, 12442.824402278362, 12450.013735649896,
+    12457.207222942827, 12464.404866557217, 12471.606668894558, 12478.812632357733,
+    12486.022759350968, 12493.237052279934, 12500.455513551638, 12507.678145574533,
+    12514.904950758404, 12522.135931514476, 12529.371090255368, 12536.610429395045,
+    12543.853951348923, 12551.101658533762, 12558.353553367777, 12565.609638270511,
+    12572.869915662963, 12580.134387967521, 12587.403057607931, 12594.675927009403,
+    12601.952998598481, 12609.234274803177, 12616.519758052844, 12623.809450778281,
+    12631.1033554117, 12638.401474386659, 12645.703810138197, 12653.010365102688,
+    12660.321141717968, 12667.636142423276, 12674.955369659217, 12682.278825867865,
+    12689.606513492648, 12696.938434978463, 12704.27459277156, 12711.614989319649,
+    12718.959627071852, 12726.308508478662, 12733.66163599205, 12741.019012065339,
+    12748.380639153336, 12755.746519712198, 12763.116656199556, 12770.491051074452,
+    12777.86970679731, 12785.252625830031, 12792.639810635881, 12800.031263679613,
+    12807.426987427334, 12814.826984346631, 12822.231256906511, 12829.639807577363,
+    12837.05263883107, 12844.469753140873, 12851.891152981507, 12859.31684082908,
+    12866.746819161168, 12874.181090456786, 12881.619657196332, 12889.062521861701,
+    12896.509686936155, 12903.961154904458, 12911.416928252745, 12918.877009468639,
+    12926.341401041193, 12933.810105460852, 12941.28312521957, 12948.760462810671,
+    12956.242120728984, 12963.728101470719, 12971.218407533574, 12978.713041416686,
+    12986.212005620597, 12993.715302647348, 13001.222935000373, 13008.734905184607,
+    13016.25121570637, 13023.771869073478, 13031.296867795205, 13038.826214382208,
+    13046.359911346681, 13053.897961202189, 13061.440366463818, 13068.987129648047,
+    13076.538253272851, 13084.093739857664, 13091.653591923327, 13099.217811992201,
+    13106.786402588039, 13114.35936623612, 13121.936705463113, 13129.518422797202,
+    13137.10452076802, 13144.695001906628, 13152.289868745604, 13159.889123818926,
+    13167.492769662102, 13175.100808812043, 13182.713243807171, 13190.330077187373,
+    13197.95131149396, 13205.576949269773, 13213.206993059057, 13220.841445407576,
+    13228.480308862569, 13236.123585972689, 13243.771279288138, 13251.423391360517,
+    13259.079924742968, 13266.74088199005, 13274.406265657839, 13282.076078303893,
+    13289.750322487193, 13297.429000768268,
+  };
 } // namespace mopo
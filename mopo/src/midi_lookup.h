@@ -25,35 +25,20 @@
 
 namespace mopo {
 
-  class MidiLookupSingleton {
+  // Midi cents to frequency through a table from tools/generate_lookups.cpp.
+  class MidiLookup {
     public:
-      MidiLookupSingleton() {
-        for (int i = 0; i < MAX_CENTS + 2; ++i) {
-          frequency_lookup_[i] = utils::midiCentsToFrequency(i);
-        }
-      }
-
-      mopo_float centsLookup(mopo_float cents_from_0) const {
+      static mopo_float centsLookup(mopo_float cents_from_0) {
         mopo_float clamped_cents = utils::clamp(cents_from_0, 0.0, MAX_CENTS);
         int full_cents = clamped_cents;
         mopo_float fraction_cents = clamped_cents - full_cents;
 
-        return utils::interpolate(frequency_lookup_[full_cents],
-                                  frequency_lookup_[full_cents + 1], fraction_cents);
-      }
-
-    private:
-      mopo_float frequency_lookup_[MAX_CENTS + 2];
-  };
-
-  class MidiLookup {
-    public:
-      static mopo_float centsLookup(mopo_float cents_from_0) {
-        return lookup_.centsLookup(cents_from_0);
+        return utils::interpolate(lookup_[full_cents],
+                                  lookup_[full_cents + 1], fraction_cents);
       }
 
     private:
-      static const MidiLookupSingleton lookup_;
+      static const mopo_float lookup_[MAX_CENTS + 2];
   };
 } // namespace mopo
 
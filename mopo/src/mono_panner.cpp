@@ -32,17 +32,20 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(kAudio));
     MOPO_ASSERT(inputMatchesBufferSize(kPan));
 
+    const mopo_float* audio = input(kAudio)->source->buffer;
+    const mopo_float* pan = input(kPan)->source->buffer;
+    mopo_float* MOPO_RESTRICT left = output(kLeft)->buffer;
+    mopo_float* MOPO_RESTRICT right = output(kRight)->buffer;
+
     mopo_float integral;
     for (int i = 0; i < buffer_size_; ++i) {
-      mopo_float audio = input(kAudio)->at(i);
-      mopo_float pan = input(kPan)->at(i);
-      mopo_float left_gain = Wave::fullsin(utils::mod(pan + LEFT_ROTATION,
+      mopo_float left_gain = Wave::fullsin(utils::mod(pan[i] + LEFT_ROTATION,
                                                       &integral));
-      mopo_float right_gain = Wave::fullsin(utils::mod(pan + RIGHT_ROTATION,
+      mopo_float right_gain = Wave::fullsin(utils::mod(pan[i] + RIGHT_ROTATION,
                                                        &integral));
 
-      output(kLeft)->buffer[i] = audio * left_gain;
-      output(kRight)->buffer[i] = audio * right_gain;
+      left[i] = audio[i] * left_gain;
+      right[i] = audio[i] * right_gain;
     }
   }
 } // namespace mopo
@@ -20,6 +20,7 @@
 
 #include "alias.h"
 #include "arpeggiator.h"
+#include "batch_math.h"
 #include "bit_crush.h"
 #include "biquad_filter.h"
 #include "bypass_router.h"
@@ -36,8 +37,10 @@
 #include "midi_lookup.h"
 #include "mono_panner.h"
 #include "note_handler.h"
+#include "note_render_cache.h"
 #include "operators.h"
 #include "oscillator.h"
+#include "oversampler.h"
 #include "portamento_slope.h"
 #include "processor.h"
 #include "processor_router.h"
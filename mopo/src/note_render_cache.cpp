@@ -0,0 +1,155 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "note_render_cache.h"
+
+#include "utils.h"
+
+#include <algorithm>
+
+namespace mopo {
+
+  NoteRenderCache::NoteRenderCache(int num_outputs, size_t memory_budget) :
+      num_outputs_(num_outputs), generation_(0), clock_(0) {
+    size_t render_size = num_outputs_ * MAX_RENDER_SAMPLES;
+    size_t num_renders = std::max<size_t>(1, memory_budget / (render_size * sizeof(mopo_float)));
+
+    renders_.resize(num_renders);
+    for (NoteRender& render : renders_) {
+      render.audio.resize(render_size);
+      render.users = 0;
+      render.stale = false;
+      render.valid = false;
+      render.last_used = 0;
+    }
+
+    for (int i = 0; i < MAX_RECORDINGS; ++i) {
+      recordings_[i].audio.resize(render_size);
+      recording_active_[i] = false;
+    }
+  }
+
+  void NoteRenderCache::clear() {
+    generation_++;
+    for (int i = 0; i < MAX_RECORDINGS; ++i)
+      recording_active_[i] = false;
+
+    for (NoteRender& render : renders_) {
+      if (render.users)
+        render.stale = true;
+      else
+        render.valid = false;
+    }
+  }
+
+  NoteRender* NoteRenderCache::find(mopo_float note, mopo_float velocity, int offset) {
+    for (NoteRender& render : renders_) {
+      if (render.valid && !render.stale && render.note == note &&
+          render.velocity == velocity && render.offset == offset) {
+        render.last_used = ++clock_;
+        return &render;
+      }
+    }
+    return nullptr;
+  }
+
+  void NoteRenderCache::release(NoteRender* render) {
+    MOPO_ASSERT(render->users > 0);
+    render->users--;
+    if (render->users == 0 && render->stale) {
+      render->stale = false;
+      render->valid = false;
+    }
+  }
+
+  int NoteRenderCache::startRecording(mopo_float note, mopo_float velocity, int offset) {
+    for (int i = 0; i < MAX_RECORDINGS; ++i) {
+      if (!recording_active_[i]) {
+        recording_active_[i] = true;
+        recordings_[i].note = note;
+        recordings_[i].velocity = velocity;
+        recordings_[i].offset = offset;
+        recordings_[i].release = -1;
+        recordings_[i].length = 0;
+        recordings_[i].users = 0;
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  bool NoteRenderCache::isRecording(int slot, int generation) const {
+    return generation == generation_ && slot >= 0 && recording_active_[slot];
+  }
+
+  bool NoteRenderCache::record(int slot, int output, const mopo_float* source, int size) {
+    NoteRender& recording = recordings_[slot];
+    if (recording.length + size > MAX_RENDER_SAMPLES) {
+      recording_active_[slot] = false;
+      return false;
+    }
+
+    mopo_float* dest = recording.audio.data() + output * MAX_RENDER_SAMPLES + recording.length;
+    utils::copyBuffer(dest, source, size);
+    return true;
+  }
+
+  void NoteRenderCache::advanceRecording(int slot, int size) {
+    recordings_[slot].length += size;
+  }
+
+  void NoteRenderCache::setRelease(int slot, int release) {
+    recordings_[slot].release = release;
+  }
+
+  void NoteRenderCache::finishRecording(int slot) {
+    NoteRender& recording = recordings_[slot];
+    recording_active_[slot] = false;
+
+    if (recording.release < 0 ||
+        find(recording.note, recording.velocity, recording.offset)) {
+      return;
+    }
+
+    NoteRender* render = findFreeRender();
+    if (render == nullptr)
+      return;
+
+    render->audio.swap(recording.audio);
+    render->note = recording.note;
+    render->velocity = recording.velocity;
+    render->offset = recording.offset;
+    render->release = recording.release;
+    render->length = recording.length;
+    render->users = 0;
+    render->stale = false;
+    render->valid = true;
+    render->last_used = ++clock_;
+  }
+
+  // An empty slot if there is one, otherwise the least recently used render
+  // nothing is replaying.
+  NoteRender* NoteRenderCache::findFreeRender() {
+    NoteRender* oldest = nullptr;
+    for (NoteRender& render : renders_) {
+      if (!render.valid)
+        return &render;
+      if (render.users == 0 && (oldest == nullptr || render.last_used < oldest->last_used))
+        oldest = &render;
+    }
+    return oldest;
+  }
+} // namespace mopo
@@ -0,0 +1,98 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef NOTE_RENDER_CACHE_H
+#define NOTE_RENDER_CACHE_H
+
+#include "common.h"
+
+#include <cstddef>
+#include <vector>
+
+#define DEFAULT_RENDER_CACHE_BYTES (32 * 1024 * 1024)
+
+namespace mopo {
+
+  // The audio a single voice made from its note on until it went silent.
+  // Control rate processors run on the buffer grid so the note on offset
+  // inside the first buffer is part of what makes a render repeatable.
+  struct NoteRender {
+    mopo_float note;
+    mopo_float velocity;
+    int offset;
+    int release;
+    int length;
+    int users;
+    bool stale;
+    bool valid;
+    unsigned long long last_used;
+    std::vector<mopo_float> audio;
+
+    inline const mopo_float* buffer(int output) const;
+  };
+
+  // Stores whole voice renders keyed by note, velocity and offset so a patch that
+  // sounds the same every time can replay them instead of running the voice.
+  // Every render and recording slot is MAX_RENDER_SAMPLES long and allocated
+  // up front, as many as fit in the memory budget. A finished recording
+  // swaps buffers with the least recently used free slot so nothing is
+  // allocated while playing.
+  class NoteRenderCache {
+    public:
+      static const int MAX_RENDER_SAMPLES = 16384;
+      static const int MAX_RECORDINGS = 8;
+
+      NoteRenderCache(int num_outputs, size_t memory_budget = DEFAULT_RENDER_CACHE_BYTES);
+
+      // Renders still being replayed stay until their last user releases them.
+      void clear();
+      int numOutputs() const { return num_outputs_; }
+
+      NoteRender* find(mopo_float note, mopo_float velocity, int offset);
+      void release(NoteRender* render);
+
+      // Returns the recording slot or -1 if all slots are in use.
+      int startRecording(mopo_float note, mopo_float velocity, int offset);
+      bool isRecording(int slot, int generation) const;
+      int generation() const { return generation_; }
+
+      // Returns false and drops the recording if it got too long.
+      bool record(int slot, int output, const mopo_float* source, int size);
+      void advanceRecording(int slot, int size);
+      void setRelease(int slot, int release);
+      void finishRecording(int slot);
+      void abortRecording(int slot) { recording_active_[slot] = false; }
+
+    private:
+      NoteRender* findFreeRender();
+
+      int num_outputs_;
+      int generation_;
+      unsigned long long clock_;
+
+      NoteRender recordings_[MAX_RECORDINGS];
+      bool recording_active_[MAX_RECORDINGS];
+
+      std::vector<NoteRender> renders_;
+  };
+
+  inline const mopo_float* NoteRender::buffer(int output) const {
+    return audio.data() + output * NoteRenderCache::MAX_RENDER_SAMPLES;
+  }
+} // namespace mopo
+
+#endif // NOTE_RENDER_CACHE_H
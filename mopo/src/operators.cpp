@@ -48,11 +48,7 @@ namespace mopo {
                 &min_, &max_,
                 output()->buffer, 1, buffer_size_);
 #else
-    mopo_float* dest = output()->buffer;
-    const mopo_float* source = input()->source->buffer;
-
-    for (int i = 0; i < buffer_size_; ++i)
-      bufferTick(dest, source, i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -64,8 +60,7 @@ namespace mopo {
     vDSP_vnegD(input()->source->buffer, 1,
                output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -77,8 +72,7 @@ namespace mopo {
     vDSP_vsmulD(input()->source->buffer, 1, &scale_,
                 output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -87,13 +81,8 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(0));
     MOPO_ASSERT(inputMatchesBufferSize(1));
 
-    mopo_float* dest = output()->buffer;
-    const mopo_float* source_left = input(0)->source->buffer;
-    const mopo_float* source_right = input(1)->source->buffer;
-
-    VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size_; ++i)
-      bufferTick(dest, source_left, source_right, i);
+    processKernel(this, output()->buffer, input(0)->source->buffer,
+                  input(1)->source->buffer, buffer_size_);
 
     processTriggers();
   }
@@ -107,8 +96,8 @@ namespace mopo {
                input(1)->source->buffer, 1,
                output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input(0)->source->buffer,
+                  input(1)->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -117,13 +106,8 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(0));
     MOPO_ASSERT(inputMatchesBufferSize(1));
 
-    mopo_float* dest = output()->buffer;
-    const mopo_float* source_left = input(0)->source->buffer;
-    const mopo_float* source_right = input(1)->source->buffer;
-
-    VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size_; ++i)
-      bufferTick(dest, source_left, source_right, i);
+    processKernel(this, output()->buffer, input(0)->source->buffer,
+                  input(1)->source->buffer, buffer_size_);
 
     processTriggers();
   }
@@ -133,21 +117,28 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(1));
     MOPO_ASSERT(inputMatchesBufferSize(2));
 
-    mopo_float* dest = output()->buffer;
-    const mopo_float* from = input(kFrom)->source->buffer;
-    const mopo_float* to = input(kTo)->source->buffer;
-    const mopo_float* fractional = input(kFractional)->source->buffer;
-
-    VECTORIZE_LOOP
-    for (int i = 0; i < buffer_size_; ++i)
-      bufferTick(dest, from, to, fractional, i);
+    processKernel(this, output()->buffer, input(kFrom)->source->buffer,
+                  input(kTo)->source->buffer, input(kFractional)->source->buffer,
+                  buffer_size_);
 
     processTriggers();
   }
 
   void BilinearInterpolate::process() {
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    mopo_float* MOPO_RESTRICT dest = output()->buffer;
+    const mopo_float* top_left = input(kTopLeft)->source->buffer;
+    const mopo_float* top_right = input(kTopRight)->source->buffer;
+    const mopo_float* bottom_left = input(kBottomLeft)->source->buffer;
+    const mopo_float* bottom_right = input(kBottomRight)->source->buffer;
+    const mopo_float* x_position = input(kXPosition)->source->buffer;
+    const mopo_float* y_position = input(kYPosition)->source->buffer;
+
+    VECTORIZE_LOOP
+    for (int i = 0; i < buffer_size_; ++i) {
+      mopo_float top = utils::interpolate(top_left[i], top_right[i], x_position[i]);
+      mopo_float bottom = utils::interpolate(bottom_left[i], bottom_right[i], x_position[i]);
+      dest[i] = utils::interpolate(top, bottom, y_position[i]);
+    }
     processTriggers();
   }
 
@@ -195,8 +186,7 @@ namespace mopo {
     vDSP_vsdivD(input()->source->buffer, 1, &sample_rate,
                 output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -209,8 +199,7 @@ namespace mopo {
     vDSP_svdivD(&sample_rate, input()->source->buffer, 1,
                 output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -223,8 +212,7 @@ namespace mopo {
     vDSP_vsmulD(input()->source->buffer, 1, &sample_rate,
                 output()->buffer, 1, buffer_size_);
 #else
-    for (int i = 0; i < buffer_size_; ++i)
-      tick(i);
+    processKernel(this, output()->buffer, input()->source->buffer, buffer_size_);
 #endif
     processTriggers();
   }
@@ -279,4 +267,71 @@ namespace mopo {
     last_value_ = new_value;
     processTriggers();
   }
+
+  LinearSmoothBank::LinearSmoothBank(int num_values) :
+      Processor(num_values + 1, num_values), num_values_(num_values) {
+    MOPO_ASSERT(num_values <= MAX_VALUES);
+    for (int i = 0; i < MAX_VALUES; ++i)
+      last_values_[i] = 0.0;
+  }
+
+  void LinearSmoothBank::process() {
+    mopo_float new_values[MAX_VALUES];
+    mopo_float increments[MAX_VALUES];
+    mopo_float settled[MAX_VALUES];
+
+    for (int v = 0; v < num_values_; ++v)
+      new_values[v] = input(v)->source->buffer[0];
+
+    const Output* trigger = input(num_values_)->source;
+    int trigger_samples = trigger->triggered ? trigger->trigger_offset : 0;
+    mopo_float inv_buffer_size = 1.0 / buffer_size_;
+
+    VECTORIZE_LOOP
+    for (int v = 0; v < num_values_; ++v) {
+      increments[v] = (new_values[v] - last_values_[v]) * inv_buffer_size;
+      settled[v] = (increments[v] == 0.0) ? 1.0 : 0.0;
+    }
+
+    for (int v = 0; v < num_values_; ++v) {
+      Output* out = output(v);
+      mopo_float* dest = out->buffer;
+      mopo_float new_value = new_values[v];
+      out->clearTrigger();
+
+      if (trigger->triggered) {
+        int i = 0;
+        mopo_float val = last_values_[v];
+        VECTORIZE_LOOP
+        for (; i < trigger_samples; ++i)
+          dest[i] = val;
+
+        VECTORIZE_LOOP
+        for (; i < buffer_size_; ++i)
+          dest[i] = new_value;
+
+        out->trigger(new_value, trigger_samples);
+        continue;
+      }
+
+      if (settled[v] == 0.0 || new_value != dest[0] ||
+          new_value != dest[buffer_size_ - 1] ||
+          (buffer_size_ > 1 && new_value != dest[buffer_size_ - 2])) {
+        mopo_float inc = increments[v];
+        mopo_float val = last_values_[v] + inc;
+
+        VECTORIZE_LOOP
+        for (int i = 0; i < buffer_size_; ++i)
+          dest[i] = val + i * inc;
+      }
+
+      const Output* source = input(v)->source;
+      if (source->triggered)
+        out->trigger(dest[source->trigger_offset], source->trigger_offset);
+    }
+
+    VECTORIZE_LOOP
+    for (int v = 0; v < num_values_; ++v)
+      last_values_[v] = new_values[v];
+  }
 } // namespace mopo
@@ -23,10 +23,9 @@
 #include "resonance_lookup.h"
 #include "processor.h"
 
-#define PROCESS_TICK_FUNCTION \
+#define PROCESS_UNARY_KERNEL \
 void process() override { \
-  for (int i = 0; i < buffer_size_; ++i) \
-    tick(i); \
+  processKernel(this, output()->buffer, input()->source->buffer, buffer_size_); \
   processTriggers(); \
 }
 
@@ -52,6 +51,41 @@ namespace mopo {
         }
       }
 
+    protected:
+      // Whole block versions of bufferTick. The buffers are looked up once
+      // per block and passed in as restrict pointers so the compiler knows
+      // the output doesn't alias the inputs and can vectorize. _op_ is the
+      // concrete operator so its bufferTick inlines.
+      template<class Op>
+      static inline void processKernel(Op* op, mopo_float* MOPO_RESTRICT dest,
+                                       const mopo_float* MOPO_RESTRICT source,
+                                       int size) {
+        VECTORIZE_LOOP
+        for (int i = 0; i < size; ++i)
+          op->bufferTick(dest, source, i);
+      }
+
+      template<class Op>
+      static inline void processKernel(Op* op, mopo_float* MOPO_RESTRICT dest,
+                                       const mopo_float* MOPO_RESTRICT source_left,
+                                       const mopo_float* MOPO_RESTRICT source_right,
+                                       int size) {
+        VECTORIZE_LOOP
+        for (int i = 0; i < size; ++i)
+          op->bufferTick(dest, source_left, source_right, i);
+      }
+
+      template<class Op>
+      static inline void processKernel(Op* op, mopo_float* MOPO_RESTRICT dest,
+                                       const mopo_float* MOPO_RESTRICT from,
+                                       const mopo_float* MOPO_RESTRICT to,
+                                       const mopo_float* MOPO_RESTRICT fraction,
+                                       int size) {
+        VECTORIZE_LOOP
+        for (int i = 0; i < size; ++i)
+          op->bufferTick(dest, from, to, fraction, i);
+      }
+
     private:
       Operator() : Processor(0, 0) { }
   };
@@ -129,7 +163,7 @@ namespace mopo {
         dest[i] = 1.0 / source[i];
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
   };
 
   // A processor that will scale a signal by a given scalar.
@@ -168,7 +202,7 @@ namespace mopo {
         dest[i] = source[i] * source[i];
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
   };
 
   // A processor that will raise a given number to the power of a signal.
@@ -189,7 +223,7 @@ namespace mopo {
         dest[i] = std::pow(scale_, source[i]);
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
 
     private:
       mopo_float scale_;
@@ -212,7 +246,7 @@ namespace mopo {
         dest[i] = MidiLookup::centsLookup(CENTS_PER_NOTE * source[i]);
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
   };
 
   // A processor that will convert a stream of magnitudes to a stream of
@@ -233,7 +267,7 @@ namespace mopo {
         dest[i] = ResonanceLookup::qLookup(source[i]);
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
   };
 
   // A processor that will convert a stream of decibels to a stream of
@@ -254,7 +288,7 @@ namespace mopo {
         dest[i] = MagnitudeLookup::magnitudeLookup(source[i]);
       }
 
-      PROCESS_TICK_FUNCTION
+      PROCESS_UNARY_KERNEL
   };
 
   // A processor that will add two streams together.
@@ -504,6 +538,30 @@ namespace mopo {
       mopo_float last_value_;
   };
 
+  // Same ramps as a group of LinearSmoothBuffers that share one trigger.
+  // The per value state is kept in arrays so the increments and convergence
+  // checks run across all values at once and values that have settled are
+  // skipped. Value _i_ is plugged into input _i_ and ramps out of output _i_.
+  class LinearSmoothBank : public Processor {
+    public:
+      static const int MAX_VALUES = 16;
+
+      LinearSmoothBank(int num_values);
+
+      virtual Processor* clone() const override {
+        return new LinearSmoothBank(*this);
+      }
+
+      void process() override;
+
+      void plugTrigger(const Output* source) { plug(source, num_values_); }
+      void plugTrigger(const Processor* source) { plug(source, num_values_); }
+
+    protected:
+      int num_values_;
+      mopo_float last_values_[MAX_VALUES];
+  };
+
   namespace cr {
 
     // A processor that passes input to output.
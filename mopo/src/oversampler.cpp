@@ -0,0 +1,222 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "oversampler.h"
+
+#include "utils.h"
+
+#include <algorithm>
+
+namespace mopo {
+
+  namespace {
+    // Non zero taps of the half-band filter, the center tap is 0.5.
+    const mopo_float half_band_coefficients[HalfBandFilter::NUM_TAPS] = {
+      -2.40152508636e-05, 0.000109036223419, -0.000293560061772, 0.000638106333638,
+      -0.00122207592314, 0.00214590843052, -0.00353441407055, 0.00554364665399,
+      -0.0083762098805, 0.0123155822279, -0.0178046990454, 0.0256376836026,
+      -0.0374893791117, 0.0577240406128, -0.102442502071, 0.31707285133,
+      0.31707285133, -0.102442502071, 0.0577240406128, -0.0374893791117,
+      0.0256376836026, -0.0178046990454, 0.0123155822279, -0.0083762098805,
+      0.00554364665399, -0.00353441407055, 0.00214590843052, -0.00122207592314,
+      0.000638106333638, -0.000293560061772, 0.000109036223419, -2.40152508636e-05
+    };
+  } // namespace
+
+  HalfBandFilter::HalfBandFilter() {
+    reset();
+  }
+
+  void HalfBandFilter::reset() {
+    utils::zeroBuffer(up_memory_, NUM_TAPS - 1);
+    utils::zeroBuffer(down_even_memory_, NUM_TAPS - 1);
+    utils::zeroBuffer(down_odd_memory_, DELAY + 1);
+  }
+
+  void HalfBandFilter::upsample(mopo_float* dest, const mopo_float* source, int size) {
+    static const int memory = NUM_TAPS - 1;
+    mopo_float history[memory + Oversampler::MAX_OVERSAMPLING * MAX_BUFFER_SIZE / 2];
+    utils::copyBuffer(history, up_memory_, memory);
+    utils::copyBuffer(history + memory, source, size);
+
+    for (int i = 0; i < size; ++i) {
+      const mopo_float* newest = history + memory + i;
+      mopo_float total = 0.0;
+
+      VECTORIZE_LOOP
+      for (int t = 0; t < NUM_TAPS; ++t)
+        total += half_band_coefficients[t] * newest[-t];
+
+      dest[2 * i] = 2.0 * total;
+      dest[2 * i + 1] = newest[-DELAY];
+    }
+
+    utils::copyBuffer(up_memory_, history + size, memory);
+  }
+
+  void HalfBandFilter::downsample(mopo_float* dest, const mopo_float* source, int size) {
+    static const int even_memory = NUM_TAPS - 1;
+    static const int odd_memory = DELAY + 1;
+    mopo_float even[even_memory + Oversampler::MAX_OVERSAMPLING * MAX_BUFFER_SIZE / 2];
+    mopo_float odd[odd_memory + Oversampler::MAX_OVERSAMPLING * MAX_BUFFER_SIZE / 2];
+    utils::copyBuffer(even, down_even_memory_, even_memory);
+    utils::copyBuffer(odd, down_odd_memory_, odd_memory);
+
+    VECTORIZE_LOOP
+    for (int i = 0; i < size; ++i) {
+      even[even_memory + i] = source[2 * i];
+      odd[odd_memory + i] = source[2 * i + 1];
+    }
+
+    for (int i = 0; i < size; ++i) {
+      const mopo_float* newest = even + even_memory + i;
+      mopo_float total = 0.0;
+
+      VECTORIZE_LOOP
+      for (int t = 0; t < NUM_TAPS; ++t)
+        total += half_band_coefficients[t] * newest[-t];
+
+      dest[i] = total + 0.5 * odd[i];
+    }
+
+    utils::copyBuffer(down_even_memory_, even + size, even_memory);
+    utils::copyBuffer(down_odd_memory_, odd + size, odd_memory);
+  }
+
+  Oversampler::Oversampler() : ProcessorRouter(kNumInputs, 1), stages_(0),
+                               chunk_size_(DEFAULT_BUFFER_SIZE), align_delay_(0),
+                               oversampled_audio_(new Output()),
+                               oversampled_output_(nullptr) {
+    oversampled_audio_->owner = this;
+    utils::zeroBuffer(align_memory_, MAX_OVERSAMPLING);
+  }
+
+  void Oversampler::destroy() {
+    delete oversampled_audio_;
+    ProcessorRouter::destroy();
+  }
+
+  void Oversampler::process() {
+    MOPO_ASSERT(inputMatchesBufferSize(kAudio));
+    MOPO_ASSERT(oversampled_output_);
+
+    if (stages_ == 0) {
+      ProcessorRouter::process();
+      return;
+    }
+
+    const mopo_float* audio = input(kAudio)->source->buffer;
+    mopo_float* dest = output()->buffer;
+
+    mopo_float buffer_a[MAX_OVERSAMPLING * (MAX_BUFFER_SIZE + 1)];
+    mopo_float buffer_b[MAX_OVERSAMPLING * (MAX_BUFFER_SIZE + 1)];
+    mopo_float* from = buffer_a;
+    mopo_float* to = buffer_b;
+
+    int size = buffer_size_;
+    utils::copyBuffer(from, audio, size);
+    for (int s = 0; s < stages_; ++s) {
+      up_filters_[s].upsample(to, from, size);
+      std::swap(from, to);
+      size *= 2;
+    }
+
+    utils::copyBuffer(to, align_memory_, align_delay_);
+    for (int offset = 0; offset < size; offset += chunk_size_) {
+      utils::copyBuffer(oversampled_audio_->buffer, from + offset, chunk_size_);
+      ProcessorRouter::process();
+      utils::copyBuffer(to + align_delay_ + offset, oversampled_output_->buffer, chunk_size_);
+    }
+    utils::copyBuffer(align_memory_, to + size, align_delay_);
+    std::swap(from, to);
+
+    for (int s = stages_ - 1; s > 0; --s) {
+      size /= 2;
+      down_filters_[s].downsample(to, from, size);
+      std::swap(from, to);
+    }
+    down_filters_[0].downsample(dest, from, buffer_size_);
+  }
+
+  void Oversampler::setSampleRate(int sample_rate) {
+    Processor::setSampleRate(sample_rate);
+    updateInternalRates();
+  }
+
+  void Oversampler::setBufferSize(int buffer_size) {
+    Processor::setBufferSize(buffer_size);
+    updateInternalRates();
+  }
+
+  void Oversampler::addProcessor(Processor* processor) {
+    ProcessorRouter::addProcessor(processor);
+    processor->setBufferSize(chunk_size_);
+    processor->setSampleRate(sample_rate_ << stages_);
+  }
+
+  void Oversampler::setOversampling(int amount) {
+    int stages = 0;
+    while (stages < MAX_STAGES && (1 << stages) < amount)
+      stages++;
+
+    if (stages == stages_)
+      return;
+
+    stages_ = stages;
+    for (int s = 0; s < MAX_STAGES; ++s) {
+      up_filters_[s].reset();
+      down_filters_[s].reset();
+    }
+
+    // Pad the filter delay at the oversampled rate up to whole host samples.
+    int oversampling = 1 << stages_;
+    int delay = 0;
+    for (int s = 0; s < stages_; ++s)
+      delay += HalfBandFilter::latency() << (stages_ - s);
+    align_delay_ = (oversampling - delay % oversampling) % oversampling;
+    utils::zeroBuffer(align_memory_, MAX_OVERSAMPLING);
+
+    updateInternalRates();
+  }
+
+  int Oversampler::getLatency() const {
+    int delay = align_delay_;
+    for (int s = 0; s < stages_; ++s)
+      delay += HalfBandFilter::latency() << (stages_ - s);
+    return delay >> stages_;
+  }
+
+  void Oversampler::updateInternalRates() {
+    chunk_size_ = buffer_size_ << stages_;
+    while (chunk_size_ > MAX_BUFFER_SIZE)
+      chunk_size_ /= 2;
+
+    updateAllProcessors();
+    int internal_sample_rate = sample_rate_ << stages_;
+
+    int num_processors = local_order_.size();
+    for (int i = 0; i < num_processors; ++i) {
+      local_order_[i]->setSampleRate(internal_sample_rate);
+      local_order_[i]->setBufferSize(chunk_size_);
+    }
+
+    int num_feedbacks = local_feedback_order_.size();
+    for (int i = 0; i < num_feedbacks; ++i) {
+      local_feedback_order_[i]->setSampleRate(internal_sample_rate);
+      local_feedback_order_[i]->setBufferSize(chunk_size_);
+    }
+  }
+} // namespace mopo
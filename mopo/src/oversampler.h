@@ -0,0 +1,108 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef OVERSAMPLER_H
+#define OVERSAMPLER_H
+
+#include "processor_router.h"
+
+namespace mopo {
+
+  // 2x polyphase half-band FIR. 63 taps, Kaiser windowed, so every other
+  // coefficient is zero and one phase is a pure delay. Passband ripple is
+  // under 0.0025dB up to 0.42 of the oversampled nyquist and the stopband is
+  // below -70dB from 0.58 of the oversampled nyquist.
+  class HalfBandFilter {
+    public:
+      static const int NUM_TAPS = 32;
+      static const int DELAY = 15;
+
+      HalfBandFilter();
+
+      void reset();
+
+      // Writes 2 * _size_ samples to _dest_.
+      void upsample(mopo_float* dest, const mopo_float* source, int size);
+
+      // Reads 2 * _size_ samples from _source_.
+      void downsample(mopo_float* dest, const mopo_float* source, int size);
+
+      // Round trip delay in samples at the lower sample rate.
+      static int latency() { return NUM_TAPS - 1; }
+
+    private:
+      mopo_float up_memory_[NUM_TAPS - 1];
+      mopo_float down_even_memory_[NUM_TAPS - 1];
+      mopo_float down_odd_memory_[DELAY + 1];
+  };
+
+  // Runs all contained processors at a multiple of the sample rate.
+  // The audio input is upsampled and available from oversampledAudio(), the
+  // output set with setOversampledOutput is filtered back down to the output
+  // of this router. Contained processors are run in chunks of at most
+  // MAX_BUFFER_SIZE so triggers they read are seen once per chunk.
+  // At 1x the contained processors are run and nothing is copied, so they
+  // should be plugged to the audio input and read from directly.
+  class Oversampler : public ProcessorRouter {
+    public:
+      static const int MAX_STAGES = 3;
+      static const int MAX_OVERSAMPLING = 1 << MAX_STAGES;
+
+      enum Inputs {
+        kAudio,
+        kNumInputs
+      };
+
+      Oversampler();
+
+      virtual Processor* clone() const override {
+        return new Oversampler(*this);
+      }
+
+      void destroy() override;
+      void process() override;
+      void setSampleRate(int sample_rate) override;
+      void setBufferSize(int buffer_size) override;
+      void addProcessor(Processor* processor) override;
+
+      // _amount_ is 1, 2, 4 or 8.
+      void setOversampling(int amount);
+      int getOversampling() const { return 1 << stages_; }
+
+      // Delay the filters add, in samples at the host sample rate. The
+      // oversampled output is delayed a little so this is always whole.
+      int getLatency() const;
+
+      Output* oversampledAudio() { return oversampled_audio_; }
+      void setOversampledOutput(const Output* output) { oversampled_output_ = output; }
+
+    private:
+      void updateInternalRates();
+
+      int stages_;
+      int chunk_size_;
+      int align_delay_;
+      mopo_float align_memory_[MAX_OVERSAMPLING];
+      Output* oversampled_audio_;
+      const Output* oversampled_output_;
+
+      HalfBandFilter up_filters_[MAX_STAGES];
+      HalfBandFilter down_filters_[MAX_STAGES];
+  };
+} // namespace mopo
+
+#endif // OVERSAMPLER_H
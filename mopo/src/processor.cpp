@@ -26,7 +26,7 @@ namespace mopo {
   Processor::Processor(int num_inputs, int num_outputs, bool control_rate) :
       sample_rate_(DEFAULT_SAMPLE_RATE), buffer_size_(DEFAULT_BUFFER_SIZE),
       samples_to_process_(DEFAULT_BUFFER_SIZE),
-      control_rate_(control_rate), enabled_(new bool(true)),
+      control_rate_(control_rate), trigger_driven_(false), enabled_(new bool(true)),
       inputs_(new std::vector<Input*>()), outputs_(new std::vector<Output*>()),
       router_(0) {
         
@@ -38,6 +38,18 @@ namespace mopo {
       addOutput();
   }
 
+  void Processor::setControlRate(bool control_rate) {
+    control_rate_ = control_rate;
+    if (control_rate)
+      buffer_size_ = 1;
+
+    int size = control_rate ? 1 : MAX_BUFFER_SIZE;
+    for (Output* output : owned_outputs_) {
+      if (output->buffer_size != size)
+        output->resizeBuffer(size);
+    }
+  }
+
   void Processor::destroy() {
     for (Input* input : owned_inputs_)
       delete input;
@@ -54,6 +54,14 @@ namespace mopo {
       trigger_value = 0.0;
     }
 
+    // Only safe before anything reads _buffer_, e.g. while building a graph.
+    void resizeBuffer(int size) {
+      delete[] buffer;
+      buffer = new mopo_float[size];
+      buffer_size = size;
+      clearBuffer();
+    }
+
     void clearBuffer() {
       VECTORIZE_LOOP
       for (int i = 0; i < buffer_size; ++i)
@@ -118,11 +126,8 @@ namespace mopo {
         samples_to_process_ = buffer_size;
       }
 
-      virtual void setControlRate(bool control_rate = true) {
-        control_rate_ = control_rate;
-        if (control_rate)
-          buffer_size_ = 1;
-      }
+      // Control rate processors only keep one sample per output.
+      virtual void setControlRate(bool control_rate = true);
 
       inline bool enabled() const {
         return *enabled_;
@@ -148,6 +153,28 @@ namespace mopo {
         return control_rate_;
       }
 
+      // Trigger driven processors only pass triggers along. Routers skip
+      // them in blocks where none of their inputs or outputs carry a trigger.
+      void setTriggerDriven(bool trigger_driven = true) {
+        trigger_driven_ = trigger_driven;
+      }
+
+      inline bool isTriggerDriven() const {
+        return trigger_driven_;
+      }
+
+      inline bool hasTriggers() const {
+        for (const Input* input : *inputs_) {
+          if (input->source->triggered)
+            return true;
+        }
+        for (const Output* output : *outputs_) {
+          if (output->triggered)
+            return true;
+        }
+        return false;
+      }
+
       bool inputMatchesBufferSize(int input = 0);
 
       virtual bool isPolyphonic() const;
@@ -219,6 +246,7 @@ namespace mopo {
       int buffer_size_;
       int samples_to_process_;
       bool control_rate_;
+      bool trigger_driven_;
       bool* enabled_;
 
       std::vector<Input*> owned_inputs_;
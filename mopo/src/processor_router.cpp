@@ -27,14 +27,14 @@ namespace mopo {
       Processor(num_inputs, num_outputs),
       global_order_(new std::vector<const Processor*>()),
       global_feedback_order_(new std::vector<const Feedback*>()),
-      global_changes_(new int(0)), local_changes_(0) {
+      global_changes_(new int(0)), local_changes_(0), defer_ordering_(false) {
   }
 
   ProcessorRouter::ProcessorRouter(const ProcessorRouter& original) :
       Processor(original), global_order_(original.global_order_),
       global_feedback_order_(original.global_feedback_order_),
       global_changes_(original.global_changes_),
-      local_changes_(original.local_changes_) {
+      local_changes_(original.local_changes_), defer_ordering_(false) {
     local_order_.assign(global_order_->size(), 0);
     local_feedback_order_.assign(global_feedback_order_->size(), 0);
 
@@ -75,11 +75,13 @@ namespace mopo {
     for (int i = 0; i < num_feedbacks; ++i)
       local_feedback_order_[i]->refreshOutput();
 
-    // Run all the main processors.
+    // Run all the main processors. Trigger driven ones only run when there's
+    // a trigger to pass along or clear.
     int num_processors = local_order_.size();
     for (int i = 0; i < num_processors; ++i) {
-      if (local_order_[i]->enabled())
-        local_order_[i]->process();
+      Processor* processor = local_order_[i];
+      if (processor->enabled() && (!processor->isTriggerDriven() || processor->hasTriggers()))
+        processor->process();
     }
 
     // Store the outputs into the Feedback objects for next time.
@@ -203,6 +205,9 @@ namespace mopo {
   }
 
   void ProcessorRouter::reorder(Processor* processor) {
+    if (orderingDeferred())
+      return;
+
     (*global_changes_)++;
     local_changes_++;
 
@@ -284,6 +289,76 @@ namespace mopo {
     return this;
   }
 
+  void ProcessorRouter::getRouters(std::vector<ProcessorRouter*>& routers) {
+    routers.push_back(this);
+
+    for (const Processor* processor : *global_order_) {
+      ProcessorRouter* router = dynamic_cast<ProcessorRouter*>(processors_[processor]);
+      if (router)
+        router->getRouters(routers);
+    }
+  }
+
+  std::vector<int> ProcessorRouter::sortGraph() {
+    std::vector<ProcessorRouter*> routers;
+    getRouters(routers);
+
+    std::vector<std::vector<const Processor*>> unsorted;
+    for (ProcessorRouter* router : routers)
+      unsorted.push_back(*router->global_order_);
+
+    // Reordering every processor once in every router gives the same
+    // constraints as reordering on every connection while building.
+    defer_ordering_ = false;
+    for (size_t r = 0; r < routers.size(); ++r) {
+      for (const Processor* processor : unsorted[r])
+        routers[r]->reorder(routers[r]->processors_[processor]);
+    }
+
+    std::vector<int> order;
+    for (size_t r = 0; r < routers.size(); ++r) {
+      std::map<const Processor*, int> indices;
+      for (size_t i = 0; i < unsorted[r].size(); ++i)
+        indices[unsorted[r][i]] = i;
+
+      order.push_back(unsorted[r].size());
+      for (const Processor* processor : *routers[r]->global_order_)
+        order.push_back(indices[processor]);
+    }
+    return order;
+  }
+
+  bool ProcessorRouter::orderGraph(const std::vector<int>& order) {
+    std::vector<ProcessorRouter*> routers;
+    getRouters(routers);
+
+    size_t position = 0;
+    for (ProcessorRouter* router : routers) {
+      if (position >= order.size() ||
+          order[position] != static_cast<int>(router->global_order_->size())) {
+        return false;
+      }
+      position += order[position] + 1;
+    }
+    if (position != order.size())
+      return false;
+
+    position = 0;
+    for (ProcessorRouter* router : routers) {
+      int num_processors = order[position++];
+      std::vector<const Processor*> new_order(num_processors);
+      for (int i = 0; i < num_processors; ++i)
+        new_order[i] = router->global_order_->at(order[position++]);
+
+      (*router->global_order_) = new_order;
+      (*router->global_changes_)++;
+      router->local_changes_++;
+    }
+
+    defer_ordering_ = false;
+    return true;
+  }
+
   void ProcessorRouter::addFeedback(Feedback* feedback) {
     feedback->router(this);
     global_feedback_order_->push_back(feedback);
@@ -333,6 +408,14 @@ namespace mopo {
     local_changes_ = *global_changes_;
   }
 
+  bool ProcessorRouter::orderingDeferred() const {
+    for (const ProcessorRouter* router = this; router; router = router->router_) {
+      if (router->defer_ordering_)
+        return true;
+    }
+    return false;
+  }
+
   const Processor* ProcessorRouter::getContext(const Processor* processor)
       const {
     const Processor* context = processor;
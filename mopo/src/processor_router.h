@@ -59,6 +59,21 @@ namespace mopo {
       virtual ProcessorRouter* getMonoRouter();
       virtual ProcessorRouter* getPolyRouter();
 
+      // Adds _this_ and every router nested inside it to _routers_.
+      virtual void getRouters(std::vector<ProcessorRouter*>& routers);
+
+      // Skips ordering while building a large graph. The graph must be
+      // ordered once it's built with either _sortGraph_ or _orderGraph_.
+      void deferOrdering(bool defer) { defer_ordering_ = defer; }
+
+      // Orders every router in this graph and returns the new orders as
+      // indices into the orders the routers had before.
+      std::vector<int> sortGraph();
+
+      // Applies orders from _sortGraph_ on an identically built graph.
+      // Returns false and leaves the graph alone if the graph doesn't match.
+      bool orderGraph(const std::vector<int>& order);
+
     protected:
       // When we create a cycle into the ProcessorRouter graph, we must insert
       // a Feedback node and add it here.
@@ -72,6 +87,8 @@ namespace mopo {
       // Ensures we have all copies of all processors and feedback processors.
       virtual void updateAllProcessors();
 
+      bool orderingDeferred() const;
+
       // Returns the ancestor of _processor_ which is a child of _this_.
       // Returns null if _processor_ is not a descendant of _this_.
       const Processor* getContext(const Processor* processor) const;
@@ -89,6 +106,7 @@ namespace mopo {
 
       int* global_changes_;
       int local_changes_;
+      bool defer_ordering_;
   };
 } // namespace mopo
 
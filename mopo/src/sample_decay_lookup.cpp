@@ -14,9 +14,525 @@
  * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// Generated by tools/generate_lookups.cpp. Don't edit by hand.
+
 #include "sample_decay_lookup.h"
 
 namespace mopo {
 
-  const SampleDecayLookupSingleton SampleDecayLookup::lookup_;
+  const mopo_float SampleDecayLookup::lookup_[SAMPLE_DECAY_LOOKUP_RESOLUTION + 3] = {
+    1, 0.99729341651422343, 0.99459415862261236, 0.99190220649783456,
+    0.98921754036622223, 0.9865401405076264, 0.98386998725527286, 0.9812070609956165,
+    0.97855134216819839, 0.97590281126550149, 0.9732614488328073, 0.97062723546805352,
+    0.96800015182169075, 0.96538017859654091, 0.96276729654765547, 0.96016148648217381,
+    0.95756272925918251, 0.9549710057895745, 0.95238629703590894, 0.94980858401227164,
+    0.94723784778413522, 0.94467406946822019, 0.94211723023235616, 0.93956731129534365,
+    0.93702429392681619, 0.93448815944710251, 0.93195888922708925, 0.9294364646880845,
+    0.92692086730168122, 0.92441207858962071, 0.92191008012365772, 0.91941485352542407,
+    0.91692638046629449, 0.91444464266725156, 0.91196962189875153, 0.90950129998059048,
+    0.90703965878177062, 0.90458468022036753, 0.90213634626339656, 0.89969463892668122,
+    0.89725954027472055, 0.89483103242055761, 0.89240909752564768, 0.88999371779972802,
+    0.88758487550068632, 0.88518255293443115, 0.88278673245476125, 0.88039739646323656,
+    0.87801452740904851, 0.87563810778889128, 0.87326812014683319, 0.87090454707418863,
+    0.86854737120938996, 0.86619657523785998, 0.86385214189188497, 0.86151405395048763,
+    0.85918229423930081, 0.85685684563044118, 0.8545376910423832, 0.85222481343983425,
+    0.84991819583360895, 0.84761782128050467, 0.845323672883177, 0.8430357337900154,
+    0.84075398719501981, 0.83847841633767695, 0.83620900450283731, 0.83394573502059233,
+    0.8316885912661518, 0.82943755665972208, 0.82719261466638394, 0.82495374879597161,
+    0.82272094260295092, 0.82049417968629923, 0.81827344368938448, 0.81605871829984533,
+    0.813849987249471, 0.81164723431408203, 0.80945044331341132, 0.8072595981109848,
+    0.80507468261400295, 0.80289568077322304, 0.80072257658284096, 0.79855535408037337,
+    0.79639399734654104, 0.79423849050515127, 0.7920888177229819, 0.78994496320966456,
+    0.78780691121756896, 0.7856746460416868, 0.783548152019517, 0.78142741353095024,
+    0.77931241499815429, 0.77720314088545961, 0.77509957569924537, 0.77300170398782542,
+    0.77090951034133481, 0.76882297939161681, 0.76674209581210995, 0.76466684431773524,
+    0.76259720966478395, 0.760533176650806, 0.75847473011449773, 0.756421854935591,
+    0.7543745360347418, 0.75233275837341984, 0.75029650695379757, 0.74826576681864054,
+    0.74624052305119737, 0.7442207607750897, 0.74220646515420374, 0.74019762139258083,
+    0.73819421473430857, 0.73619623046341287, 0.73420365390374964, 0.73221647041889693,
+    0.73023466541204751, 0.7282582243259017, 0.72628713264256028, 0.72432137588341794,
+    0.7223609396090569, 0.72040580941914101, 0.71845597095230962, 0.71651140988607254,
+    0.71457211193670445, 0.71263806285914, 0.71070924844686967, 0.70878565453183473,
+    0.70686726698432356, 0.70495407171286772, 0.70304605466413872, 0.7011432018228444,
+    0.69924549921162626, 0.69735293289095646, 0.69546548895903593, 0.69358315355169187,
+    0.69170591284227601, 0.68983375304156314, 0.68796666039764953, 0.68610462119585247,
+    0.68424762175860876, 0.68239564844537504, 0.68054868765252696, 0.67870672581325975,
+    0.67686974939748801, 0.67503774491174706, 0.67321069889909313, 0.67138859793900474,
+    0.66957142864728436, 0.66775917767595983, 0.66595183171318628, 0.66414937748314873,
+    0.66235180174596409, 0.66055909129758406, 0.65877123296969842, 0.656988213629638,
+    0.65521002018027819, 0.65343663955994291, 0.6516680587423086, 0.64990426473630869,
+    0.64814524458603762, 0.64639098537065642, 0.6446414742042974, 0.6428966982359694,
+    0.64115664464946365, 0.63942130066325942, 0.63769065353043053, 0.63596469053855098,
+    0.63424339900960236, 0.63252676629988014, 0.63081477979990119, 0.6291074269343111,
+    0.62740469516179131, 0.62570657197496771, 0.62401304490031839, 0.62232410149808204,
+    0.62063972936216649, 0.61895991612005807, 0.61728464943272987, 0.61561391699455181,
+    0.61394770653320019, 0.61228600580956705, 0.61062880261767072, 0.60897608478456622,
+    0.60732784017025554, 0.60568405666759828, 0.60404472220222361, 0.60240982473244065,
+    0.60077935224915024, 0.59915329277575713, 0.59753163436808165, 0.59591436511427187,
+    0.5943014731347166, 0.59269294658195748, 0.59108877364060253, 0.58948894252723893,
+    0.58789344149034684, 0.5863022588102127, 0.5847153827988435, 0.58313280179988058,
+    0.5815545041885144, 0.57998047837139888, 0.57841071278656597, 0.5768451959033416,
+    0.57528391622226016, 0.57372686227498004, 0.57217402262420025, 0.57062538586357525,
+    0.56908094061763193, 0.56754067554168608, 0.56600457932175852, 0.56447264067449232,
+    0.56294484834707004, 0.56142119111713085, 0.55990165779268819, 0.55838623721204761,
+    0.55687491824372459, 0.55536768978636297, 0.55386454076865332, 0.55236546014925159,
+    0.55087043691669824, 0.54937946008933702, 0.54789251871523437, 0.54640960187209919,
+    0.54493069866720245, 0.54345579823729706, 0.54198488974853853, 0.54051796239640471,
+    0.53905500540561702, 0.53759600803006091, 0.53614095955270735, 0.53468984928553365,
+    0.53324266656944508, 0.53179940077419674, 0.53036004129831538, 0.52892457756902167,
+    0.52749299904215197, 0.52606529520208167, 0.52464145556164754, 0.52322146966207062,
+    0.52180532707287952, 0.52039301739183386, 0.5189845302448477, 0.51757985528591344,
+    0.51617898219702596, 0.51478190068810659, 0.51338860049692747, 0.51199907138903655,
+    0.51061330315768205, 0.50923128562373765, 0.50785300863562766, 0.50647846206925251,
+    0.5051076358279144, 0.50374051984224288, 0.50237710407012137, 0.50101737849661288,
+    0.49966133313388694, 0.49830895802114566, 0.49696024322455107, 0.495615178837152,
+    0.49427375497881121, 0.49293596179613275, 0.49160178946238997, 0.49027122817745283,
+    0.48894426816771636, 0.48762089968602851, 0.48630111301161882, 0.48498489845002679,
+    0.48367224633303091, 0.48236314701857752, 0.48105759089070982, 0.47975556835949756,
+    0.47845706986096637, 0.47716208585702763, 0.47587060683540833, 0.47458262330958112,
+    0.4732981258186949, 0.47201710492750504, 0.47073955122630418, 0.46946545533085321,
+    0.46819480788231216, 0.46692759954717156, 0.4656638210171839, 0.46440346300929514,
+    0.46314651626557674, 0.46189297155315739, 0.46064281966415538, 0.4593960514156108,
+    0.45815265764941826, 0.45691262923225973, 0.45567595705553693, 0.45444263203530499,
+    0.45321264511220538, 0.4519859872513996, 0.45076264944250255, 0.44954262269951656,
+    0.44832589806076539, 0.44711246658882814, 0.44590231937047403, 0.44469544751659645,
+    0.44349184216214799, 0.4422914944660753, 0.44109439561125396, 0.43990053680442398,
+    0.43870990927612485, 0.43752250428063155, 0.43633831309589, 0.43515732702345306,
+    0.43397953738841671, 0.43280493553935628, 0.4316335128482629, 0.43046526071048002,
+    0.42930017054464054, 0.42813823379260335, 0.42697944191939075, 0.42582378641312563,
+    0.42467125878496903, 0.42352185056905772, 0.42237555332244198, 0.42123235862502367,
+    0.42009225807949452, 0.41895524331127393, 0.41782130596844819, 0.41669043772170838,
+    0.4155626302642898, 0.41443787531191056, 0.41331616460271103, 0.41219748989719285,
+    0.41108184297815853, 0.40996921565065125, 0.40885959974189445, 0.40775298710123181,
+    0.40664936960006753, 0.40554873913180656, 0.40445108761179493, 0.40335640697726044,
+    0.40226468918725361, 0.40117592622258835, 0.40009011008578321, 0.39900723280100248,
+    0.39792728641399788, 0.3968502629920499, 0.39577615462390953, 0.39470495341974032,
+    0.3936366515110602, 0.39257124105068403, 0.39150871421266542, 0.39044906319223982,
+    0.38939228020576677, 0.38833835749067297, 0.38728728730539508, 0.38623906192932311,
+    0.38519367366274332, 0.3841511148267821, 0.3831113777633493, 0.3820744548350819,
+    0.38104033842528817, 0.38000902093789163, 0.378980494797375, 0.37795475244872501,
+    0.37693178635737651, 0.37591158900915733, 0.37489415291023315, 0.37387947058705212,
+    0.37286753458629029, 0.37185833747479685, 0.37085187183953922, 0.36984813028754904,
+    0.36884710544586741, 0.36784878996149112, 0.36685317650131843, 0.3658602577520953,
+    0.36487002642036154, 0.36388247523239731, 0.36289759693416984, 0.36191538429127978,
+    0.36093583008890856, 0.35995892713176486, 0.35898466824403219, 0.3580130462693159,
+    0.35704405407059081, 0.35607768453014865, 0.35511393054954576, 0.35415278504955117,
+    0.35319424097009428, 0.35223829127021322, 0.35128492892800312, 0.35033414694056442,
+    0.34938593832395143, 0.34844029611312127, 0.34749721336188244, 0.34655668314284377,
+    0.34561869854736382, 0.34468325268549999, 0.34375033868595767, 0.34281994969604013,
+    0.34189207888159806, 0.34096671942697931, 0.34004386453497887, 0.33912350742678882,
+    0.33820564134194886, 0.33729025953829628, 0.33637735529191665, 0.33546692189709432,
+    0.33455895266626334, 0.33365344092995813, 0.3327503800367646, 0.33184976335327121,
+    0.33095158426402038, 0.33005583617145984, 0.32916251249589396, 0.32827160667543587,
+    0.32738311216595878, 0.32649702244104828, 0.32561333099195411, 0.32473203132754258,
+    0.32385311697424873, 0.32297658147602898, 0.32210241839431336, 0.32123062130795865,
+    0.32036118381320078, 0.31949409952360813, 0.31862936207003451, 0.31776696510057223,
+    0.31690690228050566, 0.31604916729226462, 0.31519375383537795, 0.31434065562642721,
+    0.31348986639900056, 0.31264137990364671, 0.31179518990782912, 0.31095129019588003,
+    0.31010967456895494, 0.30927033684498706, 0.30843327085864186, 0.30759847046127181,
+    0.30676592952087117, 0.3059356419220311, 0.3051076015658945, 0.30428180237011132,
+    0.30345823826879409, 0.30263690321247289, 0.30181779116805146, 0.30100089611876246,
+    0.30018621206412344, 0.2993737330198929, 0.29856345301802595, 0.29775536610663095,
+    0.29694946634992536, 0.29614574782819253, 0.29534420463773775, 0.29454483089084549,
+    0.29374762071573546, 0.29295256825652011, 0.29215966767316115, 0.29136891314142699,
+    0.29058029885284975, 0.2897938190146826, 0.28900946784985737, 0.28822723959694185,
+    0.28744712851009779, 0.2866691288590385, 0.28589323492898666, 0.28511944102063264,
+    0.28434774145009234, 0.28357813054886566, 0.28281060266379471, 0.28204515215702236,
+    0.28128177340595084, 0.28052046080320031, 0.27976120875656796, 0.27900401168898653,
+    0.2782488640384837, 0.2774957602581411, 0.2767446948160534, 0.27599566219528798,
+    0.27524865689384426, 0.27450367342461318, 0.27376070631533711, 0.27301975010856949,
+    0.2722807993616348, 0.27154384864658854, 0.27080889255017748, 0.27007592567379973,
+    0.2693449426334652, 0.26861593805975603, 0.26788890659778708, 0.26716384290716677,
+    0.26644074166195764, 0.26571959755063734, 0.26500040527605961, 0.26428315955541531,
+    0.26356785512019376, 0.26285448671614392, 0.26214304910323571, 0.26143353705562178,
+    0.26072594536159888, 0.26002026882356971, 0.25931650225800462, 0.25861464049540378,
+    0.25791467838025889, 0.25721661077101549, 0.25652043254003526, 0.25582613857355813,
+    0.25513372377166493, 0.25444318304823987, 0.25375451133093307, 0.25306770356112351,
+    0.25238275469388155, 0.25169965969793229, 0.25101841355561832, 0.25033901126286284,
+    0.24966144782913313, 0.24898571827740373, 0.24831181764411989, 0.24763974097916117,
+    0.24696948334580499, 0.24630103982069046, 0.24563440549378218, 0.24496957546833417,
+    0.24430654486085387, 0.24364530880106636, 0.24298586243187847, 0.24232820090934315,
+    0.24167231940262399, 0.24101821309395954, 0.24036587717862803, 0.23971530686491216,
+    0.23906649737406374, 0.23841944394026865, 0.23777414181061188, 0.2371305862450426,
+    0.23648877251633924, 0.23584869591007496, 0.23521035172458279, 0.23457373527092135,
+    0.23393884187284017, 0.23330566686674542, 0.23267420560166582, 0.23204445343921817,
+    0.23141640575357353, 0.23079005793142313, 0.23016540537194452, 0.22954244348676775,
+    0.22892116769994167, 0.22830157344790034, 0.22768365617942943, 0.22706741135563296,
+    0.22645283444989978, 0.22583992094787037, 0.22522866634740379, 0.22461906615854443,
+    0.22401111590348916, 0.22340481111655439, 0.2228001473441433, 0.22219712014471305,
+    0.22159572508874226, 0.2209959577586984, 0.22039781374900533, 0.21980128866601101,
+    0.21920637812795518, 0.21861307776493716, 0.21802138321888379, 0.21743129014351739,
+    0.21684279420432387, 0.21625589107852081, 0.21567057645502577, 0.21508684603442468,
+    0.21450469552894016, 0.21392412066239999, 0.21334511717020588, 0.21276768079930192,
+    0.21219180730814355, 0.21161749246666625, 0.21104473205625451, 0.21047352186971094,
+    0.20990385771122508, 0.20933573539634306, 0.20876915075193644, 0.20820409961617165,
+    0.20764057783847956, 0.2070785812795248, 0.20651810581117561, 0.20595914731647322,
+    0.20540170168960184, 0.20484576483585837, 0.20429133267162236, 0.20373840112432606,
+    0.20318696613242443, 0.20263702364536537, 0.20208856962355992, 0.20154160003835259,
+    0.20099611087199179, 0.20045209811760034, 0.19990955777914599, 0.19936848587141207,
+    0.19882887841996821, 0.19829073146114126, 0.19775404104198596, 0.19721880322025614,
+    0.19668501406437558, 0.19615266965340922, 0.19562176607703433, 0.19509229943551176,
+    0.19456426583965744, 0.19403766141081358, 0.19351248228082035, 0.19298872459198746,
+    0.19246638449706571, 0.19194545815921885, 0.19142594175199529, 0.1909078314593001,
+    0.19039112347536694, 0.18987581400473008, 0.18936189926219649, 0.18884937547281813,
+    0.18833823887186418, 0.18782848570479335, 0.18732011222722636, 0.18681311470491832,
+    0.18630748941373151, 0.18580323263960782, 0.18530034067854156, 0.18479880983655225,
+    0.18429863642965746, 0.18379981678384583, 0.1833023472350499, 0.18280622412911943,
+    0.1823114438217944, 0.18181800267867823, 0.18132589707521124, 0.18083512339664387,
+    0.18034567803801013, 0.17985755740410128, 0.17937075790943924, 0.17888527597825032,
+    0.17840110804443901, 0.17791825055156169, 0.17743669995280056, 0.17695645271093763,
+    0.17647750529832862, 0.17599985419687711, 0.17552349589800875, 0.17504842690264544,
+    0.17457464372117956, 0.1741021428734485, 0.17363092088870891, 0.17316097430561136,
+    0.17269229967217481, 0.17222489354576132, 0.17175875249305075, 0.17129387309001548,
+    0.17083025192189533, 0.17036788558317248, 0.16990677067754639, 0.16944690381790892,
+    0.1689882816263194, 0.16853090073397983, 0.1680747577812102, 0.16761984941742369,
+    0.16716617230110212, 0.16671372309977148, 0.16626249848997732, 0.1658124951572604,
+    0.16536370979613235, 0.1649161391100514, 0.1644697798113981, 0.16402462862145126,
+    0.16358068227036379, 0.16313793749713879, 0.16269639104960537, 0.16225603968439506,
+    0.16181688016691778, 0.16137890927133811, 0.16094212378055167, 0.16050652048616143,
+    0.16007209618845411, 0.15963884769637682, 0.15920677182751339, 0.15877586540806127,
+    0.15834612527280792, 0.15791754826510782, 0.15749013123685915, 0.15706387104848069,
+    0.15663876456888873, 0.15621480867547413, 0.15579200025407935, 0.15537033619897556,
+    0.15494981341283987, 0.15453042880673251, 0.15411217930007423, 0.15369506182062362,
+    0.15327907330445453, 0.15286421069593356, 0.15245047094769767, 0.15203785102063178,
+    0.15162634788384638, 0.15121595851465533, 0.1508066798985537, 0.15039850902919549,
+    0.14999144290837163, 0.14958547854598805, 0.14918061296004348, 0.1487768431766078,
+    0.14837416622979999, 0.14797257916176654, 0.14757207902265954, 0.14717266287061509,
+    0.14677432777173174, 0.1463770708000488, 0.14598088903752504, 0.14558577957401711,
+    0.14519173950725817, 0.14479876594283664, 0.14440685599417494, 0.1440160067825082,
+    0.14362621543686316, 0.14323747909403717, 0.14284979489857699, 0.14246316000275794,
+    0.14207757156656292, 0.14169302675766163, 0.14130952275138964, 0.14092705673072775,
+    0.14054562588628128, 0.14016522741625934, 0.13978585852645437, 0.13940751643022156,
+    0.13903019834845839, 0.13865390150958423, 0.13827862314951991, 0.13790436051166749,
+    0.13753111084689004, 0.13715887141349134, 0.13678763947719583, 0.1364174123111285,
+    0.13604818719579481, 0.13567996141906083, 0.13531273227613322, 0.13494649706953932,
+    0.13458125310910751, 0.13421699771194728, 0.13385372820242963, 0.1334914419121673,
+    0.13313013617999533, 0.13276980835195137, 0.13241045578125626, 0.13205207582829456,
+    0.13169466586059519, 0.13133822325281203, 0.13098274538670474, 0.13062822965111942,
+    0.13027467344196947, 0.12992207416221649, 0.12957042922185119, 0.12921973603787434,
+    0.12886999203427785, 0.12852119464202572, 0.12817334129903532, 0.12782642945015854,
+    0.12748045654716297, 0.12713542004871317, 0.12679131742035205, 0.12644814613448227,
+    0.12610590367034763, 0.12576458751401454, 0.1254241951583536, 0.12508472410302118,
+    0.12474617185444102, 0.12440853592578595, 0.12407181383695957, 0.12373600311457812,
+    0.1234011012919522, 0.12306710590906876, 0.12273401451257296, 0.12240182465575017,
+    0.122070533898508, 0.12174013980735837, 0.12141063995539965, 0.1210820319222988,
+    0.12075431329427364, 0.12042748166407506, 0.12010153463096941, 0.11977646980072082,
+    0.11945228478557357, 0.11912897720423465, 0.11880654468185622, 0.11848498485001813,
+    0.11816429534671059, 0.11784447381631676, 0.11752551790959549, 0.11720742528366404,
+    0.11689019360198089, 0.11657382053432853, 0.11625830375679644, 0.1159436409517639,
+    0.11562982980788306, 0.11531686802006189, 0.1150047532894473, 0.11469348332340829,
+    0.11438305583551896, 0.11407346854554187, 0.11376471917941126, 0.11345680546921626,
+    0.11314972515318432, 0.11284347597566455, 0.1125380556871112, 0.11223346204406705,
+    0.11192969280914705, 0.11162674575102177, 0.11132461864440107, 0.11102330927001777,
+    0.11072281541461128, 0.1104231348709114, 0.11012426543762212, 0.10982620491940537,
+    0.10952895112686499, 0.10923250187653059, 0.10893685499084152, 0.10864200829813088,
+    0.10834795963260956, 0.10805470683435034, 0.10776224774927207, 0.10747058022912372,
+    0.10717970213146875, 0.10688961131966927, 0.10660030566287038, 0.10631178303598451,
+    0.10602404131967585, 0.10573707840034473, 0.1054508921701121, 0.10516548052680406,
+    0.10488084137393643, 0.10459697262069938, 0.10431387218194198, 0.10403153797815692,
+    0.10374996793546531, 0.10346915998560133, 0.10318911206589713, 0.10290982211926762,
+    0.10263128809419542, 0.10235350794471569, 0.10207647963040122, 0.10180020111634737,
+    0.10152467037315713, 0.10124988537692624, 0.10097584410922827, 0.10070254455709989,
+    0.10042998471302596, 0.10015816257492489, 0.099887076146133874, 0.099616723435394253,
+    0.099347102456836839, 0.099078211229967406, 0.098810047779652105, 0.098542610136102896,
+    0.098275896334863208, 0.098009904416793373, 0.097744632428056338, 0.097480078420103269,
+    0.097216240449659208, 0.096953116578708878, 0.096690704874482378, 0.096429003409441008,
+    0.09616801026126312, 0.095907723512830001, 0.095648141252211744, 0.095389261572653289,
+    0.095131082572560324, 0.094873602355485379, 0.094616819030113902, 0.094360730710250279,
+    0.0941053355148041, 0.093850631567776274, 0.09359661699824523, 0.093343289940353222,
+    0.093090648533292616, 0.092838690921292169, 0.092587415253603492, 0.092336819684487356,
+    0.092086902373200191, 0.091837661483980565, 0.091589095186035682, 0.091341201653527951,
+    0.09109397906556152, 0.090847425606168999, 0.090601539464298025, 0.090356318833798022,
+    0.090111761913406904, 0.089867866906737842, 0.089624632022266101, 0.089382055473315833,
+    0.089140135478047, 0.088898870259442223, 0.088658258045293828, 0.088418297068190724,
+    0.088178985565505463, 0.087940321779381339, 0.087702303956719393, 0.087464930349165582,
+    0.087228199213097934, 0.086992108809613736, 0.086756657404516754, 0.086521843268304519,
+    0.086287664676155576, 0.086054119907916865, 0.085821207248091058, 0.085588924985823975,
+    0.085357271414891966, 0.085126244833689468, 0.08489584354521644, 0.084666065857065889,
+    0.084436910081411479, 0.084208374534995134, 0.083980457539114622, 0.083753157419611299,
+    0.083526472506857727, 0.083300401135745508, 0.083074941645672931, 0.082850092380532897,
+    0.082625851688700694, 0.082402217923021825, 0.082179189440800007, 0.081956764603785037,
+    0.081734941778160763, 0.08151371933453308, 0.081293095647918007, 0.081073069097729697,
+    0.08085363806776856, 0.080634800946209381, 0.080416556125589497, 0.080198902002796946,
+    0.079981836979058765, 0.079765359459929172, 0.079549467855277903, 0.079334160579278487,
+    0.079119436050396674, 0.078905292691378706, 0.078691728929239854, 0.078478743195252776,
+    0.078266333924935996, 0.078054499558042501, 0.077843238538548146, 0.077632549314640337,
+    0.077422430338706605, 0.077212880067323172, 0.077003896961243712, 0.076795479485387966,
+    0.07658762610883052, 0.076380335304789534, 0.076173605550615517, 0.075967435327780164,
+    0.075761823121865191, 0.075556767422551227, 0.07535226672360669, 0.075148319522876747,
+    0.074944924322272261, 0.074742079627758834, 0.074539783949345739, 0.074338035801075092,
+    0.074136833701010804, 0.073936176171227885, 0.073736061737801381, 0.073536488930795646,
+    0.07333745628425356, 0.073138962336185748, 0.072941005628559791, 0.072743584707289588,
+    0.072546698122224654, 0.072350344427139418, 0.07215452217972268, 0.071959229941566949,
+    0.071764466278157898, 0.071570229758863874, 0.071376518956925289, 0.071183332449444262,
+    0.07099066881737405, 0.070798526645508716, 0.070606904522472674, 0.070415801040710338,
+    0.070225214796475824, 0.070035144389822571, 0.069845588424593111, 0.06965654550840876,
+    0.069468014252659457, 0.069279993272493512, 0.06909248118680747, 0.068905476618235928,
+    0.068718978193141447, 0.068532984541604461, 0.068347494297413172, 0.068162506098053577,
+    0.067978018584699443, 0.06779403040220229, 0.067610540199081456, 0.067427546627514184,
+    0.067245048343325731, 0.067063044005979427, 0.066881532278566941, 0.066700511827798348,
+    0.06651998132399238, 0.066339939441066698, 0.066160384856528087, 0.065981316251462793,
+    0.065802732310526774, 0.065624631721936125, 0.065447013177457367, 0.065269875372397868,
+    0.065093217005596241, 0.064917036779412823, 0.064741333399720116, 0.064566105575893276,
+    0.064391352020800652, 0.064217071450794333, 0.064043262585700672, 0.063869924148810972,
+    0.063697054866871994, 0.063524653470076714, 0.06335271869205493, 0.063181249269863959,
+    0.063010243943979416, 0.062839701458285893, 0.062669620560067765, 0.0625,
+    0.062330838532138964, 0.062162134913913272, 0.06199388790611466, 0.061826096272888889,
+    0.061658758781726657, 0.061491874203454554, 0.061325441312226031, 0.061159458885512399,
+    0.060993925704093843, 0.060828840552050463, 0.060664202216753345, 0.060500009488855672,
+    0.060336261162283807, 0.060172956034228467, 0.06001009290513587, 0.059847670578698907,
+    0.059685687861848406, 0.059524143564744315, 0.059363036500766984, 0.059202365486508458,
+    0.059042129341763762, 0.05888232688952226, 0.058722956955958985, 0.058564018370426019,
+    0.058405509965443907, 0.058247430576693078, 0.058089779043005288, 0.057932554206355076,
+    0.057775754911851301, 0.057619380007728614, 0.057463428345339011, 0.057307898779143412,
+    0.057152790166703223, 0.05699810136867197, 0.056843831248786905, 0.056689978673860671,
+    0.056536542513772971, 0.056383521641462292, 0.056230914932917583, 0.056078721267170041,
+    0.055926939526284851, 0.055775568595352987, 0.055624607362483008, 0.055474054718792902,
+    0.055323909558401954, 0.055174170778422585, 0.055024837278952292, 0.054875907963065539,
+    0.054727381736805712, 0.054579257509177082, 0.054431534192136796, 0.05428421070058688,
+    0.054137285952366256, 0.053990758868242818, 0.053844628371905484, 0.053698893389956308,
+    0.053553552851902581, 0.053408605690148957, 0.053264050839989648, 0.053119887239600566,
+    0.052976113830031556, 0.05283272955519857, 0.052689733361875969, 0.052547124199688745,
+    0.052404901021104816, 0.052263062781427339, 0.052121608438787027, 0.051980536954134494,
+    0.051839847291232637, 0.051699538416649003, 0.051559609299748232, 0.05142005891268444,
+    0.051280886230393716, 0.051142090230586544, 0.05100366989374034, 0.050865624203091944,
+    0.050727952144630141, 0.050590652707088221, 0.050453724881936557, 0.050317167663375198,
+    0.050180980048326454, 0.050045161036427567, 0.049909709630023343, 0.049774624834158822,
+    0.049639905656571962, 0.049505551107686382, 0.049371560200604049, 0.049237931951098067,
+    0.049104665377605439, 0.048971759501219826, 0.048839213345684404, 0.048707025937384657,
+    0.048575196305341239, 0.048443723481202849, 0.048312606499239096, 0.04818184439633344,
+    0.048051436211976065, 0.047921380988256886, 0.047791677769858459, 0.047662325604049011,
+    0.047533323540675382, 0.047404670632156115, 0.047276365933474444, 0.047148408502171377,
+    0.047020797398338747, 0.046893531684612362, 0.046766610426165048, 0.046640032690699842,
+    0.04651379754844312, 0.046387904072137748, 0.046262351337036316, 0.0461371384208943,
+    0.046012264403963318, 0.045887728368984367, 0.045763529401181072, 0.045639666588252983,
+    0.04551613902036887, 0.045392945790160032, 0.045270085992713635, 0.04514755872556607,
+    0.045025363088696327, 0.044903498184519365, 0.044781963117879547, 0.044660756996044042,
+    0.044539878928696264, 0.044419328027929368, 0.044299103408239685, 0.044179204186520209,
+    0.044059629482054219, 0.043940378416508656, 0.043821450113927761, 0.043702843700726628,
+    0.043584558305684765, 0.043466593059939732, 0.043348947096980728, 0.043231619552642236,
+    0.043114609565097682, 0.042997916274853089, 0.042881538824740766, 0.042765476359913034,
+    0.042649728027835926, 0.042534292978282921, 0.04241917036332872, 0.042304359337342994,
+    0.042189859056984184, 0.042075668681193307, 0.041961787371187782, 0.041848214290455259,
+    0.041734948604747475, 0.041621989482074136, 0.041509336092696789, 0.041396987609122742,
+    0.041284943206098997, 0.041173202060606144, 0.041061763351852368, 0.04095062626126738,
+    0.040839789972496425, 0.04072925367139428, 0.040619016546019279, 0.040509077786627337,
+    0.04039943658566602, 0.040290092137768574, 0.040181043639748074, 0.040072290290591464,
+    0.039963831291453707, 0.039855665845651894, 0.039747793158659429, 0.039640212438100134,
+    0.039532922893742502, 0.039425923737493818, 0.03931921418339443, 0.039212793447611943,
+    0.039106660748435468, 0.039000815306269893, 0.03889525634363012, 0.038789983085135399,
+    0.038684994757503623, 0.03858029058954561, 0.038475869812159488, 0.038371731658325005,
+    0.038267875363097933, 0.03816430016360442, 0.038061005299035389, 0.037957990010640964,
+    0.037855253541724893, 0.037752795137638975, 0.037650614045777533, 0.037548709515571883,
+    0.037447080798484814, 0.037345727148005096, 0.037244647819641992, 0.03714384207091978,
+    0.037043309161372336, 0.036943048352537651, 0.036843058907952426, 0.03674334009314667,
+    0.036643891175638287, 0.036544711424927712, 0.036445800112492537, 0.03634715651178215,
+    0.036248779898212423, 0.036150669549160373, 0.03605282474395885, 0.035955244763891253,
+    0.035857928892186253, 0.035760876414012509, 0.035664086616473446, 0.035567558788601995,
+    0.035471292221355373, 0.0353752862076099, 0.035279540042155763, 0.03518405302169187,
+    0.035088824444820678, 0.034993853612043012, 0.034899139825752976, 0.03480468239023278,
+    0.034710480611647679, 0.034616533798040826, 0.034522841259328224, 0.03442940230729364,
+    0.034336216255583564, 0.034243282419702148, 0.0341506001170062, 0.034058168666700146,
+    0.033965987389831066, 0.033874055609283651, 0.033782372649775294, 0.033690937837851057,
+    0.033599750501878807, 0.03350880997204421, 0.033418115580345846, 0.03332766666059031,
+    0.033237462548387289, 0.033147502581144711, 0.033057786098063847, 0.032968312440134498,
+    0.032879080950130105, 0.032790090972602971, 0.032701341853879413, 0.03261283294205497,
+    0.032524563586989616, 0.032436533140302981, 0.03234874095536959, 0.032261186387314122,
+    0.032173868793006662, 0.032086787531057967, 0.031999941961814785, 0.031913331447355128,
+    0.031826955351483603, 0.031740813039726729, 0.031654903879328282, 0.03156922723924465,
+    0.03148378249014018, 0.031398569004382586, 0.031313586156038305, 0.031228833320867934,
+    0.031144309876321604, 0.031060015201534442, 0.030975948677322, 0.030892109686175701,
+    0.030808497612258297, 0.030725111841399373, 0.030641951761090802, 0.030559016760482272,
+    0.030476306230376782, 0.030393819563226177, 0.030311556153126674, 0.030229515395814432,
+    0.030147696688661095, 0.030066099430669364, 0.029984723022468598, 0.029903566866310398,
+    0.029822630366064227, 0.02974191292721302, 0.02966141395684882, 0.029581132863668431,
+    0.029501069057969065, 0.029421221951644011, 0.029341590958178326, 0.02926217549264451,
+    0.029182974971698222, 0.029103988813573994, 0.029025216438080946, 0.028946657266598546,
+    0.028868310722072337, 0.028790176229009711, 0.028712253213475675, 0.028634541103088648,
+    0.028557039327016236, 0.028479747315971062, 0.028402664502206566, 0.028325790319512843,
+    0.028249124203212479, 0.028172665590156413, 0.028096413918719792, 0.028020368628797841,
+    0.027944529161801766, 0.02786889496065463, 0.027793465469787282, 0.027718240135134253,
+    0.02764321840412971, 0.02756839972570338, 0.027493783550276502, 0.02741936932975781,
+    0.027345156517539479, 0.027271144568493132, 0.027197332938965823, 0.027123721086776048,
+    0.027050308471209771, 0.026977094553016435, 0.026904078794405008, 0.02683126065904004,
+    0.026758639612037716, 0.026686215119961929, 0.026613986650820359, 0.026541953674060568,
+    0.026470115660566111, 0.026398472082652627, 0.026327022414063986, 0.026255766129968411,
+    0.026184702706954627, 0.026113831623028015, 0.026043152357606777, 0.025972664391518116,
+    0.025902367206994414, 0.025832260287669443, 0.025762343118574556, 0.025692615186134912,
+    0.025623075978165707, 0.025553724983868407, 0.025484561693826992, 0.025415585600004228,
+    0.025346796195737913, 0.025278192975737187, 0.025209775436078781, 0.025141543074203358,
+    0.025073495388911776, 0.025005631880361454, 0.024937952050062658, 0.024870455400874871,
+    0.024803141437003122, 0.024736009663994349, 0.024669059588733774, 0.024602290719441269,
+    0.024535702565667755, 0.024469294638291592, 0.024403066449514992, 0.024337017512860427,
+    0.024271147343167064, 0.024205455456587196, 0.024139941370582698, 0.024074604603921464,
+    0.024009444676673892, 0.023944461110209338, 0.023879653427192626, 0.023815021151580521,
+    0.023750563808618234, 0.023686280924835944, 0.02362217202804532, 0.023558236647336039,
+    0.023494474313072344, 0.023430884556889579, 0.023367466911690764, 0.023304220911643154,
+    0.02324114609217481, 0.023178241989971208, 0.023115508142971822, 0.02305294409036672,
+    0.022990549372593202, 0.022928323531332409, 0.022866266109505963, 0.022804376651272603,
+    0.022742654702024839, 0.022681099808385622, 0.022619711518204993, 0.022558489380556792,
+    0.022497432945735311, 0.022436541765252019, 0.022375815391832251, 0.022315253379411933,
+    0.022254855283134298, 0.022194620659346617, 0.022134549065596955, 0.022074640060630885,
+    0.022014893204388319, 0.021955308058000188, 0.021895884183785269, 0.021836621145246957,
+    0.021777518507070073, 0.021718575835117646, 0.021659792696427729, 0.021601168659210235,
+    0.021542703292843742, 0.021484396167872347, 0.021426246856002501, 0.021368254930099872,
+    0.0213104199641862, 0.021252741533436172, 0.021195219214174298, 0.021137852583871797,
+    0.02108064122114351, 0.021023584705744783, 0.020966682618568391, 0.020909934541641455,
+    0.02085334005812238, 0.020796898752297781, 0.020740610209579444, 0.02068447401650127,
+    0.020628489760716233, 0.020572657030993365, 0.020516975417214735, 0.020461444510372417,
+    0.020406063902565511, 0.020350833186997125, 0.020295751957971404, 0.020240819810890542,
+    0.020186036342251808, 0.020131401149644582, 0.020076913831747412, 0.020022573988325045,
+    0.019968381220225505, 0.019914335129377153, 0.019860435318785761, 0.019806681392531601,
+    0.019753072955766535, 0.019699609614711119, 0.019646290976651697, 0.019593116649937532,
+    0.019540086243977916, 0.019487199369239316, 0.019434455637242498, 0.01938185466055968,
+    0.019329396052811688, 0.019277079428665113, 0.019224904403829485, 0.019172870595054445,
+    0.01912097762012694, 0.019069225097868403, 0.019017612648131954, 0.018966139891799627,
+    0.018914806450779552, 0.018863611948003213, 0.01881255600742265, 0.018761638254007715,
+    0.018710858313743303, 0.018660215813626618, 0.018609710381664431, 0.018559341646870335,
+    0.01850910923926203, 0.018459012789858609, 0.01840905193067784, 0.018359226294733463,
+    0.018309535516032503, 0.018259979229572568, 0.018210557071339187, 0.018161268678303106,
+    0.018112113688417662, 0.018063091740616082, 0.018014202474808862, 0.017965445531881112,
+    0.017916820553689903, 0.017868327183061663, 0.017819965063789536, 0.017771733840630768,
+    0.0177236331593041, 0.017675662666487166, 0.017627822009813894, 0.017580110837871924,
+    0.017532528800200019, 0.017485075547285494, 0.017437750730561658, 0.017390554002405231,
+    0.017343485016133815, 0.017296543426003334, 0.017249728887205495, 0.017203041055865263,
+    0.01715647958903832, 0.017110044144708569, 0.017063734381785593, 0.017017549960102175,
+    0.016971490540411784, 0.016925555784386093, 0.016879745354612483, 0.016834058914591575,
+    0.016788496128734752, 0.016743056662361692, 0.016697740181697923, 0.016652546353872352,
+    0.016607474846914834, 0.016562525329753726, 0.016517697472213457, 0.01647299094501211,
+    0.016428405419758995, 0.016383940568952232, 0.016339596065976361, 0.01629537158509993,
+    0.016251266801473107, 0.016207281391125289, 0.016163415030962736, 0.016119667398766181,
+    0.016076038173188468, 0.016032527033752204, 0.015989133660847383, 0.015945857735729058,
+    0.015902698940514992, 0.015859656958183317, 0.01581673147257022, 0.015773922168367597,
+    0.015731228731120768, 0.015688650847226145, 0.015646188203928928, 0.015603840489320821,
+    0.015561607392337733, 0.015519488602757493, 0.015477483811197573, 0.015435592709112812,
+    0.015393814988793154, 0.015352150343361386, 0.015310598466770886, 0.015269159053803367,
+    0.015227831800066647, 0.015186616401992405, 0.015145512556833947, 0.015104519962663999,
+    0.015063638318372471, 0.015022867323664252, 0.01498220667905701, 0.014941656085878984,
+    0.014901215246266791, 0.014860883863163242, 0.014820661640315163, 0.014780548282271202,
+    0.014740543494379685, 0.014700646982786425, 0.014660858454432584, 0.014621177617052511,
+    0.014581604179171589, 0.014542137850104114, 0.014502778339951136, 0.014463525359598346,
+    0.014424378620713945, 0.014385337835746533, 0.014346402717922984, 0.014307572981246354,
+    0.014268848340493771, 0.014230228511214339, 0.01419171320972706, 0.014153302153118736,
+    0.014114995059241898, 0.014076791646712737, 0.014038691634909027, 0.014000694743968072,
+    0.013962800694784649, 0.013925009209008956, 0.013887320009044565, 0.013849732818046391,
+    0.01381224735991865, 0.013774863359312833, 0.013737580541625688, 0.013700398632997199,
+    0.013663317360308572, 0.013626336451180237, 0.013589455633969837, 0.013552674637770242,
+    0.01351599319240755, 0.013479411028439111, 0.013442927877151543, 0.01340654347055876,
+    0.013370257541399999, 0.013334069823137867, 0.01329798004995637, 0.013261987956758972,
+    0.013226093279166641, 0.013190295753515907, 0.013154595116856934, 0.013118991106951571,
+    0.013083483462271447, 0.013048071921996031, 0.013012756226010733, 0.012977536114904976,
+    0.012942411329970305, 0.012907381613198481, 0.012872446707279581, 0.012837606355600118,
+    0.012802860302241151, 0.012768208291976401, 0.012733650070270382, 0.012699185383276532,
+    0.012664813977835339, 0.012630535601472499, 0.01259635000239704, 0.01256225692949949,
+    0.012528256132350025, 0.012494347361196628, 0.012460530366963258, 0.012426804901248017,
+    0.012393170716321332, 0.012359627565124126, 0.012326175201266013, 0.012292813379023477,
+    0.01225954185333808, 0.012226360379814649, 0.012193268714719489, 0.012160266614978594,
+    0.012127353838175852, 0.012094530142551277, 0.01206179528699922, 0.01202914903106661,
+    0.011996591134951181, 0.011964121359499709, 0.01193173946620626, 0.011899445217210437,
+    0.011867238375295634, 0.011835118703887284, 0.011803085967051137, 0.011771139929491515,
+    0.01173928035654959, 0.011707507014201651, 0.011675819669057399, 0.011644218088358223,
+    0.011612702039975492, 0.011581271292408851, 0.011549925614784519, 0.011518664776853595,
+    0.011487488548990368, 0.011456396702190622, 0.011425389008069968, 0.011394465238862153,
+    0.011363625167417393, 0.011332868567200706, 0.011302195212290245, 0.011271604877375637,
+    0.011241097337756334, 0.011210672369339956, 0.011180329748640649, 0.011150069252777442,
+    0.011119890659472609, 0.011089793747050039, 0.011059778294433605, 0.011029844081145535,
+    0.010999990887304816, 0.010970218493625544, 0.010940526681415336, 0.010910915232573719,
+    0.010881383929590527, 0.010851932555544303, 0.010822560894100707, 0.010793268729510922,
+    0.010764055846610079, 0.010734922030815669, 0.010705867068125964, 0.010676890745118454,
+    0.010647992848948276, 0.010619173167346646, 0.010590431488619304, 0.010561767601644959,
+    0.010533181295873736, 0.010504672361325634, 0.010476240588588977, 0.010447885768818881,
+    0.010419607693735716, 0.010391406155623579, 0.010363280947328772, 0.010335231862258269,
+    0.010307258694378209, 0.010279361238212378, 0.0102515392888407, 0.010223792641897735,
+    0.010196121093571171, 0.010168524440600332, 0.010141002480274688, 0.010113555010432358,
+    0.010086181829458628, 0.010058882736284476, 0.010031657530385086, 0.01000450601177838,
+    0.0099774279810235476, 0.009950423239219585, 0.0099234915880038257, 0.0098966328295504915,
+    0.0098698467665692367, 0.0098431332023036951, 0.0098164919405300411, 0.0097899227855555437,
+    0.0097634255422171315, 0.0097370000158799562, 0.0097106460124359705, 0.0096843633383024881,
+    0.0096581518004207785, 0.0096320112062546377, 0.0096059413637889744, 0.0095799420815284048,
+    0.0095540131684958441, 0.0095281544342311012, 0.0095023656887894825, 0.0094766467427403953,
+    0.0094509974071659564, 0.0094254174936596029, 0.0093999068143247148, 0.0093744651817732252,
+    0.0093490924091242499, 0.0093237883100027157, 0.009298552698537986, 0.0092733853893624991,
+    0.0092482861976104086, 0.009223254938916221, 0.0091982914294134431, 0.009173395485733234,
+    0.0091485669250030502, 0.0091238055648453151, 0.0090991112233760694, 0.0090744837192036354,
+    0.0090499228714272899, 0.0090254284996359336, 0.0090010004239067624, 0.0089766384648039474,
+    0.008952342443377323, 0.008928112181161062, 0.0089039475001723711, 0.0088798482229101826,
+    0.0088558141723538517, 0.0088318451719618524, 0.0088079410456704844, 0.0087841016178925799,
+    0.0087603267135162085, 0.0087366161579033978, 0.0087129697768888476, 0.0086893873967786497,
+    0.0086658688443490145, 0.0086424139468449946, 0.0086190225319792181, 0.0085956944279306276,
+    0.0085724294633432088, 0.0085492274673247392, 0.0085260882694455312, 0.0085030116997371757,
+    0.0084799975886913018, 0.0084570457672583262, 0.0084341560668462073, 0.0084113283193192195,
+    0.0083885623569967052, 0.0083658580126518521, 0.0083432151195104564, 0.0083206335112497084,
+    0.0082981130219969609, 0.0082756534863285165, 0.0082532547392684102, 0.0082309166162871997,
+    0.0082086389533007516, 0.008186421586669046, 0.0081642643531949638, 0.0081421670901230918,
+    0.0081201296351385305, 0.0080981518263656994, 0.0080762335023671465, 0.0080543745021423654,
+    0.0080325746651266072, 0.0080108338311897075, 0.0079891518406349088, 0.0079675285341976858,
+    0.0079459637530445732, 0.0079244573387720028, 0.0079030091334051419, 0.0078816189793967269,
+    0.0078602867196259085, 0.0078390121973970998, 0.0078177952564388239, 0.0077966357409025638,
+    0.0077755334953616218, 0.0077544883648099734, 0.0077335001946611326, 0.0077125688307470124,
+    0.0076916941193167975, 0.0076708759070358099, 0.0076501140409843855, 0.0076294083686567499,
+    0.0076087587379598982, 0.0075881649972124781, 0.007567626995143675, 0.0075471445808921022,
+    0.0075267176040046914, 0.0075063459144355882, 0.0074860293625450512, 0.0074657677990983481,
+    0.0074455610752646659, 0.007425409042616014, 0.0074053115531261329, 0.0073852684591694121,
+    0.0073652796135197972, 0.0073453448693497183, 0.0073254640802290025, 0.0073056371001238053,
+    0.0072858637833955334, 0.0072661439847997774, 0.007246477559485244, 0.007226864362992691,
+    0.0072073042512538679, 0.0071877970805904563, 0.0071683427077130178, 0.0071489409897199348,
+    0.0071295917840963671, 0.007110294948713204, 0.0070910503418260161, 0.0070718578220740199,
+    0.0070527172484790342, 0.00703362848044445, 0.0070145913777541905, 0.0069956058005716908,
+    0.0069766716094388607, 0.0069577886652750671, 0.0069389568293761108, 0.0069201759634132049,
+    0.0069014459294319628, 0.0068827665898513824, 0.0068641378074628355, 0.0068455594454290619,
+    0.0068270313672831621, 0.006808553436927595, 0.00679012551863318, 0.0067717474770380972,
+    0.0067534191771468962, 0.0067351404843295042, 0.0067169112643202323, 0.0066987313832167971,
+    0.0066806007074793295, 0.0066625191039293985, 0.0066444864397490321, 0.0066265025824797409,
+    0.0066085674000215455, 0.006590680760632006, 0.006572842532925254, 0.0065550525858710292,
+    0.0065373107887937137, 0.0065196170113713753, 0.0065019711236348095, 0.0064843729959665839,
+    0.0064668224991000847, 0.0064493195041185726, 0.0064318638824542281, 0.0064144555058872153,
+    0.0063970942465447324, 0.0063797799769000777, 0.0063625125697717123, 0.0063452918983223222,
+    0.0063281178360578916, 0.0063109902568267689, 0.0062939090348187446, 0.006276874044564125,
+    0.0062598851609328076, 0.0062429422591333697, 0.0062260452147121425, 0.0062091939035523042,
+    0.0061923882018729655, 0.0061756279862282583, 0.0061589131335064336, 0.0061422435209289522,
+    0.0061256190260495875, 0.0061090395267535237, 0.0060925049012564561, 0.0060760150281037022,
+    0.0060595697861693066, 0.0060431690546551503, 0.0060268127130900647, 0.0060105006413289468,
+    0.0059942327195518768, 0.0059780088282632357, 0.0059618288482908323, 0.005945692660785022,
+    0.0059296001472178388, 0.0059135511893821206, 0.0058975456693906442, 0.0058815834696752589,
+    0.0058656644729860189, 0.0058497885623903286, 0.005833955621272079, 0.0058181655333307903,
+    0.0058024181825807623, 0.00578671345335022, 0.0057710512302804615, 0.0057554313983250137,
+    0.005739853842748787, 0.0057243184491272319, 0.0057088251033454987, 0.0056933736915975967,
+    0.0056779641003855642, 0.0056625962165186283, 0.0056472699271123781, 0.0056319851195879332,
+    0.0056167416816711169, 0.0056015395013916331, 0.0055863784670822413, 0.0055712584673779392,
+    0.0055561793912151406, 0.005541141127830866, 0.005526143566761922, 0.0055111865978440897,
+    0.005496270111211332, 0.0054813939972949604, 0.0054665581468228471, 0.0054517624508186192,
+    0.0054370068006008567, 0.0054222910877822954, 0.0054076152042690307, 0.0053929790422597218,
+    0.0053783824942448023, 0.0053638254530056894, 0.0053493078116139967, 0.0053348294634307462,
+    0.0053203903021055909, 0.0053059902215760258, 0.0052916291160666163, 0.0052773068800882157,
+    0.0052630234084371941, 0.0052487785961946622, 0.0052345723387257044, 0.0052204045316786071,
+    0.0052062750709840925, 0.0051921838528545565, 0.0051781307737833043, 0.0051641157305437916,
+    0.0051501386201888624, 0.0051361993400499996, 0.0051222977877365631, 0.005108433861135046,
+    0.0050946074584083158, 0.0050808184779948737, 0.0050670668186081043, 0.0050533523792355333,
+    0.0050396750591380846, 0.0050260347578493418, 0.0050124313751748074, 0.0049988648111911711,
+    0.0049853349662455715, 0.0049718417409548672, 0.0049583850362049037, 0.0049449647531497904,
+    0.0049315807932111674, 0.00491823305807749, 0.0049049214497032968, 0.0048916458703084989,
+    0.0048784062223776545, 0.0048652024086592574, 0.0048520343321650202, 0.0048389018961691611,
+    0.0048258050042076965, 0.0048127435600777303, 0.0047997174678367461, 0.0047867266318019066,
+    0.0047737709565493442, 0.0047608503469134681, 0.0047479647079862585, 0.0047351139451165727,
+    0.00472229796390945, 0.0047095166702254164, 0.004696769970179795, 0.0046840577701420154,
+    0.0046713799767349254, 0.004658736496834107, 0.0046461272375671915, 0.0046335521063131753,
+    0.0046210110107017428, 0.0046085038586125863, 0.0045960305581747279, 0.0045835910177658475,
+    0.0045711851460116092, 0.0045588128517849869, 0.0045464740442055993, 0.0045341686326390409,
+    0.0045218965266962136, 0.0045096576362326675, 0.0044974518713479343, 0.0044852791423848687,
+    0.0044731393599289921, 0.0044610324348078306, 0.0044489582780902663, 0.0044369168010858781,
+    0.0044249079153442948, 0.0044129315326545421, 0.0044009875650443961, 0.004389075924779739,
+    0.0043771965243639107, 0.0043653492765370694, 0.0043535340942755475, 0.0043417508907912161,
+    0.0043299995795308445, 0.0043182800741754668, 0.0043065922886397455, 0.0042949361370713405,
+    0.0042833115338502788, 0.0042717183935883233, 0.0042601566311283486, 0.0042486261615437152,
+    0.0042371269001376432, 0.004225658762442591, 0.0042142216642196365, 0.0042028155214578582,
+    0.0041914402503737142, 0.0041800957674104338, 0.0041687819892373967, 0.0041574988327495238,
+    0.0041462462150666686, 0.0041350240535330055, 0.0041238322657164246, 0.0041126707694079234,
+    0.0041015394826210078, 0.0040904383235910854, 0.0040793672107748667, 0.004068326062849765,
+    0.0040573147987133015, 0.0040463333374825073, 0.0040353815984933298, 0.0040244595013000407,
+    0.0040135669656746458, 0.004002703911606292, 0.0039918702593006858, 0.0039810659291794996,
+    0.0039702908418797946, 0.0039595449182534331, 0.0039488280793664975, 0.0039381402464987135,
+    0.0039274813411428683, 0.0039168512850042353, 0.00390625, 0.0038956774082586853,
+    0.0038851334321195795,
+  };
 } // namespace mopo
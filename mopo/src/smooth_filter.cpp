@@ -32,11 +32,15 @@ namespace mopo {
     if (half_life > 0.0)
       decay = std::pow(0.5, 1.0 / (half_life * sample_rate_));
 
+    const mopo_float* target = input(kTarget)->source->buffer;
+    mopo_float* MOPO_RESTRICT dest = output(0)->buffer;
+    mopo_float value = last_value_;
+
     for (int i = 0; i < buffer_size_; ++i) {
-      mopo_float target = input(kTarget)->at(i);
-      last_value_ = utils::interpolate(target, last_value_, decay);
-      output(0)->buffer[i] = last_value_;
+      value = utils::interpolate(target[i], value, decay);
+      dest[i] = value;
     }
+    last_value_ = value;
   }
 
   namespace cr {
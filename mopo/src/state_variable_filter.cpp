@@ -77,7 +77,7 @@ namespace mopo {
       process12db(audio_buffer, dest);
   }
 
-  void StateVariableFilter::process12db(const mopo_float* audio_buffer, mopo_float* dest) {
+  void StateVariableFilter::process12db(const mopo_float* audio_buffer, mopo_float* MOPO_RESTRICT dest) {
     mopo_float delta_m0 = (target_m0_ - m0_) / buffer_size_;
     mopo_float delta_m1 = (target_m1_ - m1_) / buffer_size_;
     mopo_float delta_m2 = (target_m2_ - m2_) / buffer_size_;
@@ -111,7 +111,7 @@ namespace mopo {
     }
   }
 
-  void StateVariableFilter::process24db(const mopo_float* audio_buffer, mopo_float* dest) {
+  void StateVariableFilter::process24db(const mopo_float* audio_buffer, mopo_float* MOPO_RESTRICT dest) {
     mopo_float delta_m0 = (target_m0_ - m0_) / buffer_size_;
     mopo_float delta_m1 = (target_m1_ - m1_) / buffer_size_;
     mopo_float delta_m2 = (target_m2_ - m2_) / buffer_size_;
@@ -233,7 +233,8 @@ namespace mopo {
     }
   }
 
-  inline void StateVariableFilter::tick(int i, mopo_float* dest, const mopo_float* audio_buffer) {
+  inline void StateVariableFilter::tick(int i, mopo_float* MOPO_RESTRICT dest,
+                                        const mopo_float* audio_buffer) {
     mopo_float audio = utils::quickTanh(drive_ * audio_buffer[i]);
 
     mopo_float v3_a = audio - ic2eq_a_;
@@ -245,7 +246,7 @@ namespace mopo {
     dest[i] = m0_ * audio + m1_ * v1_a + m2_ * v2_a;
   }
 
-  inline void StateVariableFilter::tick24db(int i, mopo_float* dest,
+  inline void StateVariableFilter::tick24db(int i, mopo_float* MOPO_RESTRICT dest,
                                             const mopo_float* audio_buffer) {
     mopo_float audio = drive_ * audio_buffer[i];
 
@@ -60,8 +60,8 @@ namespace mopo {
 
       virtual Processor* clone() const { return new StateVariableFilter(*this); }
       virtual void process();
-      void process12db(const mopo_float* audio_buffer, mopo_float* dest);
-      void process24db(const mopo_float* audio_buffer, mopo_float* dest);
+      void process12db(const mopo_float* audio_buffer, mopo_float* MOPO_RESTRICT dest);
+      void process24db(const mopo_float* audio_buffer, mopo_float* MOPO_RESTRICT dest);
       void processAllPass(const mopo_float* audio_buffer, mopo_float* dest);
 
       void computePassCoefficients(mopo_float blend,
@@ -73,8 +73,8 @@ namespace mopo {
                                     mopo_float cutoff,
                                     mopo_float gain);
 
-      inline void tick(int i, mopo_float* dest, const mopo_float* audio_buffer);
-      inline void tick24db(int i, mopo_float* dest, const mopo_float* audio_buffer);
+      inline void tick(int i, mopo_float* MOPO_RESTRICT dest, const mopo_float* audio_buffer);
+      inline void tick24db(int i, mopo_float* MOPO_RESTRICT dest, const mopo_float* audio_buffer);
 
     private:
       void reset();
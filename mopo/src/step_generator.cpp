@@ -26,26 +26,43 @@ namespace mopo {
       offset_(0.0), current_step_(0) { }
 
   void StepGenerator::process() {
-    static mopo_float integral;
     unsigned int num_steps = static_cast<int>(input(kNumSteps)->at(0));
     num_steps = utils::iclamp(num_steps, 1, max_steps_);
+    mopo_float delta_offset = input(kFrequency)->at(0) / sample_rate_;
+
+    const Output* reset = input(kReset)->source;
+    output(kStep)->clearTrigger();
 
-    int i = 0;
-    if (input(kReset)->source->triggered) {
-      offset_ = 0.0f;
+    int samples = samples_to_process_;
+    if (reset->triggered) {
+      offset_ = 0.0;
       current_step_ = 0;
-      i = input(kReset)->source->trigger_offset;
+      samples -= reset->trigger_offset;
     }
 
-    offset_ += samples_to_process_ * input(kFrequency)->at(0) / sample_rate_;
-    offset_ = utils::mod(offset_, &integral);
-    current_step_ += integral;
-    current_step_ = (current_step_ + num_steps) % num_steps;
+    unsigned int last_step = current_step_;
+    advance(samples * delta_offset, num_steps);
+    if (current_step_ != last_step && delta_offset > 0.0) {
+      int offset = samples_to_process_ - 1 - static_cast<int>(offset_ / delta_offset);
+      output(kStep)->trigger(current_step_, utils::iclamp(offset, 0, samples_to_process_ - 1));
+    }
 
     output(kValue)->buffer[0] = input(kSteps + current_step_)->source->buffer[0];
     output(kStep)->buffer[0] = current_step_;
   }
 
+  void StepGenerator::advance(mopo_float delta_offset, unsigned int num_steps) {
+    mopo_float integral;
+    offset_ = utils::mod(offset_ + delta_offset, &integral);
+    current_step_ = (current_step_ + static_cast<unsigned int>(integral)) % num_steps;
+  }
+
+  void StepGenerator::skip(int samples) {
+    unsigned int num_steps = static_cast<int>(input(kNumSteps)->at(0));
+    num_steps = utils::iclamp(num_steps, 1, max_steps_);
+    advance(samples * input(kFrequency)->at(0) / sample_rate_, num_steps);
+  }
+
   void StepGenerator::correctToTime(mopo_float samples) {
     static mopo_float integral;
 
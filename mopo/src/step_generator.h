@@ -49,7 +49,12 @@ namespace mopo {
       void process() override;
       void correctToTime(mopo_float samples);
 
+      // Advances _samples_ worth of steps without writing the outputs.
+      void skip(int samples);
+
     protected:
+      void advance(mopo_float delta_offset, unsigned int num_steps);
+
       unsigned int max_steps_;
       mopo_float offset_;
       unsigned int current_step_;
@@ -30,18 +30,20 @@ namespace mopo {
     }
   } // namespace
 
-  Stutter::Stutter(int size) : Processor(Stutter::kNumInputs, 1),
-      memory_(nullptr), size_(size), offset_(0.0), memory_offset_(0.0), resample_countdown_(0.0),
-      last_stutter_period_(0.0), last_amplitude_(0.0), resampling_(true) {
+  Stutter::Stutter(mopo_float max_period) : Processor(Stutter::kNumInputs, 1),
+      memory_(nullptr), memory_size_(0), max_period_(max_period), offset_(0.0),
+      memory_offset_(0.0), resample_countdown_(0.0), last_stutter_period_(0.0),
+      last_amplitude_(0.0), resampling_(true) {
   }
 
   Stutter::~Stutter() {
-    delete memory_;
+    delete[] memory_;
   }
 
   Stutter::Stutter(const Stutter& other) : Processor(other) {
     this->memory_ = nullptr;
-    this->size_ = other.size_;
+    this->memory_size_ = 0;
+    this->max_period_ = other.max_period_;
     this->offset_ = other.offset_;
     this->memory_offset_ = 0.0;
     this->resample_countdown_ = other.resample_countdown_;
@@ -50,14 +52,31 @@ namespace mopo {
     this->resampling_ = other.resampling_;
   }
 
+  void Stutter::setSampleRate(int sample_rate) {
+    Processor::setSampleRate(sample_rate);
+
+    // Resized the next time stutter is used.
+    delete[] memory_;
+    memory_ = nullptr;
+    memory_size_ = 0;
+    last_stutter_period_ = 0.0;
+    startResampling(0.0);
+  }
+
+  void Stutter::allocateMemory() {
+    memory_size_ = utils::imax(1, std::ceil(max_period_ * sample_rate_));
+    memory_ = new float[memory_size_];
+    std::fill(memory_, memory_ + memory_size_, 0.0f);
+  }
+
   void Stutter::process() {
     MOPO_ASSERT(inputMatchesBufferSize(kAudio));
 
     // A hack to save memory until stutter is used.
     if (memory_ == nullptr)
-      memory_ = new Memory(size_);
+      allocateMemory();
 
-    mopo_float max_memory_write = memory_->getSize();
+    mopo_float max_memory_write = memory_size_;
     const mopo_float* audio = input(kAudio)->source->buffer;
     mopo_float* dest = output()->buffer;
 
@@ -99,11 +118,18 @@ namespace mopo {
       MOPO_ASSERT(samples >= 0);
       MOPO_ASSERT(num_samples >= 0);
 
+      // The recording starts at the last resample and stops when it's full,
+      // so it never wraps.
       if (memory_offset_ < max_memory_write) {
         int mem_samples = std::min<int>(max_memory_write - memory_offset_, num_samples);
         MOPO_ASSERT(buffer_size_ - i >= mem_samples);
-        memory_->pushBlock(audio + i, std::max<int>(0, mem_samples));
-        memory_offset_ += mem_samples;
+        float* record = memory_ + static_cast<int>(memory_offset_);
+        const mopo_float* record_source = audio + i;
+
+        VECTORIZE_LOOP
+        for (int s = 0; s < mem_samples; ++s)
+          record[s] = record_source[s];
+        memory_offset_ += std::max(0, mem_samples);
       }
 
       stutter_period += num_samples * stutter_period_diff;
@@ -117,18 +143,24 @@ namespace mopo {
       mopo_float amplitude = last_amplitude_;
       mopo_float amplitude_diff = (end_amplitude - amplitude) / num_samples;
 
+      mopo_float* segment_dest = dest + i;
       if (resampling_) {
-        for (; i < samples; ++i) {
-          amplitude += amplitude_diff;
-          dest[i] = amplitude * audio[i];
-        }
+        const mopo_float* segment_source = audio + i;
+
+        VECTORIZE_LOOP
+        for (int s = 0; s < num_samples; ++s)
+          segment_dest[s] = (amplitude + (s + 1) * amplitude_diff) * segment_source[s];
       }
       else {
-        mopo_float* playback_dest = dest + i;
-        for (int s = 0; s < num_samples; ++s) {
-          amplitude += amplitude_diff;
-          playback_dest[s] = amplitude * memory_->get(memory_offset_ - offset_ - s);
-        }
+        // Playback is always on whole samples so it reads the recording as
+        // one contiguous span from the stutter offset.
+        int start = offset_;
+        MOPO_ASSERT(start + num_samples <= memory_size_);
+        const float* segment_source = memory_ + start;
+
+        VECTORIZE_LOOP
+        for (int s = 0; s < num_samples; ++s)
+          segment_dest[s] = (amplitude + (s + 1) * amplitude_diff) * segment_source[s];
       }
 
       i = samples;
@@ -18,7 +18,6 @@
 #ifndef STUTTER_H
 #define STUTTER_H
 
-#include "memory.h"
 #include "processor.h"
 #include "utils.h"
 
@@ -37,12 +36,15 @@ namespace mopo {
         kNumInputs
       };
 
-      Stutter(int size);
+      // _max_period_ is the longest stutter in seconds. The recording buffer
+      // is sized for it at the current sample rate when stutter is first used.
+      Stutter(mopo_float max_period);
       Stutter(const Stutter& other);
       virtual ~Stutter();
 
       virtual Processor* clone() const override { return new Stutter(*this); }
       virtual void process() override;
+      virtual void setSampleRate(int sample_rate) override;
 
     protected:
       void startResampling(mopo_float sample_period) {
@@ -52,8 +54,13 @@ namespace mopo {
         memory_offset_ = 0.0;
       }
 
-      Memory* memory_;
-      int size_;
+      void allocateMemory();
+
+      // Audio recorded since the last resample, from its start. Stored as
+      // float since it's only played back.
+      float* memory_;
+      int memory_size_;
+      mopo_float max_period_;
       mopo_float offset_;
       mopo_float memory_offset_;
       mopo_float resample_countdown_;
@@ -18,7 +18,9 @@
 
 namespace mopo {
 
-  TriggerCombiner::TriggerCombiner() : Processor(2, 1) { }
+  TriggerCombiner::TriggerCombiner() : Processor(2, 1) {
+    setTriggerDriven();
+  }
 
   void TriggerCombiner::process() {
     output()->clearTrigger();
@@ -33,7 +35,9 @@ namespace mopo {
     }
   }
 
-  TriggerWait::TriggerWait() : Processor(kNumInputs, 1) { }
+  TriggerWait::TriggerWait() : Processor(kNumInputs, 1) {
+    setTriggerDriven();
+  }
 
   void TriggerWait::waitTrigger(mopo_float trigger_value) {
     waiting_ = true;
@@ -70,7 +74,7 @@ namespace mopo {
 
   TriggerFilter::TriggerFilter(mopo_float trigger_filter) :
       Processor(kNumInputs, 1), trigger_filter_(trigger_filter) {
-
+    setTriggerDriven();
   }
 
   void TriggerFilter::process() {
@@ -106,7 +110,9 @@ namespace mopo {
   }
 
   LegatoFilter::LegatoFilter() : Processor(kNumInputs, kNumOutputs),
-                                 last_value_(kVoiceOff) { }
+                                 last_value_(kVoiceOff) {
+    setTriggerDriven();
+  }
 
   void LegatoFilter::process() {
     output(kRetrigger)->clearTrigger();
@@ -129,7 +135,9 @@ namespace mopo {
   }
 
   PortamentoFilter::PortamentoFilter() : Processor(kNumInputs, 1),
-                                         released_(true) { }
+                                         released_(true) {
+    setTriggerDriven();
+  }
 
   void PortamentoFilter::updateReleased() {
     if (!input(kVoiceTrigger)->source->triggered)
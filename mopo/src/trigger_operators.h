@@ -84,7 +84,9 @@ namespace mopo {
         kCondition,
         kNumInputs
       };
-      TriggerEquals(mopo_float value) : Processor(kNumInputs, 1), value_(value) { }
+      TriggerEquals(mopo_float value) : Processor(kNumInputs, 1), value_(value) {
+        setTriggerDriven();
+      }
 
       virtual Processor* clone() const override {
         return new TriggerEquals(*this);
@@ -103,7 +105,9 @@ namespace mopo {
         kCondition,
         kNumInputs
       };
-      TriggerNonZero() : Processor(kNumInputs, 1) { }
+      TriggerNonZero() : Processor(kNumInputs, 1) {
+        setTriggerDriven();
+      }
 
       virtual Processor* clone() const override {
         return new TriggerNonZero(*this);
@@ -18,10 +18,19 @@
 
 #include "utils.h"
 
+#include <algorithm>
+
+// Buffers of catch up processing shared by all voices in one block.
+#define CATCH_UP_BUFFERS 8
+
 namespace mopo {
 
   Voice::Voice(Processor* processor) : event_sample_(-1),
-      aftertouch_sample_(-1), aftertouch_(0.0), processor_(processor) {
+      aftertouch_sample_(-1), aftertouch_(0.0), processor_(processor),
+      replay_(nullptr), render_position_(0),
+      recording_slot_(-1), recording_generation_(0),
+      catching_up_(false), live_position_(0), catch_up_release_(-1),
+      has_pending_event_(false), pending_event_(kVoiceOff), pending_position_(0) {
     state_.event = kVoiceOff;
     state_.note = 0;
     state_.velocity = 0;
@@ -37,7 +46,8 @@ namespace mopo {
 
   VoiceHandler::VoiceHandler(size_t polyphony) :
       ProcessorRouter(kNumInputs, 0), polyphony_(0), sustain_(false),
-      legato_(false), voice_killer_(0), last_played_note_(-1.0) {
+      legato_(false), voice_killer_(0), last_played_note_(-1.0), voices_wanted_(0),
+      render_cache_(nullptr), render_caching_(false), catch_up_buffers_(0) {
     pressed_notes_.reserve(MIDI_SIZE);
     all_voices_.reserve(MAX_POLYPHONY);
     free_voices_.reserve(MAX_POLYPHONY);
@@ -58,8 +68,13 @@ namespace mopo {
     for (auto& output : accumulated_outputs_)
       delete output.second;
 
+    for (Readout& readout : readouts_)
+      delete readout.destination;
+
     for (auto& output : last_voice_outputs_)
       delete output.second;
+
+    delete render_cache_;
   }
 
   void VoiceHandler::prepareVoiceTriggers(Voice* voice) {
@@ -101,6 +116,11 @@ namespace mopo {
   void VoiceHandler::clearNonaccumulatedOutputs() {
     for (auto& output : last_voice_outputs_)
       utils::zeroBuffer(output.second->buffer, MAX_BUFFER_SIZE);
+
+    for (Readout& readout : readouts_) {
+      if (readout.subscribers)
+        utils::zeroBuffer(readout.destination->buffer, MAX_BUFFER_SIZE);
+    }
   }
 
   void VoiceHandler::accumulateOutputs() {
@@ -123,6 +143,13 @@ namespace mopo {
 
       utils::copyBuffer(dest, source, buffer_size);
     }
+
+    for (Readout& readout : readouts_) {
+      if (readout.subscribers) {
+        utils::copyBuffer(readout.destination->buffer, readout.source->buffer,
+                          readout.source->owner->getBufferSize());
+      }
+    }
   }
 
   bool VoiceHandler::shouldAccumulate(Output* output) {
@@ -132,6 +159,9 @@ namespace mopo {
   void VoiceHandler::process() {
     global_router_.process();
 
+    int polyphony = static_cast<int>(input(kPolyphony)->at(0));
+    setPolyphony(utils::iclamp(polyphony, 1, MAX_POLYPHONY));
+
     int num_voices = active_voices_.size();
     if (num_voices == 0) {
       if (last_num_voices_) {
@@ -143,20 +173,49 @@ namespace mopo {
       return;
     }
 
-    int polyphony = static_cast<int>(input(kPolyphony)->at(0));
-    setPolyphony(utils::iclamp(polyphony, 1, polyphony));
     clearAccumulatedOutputs();
 
+    catch_up_buffers_ = CATCH_UP_BUFFERS;
     auto iter = active_voices_.begin();
     while (iter != active_voices_.end()) {
       Voice* voice = *iter;
-      prepareVoiceTriggers(voice);
-      processVoice(voice);
+
+      if (voice->replay_ && !voice->catching_up_ && !canReplay(voice))
+        startCatchUp(voice);
+
+      if (voice->catching_up_ && !catchUp(voice) && voice->hasNewEvent()) {
+        voice->has_pending_event_ = true;
+        voice->pending_event_ = voice->state().event;
+        voice->pending_position_ = voice->render_position_ + voice->event_sample();
+      }
+
+      if (voice->replay_) {
+        if (replayVoice(voice)) {
+          stopRenderCaching(voice);
+          free_voices_.push_back(voice);
+          iter = active_voices_.erase(iter);
+        }
+        else
+          iter++;
+        continue;
+      }
+
+      if (voice->recording_slot_ >= 0)
+        recordVoice(voice);
+      else {
+        prepareVoiceTriggers(voice);
+        processVoice(voice);
+      }
       accumulateOutputs();
 
       // Remove voice if the right processor has a full silent buffer.
       if (voice_killer_ && voice->state().event != kVoiceOn &&
           utils::isSilent(voice_killer_->buffer, buffer_size_)) {
+        if (voice->recording_slot_ >= 0 &&
+            render_cache_->isRecording(voice->recording_slot_, voice->recording_generation_)) {
+          render_cache_->finishRecording(voice->recording_slot_);
+        }
+        voice->recording_slot_ = -1;
         free_voices_.push_back(voice);
         iter = active_voices_.erase(iter);
       }
@@ -217,12 +276,16 @@ namespace mopo {
       voice->deactivate(sample);
   }
 
+  bool VoiceHandler::hasFreeVoice() {
+    return free_voices_.size() &&
+           (!legato_ || pressed_notes_.size() < polyphony_ || active_voices_.size() < polyphony_);
+  }
+
   Voice* VoiceHandler::grabVoice() {
     Voice* voice = 0;
 
     // First check free voices.
-    if (free_voices_.size() &&
-       (!legato_ || pressed_notes_.size() < polyphony_ || active_voices_.size() < polyphony_)) {
+    if (hasFreeVoice()) {
       voice = free_voices_.front();
       free_voices_.pop_front();
       return voice;
@@ -294,7 +357,9 @@ namespace mopo {
     MOPO_ASSERT(sample >= 0 && sample < buffer_size_);
     MOPO_ASSERT(channel >= 0 && channel < NUM_MIDI_CHANNELS);
 
+    bool fresh_voice = hasFreeVoice();
     Voice* voice = grabVoice();
+    stopRenderCaching(voice);
     pressed_notes_.remove(note);
     pressed_notes_.push_front(note);
 
@@ -303,6 +368,9 @@ namespace mopo {
     voice->activate(note, velocity, last_played_note_, pressed_notes_.size(), sample, channel);
     active_voices_.push_back(voice);
     last_played_note_ = note;
+
+    if (render_caching_ && fresh_voice)
+      startRenderCaching(voice);
   }
 
   VoiceEvent VoiceHandler::noteOff(mopo_float note, int sample) {
@@ -319,6 +387,7 @@ namespace mopo {
             voice->kill();
 
             Voice* new_voice = grabVoice();
+            stopRenderCaching(new_voice);
             active_voices_.push_back(new_voice);
             mopo_float old_note = pressed_notes_.back();
             pressed_notes_.pop_back();
@@ -352,12 +421,6 @@ namespace mopo {
   }
 
   void VoiceHandler::setPolyphony(size_t polyphony) {
-    while (all_voices_.size() < polyphony) {
-      Voice* new_voice = createVoice();
-      all_voices_.push_back(new_voice);
-      active_voices_.push_back(new_voice);
-    }
-
     int num_voices_to_kill = active_voices_.size() - polyphony;
     for (int i = 0; i < num_voices_to_kill; ++i) {
       Voice* sacrifice = getVoiceToKill();
@@ -366,6 +429,7 @@ namespace mopo {
     }
 
     polyphony_ = polyphony;
+    updateVoicesWanted();
   }
 
   mopo_float VoiceHandler::getLastActiveNote() const {
@@ -408,11 +472,265 @@ namespace mopo {
     return output;
   }
 
+  Output* VoiceHandler::registerReadout(Output* output) {
+    Output* readout = new Output();
+    readout->owner = this;
+    ProcessorRouter::registerOutput(readout);
+    readouts_.push_back({ output, readout, 0 });
+    return readout;
+  }
+
+  VoiceHandler::Readout* VoiceHandler::findReadout(const Output* readout) {
+    for (Readout& details : readouts_) {
+      if (details.destination == readout)
+        return &details;
+    }
+    return nullptr;
+  }
+
+  void VoiceHandler::subscribeReadout(const Output* readout) {
+    Readout* details = findReadout(readout);
+    if (details)
+      details->subscribers++;
+  }
+
+  void VoiceHandler::unsubscribeReadout(const Output* readout) {
+    Readout* details = findReadout(readout);
+    if (details == nullptr || details->subscribers == 0)
+      return;
+
+    if (--details->subscribers == 0)
+      utils::zeroBuffer(details->destination->buffer, MAX_BUFFER_SIZE);
+  }
+
   bool VoiceHandler::isPolyphonic(const Processor* processor) const {
     return processor == &voice_router_;
   }
 
+  void VoiceHandler::getRouters(std::vector<ProcessorRouter*>& routers) {
+    ProcessorRouter::getRouters(routers);
+    voice_router_.getRouters(routers);
+    global_router_.getRouters(routers);
+  }
+
   Voice* VoiceHandler::createVoice() {
     return new Voice(voice_router_.clone());
   }
+
+  bool VoiceHandler::addVoice(Voice* voice) {
+    Processor* processor = voice->processor();
+    if (voices_wanted_ <= 0 || processor->getSampleRate() != getSampleRate() ||
+        processor->getBufferSize() != getBufferSize()) {
+      return false;
+    }
+
+    all_voices_.push_back(voice);
+    free_voices_.push_back(voice);
+    updateVoicesWanted();
+    return true;
+  }
+
+  // There's a voice for every note the polyphony allows so none are stolen
+  // early. Voices are kept if the polyphony drops again.
+  void VoiceHandler::updateVoicesWanted() {
+    int num_voices = static_cast<int>(all_voices_.size());
+    voices_wanted_ = std::max(0, static_cast<int>(polyphony_) - num_voices);
+  }
+
+  void VoiceHandler::createRenderCache() {
+    if (render_cache_ == nullptr)
+      render_cache_ = new NoteRenderCache(accumulated_outputs_.size());
+  }
+
+  void VoiceHandler::setRenderCaching(bool caching) {
+    MOPO_ASSERT(render_cache_ || !caching);
+    if (render_caching_ == caching)
+      return;
+
+    if (!caching) {
+      for (Voice* voice : active_voices_)
+        leaveRenderCache(voice);
+    }
+    render_caching_ = caching;
+  }
+
+  void VoiceHandler::clearRenderCache() {
+    if (render_cache_ == nullptr)
+      return;
+
+    for (Voice* voice : active_voices_)
+      leaveRenderCache(voice);
+    render_cache_->clear();
+  }
+
+  void VoiceHandler::startRenderCaching(Voice* voice) {
+    voice->render_position_ = -voice->event_sample();
+    voice->replay_ = render_cache_->find(voice->state().note, voice->state().velocity,
+                                         voice->event_sample());
+
+    if (voice->replay_)
+      voice->replay_->users++;
+    else {
+      voice->recording_slot_ = render_cache_->startRecording(voice->state().note,
+                                                             voice->state().velocity,
+                                                             voice->event_sample());
+      voice->recording_generation_ = render_cache_->generation();
+    }
+  }
+
+  // Used when the voice is done or starts another note, so there's nothing to
+  // carry on from.
+  void VoiceHandler::stopRenderCaching(Voice* voice) {
+    if (voice->replay_) {
+      render_cache_->release(voice->replay_);
+      voice->replay_ = nullptr;
+    }
+    voice->catching_up_ = false;
+
+    if (voice->recording_slot_ >= 0 &&
+        render_cache_->isRecording(voice->recording_slot_, voice->recording_generation_)) {
+      render_cache_->abortRecording(voice->recording_slot_);
+    }
+    voice->recording_slot_ = -1;
+  }
+
+  // Replaying voices go live once they've caught up, recordings are dropped.
+  void VoiceHandler::leaveRenderCache(Voice* voice) {
+    if (voice->replay_ && !voice->catching_up_)
+      startCatchUp(voice);
+
+    if (voice->recording_slot_ >= 0 &&
+        render_cache_->isRecording(voice->recording_slot_, voice->recording_generation_)) {
+      render_cache_->abortRecording(voice->recording_slot_);
+    }
+    voice->recording_slot_ = -1;
+  }
+
+  // Checks the events for this buffer line up with the recorded ones.
+  bool VoiceHandler::canReplay(Voice* voice) {
+    const NoteRender* render = voice->replay_;
+    int position = voice->render_position_;
+
+    if (voice->hasNewEvent()) {
+      VoiceEvent event = voice->state().event;
+      if (position <= 0)
+        return event == kVoiceOn;
+      return event == kVoiceOff && position + voice->event_sample() == render->release;
+    }
+
+    if (position <= 0)
+      return false;
+    return voice->key_state() == Voice::kReleased || position + buffer_size_ <= render->release;
+  }
+
+  // Adds the recorded audio for this buffer. Returns true when it's done.
+  bool VoiceHandler::replayVoice(Voice* voice) {
+    const NoteRender* render = voice->replay_;
+    int position = voice->render_position_;
+    int start = std::max(0, -position);
+    int end = std::min(buffer_size_, render->length - position);
+
+    int index = 0;
+    for (auto& output : accumulated_outputs_) {
+      const mopo_float* source = render->buffer(index++) + position;
+      mopo_float* dest = output.second->buffer;
+
+      VECTORIZE_LOOP
+      for (int i = start; i < end; ++i)
+        dest[i] += source[i];
+    }
+
+    voice->clearEvents();
+    voice->render_position_ = position + buffer_size_;
+    return voice->render_position_ >= render->length;
+  }
+
+  void VoiceHandler::recordVoice(Voice* voice) {
+    int slot = voice->recording_slot_;
+    int position = voice->render_position_;
+    bool recording = render_cache_->isRecording(slot, voice->recording_generation_);
+
+    if (voice->hasNewEvent()) {
+      VoiceEvent event = voice->state().event;
+      if (event == kVoiceOff && position > 0)
+        render_cache_->setRelease(slot, position + voice->event_sample());
+      else if (event != kVoiceOn || position > 0)
+        recording = false;
+    }
+
+    prepareVoiceTriggers(voice);
+    processVoice(voice);
+
+    int start = std::max(0, -position);
+    int index = 0;
+    for (auto& output : accumulated_outputs_) {
+      if (recording)
+        recording = render_cache_->record(slot, index++, output.first->buffer + start,
+                                          buffer_size_ - start);
+    }
+
+    voice->render_position_ = position + buffer_size_;
+    if (recording)
+      render_cache_->advanceRecording(slot, buffer_size_ - start);
+    else
+      stopRenderCaching(voice);
+  }
+
+  // Events up to the start of this buffer matched the recording. Later ones
+  // are kept as pending while the voice catches up.
+  void VoiceHandler::startCatchUp(Voice* voice) {
+    const NoteRender* render = voice->replay_;
+    voice->catching_up_ = true;
+    voice->live_position_ = -render->offset;
+    voice->catch_up_release_ = render->release < voice->render_position_ ? render->release : -1;
+    voice->has_pending_event_ = false;
+  }
+
+  // Runs the voice from where it got to towards the start of this buffer,
+  // sharing CATCH_UP_BUFFERS between all voices each block. Returns true
+  // once it's there and the voice carries on live.
+  bool VoiceHandler::catchUp(Voice* voice) {
+    bool had_event = voice->hasNewEvent();
+    int event_sample = voice->event_sample();
+    int aftertouch_sample = voice->aftertouch_sample_;
+    Voice::KeyState key_state = voice->key_state();
+    VoiceState state = voice->state();
+
+    while (voice->live_position_ < voice->render_position_ && catch_up_buffers_ > 0) {
+      int position = voice->live_position_;
+      int release_sample = voice->catch_up_release_ - position;
+      int pending_sample = voice->pending_position_ - position;
+
+      if (position <= 0) {
+        voice->activate(state.note, state.velocity, state.last_note,
+                        state.note_pressed, -position, state.channel);
+      }
+      else if (voice->has_pending_event_ && pending_sample >= 0 && pending_sample < buffer_size_) {
+        if (voice->pending_event_ == kVoiceKill)
+          voice->kill(pending_sample);
+        else
+          voice->deactivate(pending_sample);
+      }
+      else if (voice->catch_up_release_ >= 0 && release_sample >= 0 &&
+               release_sample < buffer_size_) {
+        voice->deactivate(release_sample);
+      }
+
+      prepareVoiceTriggers(voice);
+      processVoice(voice);
+      voice->live_position_ = position + buffer_size_;
+      catch_up_buffers_--;
+    }
+
+    voice->state_ = state;
+    voice->key_state_ = key_state;
+    voice->event_sample_ = had_event ? event_sample : -1;
+    voice->aftertouch_sample_ = aftertouch_sample;
+
+    if (voice->live_position_ < voice->render_position_)
+      return false;
+
+    stopRenderCaching(voice);
+    return true;
+  }
 } // namespace mopo
@@ -20,11 +20,14 @@
 
 #include "circular_queue.h"
 #include "note_handler.h"
+#include "note_render_cache.h"
 #include "processor_router.h"
 #include "value.h"
 
+#include <atomic>
 #include <map>
 #include <list>
+#include <vector>
 
 namespace mopo {
 
@@ -106,6 +109,8 @@ namespace mopo {
       }
 
     private:
+      friend class VoiceHandler;
+
       Voice() { }
 
       int event_sample_;
@@ -116,8 +121,27 @@ namespace mopo {
       mopo_float aftertouch_;
 
       Processor* processor_;
+
+      // Render cache state. _render_position_ is the number of samples since
+      // the note started at the beginning of the current buffer.
+      NoteRender* replay_;
+      int render_position_;
+      int recording_slot_;
+      int recording_generation_;
+
+      // A replay that stops matching keeps playing while the voice runs a few
+      // buffers a block from its note on. _live_position_ is how far it got.
+      bool catching_up_;
+      int live_position_;
+      int catch_up_release_;
+      bool has_pending_event_;
+      VoiceEvent pending_event_;
+      int pending_position_;
   };
 
+  // Voices are cloned from the voice router up to the polyphony. Cloning is
+  // left to another thread, which asks how many voices are wanted and hands
+  // finished ones back with addVoice.
   class VoiceHandler : public virtual ProcessorRouter, public NoteHandler {
     public:
       enum Inputs {
@@ -171,8 +195,20 @@ namespace mopo {
       Output* registerOutput(Output* output) override;
       Output* registerOutput(Output* output, int index) override;
 
+      // Readouts copy an output from the last voice so it can be displayed.
+      // They're only written while something is subscribed to them.
+      Output* registerReadout(Output* output);
+      void subscribeReadout(const Output* readout);
+      void unsubscribeReadout(const Output* readout);
+
       void setPolyphony(size_t polyphony);
 
+      int getNumVoicesWanted() const { return voices_wanted_; }
+      Voice* createVoice();
+      // Returns false if _voice_ wasn't wanted or was built for a different
+      // sample rate or buffer size. The caller still owns it then.
+      bool addVoice(Voice* voice);
+
       void setVoiceKiller(const Output* killer) {
         voice_killer_ = killer;
       }
@@ -186,6 +222,14 @@ namespace mopo {
       }
 
       bool isPolyphonic(const Processor* processor) const override;
+      void getRouters(std::vector<ProcessorRouter*>& routers) override;
+
+      // Only enable render caching when every note is rendered the same way
+      // given its note, velocity and release time.
+      void createRenderCache();
+      void setRenderCaching(bool caching);
+      void clearRenderCache();
+      NoteRenderCache* getRenderCache() { return render_cache_; }
 
     protected:
       virtual bool shouldAccumulate(Output* output);
@@ -193,9 +237,10 @@ namespace mopo {
     private:
       VoiceHandler() { }
 
+      bool hasFreeVoice();
       Voice* grabVoice();
       Voice* getVoiceToKill();
-      Voice* createVoice();
+      void updateVoicesWanted();
       void prepareVoiceTriggers(Voice* voice);
       void processVoice(Voice* voice);
       void clearAccumulatedOutputs();
@@ -203,14 +248,37 @@ namespace mopo {
       void accumulateOutputs();
       void writeNonaccumulatedOutputs();
 
+      void startRenderCaching(Voice* voice);
+      void stopRenderCaching(Voice* voice);
+      void leaveRenderCache(Voice* voice);
+      bool canReplay(Voice* voice);
+      bool replayVoice(Voice* voice);
+      void recordVoice(Voice* voice);
+      void startCatchUp(Voice* voice);
+      bool catchUp(Voice* voice);
+
+      struct Readout {
+        Output* source;
+        Output* destination;
+        int subscribers;
+      };
+
+      Readout* findReadout(const Output* readout);
+
       size_t polyphony_;
       bool sustain_;
       bool legato_;
       std::map<Output*, Output*> last_voice_outputs_;
       std::map<Output*, Output*> accumulated_outputs_;
+      std::vector<Readout> readouts_;
       const Output* voice_killer_;
       mopo_float last_played_note_;
       int last_num_voices_;
+      std::atomic<int> voices_wanted_;
+
+      NoteRenderCache* render_cache_;
+      bool render_caching_;
+      int catch_up_buffers_;
 
       Output voice_event_;
       Output note_;
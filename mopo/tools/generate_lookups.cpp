@@ -0,0 +1,143 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * mopo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * mopo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Writes the lookup table sources so the tables are read only data instead
+// of being filled in when the library loads. Run from the mopo directory
+// after changing a resolution or formula:
+//
+//   g++ -std=c++11 -Isrc tools/generate_lookups.cpp src/value.cpp \
+//       src/processor.cpp src/processor_router.cpp src/feedback.cpp \
+//       -o generate_lookups && ./generate_lookups src
+
+#include "magnitude_lookup.h"
+#include "midi_lookup.h"
+#include "resonance_lookup.h"
+#include "sample_decay_lookup.h"
+#include "utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace mopo;
+
+namespace {
+  const int VALUES_PER_LINE = 4;
+
+  const char* LICENSE =
+      "/* Copyright 2013-2017 Matt Tytel\n"
+      " *\n"
+      " * mopo is free software: you can redistribute it and/or modify\n"
+      " * it under the terms of the GNU General Public License as published by\n"
+      " * the Free Software Foundation, either version 3 of the License, or\n"
+      " * (at your option) any later version.\n"
+      " *\n"
+      " * mopo is distributed in the hope that it will be useful,\n"
+      " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+      " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+      " * GNU General Public License for more details.\n"
+      " *\n"
+      " * You should have received a copy of the GNU General Public License\n"
+      " * along with mopo.  If not, see <http://www.gnu.org/licenses/>.\n"
+      " */\n";
+
+  // 17 significant digits round trip a double exactly.
+  bool writeTable(const std::string& directory, const std::string& name,
+                  const std::string& definition, const std::string& size,
+                  const std::vector<mopo_float>& values) {
+    std::string path = directory + "/" + name + ".cpp";
+    FILE* file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+      fprintf(stderr, "Couldn't write %s\n", path.c_str());
+      return false;
+    }
+
+    fprintf(file, "%s\n", LICENSE);
+    fprintf(file, "// Generated by tools/generate_lookups.cpp. Don't edit by hand.\n\n");
+    fprintf(file, "#include \"%s.h\"\n\n", name.c_str());
+    fprintf(file, "namespace mopo {\n\n");
+    fprintf(file, "  const mopo_float %s[%s] = {\n", definition.c_str(), size.c_str());
+
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i % VALUES_PER_LINE == 0)
+        fprintf(file, "    ");
+
+      fprintf(file, "%.17g,", values[i]);
+
+      if (i % VALUES_PER_LINE == VALUES_PER_LINE - 1 || i == values.size() - 1)
+        fprintf(file, "\n");
+      else
+        fprintf(file, " ");
+    }
+
+    fprintf(file, "  };\n");
+    fprintf(file, "} // namespace mopo\n");
+    fclose(file);
+    return true;
+  }
+
+  std::vector<mopo_float> magnitudeTable() {
+    std::vector<mopo_float> values(MAGNITUDE_LOOKUP_RESOLUTION + 2);
+    for (int i = 0; i < MAGNITUDE_LOOKUP_RESOLUTION + 2; ++i) {
+      mopo_float t = (1.0 * i) / MAGNITUDE_LOOKUP_RESOLUTION;
+      mopo_float decibels = utils::interpolate(MIN_DB_LOOKUP, MAX_DB_LOOKUP, t);
+      values[i] = utils::dbToGain(decibels);
+    }
+    return values;
+  }
+
+  std::vector<mopo_float> midiTable() {
+    std::vector<mopo_float> values(MAX_CENTS + 2);
+    for (int i = 0; i < MAX_CENTS + 2; ++i)
+      values[i] = utils::midiCentsToFrequency(i);
+    return values;
+  }
+
+  std::vector<mopo_float> resonanceTable() {
+    std::vector<mopo_float> values(Q_RESOLUTION + 2);
+    for (int i = 0; i < Q_RESOLUTION + 2; ++i)
+      values[i] = utils::magnitudeToQ((1.0 * i) / Q_RESOLUTION);
+    return values;
+  }
+
+  std::vector<mopo_float> sampleDecayTable() {
+    std::vector<mopo_float> values(SAMPLE_DECAY_LOOKUP_RESOLUTION + 3);
+    for (int i = 0; i < SAMPLE_DECAY_LOOKUP_RESOLUTION + 3; ++i) {
+      mopo_float percent = (1.0 * i) / SAMPLE_DECAY_LOOKUP_RESOLUTION;
+      values[i] = pow(CLOSE_ENOUGH, percent);
+    }
+    return values;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <mopo source directory>\n", argv[0]);
+    return 1;
+  }
+
+  std::string directory = argv[1];
+  bool success = writeTable(directory, "magnitude_lookup", "MagnitudeLookup::lookup_",
+                            "MAGNITUDE_LOOKUP_RESOLUTION + 2", magnitudeTable()) &&
+                 writeTable(directory, "midi_lookup", "MidiLookup::lookup_",
+                            "MAX_CENTS + 2", midiTable()) &&
+                 writeTable(directory, "resonance_lookup", "ResonanceLookup::lookup_",
+                            "Q_RESOLUTION + 2", resonanceTable()) &&
+                 writeTable(directory, "sample_decay_lookup", "SampleDecayLookup::lookup_",
+                            "SAMPLE_DECAY_LOOKUP_RESOLUTION + 3", sampleDecayTable());
+  return success ? 0 : 1;
+}
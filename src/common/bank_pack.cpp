@@ -0,0 +1,371 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bank_pack.h"
+
+#include "helm_common.h"
+#include "load_save.h"
+
+#include <cstring>
+#include <limits>
+#include <map>
+#include <vector>
+
+#define PACK_MAGIC 0x4b415048
+#define PACK_VERSION 1
+#define RECORD_ALIGNMENT 8
+
+// All values are stored little endian.
+struct BankPack::Entry {
+  uint32 path;
+  uint32 patch_name;
+  uint32 folder_name;
+  uint32 author;
+  uint32 license;
+  uint32 synth_version;
+  uint32 record_offset;
+  uint32 num_controls;
+  uint32 num_modulations;
+  uint32 reserved;
+};
+
+namespace {
+  struct Header {
+    uint32 magic;
+    uint32 version;
+    uint32 num_patches;
+    uint32 index_offset;
+    uint32 strings_offset;
+    uint32 strings_size;
+  };
+
+  // A patch record is its controls followed by its modulations.
+  struct Control {
+    uint32 name;
+    uint32 reserved;
+    double value;
+  };
+
+  struct Modulation {
+    uint32 source;
+    uint32 destination;
+    double amount;
+  };
+
+  static_assert(sizeof(Header) == 24, "Bank pack header must be packed.");
+  static_assert(sizeof(Control) == 16 && sizeof(Modulation) == 16,
+                "Bank pack records must be packed.");
+
+  uint32 read(uint32 value) {
+    return ByteOrder::swapIfBigEndian(value);
+  }
+
+  double read(double value) {
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bits = ByteOrder::swapIfBigEndian(bits);
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // Each string is stored once as a length, the UTF-8 bytes and a
+  // terminator, padded to four bytes.
+  class StringTable {
+    public:
+      uint32 add(const String& string) {
+        auto found = offsets_.find(string);
+        if (found != offsets_.end())
+          return found->second;
+
+        uint32 offset = static_cast<uint32>(data_.getDataSize());
+        size_t length = string.getNumBytesAsUTF8();
+        data_.writeInt(static_cast<int>(length));
+        data_.write(string.toRawUTF8(), length);
+        data_.writeRepeatedByte(0, 4 - (length % 4));
+
+        offsets_[string] = offset;
+        return offset;
+      }
+
+      const MemoryOutputStream& getData() const { return data_; }
+
+    private:
+      std::map<String, uint32> offsets_;
+      MemoryOutputStream data_;
+  };
+
+  bool isNumber(const var& value) {
+    return value.isDouble() || value.isInt() || value.isInt64() || value.isBool();
+  }
+} // namespace
+
+BankPack::BankPack(const File& file) : data_(nullptr), size_(0), num_patches_(0),
+                                       strings_offset_(0), strings_size_(0) {
+  mapped_file_ = new MemoryMappedFile(file, MemoryMappedFile::readOnly);
+  data_ = static_cast<const char*>(mapped_file_->getData());
+  size_ = mapped_file_->getSize();
+
+  if (data_ == nullptr || !validate()) {
+    mapped_file_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+    num_patches_ = 0;
+  }
+}
+
+BankPack::~BankPack() { }
+
+bool BankPack::validate() {
+  if (size_ < sizeof(Header))
+    return false;
+
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  if (read(header->magic) != PACK_MAGIC || read(header->version) != PACK_VERSION)
+    return false;
+
+  uint64 num_patches = read(header->num_patches);
+  uint64 index_offset = read(header->index_offset);
+  uint64 strings_offset = read(header->strings_offset);
+  uint64 strings_size = read(header->strings_size);
+  if (index_offset % sizeof(uint32) || index_offset + num_patches * sizeof(Entry) > size_)
+    return false;
+  if (strings_offset % sizeof(uint32) || strings_offset + strings_size > size_)
+    return false;
+
+  const Entry* entries = reinterpret_cast<const Entry*>(data_ + index_offset);
+  for (uint64 i = 0; i < num_patches; ++i) {
+    uint64 record_offset = read(entries[i].record_offset);
+    uint64 num_records = uint64(read(entries[i].num_controls)) + read(entries[i].num_modulations);
+    if (record_offset % RECORD_ALIGNMENT || record_offset + num_records * sizeof(Control) > size_)
+      return false;
+  }
+
+  num_patches_ = static_cast<int>(num_patches);
+  strings_offset_ = static_cast<uint32>(strings_offset);
+  strings_size_ = static_cast<uint32>(strings_size);
+  return true;
+}
+
+const BankPack::Entry* BankPack::getEntry(int index) const {
+  if (index < 0 || index >= num_patches_)
+    return nullptr;
+
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  return reinterpret_cast<const Entry*>(data_ + read(header->index_offset)) + index;
+}
+
+String BankPack::getString(uint32 offset) const {
+  if (uint64(offset) + sizeof(uint32) > strings_size_)
+    return String();
+
+  const char* string = data_ + strings_offset_ + offset;
+  uint32 length = read(*reinterpret_cast<const uint32*>(string));
+  if (uint64(offset) + sizeof(uint32) + length > strings_size_)
+    return String();
+  return String::fromUTF8(string + sizeof(uint32), length);
+}
+
+String BankPack::getPath(int index) const {
+  const Entry* entry = getEntry(index);
+  return entry ? getString(read(entry->path)) : String();
+}
+
+String BankPack::getPatchName(int index) const {
+  return getPath(index).fromLastOccurrenceOf("/", false, false).upToLastOccurrenceOf(".", false, false);
+}
+
+String BankPack::getFolderName(int index) const {
+  return getPath(index).upToLastOccurrenceOf("/", false, false).fromLastOccurrenceOf("/", false, false);
+}
+
+String BankPack::getAuthor(int index) const {
+  const Entry* entry = getEntry(index);
+  return entry ? getString(read(entry->author)) : String();
+}
+
+var BankPack::getPatchState(int index) const {
+  const Entry* entry = getEntry(index);
+  if (entry == nullptr)
+    return var();
+
+  uint32 num_controls = read(entry->num_controls);
+  uint32 num_modulations = read(entry->num_modulations);
+  const Control* controls = reinterpret_cast<const Control*>(data_ + read(entry->record_offset));
+  const Modulation* modulations = reinterpret_cast<const Modulation*>(controls + num_controls);
+
+  DynamicObject* settings_object = new DynamicObject();
+  for (uint32 i = 0; i < num_controls; ++i) {
+    String name = getString(read(controls[i].name));
+    if (name.isNotEmpty())
+      settings_object->setProperty(name, read(controls[i].value));
+  }
+
+  Array<var> modulation_states;
+  for (uint32 i = 0; i < num_modulations; ++i) {
+    DynamicObject* mod_object = new DynamicObject();
+    mod_object->setProperty("source", getString(read(modulations[i].source)));
+    mod_object->setProperty("destination", getString(read(modulations[i].destination)));
+    mod_object->setProperty("amount", read(modulations[i].amount));
+    modulation_states.add(mod_object);
+  }
+  settings_object->setProperty("modulations", modulation_states);
+
+  // Patches from before 0.4.1 kept their settings and details at the top level.
+  String version = getString(read(entry->synth_version));
+  if (version.isEmpty()) {
+    String author = getString(read(entry->author));
+    String license = getString(read(entry->license));
+    if (author.isNotEmpty())
+      settings_object->setProperty("author", author);
+    if (license.isNotEmpty())
+      settings_object->setProperty("license", license);
+    return settings_object;
+  }
+
+  DynamicObject* state_object = new DynamicObject();
+  state_object->setProperty("license", getString(read(entry->license)));
+  state_object->setProperty("synth_version", version);
+  state_object->setProperty("patch_name", getString(read(entry->patch_name)));
+  state_object->setProperty("folder_name", getString(read(entry->folder_name)));
+  state_object->setProperty("author", getString(read(entry->author)));
+  state_object->setProperty("settings", settings_object);
+  return state_object;
+}
+
+bool BankPack::extractTo(const File& directory) const {
+  if (!isValid())
+    return false;
+
+  bool success = true;
+  for (int i = 0; i < num_patches_; ++i) {
+    File patch = directory.getChildFile(getPath(i));
+    if (!patch.isAChildOf(directory) || !patch.hasFileExtension(String(mopo::PATCH_EXTENSION))) {
+      success = false;
+      continue;
+    }
+
+    success = patch.getParentDirectory().createDirectory().wasOk() &&
+              patch.replaceWithText(JSON::toString(getPatchState(i))) && success;
+  }
+  return success;
+}
+
+bool BankPack::create(const File& bank, const File& destination) {
+  static const FileSorterAscending file_sorter;
+
+  Array<File> patches;
+  bank.findChildFiles(patches, File::findFiles, true, String("*.") + mopo::PATCH_EXTENSION);
+  patches.sort(file_sorter);
+
+  File root = bank.getParentDirectory();
+  StringTable strings;
+  std::vector<Entry> entries;
+  std::vector<Control> controls;
+  std::vector<Modulation> modulations;
+  MemoryOutputStream records;
+
+  for (File patch : patches) {
+    var state;
+    if (!JSON::parse(patch.loadFileAsString(), state).wasOk() || !state.isObject())
+      continue;
+
+    DynamicObject* object = state.getDynamicObject();
+    bool legacy = !object->hasProperty("synth_version");
+    var settings = legacy ? state : object->getProperty("settings");
+    if (!settings.isObject())
+      continue;
+
+    controls.clear();
+    modulations.clear();
+    NamedValueSet& properties = settings.getDynamicObject()->getProperties();
+    for (int i = 0; i < properties.size(); ++i) {
+      const var& value = properties.getValueAt(i);
+      if (isNumber(value))
+        controls.push_back({ strings.add(properties.getName(i).toString()), 0, value });
+    }
+
+    Array<var>* modulation_states = settings["modulations"].getArray();
+    if (modulation_states) {
+      for (const var& modulation : *modulation_states) {
+        if (!modulation.isObject())
+          continue;
+
+        modulations.push_back({ strings.add(modulation["source"].toString()),
+                                strings.add(modulation["destination"].toString()),
+                                modulation["amount"] });
+      }
+    }
+
+    Entry entry;
+    String path = patch.getRelativePathFrom(root).replaceCharacter('\\', '/');
+    entry.path = strings.add(path);
+    entry.patch_name = strings.add(legacy ? String() : object->getProperty("patch_name").toString());
+    entry.folder_name = strings.add(legacy ? String() : object->getProperty("folder_name").toString());
+    entry.author = strings.add(LoadSave::getAuthor(state));
+    entry.license = strings.add(LoadSave::getLicense(state));
+    entry.synth_version = strings.add(legacy ? String() : object->getProperty("synth_version").toString());
+    entry.record_offset = static_cast<uint32>(records.getDataSize());
+    entry.num_controls = static_cast<uint32>(controls.size());
+    entry.num_modulations = static_cast<uint32>(modulations.size());
+    entry.reserved = 0;
+    entries.push_back(entry);
+
+    for (const Control& control : controls) {
+      records.writeInt(static_cast<int>(control.name));
+      records.writeInt(0);
+      records.writeDouble(control.value);
+    }
+    for (const Modulation& modulation : modulations) {
+      records.writeInt(static_cast<int>(modulation.source));
+      records.writeInt(static_cast<int>(modulation.destination));
+      records.writeDouble(modulation.amount);
+    }
+  }
+
+  uint64 index_offset = sizeof(Header);
+  uint64 records_offset = index_offset + entries.size() * sizeof(Entry);
+  records_offset += (RECORD_ALIGNMENT - records_offset % RECORD_ALIGNMENT) % RECORD_ALIGNMENT;
+  uint64 strings_offset = records_offset + records.getDataSize();
+  uint64 strings_size = strings.getData().getDataSize();
+  if (strings_offset + strings_size > std::numeric_limits<uint32>::max())
+    return false;
+
+  MemoryOutputStream output;
+  output.writeInt(PACK_MAGIC);
+  output.writeInt(PACK_VERSION);
+  output.writeInt(static_cast<int>(entries.size()));
+  output.writeInt(static_cast<int>(index_offset));
+  output.writeInt(static_cast<int>(strings_offset));
+  output.writeInt(static_cast<int>(strings_size));
+
+  for (const Entry& entry : entries) {
+    output.writeInt(static_cast<int>(entry.path));
+    output.writeInt(static_cast<int>(entry.patch_name));
+    output.writeInt(static_cast<int>(entry.folder_name));
+    output.writeInt(static_cast<int>(entry.author));
+    output.writeInt(static_cast<int>(entry.license));
+    output.writeInt(static_cast<int>(entry.synth_version));
+    output.writeInt(static_cast<int>(records_offset + entry.record_offset));
+    output.writeInt(static_cast<int>(entry.num_controls));
+    output.writeInt(static_cast<int>(entry.num_modulations));
+    output.writeInt(0);
+  }
+
+  output.writeRepeatedByte(0, records_offset - output.getDataSize());
+  output << records;
+  output << strings.getData();
+  return destination.replaceWithData(output.getData(), output.getDataSize());
+}
@@ -0,0 +1,73 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BANK_PACK_H
+#define BANK_PACK_H
+
+#include "JuceHeader.h"
+
+// A whole bank in one file, read through a memory map. The file starts with
+// an index of fixed size entries, one per patch, followed by the binary patch
+// records and a shared string table. Browsing only touches the index and
+// strings, and loading a patch reads its record without opening any other
+// file. Packs convert losslessly to and from the folder layout.
+class BankPack {
+  public:
+    BankPack(const File& file);
+    ~BankPack();
+
+    // False if the file is missing, isn't a pack or is damaged.
+    bool isValid() const { return mapped_file_ != nullptr; }
+
+    int getNumPatches() const { return num_patches_; }
+
+    // Path of the patch relative to the banks directory, e.g.
+    // "Bank/Folder/Patch.helm".
+    String getPath(int index) const;
+
+    // Named by the path like loose patch files are, not by the saved state.
+    String getPatchName(int index) const;
+    String getFolderName(int index) const;
+    String getAuthor(int index) const;
+
+    // Rebuilds the patch as it was in its .helm file.
+    var getPatchState(int index) const;
+
+    // Writes every patch back out as a .helm file under _directory_.
+    bool extractTo(const File& directory) const;
+
+    // Packs every patch under _bank_. Paths are stored relative to the
+    // directory holding the bank so extracting recreates the bank folder.
+    static bool create(const File& bank, const File& destination);
+
+  private:
+    struct Entry;
+
+    const Entry* getEntry(int index) const;
+    String getString(uint32 offset) const;
+    bool validate();
+
+    ScopedPointer<MemoryMappedFile> mapped_file_;
+    const char* data_;
+    size_t size_;
+    int num_patches_;
+    uint32 strings_offset_;
+    uint32 strings_size_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BankPack)
+};
+
+#endif  // BANK_PACK_H
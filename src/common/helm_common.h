@@ -28,6 +28,7 @@
 namespace mopo {
 
   struct ModulationConnection;
+  class Wavetable;
 
   struct ValueDetails {
     enum DisplaySkew {
@@ -173,7 +174,7 @@ namespace mopo {
   const int NUM_CHANNELS = 2;
   const int MEMORY_SAMPLE_RATE = 22000;
   const int MEMORY_RESOLUTION = 512;
-  const mopo_float STUTTER_MAX_SAMPLES = 96000.0;
+  const mopo_float STUTTER_MAX_PERIOD = 2.0;
   const int DEFAULT_MODULATION_CONNECTIONS = 256;
   const int DEFAULT_WINDOW_WIDTH = 992;
   const int DEFAULT_WINDOW_HEIGHT = 734;
@@ -184,10 +185,13 @@ namespace mopo {
   const wchar_t DEFAULT_KEYBOARD_OCTAVE_DOWN = 'z';
 
   const std::string PATCH_EXTENSION = "helm";
+  const std::string BANK_PACK_EXTENSION = "helmpack";
 
   typedef std::map<std::string, Value*> control_map;
   typedef std::pair<Value*, mopo_float> control_change;
   typedef std::pair<ModulationConnection*, mopo_float> modulation_change;
+  typedef std::pair<const Output*, bool> readout_change;
+  typedef std::pair<int, const Wavetable*> wavetable_change;
   typedef std::map<std::string, Processor*> input_map;
   typedef std::map<std::string, Output*> output_map;
 
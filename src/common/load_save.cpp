@@ -16,6 +16,7 @@
 
 #include "load_save.h"
 #include "JuceHeader.h"
+#include "bank_pack.h"
 #include "helm_common.h"
 #include "midi_manager.h"
 #include "synth_base.h"
@@ -26,6 +27,8 @@
 #define EXPORTED_BANK_EXTENSION "helmbank"
 #define DID_PAY_FILE "thank_you.txt"
 #define PAY_WAIT_DAYS 4
+#define CONFIG_FLUSH_MS 500
+#define CONFIG_CHECK_MS 1000
 
 namespace {
 
@@ -351,6 +354,151 @@ String LoadSave::getLicense(var state) {
   return "";
 }
 
+ConfigCache::ConfigCache() : Thread("Helm Config"), file_(LoadSave::getConfigFile()),
+                             last_checked_(0), loaded_(false), dirty_(false) { }
+
+ConfigCache::~ConfigCache() {
+  stopThread(4 * CONFIG_FLUSH_MS);
+  flush();
+}
+
+var ConfigCache::getConfig() {
+  ScopedLock lock(lock_);
+  reloadIfChanged();
+  return config_.clone();
+}
+
+void ConfigCache::setConfig(var config) {
+  ScopedLock lock(lock_);
+  recordChanges(config);
+  config_ = config.clone();
+  dirty_ = true;
+
+  if (!isThreadRunning())
+    startThread();
+}
+
+void ConfigCache::run() {
+  while (!threadShouldExit()) {
+    wait(CONFIG_FLUSH_MS);
+    flush();
+  }
+}
+
+void ConfigCache::applyChanges(var& config, const NamedValueSet& changes) {
+  if (changes.size() == 0)
+    return;
+
+  if (!config.isObject())
+    config = new DynamicObject();
+
+  DynamicObject* config_object = config.getDynamicObject();
+  for (int i = 0; i < changes.size(); ++i) {
+    const var& value = changes.getValueAt(i);
+    if (value.isUndefined())
+      config_object->removeProperty(changes.getName(i));
+    else
+      config_object->setProperty(changes.getName(i), value);
+  }
+}
+
+// Only keys whose values differ from the cached config count as changed, so
+// a write doesn't undo what other processes saved to the other keys.
+void ConfigCache::recordChanges(const var& config) {
+  DynamicObject* old_object = config_.getDynamicObject();
+  DynamicObject* new_object = config.getDynamicObject();
+
+  if (old_object) {
+    NamedValueSet& old_properties = old_object->getProperties();
+    for (int i = 0; i < old_properties.size(); ++i) {
+      Identifier name = old_properties.getName(i);
+      if (new_object == nullptr || !new_object->hasProperty(name))
+        changes_.set(name, var::undefined());
+    }
+  }
+
+  if (new_object == nullptr)
+    return;
+
+  NamedValueSet& new_properties = new_object->getProperties();
+  for (int i = 0; i < new_properties.size(); ++i) {
+    Identifier name = new_properties.getName(i);
+    const var& value = new_properties.getValueAt(i);
+    if (old_object == nullptr || !old_object->hasProperty(name) ||
+        JSON::toString(old_object->getProperty(name)) != JSON::toString(value)) {
+      changes_.set(name, value.clone());
+    }
+  }
+}
+
+// Changes that aren't written yet win over changes from other processes.
+// The file is checked at most once every CONFIG_CHECK_MS.
+void ConfigCache::reloadIfChanged() {
+  uint32 now = Time::getMillisecondCounter();
+  if (loaded_ && now - last_checked_ < CONFIG_CHECK_MS)
+    return;
+
+  last_checked_ = now;
+  Time last_modified = file_.getLastModificationTime();
+  if (loaded_ && last_modified == last_modified_)
+    return;
+
+  var config;
+  if (!JSON::parse(file_.loadFileAsString(), config).wasOk() || !config.isObject())
+    config = var();
+
+  applyChanges(config, changes_);
+  config_ = config;
+  last_modified_ = last_modified;
+  loaded_ = true;
+}
+
+// Puts back changes a failed write took so the next flush retries them.
+// Anything set since the write started is newer and stays.
+void ConfigCache::restoreChanges(const NamedValueSet& changes) {
+  ScopedLock lock(lock_);
+  for (int i = 0; i < changes.size(); ++i) {
+    Identifier name = changes.getName(i);
+    if (!changes_.contains(name))
+      changes_.set(name, changes.getValueAt(i));
+  }
+  dirty_ = true;
+}
+
+// Merges this process's changes into the file as it is now and swaps the
+// result in with a rename, so other processes never read a partial file.
+void ConfigCache::flush() {
+  NamedValueSet changes;
+  {
+    ScopedLock lock(lock_);
+    if (!dirty_)
+      return;
+
+    changes = std::move(changes_);
+    changes_.clear();
+    dirty_ = false;
+  }
+
+  var config;
+  if (!JSON::parse(file_.loadFileAsString(), config).wasOk() || !config.isObject())
+    config = var();
+  applyChanges(config, changes);
+
+  file_.getParentDirectory().createDirectory();
+  TemporaryFile temp_file(file_);
+  if (!temp_file.getFile().replaceWithText(JSON::toString(config)) ||
+      !temp_file.overwriteTargetFileWithTemporary()) {
+    restoreChanges(changes);
+    return;
+  }
+
+  ScopedLock lock(lock_);
+  applyChanges(config, changes_);
+  config_ = config;
+  last_modified_ = file_.getLastModificationTime();
+  loaded_ = true;
+}
+
 File LoadSave::getConfigFile() {
   PropertiesFile::Options config_options;
   config_options.applicationName = "Helm";
@@ -367,27 +515,16 @@ File LoadSave::getConfigFile() {
 }
 
 var LoadSave::getConfigVar() {
-  File config_file = getConfigFile();
-
-  var config_state;
-  if (!JSON::parse(config_file.loadFileAsString(), config_state).wasOk())
-    return var();
-
-  if (!config_state.isObject())
-    return var();
-
-  return config_state;
+  SharedResourcePointer<ConfigCache> config_cache;
+  return config_cache->getConfig();
 }
 
 void LoadSave::saveVarToConfig(var config_state) {
   if (!isInstalled())
     return;
 
-  File config_file = getConfigFile();
-
-  if (!config_file.exists())
-    config_file.create();
-  config_file.replaceWithText(JSON::toString(config_state));
+  SharedResourcePointer<ConfigCache> config_cache;
+  config_cache->setConfig(config_state);
 }
 
 void LoadSave::saveVersionConfig() {
@@ -440,6 +577,36 @@ void LoadSave::saveAnimateWidgets(bool animate_widgets) {
   saveVarToConfig(config_object);
 }
 
+void LoadSave::saveNoteRenderCaching(bool cache_note_renders) {
+  var config_var = getConfigVar();
+  if (!config_var.isObject())
+    config_var = new DynamicObject();
+
+  DynamicObject* config_object = config_var.getDynamicObject();
+  config_object->setProperty("cache_note_renders", cache_note_renders);
+  saveVarToConfig(config_object);
+}
+
+void LoadSave::saveDistortionOversampling(int oversampling) {
+  var config_var = getConfigVar();
+  if (!config_var.isObject())
+    config_var = new DynamicObject();
+
+  DynamicObject* config_object = config_var.getDynamicObject();
+  config_object->setProperty("distortion_oversampling", oversampling);
+  saveVarToConfig(config_object);
+}
+
+void LoadSave::saveVoiceDetailReduction(bool reduce_voice_detail) {
+  var config_var = getConfigVar();
+  if (!config_var.isObject())
+    config_var = new DynamicObject();
+
+  DynamicObject* config_object = config_var.getDynamicObject();
+  config_object->setProperty("reduce_voice_detail", reduce_voice_detail);
+  saveVarToConfig(config_object);
+}
+
 void LoadSave::saveWindowSize(float window_size) {
   var config_var = getConfigVar();
   if (!config_var.isObject())
@@ -607,6 +774,42 @@ bool LoadSave::shouldAnimateWidgets() {
   return config_object->getProperty("animate_widgets");
 }
 
+bool LoadSave::shouldCacheNoteRenders() {
+  var config_state = getConfigVar();
+  DynamicObject* config_object = config_state.getDynamicObject();
+  if (!config_state.isObject())
+    return false;
+
+  if (!config_object->hasProperty("cache_note_renders"))
+    return false;
+
+  return config_object->getProperty("cache_note_renders");
+}
+
+int LoadSave::loadDistortionOversampling() {
+  var config_state = getConfigVar();
+  DynamicObject* config_object = config_state.getDynamicObject();
+  if (!config_state.isObject())
+    return 1;
+
+  if (!config_object->hasProperty("distortion_oversampling"))
+    return 1;
+
+  return config_object->getProperty("distortion_oversampling");
+}
+
+bool LoadSave::shouldReduceVoiceDetail() {
+  var config_state = getConfigVar();
+  DynamicObject* config_object = config_state.getDynamicObject();
+  if (!config_state.isObject())
+    return false;
+
+  if (!config_object->hasProperty("reduce_voice_detail"))
+    return false;
+
+  return config_object->getProperty("reduce_voice_detail");
+}
+
 float LoadSave::loadWindowSize() {
   var config_state = getConfigVar();
   DynamicObject* config_object = config_state.getDynamicObject();
@@ -753,6 +956,18 @@ File LoadSave::getDidPayInitiallyFile() {
 void LoadSave::exportBank(String bank_name) {
   File banks_dir = getBankDirectory();
   File bank = banks_dir.getChildFile(bank_name);
+
+  String extensions = String("*.") + EXPORTED_BANK_EXTENSION + ";*." + mopo::BANK_PACK_EXTENSION;
+  FileChooser save_box("Export Bank As", File::getSpecialLocation(File::userHomeDirectory), extensions);
+  if (!save_box.browseForFileToSave(true))
+    return;
+
+  File result = save_box.getResult();
+  if (result.hasFileExtension(String(mopo::BANK_PACK_EXTENSION))) {
+    BankPack::create(bank, result);
+    return;
+  }
+
   Array<File> patches;
   bank.findChildFiles(patches, File::findFiles, true, String("*.") + mopo::PATCH_EXTENSION);
   ZipFile::Builder zip_builder;
@@ -760,20 +975,24 @@ void LoadSave::exportBank(String bank_name) {
   for (File patch : patches)
     zip_builder.addFile(patch, 2, patch.getRelativePathFrom(banks_dir));
 
-  FileChooser save_box("Export Bank As", File::getSpecialLocation(File::userHomeDirectory),
-                       String("*.") + EXPORTED_BANK_EXTENSION);
-  if (save_box.browseForFileToSave(true)) {
-    FileOutputStream out_stream(save_box.getResult().withFileExtension(EXPORTED_BANK_EXTENSION));
-    double *progress = nullptr;
-    zip_builder.writeToStream(out_stream, progress);
-  }
+  FileOutputStream out_stream(result.withFileExtension(EXPORTED_BANK_EXTENSION));
+  double *progress = nullptr;
+  zip_builder.writeToStream(out_stream, progress);
 }
 
 void LoadSave::importBank() {
-  FileChooser open_box("Import Bank", File::getSpecialLocation(File::userHomeDirectory),
-                       String("*.") + EXPORTED_BANK_EXTENSION);
-  if (open_box.browseForFileToOpen()) {
-    ZipFile zip_file(open_box.getResult());
+  String extensions = String("*.") + EXPORTED_BANK_EXTENSION + ";*." + mopo::BANK_PACK_EXTENSION;
+  FileChooser open_box("Import Bank", File::getSpecialLocation(File::userHomeDirectory), extensions);
+  if (!open_box.browseForFileToOpen())
+    return;
+
+  File result = open_box.getResult();
+  if (result.hasFileExtension(String(mopo::BANK_PACK_EXTENSION))) {
+    BankPack bank_pack(result);
+    bank_pack.extractTo(getBankDirectory());
+  }
+  else {
+    ZipFile zip_file(result);
     zip_file.uncompressTo(getBankDirectory());
   }
 }
@@ -891,6 +1110,16 @@ Array<File> LoadSave::getAllPatches() {
   return patches;
 }
 
+Array<File> LoadSave::getAllBankPacks() {
+  static const FileSorterAscending file_sorter;
+
+  Array<File> packs;
+  getBankDirectory().findChildFiles(packs, File::findFiles, false,
+                                    String("*.") + mopo::BANK_PACK_EXTENSION);
+  packs.sort(file_sorter);
+  return packs;
+}
+
 File LoadSave::loadPatch(int bank_index, int folder_index, int patch_index,
                          SynthBase* synth, std::map<std::string, String>& save_info) {
   File patch = getPatchFile(bank_index, folder_index, patch_index);
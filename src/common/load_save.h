@@ -43,6 +43,40 @@ public:
   }
 };
 
+// The config shared by every instance in the process. The file is read once
+// and again only when another process changes it. Saves update the memory
+// copy and are written to disk together on a background thread.
+class ConfigCache : private Thread {
+  public:
+    ConfigCache();
+    ~ConfigCache();
+
+    var getConfig();
+    void setConfig(var config);
+
+  private:
+    void run() override;
+    void reloadIfChanged();
+    void flush();
+    void restoreChanges(const NamedValueSet& changes);
+
+    static void applyChanges(var& config, const NamedValueSet& changes);
+    void recordChanges(const var& config);
+
+    CriticalSection lock_;
+    File file_;
+    var config_;
+
+    // Keys this process set since its last write, undefined where removed.
+    NamedValueSet changes_;
+    Time last_modified_;
+    uint32 last_checked_;
+    bool loaded_;
+    bool dirty_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ConfigCache)
+};
+
 class LoadSave {
   public:
     static var stateToVar(SynthBase* synth,
@@ -73,6 +107,9 @@ class LoadSave {
     static bool wasUpgraded();
     static bool shouldCheckForUpdates();
     static bool shouldAnimateWidgets();
+    static bool shouldCacheNoteRenders();
+    static int loadDistortionOversampling();
+    static bool shouldReduceVoiceDetail();
     static float loadWindowSize();
     static String loadVersion();
     static bool shouldAskForPayment();
@@ -84,6 +121,9 @@ class LoadSave {
     static void savePaid();
     static void saveUpdateCheckConfig(bool check_for_updates);
     static void saveAnimateWidgets(bool check_for_updates);
+    static void saveNoteRenderCaching(bool cache_note_renders);
+    static void saveDistortionOversampling(int oversampling);
+    static void saveVoiceDetailReduction(bool reduce_voice_detail);
     static void saveWindowSize(float window_size);
     static void saveMidiMapConfig(MidiManager* midi_manager);
     static void loadConfig(MidiManager* midi_manager, mopo::StringLayout* layout = nullptr);
@@ -102,6 +142,7 @@ class LoadSave {
     static int getNumPatches();
     static File getPatchFile(int bank_index, int folder_index, int patch_index);
     static Array<File> getAllPatches();
+    static Array<File> getAllBankPacks();
     static File loadPatch(int bank_index, int folder_index, int patch_index,
                           SynthBase* synth, std::map<std::string, String>& gui_state);
     static void loadPatchFile(File file, SynthBase* synth,
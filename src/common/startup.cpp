@@ -45,7 +45,26 @@ namespace {
   }
 } // namespace
 
-void Startup::doStartupChecks(MidiManager* midi_manager, mopo::StringLayout* layout) {
+bool StartupChecks::started_ = false;
+
+// SharedResourcePointer creates this under its own lock so only the first
+// one in the process starts the checks.
+StartupChecks::StartupChecks() : Thread("Helm Startup Checks") {
+  if (!started_) {
+    started_ = true;
+    startThread();
+  }
+}
+
+StartupChecks::~StartupChecks() {
+  waitForThreadToExit(-1);
+}
+
+void StartupChecks::run() {
+  Startup::doStartupChecks();
+}
+
+void Startup::doStartupChecks() {
   if (!LoadSave::isInstalled())
     return;
 
@@ -57,8 +76,6 @@ void Startup::doStartupChecks(MidiManager* midi_manager, mopo::StringLayout* lay
     LoadSave::saveVersionConfig();
     LoadSave::saveLastAskedForMoney();
   }
-  else
-    LoadSave::loadConfig(midi_manager, layout);
 }
 
 bool Startup::isFirstStartup() {
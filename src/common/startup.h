@@ -29,10 +29,24 @@ namespace mopo {
 
 class MidiManager;
 
+// Runs the startup checks once per process on a background thread so
+// creating an instance never waits on the disk.
+class StartupChecks : private Thread {
+  public:
+    StartupChecks();
+    ~StartupChecks();
+
+  private:
+    void run() override;
+
+    static bool started_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StartupChecks)
+};
+
 class Startup {
   public:
-    static void doStartupChecks(MidiManager* midi_manager,
-                                mopo::StringLayout* layout = nullptr);
+    static void doStartupChecks();
     static bool isFirstStartup();
     static void storeOldFactoryPatches();
     static void copyFactoryPatches();
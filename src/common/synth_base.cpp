@@ -17,13 +17,66 @@
 #include "synth_base.h"
 
 #include "load_save.h"
-#include "startup.h"
 #include "synth_gui_interface.h"
 #include "utils.h"
 
 #define OUTPUT_WINDOW_MIN_NOTE 16.0
+#define WAVETABLE_FRAME_SIZE 2048
+#define MAX_WAVETABLE_FRAMES 256
+#define HOUSEKEEPING_MS 20
+#define MAX_RETIRED_WAVETABLES 32
+#define MAX_RETIRED_VOICES (2 * mopo::MAX_POLYPHONY)
+
+namespace {
+  // Files that are a whole number of 2048 sample frames are read as multi
+  // frame tables, anything else is one cycle.
+  mopo::Wavetable* readWavetable(File file) {
+    AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+    ScopedPointer<AudioFormatReader> reader = format_manager.createReaderFor(file);
+    if (reader == nullptr)
+      return nullptr;
+
+    int length = std::min<int64>(reader->lengthInSamples,
+                                 WAVETABLE_FRAME_SIZE * MAX_WAVETABLE_FRAMES);
+    if (length <= 0)
+      return nullptr;
+
+    AudioSampleBuffer buffer(1, length);
+    reader->read(&buffer, 0, length, 0, true, false);
+
+    int frame_size = length;
+    if (length > WAVETABLE_FRAME_SIZE && length % WAVETABLE_FRAME_SIZE == 0)
+      frame_size = WAVETABLE_FRAME_SIZE;
+
+    std::vector<mopo::mopo_float> samples(buffer.getReadPointer(0),
+                                          buffer.getReadPointer(0) + length);
+    return new mopo::Wavetable(samples.data(), frame_size, length / frame_size);
+  }
+} // namespace
+
+SynthHousekeeping::SynthHousekeeping(SynthBase* synth) :
+    Thread("Helm Housekeeping"), synth_(synth) {
+  startThread();
+}
+
+SynthHousekeeping::~SynthHousekeeping() {
+  stopThread(-1);
+}
+
+void SynthHousekeeping::run() {
+  while (!threadShouldExit()) {
+    synth_->doHousekeeping();
+    wait(HOUSEKEEPING_MS);
+  }
+}
 
-SynthBase::SynthBase() {
+SynthBase::SynthBase() : built_voices_(mopo::MAX_POLYPHONY),
+                         retired_wavetables_(2 * MAX_RETIRED_WAVETABLES),
+                         retired_voices_(2 * MAX_RETIRED_VOICES),
+                         retired_wavetables_token_(retired_wavetables_),
+                         retired_voices_token_(retired_voices_),
+                         wavetable_pool_(1) {
   controls_ = engine_.getControls();
 
   keyboard_state_ = new MidiKeyboardState();
@@ -37,7 +90,31 @@ SynthBase::SynthBase() {
   memory_input_offset_ = 0;
   memory_index_ = 0;
 
-  Startup::doStartupChecks(midi_manager_);
+  LoadSave::loadConfig(midi_manager_);
+  engine_.setNoteRenderCaching(LoadSave::shouldCacheNoteRenders());
+  engine_.setVoiceDetailReduction(LoadSave::shouldReduceVoiceDetail());
+  engine_.setDistortionOversampling(LoadSave::loadDistortionOversampling());
+
+  housekeeping_ = new SynthHousekeeping(this);
+}
+
+SynthBase::~SynthBase() {
+  housekeeping_ = nullptr;
+
+  mopo::Voice* voice = nullptr;
+  while (built_voices_.try_dequeue(voice))
+    delete voice;
+  deleteRetiredVoices();
+
+  wavetable_pool_.removeAllJobs(false, -1);
+
+  mopo::wavetable_change change;
+  while (wavetable_change_queue_.try_dequeue(change))
+    delete change.second;
+
+  for (int i = 0; i < mopo::Wavetable::kNumSlots; ++i)
+    delete engine_.setWavetable(static_cast<mopo::Wavetable::Slot>(i), nullptr);
+  deleteRetiredWavetables();
 }
 
 void SynthBase::valueChanged(const std::string& name, mopo::mopo_float value) {
@@ -144,6 +221,29 @@ mopo::Output* SynthBase::getModSource(const std::string& name) {
   return engine_.getModulationSource(name);
 }
 
+void SynthBase::subscribeReadout(const mopo::Output* readout) {
+  if (readout == nullptr)
+    return;
+
+  readout_subscriptions_.insert(readout);
+  readout_change_queue_.enqueue(mopo::readout_change(readout, true));
+}
+
+void SynthBase::unsubscribeReadout(const mopo::Output* readout) {
+  auto found = readout_subscriptions_.find(readout);
+  if (found == readout_subscriptions_.end())
+    return;
+
+  readout_subscriptions_.erase(found);
+  readout_change_queue_.enqueue(mopo::readout_change(readout, false));
+}
+
+void SynthBase::clearReadoutSubscriptions() {
+  for (const mopo::Output* readout : readout_subscriptions_)
+    readout_change_queue_.enqueue(mopo::readout_change(readout, false));
+  readout_subscriptions_.clear();
+}
+
 var SynthBase::saveToVar(String author) {
   save_info_["author"] = author;
   return LoadSave::stateToVar(this, save_info_, getCriticalSection());
@@ -212,6 +312,40 @@ bool SynthBase::saveToFile(File patch) {
   return false;
 }
 
+void SynthBase::loadWavetable(mopo::Wavetable::Slot slot, File file) {
+  wavetable_pool_.addJob([this, slot, file]() {
+    mopo::Wavetable* wavetable = readWavetable(file);
+    if (wavetable)
+      wavetable_change_queue_.enqueue(mopo::wavetable_change(slot, wavetable));
+  });
+}
+
+void SynthBase::clearWavetable(mopo::Wavetable::Slot slot) {
+  wavetable_change_queue_.enqueue(mopo::wavetable_change(slot, nullptr));
+}
+
+void SynthBase::setNoteRenderCaching(bool caching) {
+  ScopedLock lock(getCriticalSection());
+  engine_.setNoteRenderCaching(caching);
+}
+
+void SynthBase::setVoiceDetailReduction(bool reduce) {
+  ScopedLock lock(getCriticalSection());
+  engine_.setVoiceDetailReduction(reduce);
+}
+
+void SynthBase::setDistortionOversampling(int oversampling) {
+  {
+    ScopedLock lock(getCriticalSection());
+    engine_.setDistortionOversampling(oversampling);
+  }
+  setLatencyNotifyHost(getOversamplingLatency());
+}
+
+int SynthBase::getOversamplingLatency() {
+  return engine_.getLatency();
+}
+
 bool SynthBase::saveToActiveFile() {
   if (!active_file_.exists() || !active_file_.hasWriteAccess())
     return false;
@@ -229,6 +363,21 @@ void SynthBase::processAudio(AudioSampleBuffer* buffer, int channels, int sample
 
   const mopo::mopo_float* engine_output_left = engine_.output(0)->buffer;
   const mopo::mopo_float* engine_output_right = engine_.output(1)->buffer;
+  if (channels == 2) {
+    float* left = buffer->getWritePointer(0, offset);
+    float* right = buffer->getWritePointer(1, offset);
+
+    VECTORIZE_LOOP
+    for (int i = 0; i < samples; ++i) {
+      left[i] = engine_output_left[i];
+      right[i] = engine_output_right[i];
+      MOPO_ASSERT(std::isfinite(engine_output_left[i]) && std::isfinite(engine_output_right[i]));
+    }
+
+    updateMemoryOutput(samples, engine_output_left, engine_output_right);
+    return;
+  }
+
   for (int channel = 0; channel < channels; ++channel) {
     float* channelData = buffer->getWritePointer(channel, offset);
     const mopo::mopo_float* synth_output = (channel % 2) ? engine_output_right : engine_output_left;
@@ -269,6 +418,11 @@ void SynthBase::processControlChanges() {
 }
 
 void SynthBase::processModulationChanges() {
+  // Leave the changes queued while a voice is being cloned from the graph.
+  ScopedTryLock lock(voice_build_lock_);
+  if (!lock.isLocked())
+    return;
+
   mopo::modulation_change change;
   while (getNextModulationChange(change)) {
     mopo::ModulationConnection* connection = change.first;
@@ -283,6 +437,64 @@ void SynthBase::processModulationChanges() {
   }
 }
 
+void SynthBase::processReadoutChanges() {
+  mopo::readout_change change;
+  while (getNextReadoutChange(change)) {
+    if (change.second)
+      engine_.subscribeReadout(change.first);
+    else
+      engine_.unsubscribeReadout(change.first);
+  }
+}
+
+// Changes wait in their queue while the retired tables haven't been freed
+// yet, so there's always room to retire the table a change replaces.
+void SynthBase::processWavetableChanges() {
+  mopo::wavetable_change change;
+  while (retired_wavetables_.size_approx() < MAX_RETIRED_WAVETABLES &&
+         wavetable_change_queue_.try_dequeue(change)) {
+    mopo::Wavetable::Slot slot = static_cast<mopo::Wavetable::Slot>(change.first);
+    const mopo::Wavetable* old_wavetable = engine_.setWavetable(slot, change.second);
+    if (old_wavetable && !retired_wavetables_.try_enqueue(retired_wavetables_token_, old_wavetable))
+      jassertfalse;
+  }
+}
+
+void SynthBase::deleteRetiredWavetables() {
+  const mopo::Wavetable* wavetable = nullptr;
+  while (retired_wavetables_.try_dequeue(wavetable))
+    delete wavetable;
+}
+
+void SynthBase::processVoiceChanges() {
+  mopo::Voice* voice = nullptr;
+  while (retired_voices_.size_approx() < MAX_RETIRED_VOICES && built_voices_.try_dequeue(voice)) {
+    if (!engine_.addVoice(voice) && !retired_voices_.try_enqueue(retired_voices_token_, voice))
+      jassertfalse;
+  }
+}
+
+// Voices still queued count towards the ones wanted. If a few too many get
+// built the audio thread turns them away.
+void SynthBase::buildVoices() {
+  ScopedLock lock(voice_build_lock_);
+  int num_voices = engine_.getNumVoicesWanted() - static_cast<int>(built_voices_.size_approx());
+  for (int i = 0; i < num_voices; ++i)
+    built_voices_.enqueue(engine_.createVoice());
+}
+
+void SynthBase::deleteRetiredVoices() {
+  mopo::Voice* voice = nullptr;
+  while (retired_voices_.try_dequeue(voice))
+    delete voice;
+}
+
+void SynthBase::doHousekeeping() {
+  deleteRetiredVoices();
+  buildVoices();
+  deleteRetiredWavetables();
+}
+
 void SynthBase::updateMemoryOutput(int samples, const mopo::mopo_float* left,
                                                 const mopo::mopo_float* right) {
   mopo::mopo_float last_played = std::max(engine_.getLastActiveNote(), OUTPUT_WINDOW_MIN_NOTE);
@@ -22,16 +22,34 @@
 
 #include "helm_common.h"
 #include "helm_engine.h"
+#include "load_save.h"
 #include "memory.h"
 #include "midi_manager.h"
+#include "startup.h"
 #include <string>
 
+class SynthBase;
 class SynthGuiInterface;
 
+// Builds the voices the audio thread wants and frees what it retires so it
+// never has to touch the heap.
+class SynthHousekeeping : private Thread {
+  public:
+    SynthHousekeeping(SynthBase* synth);
+    ~SynthHousekeeping();
+
+  private:
+    void run() override;
+
+    SynthBase* synth_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SynthHousekeeping)
+};
+
 class SynthBase : public MidiManager::Listener {
   public:
     SynthBase();
-    virtual ~SynthBase() { }
+    virtual ~SynthBase();
 
     void valueChanged(const std::string& name, mopo::mopo_float value);
     void valueChangedThroughMidi(const std::string& name, mopo::mopo_float value) override;
@@ -51,6 +69,12 @@ class SynthBase : public MidiManager::Listener {
   
     mopo::Output* getModSource(const std::string& name);
 
+    // The editor subscribes to the per voice readouts it shows so they cost
+    // nothing while it's closed. Subscriptions are counted.
+    void subscribeReadout(const mopo::Output* readout);
+    void unsubscribeReadout(const mopo::Output* readout);
+    void clearReadoutSubscriptions();
+
     void loadInitPatch();
     bool loadFromFile(File patch);
     bool exportToFile();
@@ -58,9 +82,23 @@ class SynthBase : public MidiManager::Listener {
     bool saveToActiveFile();
     File getActiveFile() { return active_file_; }
 
+    // Reads a single cycle or multi frame WAV file and builds its tables on a
+    // background thread. The audio thread swaps the table in when it's ready.
+    void loadWavetable(mopo::Wavetable::Slot slot, File file);
+    void clearWavetable(mopo::Wavetable::Slot slot);
+
+    void setNoteRenderCaching(bool caching);
+    void setVoiceDetailReduction(bool reduce);
+
+    // Changes the latency, which is reported to the host in samples.
+    void setDistortionOversampling(int oversampling);
+    int getDistortionOversampling() { return engine_.getDistortionOversampling(); }
+    int getOversamplingLatency();
+
     virtual void beginChangeGesture(const std::string& name) { }
     virtual void endChangeGesture(const std::string& name) { }
     virtual void setValueNotifyHost(const std::string& name, mopo::mopo_float value) { }
+    virtual void setLatencyNotifyHost(int samples) { }
 
     void armMidiLearn(const std::string& name);
     void cancelMidiLearn();
@@ -92,6 +130,8 @@ class SynthBase : public MidiManager::Listener {
     };
 
   protected:
+    friend class SynthHousekeeping;
+
     virtual const CriticalSection& getCriticalSection() = 0;
     virtual SynthGuiInterface* getGuiInterface() = 0;
     var saveToVar(String author);
@@ -107,14 +147,29 @@ class SynthBase : public MidiManager::Listener {
       return modulation_change_queue_.try_dequeue(change);
     }
 
+    inline bool getNextReadoutChange(mopo::readout_change& change) {
+      return readout_change_queue_.try_dequeue(change);
+    }
+
     void processAudio(AudioSampleBuffer* buffer, int channels, int samples, int offset);
     void processMidi(MidiBuffer& buffer, int start_sample = 0, int end_sample = 0);
     void processKeyboardEvents(MidiBuffer& buffer, int num_samples);
     void processControlChanges();
     void processModulationChanges();
+    void processReadoutChanges();
+    void processWavetableChanges();
+    void deleteRetiredWavetables();
+    void processVoiceChanges();
+    void buildVoices();
+    void deleteRetiredVoices();
+    void doHousekeeping();
     void updateMemoryOutput(int samples, const mopo::mopo_float* left,
                                          const mopo::mopo_float* right);
 
+    // Keeps the config in memory while any instance is alive.
+    SharedResourcePointer<ConfigCache> config_cache_;
+    SharedResourcePointer<StartupChecks> startup_checks_;
+
     mopo::ModulationConnectionBank modulation_bank_;
     mopo::HelmEngine engine_;
     ScopedPointer<MidiManager> midi_manager_;
@@ -132,8 +187,25 @@ class SynthBase : public MidiManager::Listener {
     std::map<std::string, String> save_info_;
     mopo::control_map controls_;
     std::set<mopo::ModulationConnection*> mod_connections_;
+    std::multiset<const mopo::Output*> readout_subscriptions_;
     moodycamel::ConcurrentQueue<mopo::control_change> value_change_queue_;
     moodycamel::ConcurrentQueue<mopo::modulation_change> modulation_change_queue_;
+    moodycamel::ConcurrentQueue<mopo::readout_change> readout_change_queue_;
+    moodycamel::ConcurrentQueue<mopo::wavetable_change> wavetable_change_queue_;
+    moodycamel::ConcurrentQueue<mopo::Voice*> built_voices_;
+
+    // Only the audio thread retires things. Its tokens are made up front and
+    // the queues preallocated so retiring never allocates.
+    moodycamel::ConcurrentQueue<const mopo::Wavetable*> retired_wavetables_;
+    moodycamel::ConcurrentQueue<mopo::Voice*> retired_voices_;
+    moodycamel::ProducerToken retired_wavetables_token_;
+    moodycamel::ProducerToken retired_voices_token_;
+    ThreadPool wavetable_pool_;
+
+    // Held while voices are cloned. The audio thread only tries it before
+    // changing the voice graph, changing the sample rate or buffer size takes it.
+    CriticalSection voice_build_lock_;
+    ScopedPointer<SynthHousekeeping> housekeeping_;
 };
 
 #endif // SYNTH_BASE_H
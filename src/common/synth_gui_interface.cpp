@@ -30,6 +30,10 @@ SynthGuiInterface::SynthGuiInterface(SynthBase* synth, bool use_gui) : synth_(sy
   }
 }
 
+SynthGuiInterface::~SynthGuiInterface() {
+  synth_->clearReadoutSubscriptions();
+}
+
 void SynthGuiInterface::updateFullGui() {
   if (gui_ == nullptr)
     return;
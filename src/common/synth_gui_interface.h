@@ -23,7 +23,7 @@
 class SynthGuiInterface {
   public:
     SynthGuiInterface(SynthBase* synth, bool use_gui = true);
-    virtual ~SynthGuiInterface() { }
+    virtual ~SynthGuiInterface();
 
     virtual AudioDeviceManager* getAudioDeviceManager() { return nullptr; }
 
@@ -0,0 +1,51 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "async_layer.h"
+
+AsyncLayer::AsyncLayer(Callback callback) :
+    callback_(callback), generation_(std::make_shared<std::atomic<int>>(0)) { }
+
+AsyncLayer::~AsyncLayer() {
+  // Outstanding jobs see this and never call back.
+  *generation_ = -1;
+}
+
+void AsyncLayer::paint(int width, int height, float scale, Painter painter) {
+  if (width <= 0 || height <= 0)
+    return;
+
+  int generation = ++(*generation_);
+  std::shared_ptr<std::atomic<int>> current = generation_;
+  Callback callback = callback_;
+
+  pool_->addJob([=]() {
+    if (*current != generation)
+      return;
+
+    Image image(Image::ARGB, scale * width, scale * height, true);
+    {
+      Graphics g(image);
+      g.addTransform(AffineTransform::scale(scale, scale));
+      painter(g);
+    }
+
+    MessageManager::callAsync([=]() {
+      if (*current == generation)
+        callback(image);
+    });
+  });
+}
@@ -0,0 +1,55 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef ASYNC_LAYER_H
+#define ASYNC_LAYER_H
+
+#include "JuceHeader.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+// Rasterizes a static image layer on a worker thread and hands the finished
+// image to a callback on the message thread. A request that is replaced
+// before it's done is dropped, so only the latest image ever arrives.
+class AsyncLayer {
+  public:
+    typedef std::function<void(Graphics&)> Painter;
+    typedef std::function<void(Image)> Callback;
+
+    AsyncLayer(Callback callback);
+    ~AsyncLayer();
+
+    // _painter_ draws a _width_ by _height_ area that is rasterized at
+    // _scale_. It runs on the worker so it may only use values it captured.
+    void paint(int width, int height, float scale, Painter painter);
+
+  private:
+    class Pool : public ThreadPool {
+      public:
+        Pool() : ThreadPool(1) { }
+    };
+
+    SharedResourcePointer<Pool> pool_;
+    Callback callback_;
+    std::shared_ptr<std::atomic<int>> generation_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AsyncLayer)
+};
+
+#endif // ASYNC_LAYER_H
@@ -19,18 +19,27 @@
 
 #define FRAMES_PER_SECOND 24
 
-BpmSlider::BpmSlider(String name) : SynthSlider(name) {
-  startTimerHz(FRAMES_PER_SECOND);
+BpmSlider::BpmSlider(String name) : SynthSlider(name) { }
+
+void BpmSlider::parentHierarchyChanged() {
+  FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
+  if (full_interface)
+    full_interface->getFrameScheduler().addClient(this, FRAMES_PER_SECOND);
+
+  SynthSlider::parentHierarchyChanged();
 }
 
-void BpmSlider::timerCallback() {
+bool BpmSlider::updateFrame() {
   SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
   if (parent == nullptr || parent->getAudioDeviceManager()) {
-    stopTimer();
-    return;
+    stopFrameUpdates();
+    return false;
   }
-  
+
   double bpm = parent->getControlValue(getName().toStdString());
-  if (getValue() != bpm)
-    setValue(bpm, NotificationType::dontSendNotification);
+  if (getValue() == bpm)
+    return false;
+
+  setValue(bpm, NotificationType::dontSendNotification);
+  return true;
 }
@@ -18,13 +18,15 @@
 #define BPM_SLIDER_H
 
 #include "JuceHeader.h"
+#include "frame_scheduler.h"
 #include "synth_slider.h"
 
-class BpmSlider : public SynthSlider, public Timer {
+class BpmSlider : public SynthSlider, public FrameScheduler::Client {
   public:
     BpmSlider(String name);
 
-    void timerCallback() override;
+    void parentHierarchyChanged() override;
+    bool updateFrame() override;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BpmSlider)
 };
@@ -28,7 +28,11 @@
 #define DELTA_SLOPE_REDRAW_THRESHOLD 0.01
 #define X_REDRAW_THRESHOLD 30
 
-FilterResponse::FilterResponse(int resolution) {
+FilterResponse::FilterResponse(int resolution) :
+    background_layer_([this](Image image) {
+      background_ = image;
+      repaint();
+    }) {
   resolution_ = resolution;
   cutoff_slider_ = nullptr;
   resonance_slider_ = nullptr;
@@ -49,22 +53,27 @@ FilterResponse::FilterResponse(int resolution) {
 
 FilterResponse::~FilterResponse() { }
 
-void FilterResponse::paintBackground(Graphics& g) {
+void FilterResponse::paintBackground(Graphics& g, int width, int height) {
   g.fillAll(Colour(0xff424242));
 
   g.setColour(Colour(0xff4a4a4a));
-  for (int x = 0; x < getWidth(); x += GRID_CELL_WIDTH)
-    g.drawLine(x, 0, x, getHeight());
-  for (int y = 0; y < getHeight(); y += GRID_CELL_WIDTH)
-    g.drawLine(0, y, getWidth(), y);
+  for (int x = 0; x < width; x += GRID_CELL_WIDTH)
+    g.drawLine(x, 0, x, height);
+  for (int y = 0; y < height; y += GRID_CELL_WIDTH)
+    g.drawLine(0, y, width, y);
 }
 
 void FilterResponse::paint(Graphics& g) {
   static const DropShadow shadow(Colour(0xbb000000), 5, Point<int>(0, 0));
 
-  g.drawImage(background_,
-              0, 0, getWidth(), getHeight(),
-              0, 0, background_.getWidth(), background_.getHeight());
+  // The grid is rasterized in the background, the last one is stretched until it's ready.
+  if (background_.isValid()) {
+    g.drawImage(background_,
+                0, 0, getWidth(), getHeight(),
+                0, 0, background_.getWidth(), background_.getHeight());
+  }
+  else
+    g.fillAll(Colour(0xff424242));
 
   shadow.drawForPath(g, filter_response_path_);
 
@@ -83,11 +92,11 @@ void FilterResponse::paint(Graphics& g) {
 
 void FilterResponse::resized() {
   const Desktop::Displays::Display& display = Desktop::getInstance().getDisplays().getMainDisplay();
-  float scale = display.scale;
-  background_ = Image(Image::RGB, scale * getWidth(), scale * getHeight(), true);
-  Graphics g(background_);
-  g.addTransform(AffineTransform::scale(scale, scale));
-  paintBackground(g);
+  int width = getWidth();
+  int height = getHeight();
+  background_layer_.paint(width, height, display.scale, [=](Graphics& g) {
+    paintBackground(g, width, height);
+  });
 
   computeFilterCoefficients();
   resetResponsePath();
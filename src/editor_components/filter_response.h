@@ -19,6 +19,7 @@
 #define FILTER_RESPONSE_H
 
 #include "JuceHeader.h"
+#include "async_layer.h"
 #include "helm_common.h"
 #include "biquad_filter.h"
 #include "state_variable_filter.h"
@@ -42,7 +43,7 @@ class FilterResponse : public Component, SynthSlider::SliderListener {
     void setStyle(mopo::StateVariableFilter::Styles style);
 
     void paint(Graphics& g) override;
-    void paintBackground(Graphics& g);
+    static void paintBackground(Graphics& g, int width, int height);
     void resized() override;
     void mouseDown(const MouseEvent& e) override;
     void mouseDrag(const MouseEvent& e) override;
@@ -66,6 +67,7 @@ class FilterResponse : public Component, SynthSlider::SliderListener {
     SynthSlider* resonance_slider_;
 
     Image background_;
+    AsyncLayer background_layer_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FilterResponse)
 };
@@ -0,0 +1,104 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "frame_scheduler.h"
+
+#include <algorithm>
+
+#define ACTIVE_FRAMES_PER_SECOND 60
+#define IDLE_FRAMES_PER_SECOND 10
+#define FRAMES_UNTIL_IDLE 30
+
+FrameScheduler::Client::~Client() {
+  if (scheduler_)
+    scheduler_->removeClient(this);
+}
+
+void FrameScheduler::Client::stopFrameUpdates() {
+  if (scheduler_)
+    scheduler_->removeClient(this);
+}
+
+FrameScheduler::FrameScheduler() : active_(true), fast_(true), idle_frames_(0) {
+  startTimerHz(ACTIVE_FRAMES_PER_SECOND);
+}
+
+FrameScheduler::~FrameScheduler() {
+  stopTimer();
+  for (Client* client : clients_)
+    client->scheduler_ = nullptr;
+}
+
+void FrameScheduler::addClient(Client* client, int frames_per_second) {
+  if (client->scheduler_ && client->scheduler_ != this)
+    client->scheduler_->removeClient(client);
+
+  if (client->scheduler_ == nullptr)
+    clients_.push_back(client);
+
+  client->scheduler_ = this;
+  client->frame_ms_ = 1000 / frames_per_second;
+  client->last_frame_ms_ = 0;
+  wake();
+}
+
+void FrameScheduler::removeClient(Client* client) {
+  auto position = std::find(clients_.begin(), clients_.end(), client);
+  if (position != clients_.end())
+    clients_.erase(position);
+  client->scheduler_ = nullptr;
+}
+
+void FrameScheduler::setActive(bool active) {
+  active_ = active;
+  if (active)
+    wake();
+  else if (fast_) {
+    fast_ = false;
+    startTimerHz(IDLE_FRAMES_PER_SECOND);
+  }
+}
+
+void FrameScheduler::wake() {
+  idle_frames_ = 0;
+  if (active_ && !fast_) {
+    fast_ = true;
+    startTimerHz(ACTIVE_FRAMES_PER_SECOND);
+  }
+}
+
+void FrameScheduler::timerCallback() {
+  static const uint32 tolerance = 500 / ACTIVE_FRAMES_PER_SECOND;
+  uint32 now = Time::getMillisecondCounter();
+  bool changed = false;
+
+  // Backwards so a client can remove itself from its own update.
+  for (int i = static_cast<int>(clients_.size()) - 1; i >= 0; --i) {
+    Client* client = clients_[i];
+    if (now - client->last_frame_ms_ + tolerance < client->frame_ms_)
+      continue;
+
+    client->last_frame_ms_ = now;
+    changed = client->updateFrame() || changed;
+  }
+
+  if (changed)
+    wake();
+  else if (fast_ && ++idle_frames_ >= FRAMES_UNTIL_IDLE) {
+    fast_ = false;
+    startTimerHz(IDLE_FRAMES_PER_SECOND);
+  }
+}
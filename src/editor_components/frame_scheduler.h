@@ -0,0 +1,75 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "JuceHeader.h"
+
+#include <vector>
+
+// Drives every animated part of the editor from one timer. Each client is
+// polled at its own rate and only repaints when its data changed. Once no
+// client has changed for a while, or the editor isn't active, the timer
+// slows down until something changes again.
+class FrameScheduler : private Timer {
+  public:
+    class Client {
+      public:
+        Client() : scheduler_(nullptr), frame_ms_(0), last_frame_ms_(0) { }
+        virtual ~Client();
+
+        // Checks for new data and repaints if there is any. Returns true if
+        // anything was repainted.
+        virtual bool updateFrame() = 0;
+
+      protected:
+        void stopFrameUpdates();
+
+      private:
+        friend class FrameScheduler;
+
+        FrameScheduler* scheduler_;
+        uint32 frame_ms_;
+        uint32 last_frame_ms_;
+    };
+
+    FrameScheduler();
+    ~FrameScheduler();
+
+    // Polls _client_ at most _frames_per_second_ times a second.
+    void addClient(Client* client, int frames_per_second);
+    void removeClient(Client* client);
+
+    // Inactive editors are only polled at the idle rate.
+    void setActive(bool active);
+
+    // Goes back to the full rate, e.g. after a client was changed from the UI.
+    void wake();
+
+  private:
+    void timerCallback() override;
+
+    std::vector<Client*> clients_;
+    bool active_;
+    bool fast_;
+    int idle_frames_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameScheduler)
+};
+
+#endif // FRAME_SCHEDULER_H
@@ -17,12 +17,9 @@
 #include "global_tool_tip.h"
 #include "fonts.h"
 
-#define FRAMES_PER_SECOND 20
-#define TIME_TO_STAY_VISIBLE 2000.0
+#define TIME_TO_STAY_VISIBLE 2000
 
 GlobalToolTip::GlobalToolTip() {
-  startTimerHz(FRAMES_PER_SECOND);
-  time_updated_ = 0;
   setInterceptsMouseClicks(false, false);
 }
 
@@ -44,18 +41,17 @@ void GlobalToolTip::paint(Graphics& g) {
 }
 
 void GlobalToolTip::setText(String parameter, String value) {
-  parameter_text_ = parameter;
-  value_text_ = value;
-  time_updated_ = Time::currentTimeMillis();
+  if (parameter_text_ != parameter || value_text_ != value) {
+    parameter_text_ = parameter;
+    value_text_ = value;
+    repaint();
+  }
+
   setVisible(true);
+  startTimer(TIME_TO_STAY_VISIBLE);
 }
 
 void GlobalToolTip::timerCallback() {
-  if (shown_parameter_text_ != parameter_text_ || shown_value_text_ != value_text_) {
-    shown_value_text_ = value_text_;
-    shown_parameter_text_ = parameter_text_;
-    repaint();
-  }
-  else if (isVisible() && Time::currentTimeMillis() - time_updated_ > TIME_TO_STAY_VISIBLE)
-    setVisible(false);
+  stopTimer();
+  setVisible(false);
 }
@@ -30,11 +30,8 @@ class GlobalToolTip  : public Component, public Timer {
     void paint(Graphics& g) override;
 
   private:
-    String shown_parameter_text_;
-    String shown_value_text_;
     String parameter_text_;
     String value_text_;
-    int64 time_updated_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GlobalToolTip)
 };
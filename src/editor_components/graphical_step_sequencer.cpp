@@ -127,14 +127,17 @@ void GraphicalStepSequencer::mouseDrag(const MouseEvent& e) {
   last_edit_position_ = e.getPosition();
 }
 
-void GraphicalStepSequencer::timerCallback() {
-  if (step_generator_output_) {
-    int new_step = step_generator_output_->buffer[0];
-    if (new_step != last_step_) {
-      last_step_ = new_step;
-      repaint();
-    }
-  }
+bool GraphicalStepSequencer::updateFrame() {
+  if (step_generator_output_ == nullptr)
+    return false;
+
+  int new_step = step_generator_output_->buffer[0];
+  if (new_step == last_step_)
+    return false;
+
+  last_step_ = new_step;
+  repaint();
+  return true;
 }
 
 void GraphicalStepSequencer::setStepSliders(std::vector<Slider*> sliders) {
@@ -235,13 +238,16 @@ void GraphicalStepSequencer::showRealtimeFeedback(bool show_feedback) {
   if (show_feedback) {
     if (step_generator_output_ == nullptr) {
       SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
-      startTimerHz(FRAMES_PER_SECOND);
       if (parent)
         step_generator_output_ = parent->getSynth()->getModSource(getName().toStdString());
+
+      FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
+      if (full_interface)
+        full_interface->getFrameScheduler().addClient(this, FRAMES_PER_SECOND);
     }
   }
   else {
-    stopTimer();
+    stopFrameUpdates();
     step_generator_output_ = nullptr;
     last_step_ = -1;
     repaint();
@@ -19,17 +19,18 @@
 #define GRAPHICAL_STEP_SEQUENCER_H
 
 #include "JuceHeader.h"
+#include "frame_scheduler.h"
 #include "mopo.h"
 #include "synth_slider.h"
 #include <vector>
 
-class GraphicalStepSequencer : public Component, public Timer, public Slider::Listener,
-                               public SynthSlider::SliderListener {
+class GraphicalStepSequencer : public Component, public FrameScheduler::Client,
+                               public Slider::Listener, public SynthSlider::SliderListener {
   public:
     GraphicalStepSequencer();
     ~GraphicalStepSequencer();
 
-    void timerCallback() override;
+    bool updateFrame() override;
     void setNumStepsSlider(SynthSlider* num_steps_slider);
     void setStepSliders(std::vector<Slider*> sliders);
     void sliderValueChanged(Slider* moved_slider) override;
@@ -27,3 +27,16 @@ void OpenGLComponent::setViewPort(OpenGLContext& open_gl_context) {
              scale * (top_level_bounds.getHeight() - global_bounds.getBottom()),
              scale * global_bounds.getWidth(), scale * global_bounds.getHeight());
 }
+
+bool OpenGLComponent::needsRender(bool animate) {
+  bool dirty = dirty_;
+  dirty_ = false;
+  return dirty;
+}
+
+void OpenGLComponent::invalidate() {
+  dirty_ = true;
+  FullInterface* parent = findParentComponentOfClass<FullInterface>();
+  if (parent)
+    parent->getFrameScheduler().wake();
+}
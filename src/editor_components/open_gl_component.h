@@ -22,11 +22,15 @@
 
 class OpenGLComponent : public Component {
   public:
-    OpenGLComponent() { }
+    OpenGLComponent() : dirty_(true) { }
     virtual ~OpenGLComponent() { }
 
     void paint(Graphics& g) override { }
 
+    // Checked on the message thread before each frame. Frames are only
+    // rendered when some component has something new to draw.
+    virtual bool needsRender(bool animate = true);
+
     virtual void init(OpenGLContext& open_gl_context) = 0;
     virtual void render(OpenGLContext& open_gl_context, bool animate = true) = 0;
     virtual void destroy(OpenGLContext& open_gl_context) = 0;
@@ -35,6 +39,12 @@ class OpenGLComponent : public Component {
   protected:
     void setViewPort(OpenGLContext& open_gl_context);
 
+    // Call when the component's drawing changed outside of its live data.
+    void invalidate();
+
+  private:
+    bool dirty_;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OpenGLComponent)
 };
 
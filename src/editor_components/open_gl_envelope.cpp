@@ -31,7 +31,12 @@ namespace {
 } // namespace
 
 
-OpenGLEnvelope::OpenGLEnvelope() {
+OpenGLEnvelope::OpenGLEnvelope() :
+    background_layer_([this](Image image) {
+      background_image_ = image;
+      background_.updateBackgroundImage(image);
+      invalidate();
+    }) {
   attack_hover_ = false;
   decay_hover_ = false;
   sustain_hover_ = false;
@@ -44,6 +49,8 @@ OpenGLEnvelope::OpenGLEnvelope() {
   release_slider_ = nullptr;
   envelope_amp_ = nullptr;
   envelope_phase_ = nullptr;
+  last_phase_ = 0.0;
+  last_amp_ = 0.0;
 
   position_vertices_ = new float[16] {
     0.0f, 1.0f, 0.0f, 1.0f,
@@ -66,76 +73,80 @@ OpenGLEnvelope::~OpenGLEnvelope() {
 void OpenGLEnvelope::paintBackground() {
   static const DropShadow shadow(Colour(0xbb000000), 5, Point<int>(0, 0));
 
-  if (getWidth() <= 0 || getHeight() <= 0)
+  int width = getWidth();
+  int height = getHeight();
+  if (width <= 0 || height <= 0)
     return;
 
-  float ratio = getHeight() / 100.0f;
+  float ratio = height / 100.0f;
 
   const Desktop::Displays::Display& display = Desktop::getInstance().getDisplays().getMainDisplay();
-  float scale = display.scale;
-  background_image_ = Image(Image::ARGB, scale * getWidth(), scale * getHeight(), true);
-  Graphics g(background_image_);
-  g.addTransform(AffineTransform::scale(scale, scale));
-
-  g.fillAll(Colour(0xff424242));
-
-  g.setColour(Colour(0xff4a4a4a));
-  for (int x = 0; x < getWidth(); x += GRID_CELL_WIDTH)
-    g.drawLine(x, 0, x, getHeight());
-  for (int y = 0; y < getHeight(); y += GRID_CELL_WIDTH)
-    g.drawLine(0, y, getWidth(), y);
-
-  shadow.drawForPath(g, envelope_line_);
-  g.setColour(Colors::graph_fill);
-  g.fillPath(envelope_line_);
-
-  g.setColour(Colour(0xff505050));
-  g.drawLine(getAttackX(), 0.0f, getAttackX(), getHeight());
-  g.drawLine(getDecayX(), getSustainY(), getDecayX(), getHeight());
-
-  g.setColour(Colors::modulation);
-  float line_width = 1.5f * ratio;
-  PathStrokeType stroke(line_width, PathStrokeType::beveled, PathStrokeType::rounded);
-  g.strokePath(envelope_line_, stroke);
+  Path envelope_line = envelope_line_;
+  float attack_x = getAttackX();
+  float decay_x = getDecayX();
+  float sustain_y = getSustainY();
+  bool sustain_hover = sustain_hover_;
+  bool mouse_down = mouse_down_;
 
   float hover_line_x = -20;
   if (attack_hover_)
-    hover_line_x = getAttackX();
+    hover_line_x = attack_x;
   else if (decay_hover_)
-    hover_line_x = getDecayX();
+    hover_line_x = decay_x;
   else if (release_hover_)
     hover_line_x = getReleaseX();
 
-  g.setColour(Colour(0xbbffffff));
-  g.fillRect(hover_line_x - 0.5f, 0.0f, 1.0f, 1.0f * getHeight());
+  background_layer_.paint(width, height, display.scale, [=](Graphics& g) {
+    g.fillAll(Colour(0xff424242));
 
-  float grab_radius = 20.0f * ratio;
-  float hover_radius = 7.0f * ratio;
-  if (sustain_hover_) {
-    if (mouse_down_) {
-      g.setColour(Colour(0x11ffffff));
-      g.fillEllipse(getDecayX() - grab_radius, getSustainY() - grab_radius,
-                    2.0f * grab_radius, 2.0f * grab_radius);
-    }
+    g.setColour(Colour(0xff4a4a4a));
+    for (int x = 0; x < width; x += GRID_CELL_WIDTH)
+      g.drawLine(x, 0, x, height);
+    for (int y = 0; y < height; y += GRID_CELL_WIDTH)
+      g.drawLine(0, y, width, y);
 
-    g.setColour(Colour(0xbbffffff));
-    g.drawEllipse(getDecayX() - hover_radius, getSustainY() - hover_radius,
-                  2.0f * hover_radius, 2.0f * hover_radius, 1.0);
-  }
-  else if (mouse_down_) {
-    g.setColour(Colour(0x11ffffff));
-    g.fillRect(hover_line_x - 10.0f, 0.0f, 20.0f, 1.0f * getHeight());
-  }
+    shadow.drawForPath(g, envelope_line);
+    g.setColour(Colors::graph_fill);
+    g.fillPath(envelope_line);
 
-  g.setColour(Colors::modulation);
-  float marker_radius = ratio * MARKER_WIDTH / 2.0f;
-  g.fillEllipse(getDecayX() - marker_radius, getSustainY() - marker_radius,
-                2.0f * marker_radius, 2.0f * marker_radius);
-  g.setColour(Colour(0xff000000));
-  g.fillEllipse(getDecayX() - marker_radius / 2.0f, getSustainY() - marker_radius / 2.0f,
-                marker_radius, marker_radius);
+    g.setColour(Colour(0xff505050));
+    g.drawLine(attack_x, 0.0f, attack_x, height);
+    g.drawLine(decay_x, sustain_y, decay_x, height);
+
+    g.setColour(Colors::modulation);
+    float line_width = 1.5f * ratio;
+    PathStrokeType stroke(line_width, PathStrokeType::beveled, PathStrokeType::rounded);
+    g.strokePath(envelope_line, stroke);
+
+    g.setColour(Colour(0xbbffffff));
+    g.fillRect(hover_line_x - 0.5f, 0.0f, 1.0f, 1.0f * height);
+
+    float grab_radius = 20.0f * ratio;
+    float hover_radius = 7.0f * ratio;
+    if (sustain_hover) {
+      if (mouse_down) {
+        g.setColour(Colour(0x11ffffff));
+        g.fillEllipse(decay_x - grab_radius, sustain_y - grab_radius,
+                      2.0f * grab_radius, 2.0f * grab_radius);
+      }
+
+      g.setColour(Colour(0xbbffffff));
+      g.drawEllipse(decay_x - hover_radius, sustain_y - hover_radius,
+                    2.0f * hover_radius, 2.0f * hover_radius, 1.0);
+    }
+    else if (mouse_down) {
+      g.setColour(Colour(0x11ffffff));
+      g.fillRect(hover_line_x - 10.0f, 0.0f, 20.0f, 1.0f * height);
+    }
 
-  background_.updateBackgroundImage(background_image_);
+    g.setColour(Colors::modulation);
+    float marker_radius = ratio * MARKER_WIDTH / 2.0f;
+    g.fillEllipse(decay_x - marker_radius, sustain_y - marker_radius,
+                  2.0f * marker_radius, 2.0f * marker_radius);
+    g.setColour(Colour(0xff000000));
+    g.fillEllipse(decay_x - marker_radius / 2.0f, sustain_y - marker_radius / 2.0f,
+                  marker_radius, marker_radius);
+  });
 }
 
 void OpenGLEnvelope::paintPositionImage() {
@@ -161,11 +172,15 @@ void OpenGLEnvelope::resized() {
   resetEnvelopeLine();
 
   SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
-  if (envelope_amp_ == nullptr && parent)
+  if (envelope_amp_ == nullptr && parent) {
     envelope_amp_ = parent->getSynth()->getModSource(getName().toStdString() + "_amp");
+    parent->getSynth()->subscribeReadout(envelope_amp_);
+  }
 
-  if (envelope_phase_ == nullptr && parent)
+  if (envelope_phase_ == nullptr && parent) {
     envelope_phase_ = parent->getSynth()->getModSource(getName().toStdString() + "_phase");
+    parent->getSynth()->subscribeReadout(envelope_phase_);
+  }
 }
 
 void OpenGLEnvelope::mouseMove(const MouseEvent& e) {
@@ -375,6 +390,21 @@ Point<float> OpenGLEnvelope::valuesToPosition(float phase, float amp) {
   return Point<float>(2.0f * closest.x / getWidth() - 1.0f, 1.0f - 2.0f * closest.y / getHeight());
 }
 
+bool OpenGLEnvelope::needsRender(bool animate) {
+  bool changed = OpenGLComponent::needsRender(animate);
+  if (!animate || envelope_phase_ == nullptr || envelope_amp_ == nullptr)
+    return changed;
+
+  mopo::mopo_float phase = envelope_phase_->buffer[0];
+  mopo::mopo_float amp = envelope_amp_->buffer[0];
+  if (phase == last_phase_ && amp == last_amp_)
+    return changed;
+
+  last_phase_ = phase;
+  last_amp_ = amp;
+  return true;
+}
+
 void OpenGLEnvelope::init(OpenGLContext& open_gl_context) {
   paintPositionImage();
 
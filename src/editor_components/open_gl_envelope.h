@@ -19,6 +19,7 @@
 #define OPEN_GL_ENVELOPE_H
 
 #include "JuceHeader.h"
+#include "async_layer.h"
 #include "helm_common.h"
 #include "open_gl_background.h"
 #include "open_gl_component.h"
@@ -44,6 +45,7 @@ class OpenGLEnvelope : public OpenGLComponent, public SynthSlider::SliderListene
     void mouseDrag(const MouseEvent& e) override;
     void mouseUp(const MouseEvent& e) override;
 
+    bool needsRender(bool animate = true) override;
     void init(OpenGLContext& open_gl_context) override;
     void render(OpenGLContext& open_gl_context, bool animate = true) override;
     void destroy(OpenGLContext& open_gl_context) override;
@@ -74,6 +76,8 @@ class OpenGLEnvelope : public OpenGLComponent, public SynthSlider::SliderListene
 
     mopo::Output* envelope_phase_;
     mopo::Output* envelope_amp_;
+    mopo::mopo_float last_phase_;
+    mopo::mopo_float last_amp_;
 
     SynthSlider* attack_slider_;
     SynthSlider* decay_slider_;
@@ -92,6 +96,8 @@ class OpenGLEnvelope : public OpenGLComponent, public SynthSlider::SliderListene
     GLuint vertex_buffer_;
     GLuint triangle_buffer_;
 
+    AsyncLayer background_layer_;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OpenGLEnvelope)
 };
 
@@ -124,7 +124,7 @@ void OpenGLModulationMeter::collapseVertices() {
   vertices_[7] = vertices_[13] = 0.0f;
 }
 
-void OpenGLModulationMeter::updateDrawing() {
+bool OpenGLModulationMeter::updateDrawing() {
   if (mono_total_) {
     current_value_ = mono_total_->buffer[0];
     if (poly_total_)
@@ -136,64 +136,67 @@ void OpenGLModulationMeter::updateDrawing() {
   double new_mod_percent = mopo::utils::clamp(value , 0.0, 1.0);
   double new_knob_percent = (destination_->getValue() - destination_->getMinimum()) / range;
 
-  if (new_mod_percent != mod_percent_ || new_knob_percent != knob_percent_) {
-    mod_percent_ = new_mod_percent;
-    knob_percent_ = new_knob_percent;
+  if (new_mod_percent == mod_percent_ && new_knob_percent == knob_percent_)
+    return false;
 
-    float min_percent = std::min(mod_percent_, knob_percent_);
-    float max_percent = std::max(mod_percent_, knob_percent_);
+  mod_percent_ = new_mod_percent;
+  knob_percent_ = new_knob_percent;
 
-    if (rotary_) {
-      float angle = SynthSlider::rotary_angle;
+  float min_percent = std::min(mod_percent_, knob_percent_);
+  float max_percent = std::max(mod_percent_, knob_percent_);
 
-      float min_radians = mopo::utils::interpolate(-angle, angle, min_percent);
-      float max_radians = mopo::utils::interpolate(-angle, angle, max_percent);
+  if (rotary_) {
+    float angle = SynthSlider::rotary_angle;
 
-      vertices_[0] = vertices_[6] = left_;
-      vertices_[12] = vertices_[18] = right_;
-      vertices_[1] = vertices_[19] = top_;
-      vertices_[7] = vertices_[13] = bottom_;
+    float min_radians = mopo::utils::interpolate(-angle, angle, min_percent);
+    float max_radians = mopo::utils::interpolate(-angle, angle, max_percent);
 
-      for (int i = 0; i < 4; ++i) {
-        vertices_[4 + 6 * i] = min_radians;
-        vertices_[5 + 6 * i] = max_radians;
-      }
+    vertices_[0] = vertices_[6] = left_;
+    vertices_[12] = vertices_[18] = right_;
+    vertices_[1] = vertices_[19] = top_;
+    vertices_[7] = vertices_[13] = bottom_;
+
+    for (int i = 0; i < 4; ++i) {
+      vertices_[4 + 6 * i] = min_radians;
+      vertices_[5 + 6 * i] = max_radians;
     }
-    else if (destination_->isHorizontal()) {
-      float start = mopo::utils::interpolate(left_, right_, min_percent);
-      vertices_[0] = vertices_[6] = start;
+  }
+  else if (destination_->isHorizontal()) {
+    float start = mopo::utils::interpolate(left_, right_, min_percent);
+    vertices_[0] = vertices_[6] = start;
 
-      float end = mopo::utils::interpolate(left_, right_, max_percent);
-      vertices_[12] = vertices_[18] = end;
+    float end = mopo::utils::interpolate(left_, right_, max_percent);
+    vertices_[12] = vertices_[18] = end;
 
-      vertices_[1] = vertices_[19] = top_;
-      vertices_[7] = vertices_[13] = bottom_;
-    }
-    else if (&destination_->getLookAndFeel() == TextLookAndFeel::instance()) {
-      float start = bottom_;
-      float end = top_;
-      float diff_percent = mod_percent_ - knob_percent_;
+    vertices_[1] = vertices_[19] = top_;
+    vertices_[7] = vertices_[13] = bottom_;
+  }
+  else if (&destination_->getLookAndFeel() == TextLookAndFeel::instance()) {
+    float start = bottom_;
+    float end = top_;
+    float diff_percent = mod_percent_ - knob_percent_;
 
-      if (diff_percent > 0.0)
-        end = mopo::utils::interpolate(bottom_, top_, diff_percent);
-      else
-        start = mopo::utils::interpolate(top_, bottom_, -diff_percent);
+    if (diff_percent > 0.0)
+      end = mopo::utils::interpolate(bottom_, top_, diff_percent);
+    else
+      start = mopo::utils::interpolate(top_, bottom_, -diff_percent);
 
-      vertices_[7] = vertices_[13] = start;
-      vertices_[1] = vertices_[19] = end;
+    vertices_[7] = vertices_[13] = start;
+    vertices_[1] = vertices_[19] = end;
 
-      vertices_[0] = vertices_[6] = left_;
-      vertices_[12] = vertices_[18] = right_;
-    }
-    else {
-      float start = mopo::utils::interpolate(bottom_, top_, min_percent);
-      vertices_[7] = vertices_[13] = start;
+    vertices_[0] = vertices_[6] = left_;
+    vertices_[12] = vertices_[18] = right_;
+  }
+  else {
+    float start = mopo::utils::interpolate(bottom_, top_, min_percent);
+    vertices_[7] = vertices_[13] = start;
 
-      float end = mopo::utils::interpolate(bottom_, top_, max_percent);
-      vertices_[1] = vertices_[19] = end;
+    float end = mopo::utils::interpolate(bottom_, top_, max_percent);
+    vertices_[1] = vertices_[19] = end;
 
-      vertices_[0] = vertices_[6] = left_;
-      vertices_[12] = vertices_[18] = right_;
-    }
+    vertices_[0] = vertices_[6] = left_;
+    vertices_[12] = vertices_[18] = right_;
   }
+
+  return true;
 }
@@ -34,9 +34,11 @@ class OpenGLModulationMeter : public Component {
     void resized() override;
     void setVisible(bool should_be_visible) override;
 
-    void updateDrawing();
+    // Returns true if the meter moved.
+    bool updateDrawing();
 
     bool isModulated() { return modulated_; }
+    bool isDestinationVisible() const { return destination_->isVisible(); }
     void setModulated(bool modulated) { modulated_ = modulated; }
 
   private:
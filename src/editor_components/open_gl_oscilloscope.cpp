@@ -24,6 +24,7 @@
 #define GRID_CELL_WIDTH 8
 
 OpenGLOscilloscope::OpenGLOscilloscope() : output_memory_(nullptr) {
+  last_memory_ = new float[mopo::MEMORY_RESOLUTION]();
   line_data_ = new float[2 * RESOLUTION];
   line_indices_ = new int[2 * RESOLUTION];
 
@@ -40,6 +41,7 @@ OpenGLOscilloscope::OpenGLOscilloscope() : output_memory_(nullptr) {
 }
 
 OpenGLOscilloscope::~OpenGLOscilloscope() {
+  delete[] last_memory_;
   delete[] line_data_;
   delete[] line_indices_;
 }
@@ -57,6 +59,19 @@ void OpenGLOscilloscope::paintBackground(Graphics& g) {
     g.drawLine(0, y, width, y);
 }
 
+bool OpenGLOscilloscope::needsRender(bool animate) {
+  bool changed = OpenGLComponent::needsRender(animate);
+  if (!animate || output_memory_ == nullptr)
+    return changed;
+
+  size_t size = mopo::MEMORY_RESOLUTION * sizeof(float);
+  if (memcmp(last_memory_, output_memory_, size) == 0)
+    return changed;
+
+  memcpy(last_memory_, output_memory_, size);
+  return true;
+}
+
 void OpenGLOscilloscope::init(OpenGLContext& open_gl_context) {
   open_gl_context.extensions.glGenBuffers(1, &line_buffer_);
   open_gl_context.extensions.glBindBuffer(GL_ARRAY_BUFFER, line_buffer_);
@@ -30,6 +30,7 @@ class OpenGLOscilloscope : public OpenGLComponent {
 
     void setOutputMemory(const float* memory) { output_memory_ = memory; }
 
+    bool needsRender(bool animate = true) override;
     void init(OpenGLContext& open_gl_context) override;
     void render(OpenGLContext& open_gl_context, bool animate = true) override;
     void destroy(OpenGLContext& open_gl_context) override;
@@ -42,6 +43,7 @@ class OpenGLOscilloscope : public OpenGLComponent {
     ScopedPointer<OpenGLShaderProgram::Attribute> position_;
 
     const float* output_memory_;
+    float* last_memory_;
     float* line_data_;
     int* line_indices_;
     GLuint line_buffer_;
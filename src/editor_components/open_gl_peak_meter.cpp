@@ -25,6 +25,7 @@
 
 OpenGLPeakMeter::OpenGLPeakMeter(bool left) : left_(left) {
   peak_output_ = nullptr;
+  last_peak_ = 0.0;
   position_vertices_ = new float[8] {
     -1.0f, 1.0f,
     -1.0f, -1.0f,
@@ -51,6 +52,19 @@ void OpenGLPeakMeter::resized() {
   OpenGLComponent::resized();
 }
 
+bool OpenGLPeakMeter::needsRender(bool animate) {
+  bool changed = OpenGLComponent::needsRender(animate);
+  if (!animate || peak_output_ == nullptr)
+    return changed;
+
+  mopo::mopo_float peak = peak_output_->buffer[left_ ? 0 : 1];
+  if (peak == last_peak_)
+    return changed;
+
+  last_peak_ = peak;
+  return true;
+}
+
 void OpenGLPeakMeter::init(OpenGLContext& open_gl_context) {
   open_gl_context.extensions.glGenBuffers(1, &vertex_buffer_);
   open_gl_context.extensions.glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
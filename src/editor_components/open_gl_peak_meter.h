@@ -30,6 +30,7 @@ class OpenGLPeakMeter : public OpenGLComponent {
 
     void resized() override;
 
+    bool needsRender(bool animate = true) override;
     void init(OpenGLContext& open_gl_context) override;
     void render(OpenGLContext& open_gl_context, bool animate = true) override;
     void destroy(OpenGLContext& open_gl_context) override;
@@ -39,6 +40,7 @@ class OpenGLPeakMeter : public OpenGLComponent {
     void updateVertices();
 
     mopo::Output* peak_output_;
+    mopo::mopo_float last_peak_;
 
     ScopedPointer<OpenGLShaderProgram> shader_;
     ScopedPointer<OpenGLShaderProgram::Attribute> position_;
@@ -30,12 +30,19 @@ namespace {
   static const float random_values[NOISE_RESOLUTION] = {0.3f, 0.9f, -0.9f, -0.2f, -0.5f, 0.7f };
 } // namespace
 
-OpenGLWaveViewer::OpenGLWaveViewer(int resolution) {
+OpenGLWaveViewer::OpenGLWaveViewer(int resolution) :
+    background_layer_([this](Image image) {
+      background_image_ = image;
+      background_.updateBackgroundImage(image);
+      invalidate();
+    }) {
   wave_slider_ = nullptr;
   amplitude_slider_ = nullptr;
   resolution_ = resolution;
   wave_phase_ = nullptr;
   wave_amp_ = nullptr;
+  last_phase_ = 0.0;
+  last_amp_ = 0.0;
 
   position_vertices_ = new float[16] {
     0.0f, 1.0f, 0.0f, 1.0f,
@@ -58,34 +65,33 @@ OpenGLWaveViewer::~OpenGLWaveViewer() {
 void OpenGLWaveViewer::paintBackground() {
   static const DropShadow shadow(Colour(0xbb000000), 5, Point<int>(0, 0));
 
-  if (getWidth() <= 0 || getHeight() <= 0)
+  int width = getWidth();
+  int height = getHeight();
+  if (width <= 0 || height <= 0)
     return;
 
   const Desktop::Displays::Display& display = Desktop::getInstance().getDisplays().getMainDisplay();
-  float scale = display.scale;
-  background_image_ = Image(Image::ARGB, scale * getWidth(), scale * getHeight(), true);
-  Graphics g(background_image_);
-  g.addTransform(AffineTransform::scale(scale, scale));
+  Path wave_path = wave_path_;
 
-  g.fillAll(Colour(0xff424242));
+  background_layer_.paint(width, height, display.scale, [=](Graphics& g) {
+    g.fillAll(Colour(0xff424242));
 
-  g.setColour(Colour(0xff4a4a4a));
-  for (int x = 0; x < getWidth(); x += GRID_CELL_WIDTH)
-    g.drawLine(x, 0, x, getHeight());
-  for (int y = 0; y < getHeight(); y += GRID_CELL_WIDTH)
-    g.drawLine(0, y, getWidth(), y);
+    g.setColour(Colour(0xff4a4a4a));
+    for (int x = 0; x < width; x += GRID_CELL_WIDTH)
+      g.drawLine(x, 0, x, height);
+    for (int y = 0; y < height; y += GRID_CELL_WIDTH)
+      g.drawLine(0, y, width, y);
 
-  shadow.drawForPath(g, wave_path_);
+    shadow.drawForPath(g, wave_path);
 
-  g.setColour(Colors::graph_fill);
-  g.fillPath(wave_path_);
+    g.setColour(Colors::graph_fill);
+    g.fillPath(wave_path);
 
-  g.setColour(Colors::modulation);
-  float line_width = 1.5f * getHeight() / 75.0f;
-  PathStrokeType stroke(line_width, PathStrokeType::beveled, PathStrokeType::rounded);
-  g.strokePath(wave_path_, stroke);
-
-  background_.updateBackgroundImage(background_image_);
+    g.setColour(Colors::modulation);
+    float line_width = 1.5f * height / 75.0f;
+    PathStrokeType stroke(line_width, PathStrokeType::beveled, PathStrokeType::rounded);
+    g.strokePath(wave_path, stroke);
+  });
 }
 
 void OpenGLWaveViewer::paintPositionImage() {
@@ -129,10 +135,13 @@ void OpenGLWaveViewer::resized() {
 
     if (wave_amp_ == nullptr)
       wave_amp_ = parent->getSynth()->getModSource(getName().toStdString());
+    parent->getSynth()->subscribeReadout(wave_amp_);
   }
 
-  if (wave_phase_ == nullptr && parent)
+  if (wave_phase_ == nullptr && parent) {
     wave_phase_ = parent->getSynth()->getModSource(getName().toStdString() + "_phase");
+    parent->getSynth()->subscribeReadout(wave_phase_);
+  }
 }
 
 void OpenGLWaveViewer::setWaveSlider(SynthSlider* slider) {
@@ -230,6 +239,21 @@ float OpenGLWaveViewer::phaseToX(float phase) {
   return phase * getWidth();
 }
 
+bool OpenGLWaveViewer::needsRender(bool animate) {
+  bool changed = OpenGLComponent::needsRender(animate);
+  if (!animate || wave_phase_ == nullptr || wave_amp_ == nullptr)
+    return changed;
+
+  mopo::mopo_float phase = wave_phase_->buffer[0];
+  mopo::mopo_float amp = wave_amp_->buffer[0];
+  if (phase == last_phase_ && amp == last_amp_)
+    return changed;
+
+  last_phase_ = phase;
+  last_amp_ = amp;
+  return true;
+}
+
 void OpenGLWaveViewer::init(OpenGLContext& open_gl_context) {
   paintPositionImage();
 
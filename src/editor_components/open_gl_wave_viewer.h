@@ -20,6 +20,7 @@
 
 #include "JuceHeader.h"
 
+#include "async_layer.h"
 #include "helm_common.h"
 #include "open_gl_background.h"
 #include "open_gl_component.h"
@@ -40,6 +41,7 @@ class OpenGLWaveViewer : public OpenGLComponent, public SynthSlider::SliderListe
     void mouseDown(const MouseEvent& e) override;
     void resized() override;
 
+    bool needsRender(bool animate = true) override;
     void init(OpenGLContext& open_gl_context) override;
     void render(OpenGLContext& open_gl_context, bool animate = true) override;
     void destroy(OpenGLContext& open_gl_context) override;
@@ -56,6 +58,8 @@ class OpenGLWaveViewer : public OpenGLComponent, public SynthSlider::SliderListe
     SynthSlider* amplitude_slider_;
     mopo::Output* wave_phase_;
     mopo::Output* wave_amp_;
+    mopo::mopo_float last_phase_;
+    mopo::mopo_float last_amp_;
     Path wave_path_;
     int resolution_;
 
@@ -71,6 +75,8 @@ class OpenGLWaveViewer : public OpenGLComponent, public SynthSlider::SliderListe
     GLuint vertex_buffer_;
     GLuint triangle_buffer_;
 
+    AsyncLayer background_layer_;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OpenGLWaveViewer)
 };
 
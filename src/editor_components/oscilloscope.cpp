@@ -17,6 +17,7 @@
 #include "oscilloscope.h"
 
 #include "colors.h"
+#include "full_interface.h"
 #include "helm_common.h"
 
 #define FRAMES_PER_SECOND 15
@@ -84,16 +85,20 @@ void Oscilloscope::resetWavePath() {
   wave_path_.lineTo(getWidth() - PADDING_X, getHeight() / 2.0f);
 }
 
-void Oscilloscope::timerCallback() {
+bool Oscilloscope::updateFrame() {
   resetWavePath();
   repaint();
+  return true;
 }
 
 void Oscilloscope::showRealtimeFeedback(bool show_feedback) {
-  if (show_feedback)
-    startTimerHz(FRAMES_PER_SECOND);
+  if (show_feedback) {
+    FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
+    if (full_interface)
+      full_interface->getFrameScheduler().addClient(this, FRAMES_PER_SECOND);
+  }
   else {
-    stopTimer();
+    stopFrameUpdates();
     wave_path_.clear();
     repaint();
   }
@@ -19,14 +19,15 @@
 #define OSCILLOSCOPE_H
 
 #include "JuceHeader.h"
+#include "frame_scheduler.h"
 #include "memory.h"
 
-class Oscilloscope : public Component, public Timer {
+class Oscilloscope : public Component, public FrameScheduler::Client {
   public:
     Oscilloscope();
     ~Oscilloscope();
 
-    void timerCallback() override;
+    bool updateFrame() override;
     void paint(Graphics& g) override;
     void paintBackground(Graphics& g);
     void resized() override;
@@ -20,6 +20,7 @@
 #include "colors.h"
 #include "default_look_and_feel.h"
 #include "fonts.h"
+#include "full_interface.h"
 #include "load_save.h"
 #include "synth_gui_interface.h"
 
@@ -33,8 +34,7 @@ namespace {
   }
 }
 
-PatchSelector::PatchSelector() : SynthSection("patch_selector"),
-                                 browser_(nullptr), save_section_(nullptr), modified_(false) {
+PatchSelector::PatchSelector() : SynthSection("patch_selector"), modified_(false) {
   setLookAndFeel(BrowserLookAndFeel::instance());
   addButton(prev_patch_ = new TextButton("prev_patch"));
   prev_patch_->setButtonText(TRANS("<"));
@@ -137,18 +137,21 @@ void PatchSelector::mouseUp(const MouseEvent& event) {
     m.showMenuAsync(PopupMenu::Options(),
                     ModalCallbackFunction::forComponent(initPatchCallback, this));
   }
-  else if (browser_)
-    browser_->setVisible(!browser_->isVisible());
+  else if (PatchBrowser* browser = getBrowser())
+    browser->setVisible(!browser->isVisible());
 }
 
 void PatchSelector::buttonClicked(Button* clicked_button) {
-  if (browser_ == nullptr)
+  FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
+  if (full_interface == nullptr)
     return;
 
-  if (clicked_button == save_ && save_section_)
-    save_section_->setVisible(true);
-  else if (clicked_button == browse_)
-    browser_->setVisible(!browser_->isVisible());
+  if (clicked_button == save_)
+    full_interface->getSaveSection()->setVisible(true);
+  else if (clicked_button == browse_) {
+    PatchBrowser* browser = full_interface->getPatchBrowser();
+    browser->setVisible(!browser->isVisible());
+  }
   else if (clicked_button == export_) {
     SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
     if (parent == nullptr)
@@ -159,9 +162,9 @@ void PatchSelector::buttonClicked(Button* clicked_button) {
     parent->externalPatchLoaded(synth->getActiveFile());
   }
   else if (clicked_button == prev_patch_)
-    browser_->loadPrevPatch();
+    full_interface->getPatchBrowser()->loadPrevPatch();
   else if (clicked_button == next_patch_)
-    browser_->loadNextPatch();
+    full_interface->getPatchBrowser()->loadNextPatch();
 }
 
 void PatchSelector::newPatchSelected(File patch) {
@@ -181,6 +184,13 @@ void PatchSelector::loadFromFile(File& patch) {
   parent->getSynth()->loadFromFile(patch);
 }
 
+PatchBrowser* PatchSelector::getBrowser() {
+  FullInterface* parent = findParentComponentOfClass<FullInterface>();
+  if (parent == nullptr)
+    return nullptr;
+  return parent->getPatchBrowser();
+}
+
 int PatchSelector::getBrowseHeight() {
   return 2 * proportionOfHeight(BROWSE_PERCENT);
 }
@@ -188,7 +198,7 @@ int PatchSelector::getBrowseHeight() {
 void PatchSelector::initPatch() {
   SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
   parent->getSynth()->loadInitPatch();
-  browser_->externalPatchLoaded(File());
+  parent->externalPatchLoaded(File());
   parent->updateFullGui();
   parent->notifyFresh();
 }
@@ -34,17 +34,13 @@ class PatchSelector : public SynthSection, public PatchBrowser::PatchSelectedLis
     void buttonClicked(Button* buttonThatWasClicked) override;
     void newPatchSelected(File patch) override;
     void setModified(bool modified);
-    void setSaveSection(SaveSection* save_section) { save_section_ = save_section; }
-    void setBrowser(PatchBrowser* browser) {
-      browser_ = browser;
-      browser_->setListener(this);
-    }
     int getBrowseHeight();
 
     void initPatch();
 
   private:
     void loadFromFile(File& patch);
+    PatchBrowser* getBrowser();
 
     String folder_text_;
     String patch_text_;
@@ -54,8 +50,6 @@ class PatchSelector : public SynthSection, public PatchBrowser::PatchSelectedLis
     ScopedPointer<TextButton> save_;
     ScopedPointer<TextButton> export_;
     ScopedPointer<TextButton> browse_;
-    PatchBrowser* browser_;
-    SaveSection* save_section_;
     bool modified_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PatchSelector)
@@ -17,6 +17,7 @@
 #include "wave_viewer.h"
 
 #include "colors.h"
+#include "default_look_and_feel.h"
 #include "synth_gui_interface.h"
 
 #define GRID_CELL_WIDTH 8
@@ -26,13 +27,26 @@
 #define NOISE_RESOLUTION 6
 
 namespace {
+  enum MenuIds {
+    kCancel = 0,
+    kPreviousWave,
+    kLoadWavetable,
+    kClearWavetable
+  };
+
   static const float random_values[NOISE_RESOLUTION] = {0.3f, 0.9f, -0.9f, -0.2f, -0.5f, 0.7f };
+
+  static void wavePopupCallback(int result, WaveViewer* viewer) {
+    if (viewer != nullptr && result != kCancel)
+      viewer->handlePopupResult(result);
+  }
 } // namespace
 
 WaveViewer::WaveViewer(int resolution) {
   wave_slider_ = nullptr;
   amplitude_slider_ = nullptr;
   resolution_ = resolution;
+  wavetable_slot_ = mopo::Wavetable::kNumSlots;
   wave_phase_ = nullptr;
   wave_amp_ = nullptr;
   is_control_rate_ = false;
@@ -99,9 +113,44 @@ void WaveViewer::resized() {
 }
 
 void WaveViewer::mouseDown(const MouseEvent& e) {
+  if (e.mods.isPopupMenu() && wavetable_slot_ != mopo::Wavetable::kNumSlots) {
+    PopupMenu m;
+    m.setLookAndFeel(DefaultLookAndFeel::instance());
+    m.addItem(kPreviousWave, "Previous Waveform");
+    m.addItem(kLoadWavetable, "Load Wavetable...");
+    m.addItem(kClearWavetable, "Clear Wavetable");
+
+    m.showMenuAsync(PopupMenu::Options(),
+                    ModalCallbackFunction::forComponent(wavePopupCallback, this));
+  }
+  else
+    cycleWave(e.mods.isRightButtonDown());
+}
+
+void WaveViewer::handlePopupResult(int result) {
+  if (result == kPreviousWave) {
+    cycleWave(true);
+    return;
+  }
+
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  if (parent == nullptr)
+    return;
+
+  if (result == kLoadWavetable) {
+    FileChooser open_box("Load Wavetable", File::getSpecialLocation(File::userHomeDirectory),
+                         "*.wav");
+    if (open_box.browseForFileToOpen())
+      parent->getSynth()->loadWavetable(wavetable_slot_, open_box.getResult());
+  }
+  else if (result == kClearWavetable)
+    parent->getSynth()->clearWavetable(wavetable_slot_);
+}
+
+void WaveViewer::cycleWave(bool backwards) {
   if (wave_slider_) {
     int current_value = wave_slider_->getValue();
-    if (e.mods.isRightButtonDown())
+    if (backwards)
       current_value = current_value + wave_slider_->getMaximum();
     else
       current_value = current_value + 1;
@@ -111,18 +160,21 @@ void WaveViewer::mouseDown(const MouseEvent& e) {
   }
 }
 
-void WaveViewer::timerCallback() {
-  if (wave_phase_) {
-    float phase = wave_phase_->buffer[0];
-    amp_ = wave_amp_->buffer[0];
-    if (phase != phase_) {
-      float last_x = phaseToX(phase_);
-      float new_x = phaseToX(phase);
-      phase_ = phase;
-      repaint(last_x - MARKER_WIDTH / 2.0f - 1, 0.0, MARKER_WIDTH + 2, getHeight());
-      repaint(new_x - MARKER_WIDTH / 2.0f - 1, 0.0, MARKER_WIDTH + 2, getHeight());
-    }
-  }
+bool WaveViewer::updateFrame() {
+  if (wave_phase_ == nullptr)
+    return false;
+
+  float phase = wave_phase_->buffer[0];
+  amp_ = wave_amp_->buffer[0];
+  if (phase == phase_)
+    return false;
+
+  float last_x = phaseToX(phase_);
+  float new_x = phaseToX(phase);
+  phase_ = phase;
+  repaint(last_x - MARKER_WIDTH / 2.0f - 1, 0.0, MARKER_WIDTH + 2, getHeight());
+  repaint(new_x - MARKER_WIDTH / 2.0f - 1, 0.0, MARKER_WIDTH + 2, getHeight());
+  return true;
 }
 
 void WaveViewer::setWaveSlider(Slider* slider) {
@@ -236,13 +288,23 @@ void WaveViewer::showRealtimeFeedback(bool show_feedback) {
       if (parent) {
         wave_amp_ = parent->getSynth()->getModSource(getName().toStdString());
         wave_phase_ = parent->getSynth()->getModSource(getName().toStdString() + "_phase");
-        startTimerHz(FRAMES_PER_SECOND);
+        parent->getSynth()->subscribeReadout(wave_amp_);
+        parent->getSynth()->subscribeReadout(wave_phase_);
       }
+
+      FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
+      if (full_interface)
+        full_interface->getFrameScheduler().addClient(this, FRAMES_PER_SECOND);
     }
   }
   else {
+    SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+    if (parent && wave_phase_) {
+      parent->getSynth()->unsubscribeReadout(wave_amp_);
+      parent->getSynth()->unsubscribeReadout(wave_phase_);
+    }
     wave_phase_ = nullptr;
-    stopTimer();
+    stopFrameUpdates();
     repaint();
   }
 }
@@ -19,15 +19,17 @@
 #define WAVE_VIEWER_H
 
 #include "JuceHeader.h"
+#include "frame_scheduler.h"
 #include "wave.h"
+#include "wavetable.h"
 #include "helm_common.h"
 
-class WaveViewer : public Component, public Timer, public Slider::Listener {
+class WaveViewer : public Component, public FrameScheduler::Client, public Slider::Listener {
   public:
     WaveViewer(int resolution);
     ~WaveViewer();
 
-    void timerCallback() override;
+    bool updateFrame() override;
     void setWaveSlider(Slider* slider);
     void setAmplitudeSlider(Slider* slider);
     void drawRandom();
@@ -36,13 +38,16 @@ class WaveViewer : public Component, public Timer, public Slider::Listener {
     void sliderValueChanged(Slider* sliderThatWasMoved) override;
     void showRealtimeFeedback(bool show_feedback = true);
     void setControlRate(bool control_rate = true) { is_control_rate_ = control_rate; }
+    void setWavetableSlot(mopo::Wavetable::Slot slot) { wavetable_slot_ = slot; }
 
     void paint(Graphics& g) override;
     void paintBackground(Graphics& g);
     void resized() override;
     void mouseDown(const MouseEvent& e) override;
+    void handlePopupResult(int result);
 
   private:
+    void cycleWave(bool backwards);
     float phaseToX(float phase);
     float getRatio();
 
@@ -53,6 +58,7 @@ class WaveViewer : public Component, public Timer, public Slider::Listener {
     Path wave_path_;
     bool is_control_rate_;
     int resolution_;
+    mopo::Wavetable::Slot wavetable_slot_;
     float phase_;
     float amp_;
     Image background_;
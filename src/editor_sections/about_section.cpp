@@ -19,14 +19,15 @@
 #include "fonts.h"
 #include "helm_common.h"
 #include "load_save.h"
+#include "oversampler.h"
 #include "synth_gui_interface.h"
 #include "synth_section.h"
 #include "text_look_and_feel.h"
 
 #define LOGO_WIDTH 128
 #define INFO_WIDTH 470
-#define STANDALONE_INFO_HEIGHT 550
-#define PLUGIN_INFO_HEIGHT 227
+#define STANDALONE_INFO_HEIGHT 621
+#define PLUGIN_INFO_HEIGHT 298
 #define PADDING_X 25
 #define PADDING_Y 15
 #define BUTTON_WIDTH 16
@@ -63,6 +64,25 @@ AboutSection::AboutSection(String name) : Overlay(name) {
   animate_->addListener(this);
   addAndMakeVisible(animate_);
 
+  cache_note_renders_ = new ToggleButton();
+  cache_note_renders_->setToggleState(LoadSave::shouldCacheNoteRenders(),
+                                      NotificationType::dontSendNotification);
+  cache_note_renders_->setLookAndFeel(TextLookAndFeel::instance());
+  cache_note_renders_->addListener(this);
+  addAndMakeVisible(cache_note_renders_);
+
+  reduce_voice_detail_ = new ToggleButton();
+  reduce_voice_detail_->setToggleState(LoadSave::shouldReduceVoiceDetail(),
+                                       NotificationType::dontSendNotification);
+  reduce_voice_detail_->setLookAndFeel(TextLookAndFeel::instance());
+  reduce_voice_detail_->addListener(this);
+  addAndMakeVisible(reduce_voice_detail_);
+
+  distortion_oversampling_ = new TextButton();
+  setOversamplingText(LoadSave::loadDistortionOversampling());
+  distortion_oversampling_->addListener(this);
+  addAndMakeVisible(distortion_oversampling_);
+
   size_button_small_ = new TextButton(String(100 * MULT_SMALL) + "%");
   addAndMakeVisible(size_button_small_);
   size_button_small_->addListener(this);
@@ -147,6 +167,18 @@ void AboutSection::paint(Graphics& g) {
              0.0f, 180.0f,
              155.0f,
              20.0f, Justification::topRight);
+  g.drawText(TRANS("Cache note renders"),
+             0.0f, 219.0f,
+             273.0f - PADDING_X - 0.5 * BUTTON_WIDTH,
+             20.0f, Justification::topRight);
+  g.drawText(TRANS("Reduce quiet voices"),
+             0.0f, 219.0f,
+             info_rect.getWidth() - 2 * PADDING_X - 1.5 * BUTTON_WIDTH,
+             20.0f, Justification::topRight);
+  g.drawText(TRANS("Distortion oversampling"),
+             0.0f, 250.0f,
+             273.0f - PADDING_X - 0.5 * BUTTON_WIDTH,
+             20.0f, Justification::topRight);
 
   g.restoreState();
 }
@@ -181,8 +213,19 @@ void AboutSection::resized() {
   size_button_small_->setBounds(size_button_normal_->getX() - size_padding - size_width, size_y,
                                 size_width, size_height);
 
+  cache_note_renders_->setBounds(info_rect.getX() + 273.0f,
+                                 size_button_extra_large_->getBottom() + PADDING_Y,
+                                 BUTTON_WIDTH, BUTTON_WIDTH);
+
+  reduce_voice_detail_->setBounds(info_rect.getRight() - PADDING_X - BUTTON_WIDTH,
+                                  cache_note_renders_->getY(), BUTTON_WIDTH, BUTTON_WIDTH);
+
+  distortion_oversampling_->setBounds(info_rect.getX() + 273.0f,
+                                      cache_note_renders_->getBottom() + PADDING_Y,
+                                      2.5f * BUTTON_WIDTH, BUTTON_WIDTH);
+
   if (device_selector_) {
-    int y = size_button_extra_large_->getBottom() + PADDING_Y;
+    int y = distortion_oversampling_->getBottom() + PADDING_Y;
     device_selector_->setBounds(info_rect.getX(), y,
                                 info_rect.getWidth(), info_rect.getBottom() - y);
   }
@@ -226,6 +269,32 @@ void AboutSection::buttonClicked(Button* clicked_button) {
 
     parent->animate(animate_->getToggleState());
   }
+  else if (clicked_button == cache_note_renders_) {
+    LoadSave::saveNoteRenderCaching(cache_note_renders_->getToggleState());
+
+    SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+    if (parent)
+      parent->getSynth()->setNoteRenderCaching(cache_note_renders_->getToggleState());
+  }
+  else if (clicked_button == reduce_voice_detail_) {
+    LoadSave::saveVoiceDetailReduction(reduce_voice_detail_->getToggleState());
+
+    SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+    if (parent)
+      parent->getSynth()->setVoiceDetailReduction(reduce_voice_detail_->getToggleState());
+  }
+  else if (clicked_button == distortion_oversampling_) {
+    int oversampling = 2 * LoadSave::loadDistortionOversampling();
+    if (oversampling > mopo::Oversampler::MAX_OVERSAMPLING)
+      oversampling = 1;
+
+    LoadSave::saveDistortionOversampling(oversampling);
+    setOversamplingText(oversampling);
+
+    SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+    if (parent)
+      parent->getSynth()->setDistortionOversampling(oversampling);
+  }
   else if (clicked_button == size_button_small_)
     setGuiSize(MULT_SMALL);
   else if (clicked_button == size_button_normal_)
@@ -243,6 +312,11 @@ Rectangle<int> AboutSection::getInfoRect() {
   return Rectangle<int>(x, y, INFO_WIDTH, info_height);
 }
 
+void AboutSection::setOversamplingText(int oversampling) {
+  distortion_oversampling_->setName(String(oversampling) + "x");
+  distortion_oversampling_->repaint();
+}
+
 void AboutSection::setGuiSize(float multiplier) {
   float percent = sqrtf(multiplier);
   LoadSave::saveWindowSize(percent);
@@ -36,12 +36,16 @@ class AboutSection : public Overlay, public Button::Listener {
 
   private:
     void setGuiSize(float multiplier);
+    void setOversamplingText(int oversampling);
 
     ScopedPointer<HyperlinkButton> developer_link_;
     ScopedPointer<HyperlinkButton> free_software_link_;
     ScopedPointer<AudioDeviceSelectorComponent> device_selector_;
     ScopedPointer<Button> check_for_updates_;
     ScopedPointer<Button> animate_;
+    ScopedPointer<Button> cache_note_renders_;
+    ScopedPointer<Button> reduce_voice_detail_;
+    ScopedPointer<Button> distortion_oversampling_;
 
     ScopedPointer<Button> size_button_small_;
     ScopedPointer<Button> size_button_normal_;
@@ -25,6 +25,8 @@
 #include "text_look_and_feel.h"
 
 #define TOP_HEIGHT 64
+#define OPEN_GL_FRAMES_PER_SECOND 60
+#define BACKGROUND_SETTLE_MS 150
 
 #ifndef PAY_NAG
   #define PAY_NAG 1
@@ -35,7 +37,9 @@ FullInterface::FullInterface(mopo::control_map controls, mopo::output_map modula
                              mopo::output_map poly_modulations,
                              MidiKeyboardState* keyboard_state) : SynthSection("full_interface") {
   animate_ = true;
-  open_gl_context.setContinuousRepainting(true);
+  background_pending_ = false;
+  background_resized_ms_ = 0;
+  open_gl_context.setContinuousRepainting(false);
   open_gl_context.setRenderer(this);
   open_gl_context.attachTo(*getTopLevelComponent());
   open_gl_context.setOpenGLVersionRequired(OpenGLContext::openGL3_2);
@@ -73,19 +77,6 @@ FullInterface::FullInterface(mopo::control_map controls, mopo::output_map modula
   addAndMakeVisible(logo_button_);
   logo_button_->addListener(this);
 
-  addChildComponent(patch_browser_ = new PatchBrowser());
-  patch_selector_->setBrowser(patch_browser_);
-
-  addChildComponent(save_section_ = new SaveSection("save_section"));
-  patch_browser_->setSaveSection(save_section_);
-  patch_selector_->setSaveSection(save_section_);
-
-  addChildComponent(delete_section_ = new DeleteSection("delete_section"));
-  patch_browser_->setDeleteSection(delete_section_);
-
-  about_section_ = new AboutSection("about");
-  addChildComponent(about_section_);
-
 #if PAY_NAG
   if (LoadSave::shouldAskForPayment()) {
     contribute_section_ = new ContributeSection("contribute");
@@ -93,22 +84,23 @@ FullInterface::FullInterface(mopo::control_map controls, mopo::output_map modula
   }
 #endif
 
-  update_check_section_ = new UpdateCheckSection("update_check");
-  addChildComponent(update_check_section_);
+  // The update check blocks on the network so it's only created when due.
+  if (UpdateMemory::getInstance()->shouldCheck()) {
+    update_check_section_ = new UpdateCheckSection("update_check");
+    addChildComponent(update_check_section_);
+  }
 
   synthesis_interface_->toFront(true);
   modulation_manager_->toFront(false);
-  patch_browser_->toFront(false);
-  about_section_->toFront(false);
   if (contribute_section_)
     contribute_section_->toFront(false);
-  save_section_->toFront(false);
-  delete_section_->toFront(false);
 
+  frame_scheduler_.addClient(this, OPEN_GL_FRAMES_PER_SECOND);
   setOpaque(true);
 }
 
 FullInterface::~FullInterface() {
+  stopFrameUpdates();
   open_gl_context.detach();
   open_gl_context.setRenderer(nullptr);
   about_section_ = nullptr;
@@ -181,12 +173,6 @@ void FullInterface::resized() {
   }
 
   setSizeRatio(ratio);
-  save_section_->setSizeRatio(ratio);
-  delete_section_->setSizeRatio(ratio);
-  patch_browser_->setSizeRatio(ratio);
-  about_section_->setSizeRatio(ratio);
-  if (contribute_section_)
-    contribute_section_->setSizeRatio(ratio);
   int padding = 8 * ratio;
   int top_height = TOP_HEIGHT * ratio;
 
@@ -231,21 +217,22 @@ void FullInterface::resized() {
   synthesis_interface_->setBounds(left, top_height + padding,
                                   width, height - top_height - padding);
 
-  about_section_->setBounds(getBounds());
-  if (contribute_section_)
-    contribute_section_->setBounds(getBounds());
-  update_check_section_->setBounds(getBounds());
-  save_section_->setBounds(getBounds());
-  delete_section_->setBounds(getBounds());
-
-  patch_browser_->setBounds(synthesis_interface_->getX() + padding, synthesis_interface_->getY(),
-                            arp_section_->getRight() - synthesis_interface_->getX() - padding,
-                            synthesis_interface_->getHeight() - padding);
+  if (update_check_section_)
+    update_check_section_->setBounds(getBounds());
+  resizeOverlays();
 
   SynthSection::resized();
   modulation_manager_->setBounds(getBounds());
 
-  checkBackground();
+  // Repainting the background is slow so while the window is being resized
+  // the last one is stretched and it's redrawn once the size settles.
+  if (background_image_.isNull())
+    checkBackground();
+  else {
+    background_pending_ = true;
+    background_resized_ms_ = Time::getMillisecondCounter();
+    frame_scheduler_.wake();
+  }
 }
 
 void FullInterface::setOutputMemory(const float* output_memory) {
@@ -271,6 +258,94 @@ void FullInterface::createModulationSliders(mopo::output_map modulation_sources,
   addOpenGLComponent(modulation_manager_);
 }
 
+void FullInterface::externalPatchLoaded(File patch) {
+  external_patch_ = patch;
+  if (patch_browser_)
+    patch_browser_->externalPatchLoaded(patch);
+}
+
+void FullInterface::fileSaved(File save_file) {
+  external_patch_ = save_file;
+  if (patch_browser_)
+    patch_browser_->fileSaved(save_file);
+}
+
+PatchBrowser* FullInterface::getPatchBrowser() {
+  if (patch_browser_ == nullptr) {
+    patch_browser_ = new PatchBrowser();
+    patch_browser_->setListener(patch_selector_);
+    patch_browser_->setSaveSection(getSaveSection());
+    patch_browser_->setDeleteSection(getDeleteSection());
+    if (external_patch_ != File())
+      patch_browser_->externalPatchLoaded(external_patch_);
+    addOverlay(patch_browser_);
+
+    // The browser opens dialogs so they have to stay in front of it.
+    save_section_->toFront(false);
+    delete_section_->toFront(false);
+  }
+  return patch_browser_;
+}
+
+SaveSection* FullInterface::getSaveSection() {
+  if (save_section_ == nullptr) {
+    save_section_ = new SaveSection("save_section");
+    save_section_->setListener(this);
+    addOverlay(save_section_);
+  }
+  return save_section_;
+}
+
+DeleteSection* FullInterface::getDeleteSection() {
+  if (delete_section_ == nullptr) {
+    delete_section_ = new DeleteSection("delete_section");
+    addOverlay(delete_section_);
+  }
+  return delete_section_;
+}
+
+AboutSection* FullInterface::getAboutSection() {
+  if (about_section_ == nullptr) {
+    about_section_ = new AboutSection("about");
+    addOverlay(about_section_);
+  }
+  return about_section_;
+}
+
+void FullInterface::addOverlay(Overlay* overlay) {
+  addChildComponent(overlay);
+  overlay->toFront(false);
+  if (contribute_section_)
+    contribute_section_->toFront(false);
+  resizeOverlays();
+}
+
+void FullInterface::resizeOverlays() {
+  if (about_section_) {
+    about_section_->setSizeRatio(size_ratio_);
+    about_section_->setBounds(getBounds());
+  }
+  if (contribute_section_) {
+    contribute_section_->setSizeRatio(size_ratio_);
+    contribute_section_->setBounds(getBounds());
+  }
+  if (save_section_) {
+    save_section_->setSizeRatio(size_ratio_);
+    save_section_->setBounds(getBounds());
+  }
+  if (delete_section_) {
+    delete_section_->setSizeRatio(size_ratio_);
+    delete_section_->setBounds(getBounds());
+  }
+  if (patch_browser_) {
+    int padding = 8 * size_ratio_;
+    patch_browser_->setSizeRatio(size_ratio_);
+    patch_browser_->setBounds(synthesis_interface_->getX() + padding, synthesis_interface_->getY(),
+                              arp_section_->getRight() - synthesis_interface_->getX() - padding,
+                              synthesis_interface_->getHeight() - padding);
+  }
+}
+
 void FullInterface::setToolTipText(String parameter, String value) {
   if (global_tool_tip_)
     global_tool_tip_->setText(parameter, value);
@@ -278,7 +353,7 @@ void FullInterface::setToolTipText(String parameter, String value) {
 
 void FullInterface::buttonClicked(Button* clicked_button) {
   if (clicked_button == logo_button_) {
-    about_section_->setVisible(true);
+    getAboutSection()->setVisible(true);
   }
   else
     SynthSection::buttonClicked(clicked_button);
@@ -287,7 +362,8 @@ void FullInterface::buttonClicked(Button* clicked_button) {
 void FullInterface::animate(bool animate) {
   animate_ = animate;
   SynthSection::animate(animate);
-  open_gl_context.setContinuousRepainting(animate);
+  frame_scheduler_.setActive(animate);
+  open_gl_context.triggerRepaint();
   repaint();
 }
 
@@ -316,6 +392,21 @@ void FullInterface::renderOpenGL() {
   renderOpenGLComponents(open_gl_context, animate_);
 }
 
+bool FullInterface::updateFrame() {
+  bool changed = false;
+  if (background_pending_ &&
+      Time::getMillisecondCounter() - background_resized_ms_ >= BACKGROUND_SETTLE_MS) {
+    background_pending_ = false;
+    checkBackground();
+    changed = true;
+  }
+
+  changed = openGLComponentsNeedRender(animate_) || changed;
+  if (changed)
+    open_gl_context.triggerRepaint();
+  return changed;
+}
+
 void FullInterface::openGLContextClosing() {
   background_.destroy(open_gl_context);
   destroyOpenGLComponents(open_gl_context);
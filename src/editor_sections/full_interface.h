@@ -24,6 +24,7 @@
 #include "arp_section.h"
 #include "bpm_section.h"
 #include "contribute_section.h"
+#include "frame_scheduler.h"
 #include "global_tool_tip.h"
 #include "open_gl_modulation_manager.h"
 #include "oscilloscope.h"
@@ -37,7 +38,8 @@
 #include "synth_section.h"
 #include "update_check_section.h"
 
-class FullInterface : public SynthSection, public OpenGLRenderer {
+class FullInterface : public SynthSection, public OpenGLRenderer,
+                      public FrameScheduler::Client, public SaveSection::Listener {
   public:
     FullInterface(mopo::control_map controls, mopo::output_map modulation_sources,
                   mopo::output_map mono_modulations, mopo::output_map poly_modulations,
@@ -63,13 +65,28 @@ class FullInterface : public SynthSection, public OpenGLRenderer {
     void renderOpenGL() override;
     void openGLContextClosing() override;
 
+    // Only renders an OpenGL frame when a component has something new to draw.
+    bool updateFrame() override;
+    FrameScheduler& getFrameScheduler() { return frame_scheduler_; }
+
     void resetModulations() { modulation_manager_->reset(); }
     void setFocus() { synthesis_interface_->setFocus(); }
     void notifyChange() { patch_selector_->setModified(true); }
     void notifyFresh();
-    void externalPatchLoaded(File patch) { patch_browser_->externalPatchLoaded(patch); }
+    void externalPatchLoaded(File patch);
+    void fileSaved(File save_file) override;
+
+    // Overlays are only built the first time they're needed.
+    PatchBrowser* getPatchBrowser();
+    SaveSection* getSaveSection();
+    DeleteSection* getDeleteSection();
+    AboutSection* getAboutSection();
 
   private:
+    void addOverlay(Overlay* overlay);
+    void resizeOverlays();
+
+    FrameScheduler frame_scheduler_;
     std::map<std::string, SynthSlider*> slider_lookup_;
     std::map<std::string, Button*> button_lookup_;
     ScopedPointer<OpenGLModulationManager> modulation_manager_;
@@ -91,7 +108,10 @@ class FullInterface : public SynthSection, public OpenGLRenderer {
     ScopedPointer<DeleteSection> delete_section_;
     ScopedPointer<VolumeSection> volume_section_;
 
+    File external_patch_;
     bool animate_;
+    bool background_pending_;
+    uint32 background_resized_ms_;
     OpenGLContext open_gl_context;
     Image background_image_;
     OpenGLBackground background_;
@@ -55,60 +55,27 @@ OpenGLModulationManager::OpenGLModulationManager(
   for (auto& mod_button : modulation_buttons_) {
     mod_button.second->addListener(this);
     mod_button.second->addDisconnectListener(this);
-
-    // Create modulation highlight overlays.
-    std::string name = mod_button.second->getName().toStdString();
-    ModulationHighlight* overlay = new ModulationHighlight();
-    addChildComponent(overlay);
-    overlay_lookup_[name] = overlay;
-    overlay->setName(name);
-    Rectangle<int> local_bounds = mod_button.second->getBoundsInParent();
-    overlay->setBounds(mod_button.second->getParentComponent()->localAreaToGlobal(local_bounds));
   }
 
+  // Meters, highlights and modulation sliders are only created once they're
+  // shown. Most patches only modulate a few of the destinations.
+  mono_modulations_ = mono_modulations;
+  poly_modulations_ = poly_modulations;
   slider_model_lookup_ = sliders;
   vertices_ = new float[FLOATS_PER_METER * slider_model_lookup_.size()];
   triangles_ = new int[INDICES_PER_METER * slider_model_lookup_.size()];
 
   int i = 0;
   for (auto& slider : slider_model_lookup_) {
-    std::string name = slider.first;
-    const mopo::Output* mono_total = mono_modulations[name];
-    const mopo::Output* poly_total = poly_modulations[name];
-
     float* meter_vertices = vertices_ + (i * FLOATS_PER_METER);
     memset(meter_vertices, 0, FLOATS_PER_METER * sizeof(float));
+    meter_vertices_[slider.first] = meter_vertices;
 
     int* meter_triangles = triangles_ + (i * INDICES_PER_METER);
     for (int t = 0; t < INDICES_PER_METER; ++t)
       meter_triangles[t] = i * POINTS_PER_METER + quad_triangles[t];
 
     slider.second->addSliderListener(this);
-
-    // Create modulation meter.
-    if (mono_total) {
-      std::string name = slider.second->getName().toStdString();
-      OpenGLModulationMeter* meter = new OpenGLModulationMeter(mono_total, poly_total,
-                                                               slider.second, meter_vertices);
-      addChildComponent(meter);
-      meter_lookup_[name] = meter;
-      meter->setName(name);
-      Rectangle<int> local_bounds = slider.second->getBoundsInParent();
-      meter->setBounds(slider.second->getParentComponent()->localAreaToGlobal(local_bounds));
-    }
-
-    // Create modulation slider.
-    ModulationSlider* mod_slider = new ModulationSlider(slider.second);
-    mod_slider->setLookAndFeel(ModulationLookAndFeel::instance());
-    mod_slider->addListener(this);
-    if (poly_total)
-      polyphonic_destinations_->addAndMakeVisible(mod_slider);
-    else
-      monophonic_destinations_->addAndMakeVisible(mod_slider);
-
-    slider_lookup_[name] = mod_slider;
-    owned_sliders_.push_back(mod_slider);
-
     ++i;
   }
 
@@ -131,40 +98,21 @@ void OpenGLModulationManager::paint(Graphics& g) {
 }
 
 void OpenGLModulationManager::resized() {
-  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
   polyphonic_destinations_->setBounds(getBounds());
   monophonic_destinations_->setBounds(getBounds());
 
   // Update modulation slider locations.
   for (auto& slider : slider_lookup_) {
     SynthSlider* model = slider_model_lookup_[slider.first];
-    Point<float> local_top_left = getLocalPoint(model, Point<float>(0.0f, 0.0f));
     slider.second->setVisible(model->isVisible());
-    slider.second->setBounds(local_top_left.x, local_top_left.y,
-                             model->getWidth(), model->getHeight());
-  }
-
-  // Update modulation meter locations.
-  for (auto& meter : meter_lookup_) {
-    Slider* model = slider_model_lookup_[meter.first];
-    Point<float> local_top_left = getLocalPoint(model, Point<float>(0.0f, 0.0f));
-    meter.second->setBounds(local_top_left.x, local_top_left.y,
-                            model->getWidth(), model->getHeight());
-    if (parent) {
-      int num_modulations = parent->getSynth()->getNumModulations(meter.first);
-      meter.second->setModulated(num_modulations);
-      meter.second->setVisible(num_modulations);
-    }
+    placeOnModel(slider.second, model);
   }
 
   // Update modulation highlight overlay locations.
-  for (auto& overlay : overlay_lookup_) {
-    ModulationButton* model = modulation_buttons_[overlay.first];
-    Point<float> local_top_left = getLocalPoint(model, Point<float>(0.0f, 0.0f));
-    overlay.second->setBounds(local_top_left.x, local_top_left.y,
-                              model->getWidth(), model->getHeight());
-  }
+  for (auto& overlay : overlay_lookup_)
+    placeOnModel(overlay.second, modulation_buttons_[overlay.first]);
 
+  updateMeters();
   OpenGLComponent::resized();
 }
 
@@ -190,13 +138,13 @@ void OpenGLModulationManager::sliderValueChanged(juce::Slider *moved_slider) {
 }
 
 void OpenGLModulationManager::modulationDisconnected(mopo::ModulationConnection* connection, bool last) {
-  if (connection->source == current_modulator_) {
+  if (connection->source == current_modulator_ && slider_lookup_.count(connection->destination)) {
     Slider* slider = slider_lookup_[connection->destination];
     slider->setValue(slider->getDoubleClickReturnValue());
   }
 
-  meter_lookup_[connection->destination]->setModulated(!last);
-  meter_lookup_[connection->destination]->setVisible(!last);
+  updateMeter(connection->destination, last ? 0 : 1);
+  invalidate();
 }
 
 void OpenGLModulationManager::init(OpenGLContext& open_gl_context) {
@@ -231,15 +179,21 @@ void OpenGLModulationManager::init(OpenGLContext& open_gl_context) {
   }
 }
 
-void OpenGLModulationManager::render(OpenGLContext& open_gl_context, bool animate) {
+bool OpenGLModulationManager::needsRender(bool animate) {
+  bool changed = OpenGLComponent::needsRender(animate);
   if (!animate)
-    return;
+    return changed;
 
-  for (auto& meter : meter_lookup_) {
-    bool show = meter.second->isModulated() && slider_model_lookup_[meter.first]->isVisible();
-    if (show)
-      meter.second->updateDrawing();
+  for (OpenGLModulationMeter* meter : meters_) {
+    if (meter->isModulated() && meter->isDestinationVisible())
+      changed = meter->updateDrawing() || changed;
   }
+  return changed;
+}
+
+void OpenGLModulationManager::render(OpenGLContext& open_gl_context, bool animate) {
+  if (!animate)
+    return;
 
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -315,9 +269,8 @@ void OpenGLModulationManager::modulationsChanged(const std::string& destination)
   if (parent == nullptr)
     return;
   
-  int num_modulations = parent->getSynth()->getNumModulations(destination);
-  meter_lookup_[destination]->setModulated(num_modulations);
-  meter_lookup_[destination]->setVisible(num_modulations);
+  updateMeter(destination, parent->getSynth()->getNumModulations(destination));
+  invalidate();
 }
 
 void OpenGLModulationManager::setModulationAmount(std::string source, std::string destination,
@@ -337,16 +290,11 @@ void OpenGLModulationManager::forgetModulator() {
 }
 
 void OpenGLModulationManager::reset() {
-  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
-  if (parent == nullptr)
+  if (findParentComponentOfClass<SynthGuiInterface>() == nullptr)
     return;
 
-  for (auto& meter : meter_lookup_) {
-    int num_modulations = parent->getSynth()->getNumModulations(meter.first);
-    meter.second->setModulated(num_modulations);
-    meter.second->setVisible(num_modulations);
-  }
-
+  updateMeters();
+  invalidate();
   setSliderValues();
 }
 
@@ -358,8 +306,12 @@ void OpenGLModulationManager::makeModulationsVisible(std::string destination, bo
   std::vector<mopo::ModulationConnection*> connections =
       parent->getSynth()->getDestinationConnections(destination);
 
-  for (mopo::ModulationConnection* connection : connections)
-    overlay_lookup_[connection->source]->setVisible(visible);
+  for (mopo::ModulationConnection* connection : connections) {
+    if (visible)
+      getHighlight(connection->source)->setVisible(true);
+    else if (overlay_lookup_.count(connection->source))
+      overlay_lookup_[connection->source]->setVisible(false);
+  }
 }
 
 void OpenGLModulationManager::setSliderValues() {
@@ -385,6 +337,9 @@ void OpenGLModulationManager::setSliderValues() {
 }
 
 void OpenGLModulationManager::changeModulator(std::string new_modulator) {
+  if (owned_sliders_.empty())
+    createModulationSliders();
+
   current_modulator_ = new_modulator;
   setSliderValues();
 
@@ -398,3 +353,86 @@ void OpenGLModulationManager::changeModulator(std::string new_modulator) {
   monophonic_destinations_->setVisible(true);
   monophonic_destinations_->repaint();
 }
+
+void OpenGLModulationManager::placeOnModel(Component* component, Component* model) {
+  Point<float> local_top_left = getLocalPoint(model, Point<float>(0.0f, 0.0f));
+  component->setBounds(local_top_left.x, local_top_left.y, model->getWidth(), model->getHeight());
+}
+
+void OpenGLModulationManager::createModulationSliders() {
+  for (auto& slider : slider_model_lookup_) {
+    ModulationSlider* mod_slider = new ModulationSlider(slider.second);
+    mod_slider->setLookAndFeel(ModulationLookAndFeel::instance());
+    mod_slider->addListener(this);
+    if (poly_modulations_[slider.first])
+      polyphonic_destinations_->addAndMakeVisible(mod_slider);
+    else
+      monophonic_destinations_->addAndMakeVisible(mod_slider);
+
+    placeOnModel(mod_slider, slider.second);
+    slider_lookup_[slider.first] = mod_slider;
+    owned_sliders_.push_back(mod_slider);
+  }
+}
+
+ModulationHighlight* OpenGLModulationManager::getHighlight(const std::string& source) {
+  if (overlay_lookup_.count(source))
+    return overlay_lookup_[source];
+
+  ModulationHighlight* overlay = new ModulationHighlight();
+  addChildComponent(overlay);
+  overlay_lookup_[source] = overlay;
+  overlay->setName(source);
+  placeOnModel(overlay, modulation_buttons_[source]);
+  return overlay;
+}
+
+void OpenGLModulationManager::updateMeter(const std::string& destination, int num_modulations) {
+  OpenGLModulationMeter* meter = nullptr;
+  if (meter_lookup_.count(destination))
+    meter = meter_lookup_[destination];
+  else if (num_modulations && mono_modulations_[destination]) {
+    SynthSlider* model = slider_model_lookup_[destination];
+    meter = new OpenGLModulationMeter(mono_modulations_[destination],
+                                      poly_modulations_[destination],
+                                      model, meter_vertices_[destination]);
+    addChildComponent(meter);
+    meter_lookup_[destination] = meter;
+    meters_.push_back(meter);
+    meter->setName(destination);
+    placeOnModel(meter, model);
+  }
+
+  if (meter == nullptr)
+    return;
+
+  // Only modulated meters read their voice readout.
+  bool modulated = num_modulations;
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  if (parent && modulated != subscribed_readouts_.count(destination)) {
+    if (modulated) {
+      parent->getSynth()->subscribeReadout(poly_modulations_[destination]);
+      subscribed_readouts_.insert(destination);
+    }
+    else {
+      parent->getSynth()->unsubscribeReadout(poly_modulations_[destination]);
+      subscribed_readouts_.erase(destination);
+    }
+  }
+
+  meter->setModulated(modulated);
+  meter->setVisible(modulated);
+}
+
+void OpenGLModulationManager::updateMeters() {
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  if (parent == nullptr)
+    return;
+
+  for (auto& slider : slider_model_lookup_) {
+    std::string name = slider.first;
+    if (meter_lookup_.count(name))
+      placeOnModel(meter_lookup_[name], slider.second);
+    updateMeter(name, parent->getSynth()->getNumModulations(name));
+  }
+}
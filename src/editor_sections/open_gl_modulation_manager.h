@@ -53,6 +53,7 @@ class OpenGLModulationManager : public OpenGLComponent,
     void sliderValueChanged(Slider* moved_slider) override;
     void modulationDisconnected(mopo::ModulationConnection* connection, bool last) override;
 
+    bool needsRender(bool animate = true) override;
     void init(OpenGLContext& open_gl_context) override;
     void render(OpenGLContext& open_gl_context, bool animate = true) override;
     void destroy(OpenGLContext& open_gl_context) override;
@@ -66,6 +67,11 @@ class OpenGLModulationManager : public OpenGLComponent,
   private:
     void makeModulationsVisible(std::string destination, bool visible);
     void setSliderValues();
+    void placeOnModel(Component* component, Component* model);
+    void createModulationSliders();
+    ModulationHighlight* getHighlight(const std::string& source);
+    void updateMeter(const std::string& destination, int num_modulations);
+    void updateMeters();
 
     ScopedPointer<Component> polyphonic_destinations_;
     ScopedPointer<Component> monophonic_destinations_;
@@ -79,8 +85,13 @@ class OpenGLModulationManager : public OpenGLComponent,
     std::vector<Slider*> owned_sliders_;
 
     std::map<std::string, OpenGLModulationMeter*> meter_lookup_;
+    std::vector<OpenGLModulationMeter*> meters_;
+    std::map<std::string, float*> meter_vertices_;
+    std::set<std::string> subscribed_readouts_;
     std::map<std::string, ModulationHighlight*> overlay_lookup_;
     mopo::output_map modulation_sources_;
+    mopo::output_map mono_modulations_;
+    mopo::output_map poly_modulations_;
 
     ScopedPointer<OpenGLShaderProgram> shader_;
     ScopedPointer<OpenGLShaderProgram::Attribute> position_;
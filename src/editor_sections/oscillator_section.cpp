@@ -47,8 +47,10 @@ OscillatorSection::OscillatorSection(String name) : SynthSection(name) {
 
   addAndMakeVisible(wave_viewer_1_ = new WaveViewer(WAVE_RESOLUTION));
   wave_viewer_1_->setWaveSlider(wave_selector_1_);
+  wave_viewer_1_->setWavetableSlot(mopo::Wavetable::kOscillator1);
   addAndMakeVisible(wave_viewer_2_ = new WaveViewer(WAVE_RESOLUTION));
   wave_viewer_2_->setWaveSlider(wave_selector_2_);
+  wave_viewer_2_->setWavetableSlot(mopo::Wavetable::kOscillator2);
 
   addSlider(cross_modulation_ = new SynthSlider("cross_modulation"));
   cross_modulation_->setSliderStyle(Slider::RotaryHorizontalVerticalDrag);
@@ -468,7 +468,6 @@ void PatchBrowser::setPatchInfo(File& patch) {
 
 void PatchBrowser::setSaveSection(SaveSection* save_section) {
   save_section_ = save_section;
-  save_section_->setListener(this);
 }
 
 void PatchBrowser::setDeleteSection(DeleteSection* delete_section) {
@@ -32,6 +32,7 @@ SubSection::SubSection(String name) : SynthSection(name) {
 
   addAndMakeVisible(wave_viewer_ = new WaveViewer(WAVE_VIEWER_RESOLUTION));
   wave_viewer_->setWaveSlider(wave_selector_);
+  wave_viewer_->setWavetableSlot(mopo::Wavetable::kSubOscillator);
 
   addSlider(shuffle_ = new SynthSlider("sub_shuffle"));
   shuffle_->setSliderStyle(Slider::RotaryHorizontalVerticalDrag);
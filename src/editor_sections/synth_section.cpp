@@ -110,6 +110,17 @@ void SynthSection::initOpenGLComponents(OpenGLContext& open_gl_context) {
     sub_section.second->initOpenGLComponents(open_gl_context);
 }
 
+bool SynthSection::openGLComponentsNeedRender(bool animate) {
+  bool needs_render = false;
+  for (auto& open_gl_component : open_gl_components_)
+    needs_render = open_gl_component->needsRender(animate) || needs_render;
+
+  for (auto& sub_section : sub_sections_)
+    needs_render = sub_section.second->openGLComponentsNeedRender(animate) || needs_render;
+
+  return needs_render;
+}
+
 void SynthSection::renderOpenGLComponents(OpenGLContext& open_gl_context, bool animate) {
   for (auto& open_gl_component : open_gl_components_)
     open_gl_component->render(open_gl_context, animate);
@@ -46,6 +46,7 @@ class SynthSection : public Component, public Slider::Listener,
     void paintChildBackground(Graphics& g, SynthSection* child);
     void paintOpenGLBackground(Graphics& g, OpenGLComponent* child);
     void initOpenGLComponents(OpenGLContext& open_gl_context);
+    bool openGLComponentsNeedRender(bool animate);
     void renderOpenGLComponents(OpenGLContext& open_gl_context, bool animate);
     void destroyOpenGLComponents(OpenGLContext& open_gl_context);
 
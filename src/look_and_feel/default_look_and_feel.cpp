@@ -20,9 +20,18 @@
 #include "synth_slider.h"
 #include "utils.h"
 
+#include <tuple>
+
 #define POWER_ARC_ANGLE 2.5
+#define KNOB_SPRITE_FRAMES 256
+#define MAX_KNOB_SPRITE_MEMORY (16 * 1024 * 1024)
+
+bool DefaultLookAndFeel::KnobStyle::operator<(const KnobStyle& other) const {
+  return std::tie(diameter, bipolar, active, start_angle, end_angle) <
+         std::tie(other.diameter, other.bipolar, other.active, other.start_angle, other.end_angle);
+}
 
-DefaultLookAndFeel::DefaultLookAndFeel() {
+DefaultLookAndFeel::DefaultLookAndFeel() : knob_sprite_memory_(0), knob_sprite_clock_(0) {
   setColour(PopupMenu::backgroundColourId, Colour(0xff333333));
   setColour(PopupMenu::textColourId, Colour(0xffcccccc));
   setColour(PopupMenu::headerTextColourId, Colour(0xff333333));
@@ -109,12 +118,12 @@ void DefaultLookAndFeel::drawLinearSliderThumb(Graphics& g, int x, int y, int wi
                                         slider_pos, min, max, style, slider);
 }
 
-void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width, int height,
-                                          float slider_t, float start_angle, float end_angle,
-                                          Slider& slider) {
+void DefaultLookAndFeel::paintRotaryKnob(Graphics& g, float full_radius, float slider_t,
+                                         const KnobStyle& style) {
   static const float stroke_percent = 0.1f;
-  
-  float full_radius = std::min(width / 2.0f, height / 2.0f);
+
+  float start_angle = style.start_angle;
+  float end_angle = style.end_angle;
   float stroke_width = 2.0f * full_radius * stroke_percent;
   float knob_radius = 0.63f * full_radius;
   float small_outer_radius = knob_radius + stroke_width / 6.0f;
@@ -125,41 +134,19 @@ void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width,
   float end_x = full_radius + 0.8f * knob_radius * sin(current_angle);
   float end_y = full_radius - 0.8f * knob_radius * cos(current_angle);
 
-  if (slider.getInterval() == 1) {
-    static const float TEXT_W_PERCENT = 0.35f;
-    Rectangle<float> text_bounds(1.0f + width * (1.0f - TEXT_W_PERCENT) / 2.0f,
-                                 0.5f * height, width * TEXT_W_PERCENT, 0.5f * height);
-
-    g.setColour(Colour(0xff464646));
-    g.fillRoundedRectangle(text_bounds, 2.0f);
-
-    g.setColour(Colour(0xff999999));
-    g.setFont(Fonts::instance()->proportional_regular().withPointHeight(0.2f * height));
-    g.drawFittedText(String(slider.getValue()), text_bounds.getSmallestIntegerContainer(),
-                     Justification::horizontallyCentred | Justification::bottom, 1);
-  }
-
   Path active_section;
-  bool bipolar = false;
-  bool active = true;
-  SynthSlider* s_slider = dynamic_cast<SynthSlider*>(&slider);
-  if (s_slider) {
-    bipolar = s_slider->isBipolar();
-    active = s_slider->isActive();
-  }
-
   Path rail;
   rail.addCentredArc(full_radius, full_radius, small_outer_radius, small_outer_radius,
                      0.0f, start_angle, end_angle, true);
 
-  if (active)
+  if (style.active)
     g.setColour(Colour(0xff4a4a4a));
   else
     g.setColour(Colour(0xff333333));
 
   g.strokePath(rail, outer_stroke);
 
-  if (bipolar) {
+  if (style.bipolar) {
     active_section.addCentredArc(full_radius, full_radius, small_outer_radius, small_outer_radius,
                                  0.0f, 0.0f, current_angle - 2.0f * mopo::PI, true);
   }
@@ -168,14 +155,14 @@ void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width,
                                  0.0f, start_angle, current_angle, true);
   }
 
-  if (active)
+  if (style.active)
     g.setColour(Colour(0xffffab00));
   else
     g.setColour(Colour(0xff555555));
 
   g.strokePath(active_section, outer_stroke);
 
-  if (active)
+  if (style.active)
     g.setColour(Colour(0xff000000));
   else
     g.setColour(Colour(0xff444444));
@@ -185,7 +172,7 @@ void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width,
                 2.0f * knob_radius,
                 2.0f * knob_radius);
 
-  if (active)
+  if (style.active)
     g.setColour(Colour(0xff666666));
   else
     g.setColour(Colour(0xff555555));
@@ -199,6 +186,86 @@ void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width,
   g.drawLine(full_radius, full_radius, end_x, end_y, 1.0f);
 }
 
+const Image& DefaultLookAndFeel::getKnobSprite(const KnobStyle& style, float full_radius,
+                                               float slider_t) {
+  KnobSprites& sprites = knob_sprites_[style];
+  sprites.last_used = ++knob_sprite_clock_;
+  if (sprites.frames.empty()) {
+    sprites.frames.resize(KNOB_SPRITE_FRAMES);
+    sprites.memory = 0;
+  }
+
+  float t = mopo::utils::clamp(slider_t, 0.0f, 1.0f);
+  int frame = roundToInt(t * (KNOB_SPRITE_FRAMES - 1));
+  Image& sprite = sprites.frames[frame];
+  if (sprite.isValid())
+    return sprite;
+
+  sprite = Image(Image::ARGB, style.diameter, style.diameter, true);
+  Graphics g(sprite);
+  g.addTransform(AffineTransform::scale(style.diameter / (2.0f * full_radius)));
+  paintRotaryKnob(g, full_radius, frame / (KNOB_SPRITE_FRAMES - 1.0f), style);
+
+  size_t memory = style.diameter * style.diameter * sizeof(PixelARGB);
+  sprites.memory += memory;
+  knob_sprite_memory_ += memory;
+  trimKnobSprites();
+  return sprite;
+}
+
+// Drops the least recently drawn sizes and styles, never the current one.
+void DefaultLookAndFeel::trimKnobSprites() {
+  while (knob_sprite_memory_ > MAX_KNOB_SPRITE_MEMORY && knob_sprites_.size() > 1) {
+    auto oldest = knob_sprites_.begin();
+    for (auto iter = knob_sprites_.begin(); iter != knob_sprites_.end(); ++iter) {
+      if (iter->second.last_used < oldest->second.last_used)
+        oldest = iter;
+    }
+
+    knob_sprite_memory_ -= oldest->second.memory;
+    knob_sprites_.erase(oldest);
+  }
+}
+
+void DefaultLookAndFeel::drawRotarySlider(Graphics& g, int x, int y, int width, int height,
+                                          float slider_t, float start_angle, float end_angle,
+                                          Slider& slider) {
+  float full_radius = std::min(width / 2.0f, height / 2.0f);
+
+  if (slider.getInterval() == 1) {
+    static const float TEXT_W_PERCENT = 0.35f;
+    Rectangle<float> text_bounds(1.0f + width * (1.0f - TEXT_W_PERCENT) / 2.0f,
+                                 0.5f * height, width * TEXT_W_PERCENT, 0.5f * height);
+
+    g.setColour(Colour(0xff464646));
+    g.fillRoundedRectangle(text_bounds, 2.0f);
+
+    g.setColour(Colour(0xff999999));
+    g.setFont(Fonts::instance()->proportional_regular().withPointHeight(0.2f * height));
+    g.drawFittedText(String(slider.getValue()), text_bounds.getSmallestIntegerContainer(),
+                     Justification::horizontallyCentred | Justification::bottom, 1);
+  }
+
+  KnobStyle style;
+  style.bipolar = false;
+  style.active = true;
+  style.start_angle = start_angle;
+  style.end_angle = end_angle;
+  SynthSlider* s_slider = dynamic_cast<SynthSlider*>(&slider);
+  if (s_slider) {
+    style.bipolar = s_slider->isBipolar();
+    style.active = s_slider->isActive();
+  }
+
+  float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+  style.diameter = roundToInt(2.0f * full_radius * scale);
+  if (style.diameter <= 0)
+    return;
+
+  const Image& sprite = getKnobSprite(style, full_radius, slider_t);
+  g.drawImage(sprite, Rectangle<float>(0.0f, 0.0f, 2.0f * full_radius, 2.0f * full_radius));
+}
+
 void DefaultLookAndFeel::drawToggleButton(Graphics& g, ToggleButton& button,
                                           bool hover, bool is_down) {
   static const DropShadow shadow(Colour(0x88000000), 1.0f, Point<int>(0, 0));
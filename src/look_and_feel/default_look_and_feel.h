@@ -19,6 +19,9 @@
 
 #include "JuceHeader.h"
 
+#include <map>
+#include <vector>
+
 class DefaultLookAndFeel : public juce::LookAndFeel_V3 {
   public:
     void drawLinearSlider(Graphics& g, int x, int y, int width, int height,
@@ -61,6 +64,34 @@ class DefaultLookAndFeel : public juce::LookAndFeel_V3 {
 
   protected:
     DefaultLookAndFeel();
+
+  private:
+    // Knobs are drawn from sprites that are rendered the first time a value
+    // step is shown at a given physical size and style.
+    struct KnobStyle {
+      int diameter;
+      bool bipolar;
+      bool active;
+      float start_angle;
+      float end_angle;
+
+      bool operator<(const KnobStyle& other) const;
+    };
+
+    struct KnobSprites {
+      std::vector<Image> frames;
+      size_t memory;
+      uint32 last_used;
+    };
+
+    static void paintRotaryKnob(Graphics& g, float full_radius, float slider_t,
+                                const KnobStyle& style);
+    const Image& getKnobSprite(const KnobStyle& style, float full_radius, float slider_t);
+    void trimKnobSprites();
+
+    std::map<KnobStyle, KnobSprites> knob_sprites_;
+    size_t knob_sprite_memory_;
+    uint32 knob_sprite_clock_;
 };
 
 #endif // DEFAULT_LOOK_AND_FEEL_H
@@ -15,6 +15,7 @@
  */
 
 #include "helm_plugin.h"
+#include "bank_pack.h"
 #include "helm_common.h"
 #include "helm_editor.h"
 #include "load_save.h"
@@ -27,6 +28,7 @@ HelmPlugin::HelmPlugin() {
   set_state_time_ = 0;
 
   current_program_ = 0;
+  num_pack_patches_ = 0;
 
   loadPatches();
 
@@ -36,6 +38,8 @@ HelmPlugin::HelmPlugin() {
     bridge_lookup_[control.first] = bridge;
     addParameter(bridge);
   }
+
+  setLatencySamples(getOversamplingLatency());
 }
 
 HelmPlugin::~HelmPlugin() {
@@ -63,6 +67,10 @@ void HelmPlugin::setValueNotifyHost(const std::string& name, mopo::mopo_float va
   bridge_lookup_[name]->setValueNotifyHost(plugin_value);
 }
 
+void HelmPlugin::setLatencyNotifyHost(int samples) {
+  setLatencySamples(samples);
+}
+
 const CriticalSection& HelmPlugin::getCriticalSection() {
   return getCallbackLock();
 }
@@ -108,11 +116,11 @@ bool HelmPlugin::silenceInProducesSilenceOut() const {
 }
 
 double HelmPlugin::getTailLengthSeconds() const {
-  return 0.0;
+  return engine_.getTailLength();
 }
 
 int HelmPlugin::getNumPrograms() {
-  return std::max(1, all_patches_.size());
+  return std::max(1, all_patches_.size() + num_pack_patches_);
 }
 
 int HelmPlugin::getCurrentProgram() {
@@ -124,20 +132,30 @@ void HelmPlugin::setCurrentProgram(int index) {
   if (Time::getMillisecondCounter() - set_state_time_ < SET_PROGRAM_WAIT_MILLISECONDS)
     return;
 
-  if (all_patches_.size() > index) {
-    current_program_ = index;
-    LoadSave::loadPatchFile(all_patches_[current_program_], this, save_info_);
-    SynthGuiInterface* editor = getGuiInterface();
-    if (editor)
-      editor->updateFullGui();
-  }
+  int pack_index = 0;
+  BankPack* bank_pack = getBankPack(index, pack_index);
+  if (all_patches_.size() > index)
+    LoadSave::loadPatchFile(all_patches_[index], this, save_info_);
+  else if (bank_pack)
+    LoadSave::varToState(this, save_info_, bank_pack->getPatchState(pack_index));
+  else
+    return;
+
+  current_program_ = index;
+  SynthGuiInterface* editor = getGuiInterface();
+  if (editor)
+    editor->updateFullGui();
 }
 
 const String HelmPlugin::getProgramName(int index) {
-  if (all_patches_.size() <= index)
-    return "";
-
-  return all_patches_[index].getFileNameWithoutExtension();
+  if (all_patches_.size() > index)
+    return all_patches_[index].getFileNameWithoutExtension();
+
+  int pack_index = 0;
+  BankPack* bank_pack = getBankPack(index, pack_index);
+  if (bank_pack)
+    return bank_pack->getPatchName(pack_index);
+  return "";
 }
 
 void HelmPlugin::changeProgramName(int index, const String& new_name) {
@@ -150,6 +168,7 @@ void HelmPlugin::changeProgramName(int index, const String& new_name) {
 }
 
 void HelmPlugin::prepareToPlay(double sample_rate, int buffer_size) {
+  ScopedLock lock(voice_build_lock_);
   engine_.setSampleRate(sample_rate);
   engine_.setBufferSize(std::min<int>(buffer_size, MAX_BUFFER_PROCESS));
   midi_manager_->setSampleRate(sample_rate);
@@ -172,6 +191,9 @@ void HelmPlugin::processBlock(AudioSampleBuffer& buffer, MidiBuffer& midi_messag
 
   processControlChanges();
   processModulationChanges();
+  processReadoutChanges();
+  processWavetableChanges();
+  processVoiceChanges();
 
   MidiBuffer keyboard_messages = midi_messages;
   processKeyboardEvents(keyboard_messages, total_samples);
@@ -200,6 +222,31 @@ void HelmPlugin::parameterChanged(std::string name, mopo::mopo_float value) {
 
 void HelmPlugin::loadPatches() {
   all_patches_ = LoadSave::getAllPatches();
+
+  bank_packs_.clear();
+  num_pack_patches_ = 0;
+  for (File pack_file : LoadSave::getAllBankPacks()) {
+    BankPack* bank_pack = new BankPack(pack_file);
+    if (bank_pack->isValid()) {
+      bank_packs_.add(bank_pack);
+      num_pack_patches_ += bank_pack->getNumPatches();
+    }
+    else
+      delete bank_pack;
+  }
+}
+
+BankPack* HelmPlugin::getBankPack(int index, int& pack_index) {
+  pack_index = index - all_patches_.size();
+  if (pack_index < 0)
+    return nullptr;
+
+  for (BankPack* bank_pack : bank_packs_) {
+    if (pack_index < bank_pack->getNumPatches())
+      return bank_pack;
+    pack_index -= bank_pack->getNumPatches();
+  }
+  return nullptr;
 }
 
 void HelmPlugin::getStateInformation(MemoryBlock& dest_data) {
@@ -22,6 +22,7 @@
 #include "synth_base.h"
 #include "value_bridge.h"
 
+class BankPack;
 class ValueBridge;
 
 class HelmPlugin : public SynthBase, public AudioProcessor, public ValueBridge::Listener {
@@ -34,6 +35,7 @@ class HelmPlugin : public SynthBase, public AudioProcessor, public ValueBridge::
     void beginChangeGesture(const std::string& name) override;
     void endChangeGesture(const std::string& name) override;
     void setValueNotifyHost(const std::string& name, mopo::mopo_float value) override;
+    void setLatencyNotifyHost(int samples) override;
     const CriticalSection& getCriticalSection() override;
 
     // AudioProcessor
@@ -71,10 +73,15 @@ class HelmPlugin : public SynthBase, public AudioProcessor, public ValueBridge::
     void loadPatches();
 
   private:
+    // Programs past the loose patch files come from the bank packs in order.
+    BankPack* getBankPack(int index, int& pack_index);
+
     uint32 set_state_time_;
 
     int current_program_;
     Array<File> all_patches_;
+    OwnedArray<BankPack> bank_packs_;
+    int num_pack_patches_;
     AudioPlayHead::CurrentPositionInfo position_info_;
 
     std::map<std::string, ValueBridge*> bridge_lookup_;
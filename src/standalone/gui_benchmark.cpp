@@ -0,0 +1,183 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gui_benchmark.h"
+
+#include "default_look_and_feel.h"
+#include "full_interface.h"
+#include "helm_common.h"
+#include "modulation_button.h"
+#include "open_gl_modulation_manager.h"
+#include "patch_browser.h"
+#include "synth_section.h"
+
+#include <map>
+
+#define RESIZE_SCALE 0.75
+
+namespace {
+  double ticksToMs(int64 ticks) {
+    return 1000.0 * ticks / Time::getHighResolutionTicksPerSecond();
+  }
+} // namespace
+
+void GuiBenchmark::Timing::add(double ms) {
+  frames++;
+  total_ms += ms;
+  peak_ms = std::max(peak_ms, ms);
+}
+
+GuiBenchmark::GuiBenchmark() : SynthGuiInterface(this, true) {
+  setLookAndFeel(DefaultLookAndFeel::instance());
+  addAndMakeVisible(gui_);
+  gui_->setOutputMemory(getOutputMemory());
+  setSize(mopo::DEFAULT_WINDOW_WIDTH, mopo::DEFAULT_WINDOW_HEIGHT);
+}
+
+GuiBenchmark::~GuiBenchmark() {
+  gui_ = nullptr;
+  keyboard_state_ = nullptr;
+}
+
+void GuiBenchmark::resized() {
+  if (gui_)
+    gui_->setBounds(getLocalBounds());
+}
+
+void GuiBenchmark::run(int frames, OutputStream& output) {
+  output << "scenario,section,stage,frames,average_ms,peak_ms" << newLine;
+
+  runScenario("default", frames, nullptr, output);
+
+  std::map<std::string, ModulationButton*> buttons = gui_->getAllModulationButtons();
+  if (!buttons.empty()) {
+    ModulationButton* button = buttons.begin()->second;
+    button->setToggleState(true, sendNotification);
+    runScenario("modulation", frames, nullptr, output);
+    button->setToggleState(false, sendNotification);
+  }
+
+  PatchBrowser* browser = gui_->getPatchBrowser();
+  browser->setVisible(true);
+  runScenario("patch_browser", frames, [=](int) { browser->loadNextPatch(); }, output);
+  browser->setVisible(false);
+
+  int width = getWidth();
+  int height = getHeight();
+  runScenario("resize", frames, [=](int frame) {
+    if (frame % 2)
+      setSize(width, height);
+    else
+      setSize(RESIZE_SCALE * width, RESIZE_SCALE * height);
+  }, output);
+  setSize(width, height);
+}
+
+void GuiBenchmark::runScenario(const std::string& scenario, int frames,
+                               Action action, OutputStream& output) {
+  Timings timings;
+
+  for (int frame = 0; frame < frames; ++frame) {
+    if (action) {
+      int64 start = Time::getHighResolutionTicks();
+      action(frame);
+      getTiming(timings, "full_interface/action").add(ticksToMs(Time::getHighResolutionTicks() - start));
+
+      start = Time::getHighResolutionTicks();
+      gui_->checkBackground();
+      getTiming(timings, "full_interface/check_background").add(
+          ticksToMs(Time::getHighResolutionTicks() - start));
+    }
+
+    for (Component* section : getSections()) {
+      std::string label = getLabel(section);
+      Image canvas(Image::ARGB, section->getWidth(), section->getHeight(), true, SoftwareImageType());
+
+      {
+        Graphics g(canvas);
+        int64 start = Time::getHighResolutionTicks();
+        section->paintEntireComponent(g, true);
+        getTiming(timings, label + "/paint").add(ticksToMs(Time::getHighResolutionTicks() - start));
+      }
+
+      if (SynthSection* synth_section = dynamic_cast<SynthSection*>(section)) {
+        canvas.clear(canvas.getBounds());
+        Graphics g(canvas);
+        int64 start = Time::getHighResolutionTicks();
+        synth_section->paintBackground(g);
+        getTiming(timings, label + "/paint_background").add(
+            ticksToMs(Time::getHighResolutionTicks() - start));
+      }
+    }
+  }
+
+  for (auto& timing : timings) {
+    String name(timing.first);
+    output << String(scenario) << "," << name.upToLastOccurrenceOf("/", false, false) << ","
+           << name.fromLastOccurrenceOf("/", false, false) << "," << timing.second.frames << ","
+           << String(timing.second.total_ms / timing.second.frames, 4) << ","
+           << String(timing.second.peak_ms, 4) << newLine;
+  }
+}
+
+std::vector<Component*> GuiBenchmark::getSections() {
+  std::vector<Component*> sections;
+  sections.push_back(gui_);
+
+  // The synthesis interface holds most of the controls so its sections are
+  // timed one level deeper than the rest.
+  for (int i = 0; i < gui_->getNumChildComponents(); ++i) {
+    Component* child = gui_->getChildComponent(i);
+    if (!child->isVisible() || child->getWidth() <= 0 || child->getHeight() <= 0)
+      continue;
+
+    sections.push_back(child);
+    if (child->getName() != "synthesis")
+      continue;
+
+    for (int j = 0; j < child->getNumChildComponents(); ++j) {
+      Component* sub_section = child->getChildComponent(j);
+      if (sub_section->isVisible() && sub_section->getWidth() > 0 && sub_section->getHeight() > 0)
+        sections.push_back(sub_section);
+    }
+  }
+  return sections;
+}
+
+std::string GuiBenchmark::getLabel(Component* section) {
+  if (section == gui_)
+    return "full_interface";
+  if (dynamic_cast<OpenGLModulationManager*>(section))
+    return "modulation_manager";
+
+  String name = section->getName();
+  if (name.isEmpty())
+    return "unnamed";
+
+  Component* parent = section->getParentComponent();
+  if (parent && parent != gui_)
+    name = parent->getName() + "." + name;
+  return name.replaceCharacter(',', '_').toStdString();
+}
+
+GuiBenchmark::Timing& GuiBenchmark::getTiming(Timings& timings, const std::string& name) {
+  for (auto& timing : timings) {
+    if (timing.first == name)
+      return timing.second;
+  }
+  timings.push_back(std::pair<std::string, Timing>(name, Timing()));
+  return timings.back().second;
+}
@@ -0,0 +1,70 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GUI_BENCHMARK_H
+#define GUI_BENCHMARK_H
+
+#include "JuceHeader.h"
+
+#include "synth_base.h"
+#include "synth_gui_interface.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Times the editor without a display. The full interface is painted into an
+// offscreen image with the software renderer, section by section, for a few
+// scripted interactions. Results are written as CSV.
+class GuiBenchmark : public Component, public SynthBase, public SynthGuiInterface {
+  public:
+    GuiBenchmark();
+    virtual ~GuiBenchmark();
+
+    // Paints every scenario _frames_ times and writes one line per section
+    // and stage to _output_.
+    void run(int frames, OutputStream& output);
+
+    void resized() override;
+
+  protected:
+    const CriticalSection& getCriticalSection() override { return critical_section_; }
+    SynthGuiInterface* getGuiInterface() override { return this; }
+
+  private:
+    struct Timing {
+      Timing() : frames(0), total_ms(0.0), peak_ms(0.0) { }
+      void add(double ms);
+
+      int frames;
+      double total_ms;
+      double peak_ms;
+    };
+
+    typedef std::function<void(int)> Action;
+    typedef std::vector<std::pair<std::string, Timing>> Timings;
+
+    void runScenario(const std::string& scenario, int frames, Action action, OutputStream& output);
+    std::vector<Component*> getSections();
+    std::string getLabel(Component* section);
+    Timing& getTiming(Timings& timings, const std::string& name);
+
+    CriticalSection critical_section_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GuiBenchmark)
+};
+
+#endif  // GUI_BENCHMARK_H
@@ -75,6 +75,7 @@ HelmEditor::~HelmEditor() {
 }
 
 void HelmEditor::prepareToPlay(int buffer_size, double sample_rate) {
+  ScopedLock lock(voice_build_lock_);
   engine_.setSampleRate(sample_rate);
   engine_.setBufferSize(std::min(buffer_size, MAX_BUFFER_PROCESS));
   engine_.updateAllModulationSwitches();
@@ -89,6 +90,9 @@ void HelmEditor::getNextAudioBlock(const AudioSourceChannelInfo& buffer) {
 
   processControlChanges();
   processModulationChanges();
+  processReadoutChanges();
+  processWavetableChanges();
+  processVoiceChanges();
   MidiBuffer midi_messages;
   midi_manager_->removeNextBlockOfMessages(midi_messages, num_samples);
   processMidi(midi_messages);
@@ -15,9 +15,18 @@
  */
 
 #include "JuceHeader.h"
+#include "bank_pack.h"
 #include "border_bounds_constrainer.h"
+#include "gui_benchmark.h"
 #include "helm_editor.h"
 #include "load_save.h"
+#include "stress_search.h"
+
+#define STRESS_SEARCH_SEED 1
+#define STRESS_SEARCH_PATCHES 100
+#define STRESS_SEARCH_CLIMB_STEPS 20
+#define STRESS_SEARCH_RESULTS 10
+#define GUI_BENCHMARK_FRAMES 50
 
 class HelmApplication : public JUCEApplication {
   public:
@@ -169,7 +178,52 @@ class HelmApplication : public JUCEApplication {
         std::cout << "  -h, --help                          Show help options" << newLine << newLine;
         std::cout << "Application Options:" << newLine;
         std::cout << "  -v, --version                       Show version information and exit" << newLine;
-        std::cout << "  --headless                          Run without graphical interface." << newLine << newLine;
+        std::cout << "  --headless                          Run without graphical interface." << newLine;
+        std::cout << "  --stress-search [PATCHES]           Save the patches slowest to render." << newLine;
+        std::cout << "  --gui-benchmark [FRAMES]            Time offscreen interface painting as CSV." << newLine;
+        std::cout << "  --pack-bank BANK PACK               Pack a bank folder into one file." << newLine;
+        std::cout << "  --unpack-bank PACK DIRECTORY        Unpack a bank pack into patch files." << newLine << newLine;
+        quit();
+      }
+      else if (command.contains(" --stress-search ")) {
+        StringArray args = getCommandLineParameterArray();
+        int patches = args[args.indexOf("--stress-search") + 1].getIntValue();
+        if (patches <= 0)
+          patches = STRESS_SEARCH_PATCHES;
+
+        File directory = File::getCurrentWorkingDirectory().getChildFile("stress_search");
+        StressSearch stress_search(STRESS_SEARCH_SEED);
+        stress_search.run(patches, STRESS_SEARCH_CLIMB_STEPS, STRESS_SEARCH_RESULTS, directory);
+        quit();
+      }
+      else if (command.contains(" --gui-benchmark ")) {
+        StringArray args = getCommandLineParameterArray();
+        int frames = args[args.indexOf("--gui-benchmark") + 1].getIntValue();
+        if (frames <= 0)
+          frames = GUI_BENCHMARK_FRAMES;
+
+        MemoryOutputStream output;
+        GuiBenchmark gui_benchmark;
+        gui_benchmark.run(frames, output);
+        std::cout << output.toString();
+        quit();
+      }
+      else if (command.contains(" --pack-bank ") || command.contains(" --unpack-bank ")) {
+        StringArray args = getCommandLineParameterArray();
+        bool pack = command.contains(" --pack-bank ");
+        int index = args.indexOf(pack ? "--pack-bank" : "--unpack-bank");
+        File source = File::getCurrentWorkingDirectory().getChildFile(args[index + 1]);
+        File destination = File::getCurrentWorkingDirectory().getChildFile(args[index + 2]);
+
+        bool success = false;
+        if (pack)
+          success = BankPack::create(source, destination);
+        else
+          success = BankPack(source).extractTo(destination);
+
+        if (!success)
+          std::cout << "Failed to convert " << source.getFullPathName() << newLine;
+        setApplicationReturnValue(success ? 0 : 1);
         quit();
       }
       else {
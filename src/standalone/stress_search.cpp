@@ -0,0 +1,203 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stress_search.h"
+
+#include <algorithm>
+#include <iterator>
+
+#define STRESS_SAMPLE_RATE 44100
+#define STRESS_BUFFER_SIZE 128
+#define PATTERN_BLOCKS 1000
+#define CHORD_PERIOD 24
+#define CHORD_LENGTH 18
+#define CHORD_SIZE 8
+#define MAX_MODULATIONS 12
+#define MAX_FLUSH_BLOCKS (30 * STRESS_SAMPLE_RATE / STRESS_BUFFER_SIZE)
+
+namespace {
+  int chordNote(int chord, int index) {
+    return 36 + (5 * chord + 7 * index) % 48;
+  }
+
+  bool worseFirst(const StressSearch::Result& a, const StressSearch::Result& b) {
+    return a.score() > b.score();
+  }
+} // namespace
+
+StressSearch::StressSearch(int64 seed) : random_(seed) {
+  // Voices are built between blocks instead so they can't race the timing.
+  housekeeping_ = nullptr;
+
+  engine_.setSampleRate(STRESS_SAMPLE_RATE);
+  engine_.setBufferSize(STRESS_BUFFER_SIZE);
+
+  for (auto& details : mopo::Parameters::lookup_.getAllDetails()) {
+    if (controls_.count(details.first))
+      parameters_.push_back(details.second);
+  }
+
+  for (auto& source : engine_.getModulationSources())
+    mod_sources_.push_back(source.first);
+  for (auto& destination : engine_.getMonoModulations())
+    mod_destinations_.push_back(destination.first);
+}
+
+void StressSearch::run(int random_patches, int climb_steps, int num_results, File directory) {
+  std::vector<Result> results;
+  for (int i = 0; i < random_patches; ++i) {
+    randomizePatch();
+    results.push_back(measure());
+  }
+
+  std::sort(results.begin(), results.end(), worseFirst);
+  results.resize(std::min<size_t>(results.size(), num_results));
+
+  for (Result& result : results) {
+    for (int step = 0; step < climb_steps; ++step) {
+      loadState(result.state);
+      mutatePatch();
+
+      Result mutated = measure();
+      if (mutated.score() > result.score())
+        result = mutated;
+    }
+
+    // Time it again so a lucky measurement doesn't decide the ranking.
+    loadState(result.state);
+    result = measure();
+  }
+
+  std::sort(results.begin(), results.end(), worseFirst);
+
+  directory.createDirectory();
+  double block_ms = (1000.0 * STRESS_BUFFER_SIZE) / STRESS_SAMPLE_RATE;
+  for (size_t i = 0; i < results.size(); ++i) {
+    loadState(results[i].state);
+    File patch = directory.getChildFile("stress_" + String(i + 1).paddedLeft('0', 2));
+    saveToFile(patch);
+
+    std::cout << String(i + 1) << ". " << String(results[i].average_ms, 3) << " ms average, ";
+    std::cout << String(results[i].peak_ms, 3) << " ms peak (";
+    std::cout << String(100.0 * results[i].peak_ms / block_ms, 1) << "% of a block)  ";
+    std::cout << patch.withFileExtension(mopo::PATCH_EXTENSION).getFullPathName() << newLine;
+  }
+}
+
+mopo::mopo_float StressSearch::randomValue(const mopo::ValueDetails& details) {
+  if (details.steps > 1) {
+    int step = random_.nextInt(details.steps);
+    return details.min + step * (details.max - details.min) / (details.steps - 1);
+  }
+  return details.min + random_.nextDouble() * (details.max - details.min);
+}
+
+void StressSearch::randomizeControl() {
+  const mopo::ValueDetails& details = parameters_[random_.nextInt(parameters_.size())];
+  controls_[details.name]->set(randomValue(details));
+}
+
+void StressSearch::randomizeModulation() {
+  std::string source = mod_sources_[random_.nextInt(mod_sources_.size())];
+  std::string destination = mod_destinations_[random_.nextInt(mod_destinations_.size())];
+  changeModulationAmount(source, destination, 2.0 * random_.nextDouble() - 1.0);
+}
+
+void StressSearch::randomizePatch() {
+  clearModulations();
+  for (const mopo::ValueDetails& details : parameters_)
+    controls_[details.name]->set(randomValue(details));
+
+  int num_modulations = random_.nextInt(MAX_MODULATIONS + 1);
+  for (int i = 0; i < num_modulations; ++i)
+    randomizeModulation();
+  processModulationChanges();
+}
+
+void StressSearch::mutatePatch() {
+  int choice = random_.nextInt(4);
+  if (choice == 0)
+    randomizeModulation();
+  else if (choice == 1 && mod_connections_.size()) {
+    auto connection = mod_connections_.begin();
+    std::advance(connection, random_.nextInt(mod_connections_.size()));
+    disconnectModulation(*connection);
+  }
+  else
+    randomizeControl();
+  processModulationChanges();
+}
+
+void StressSearch::loadState(var state) {
+  loadFromVar(state);
+  processModulationChanges();
+}
+
+// Renders silence until the last run's tails are gone and builds every voice
+// the polyphony wants, so each run starts from the same state.
+void StressSearch::resetEngine() {
+  engine_.allNotesOff();
+  for (int i = 0; i < MAX_FLUSH_BLOCKS && !engine_.isIdle(); ++i)
+    engine_.process();
+
+  doHousekeeping();
+  processVoiceChanges();
+}
+
+void StressSearch::renderPattern(std::vector<double>& block_ms) {
+  block_ms.clear();
+  resetEngine();
+
+  for (int block = 0; block < PATTERN_BLOCKS; ++block) {
+    int chord = block / CHORD_PERIOD;
+    int phase = block % CHORD_PERIOD;
+    for (int i = 0; i < CHORD_SIZE; ++i) {
+      if (phase == 0)
+        engine_.noteOn(chordNote(chord, i), 0.3 + 0.1 * ((chord + i) % 8), i);
+      else if (phase == CHORD_LENGTH)
+        engine_.noteOff(chordNote(chord, i), i);
+    }
+
+    doHousekeeping();
+    processVoiceChanges();
+
+    int64 start = Time::getHighResolutionTicks();
+    engine_.process();
+    int64 ticks = Time::getHighResolutionTicks() - start;
+    block_ms.push_back(1000.0 * Time::highResolutionTicksToSeconds(ticks));
+  }
+}
+
+// The pattern is rendered twice and each block keeps its faster time so a
+// block that got preempted doesn't count as a peak.
+StressSearch::Result StressSearch::measure() {
+  std::vector<double> first, second;
+  renderPattern(first);
+  renderPattern(second);
+
+  Result result;
+  double total = 0.0;
+  result.peak_ms = 0.0;
+  for (size_t i = 0; i < first.size(); ++i) {
+    double block = std::min(first[i], second[i]);
+    total += block;
+    result.peak_ms = std::max(result.peak_ms, block);
+  }
+
+  result.average_ms = total / first.size();
+  result.state = saveToVar("stress search");
+  return result;
+}
@@ -0,0 +1,71 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STRESS_SEARCH_H
+#define STRESS_SEARCH_H
+
+#include "JuceHeader.h"
+
+#include "synth_base.h"
+
+#include <string>
+#include <vector>
+
+// Searches for the patches that take the longest to render. Random patches
+// with random modulations are timed on a fixed stress pattern, then the worst
+// ones are mutated one change at a time, keeping changes that make them worse.
+class StressSearch : public SynthBase {
+  public:
+    struct Result {
+      double average_ms;
+      double peak_ms;
+      var state;
+
+      double score() const { return average_ms + peak_ms; }
+    };
+
+    StressSearch(int64 seed);
+    virtual ~StressSearch() { }
+
+    // Times _random_patches_ random patches, climbs from the _num_results_
+    // worst for _climb_steps_ each and saves them ranked into _directory_.
+    void run(int random_patches, int climb_steps, int num_results, File directory);
+
+  protected:
+    const CriticalSection& getCriticalSection() override { return critical_section_; }
+    SynthGuiInterface* getGuiInterface() override { return nullptr; }
+
+  private:
+    mopo::mopo_float randomValue(const mopo::ValueDetails& details);
+    void randomizeControl();
+    void randomizeModulation();
+    void randomizePatch();
+    void mutatePatch();
+    void loadState(var state);
+    void resetEngine();
+    void renderPattern(std::vector<double>& block_ms);
+    Result measure();
+
+    Random random_;
+    CriticalSection critical_section_;
+    std::vector<mopo::ValueDetails> parameters_;
+    std::vector<std::string> mod_sources_;
+    std::vector<std::string> mod_destinations_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StressSearch)
+};
+
+#endif  // STRESS_SEARCH_H
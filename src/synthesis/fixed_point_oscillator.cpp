@@ -18,7 +18,10 @@
 
 namespace mopo {
 
-  FixedPointOscillator::FixedPointOscillator() : Processor(kNumInputs, 1), phase_(0) { }
+  FixedPointOscillator::FixedPointOscillator() : Processor(kNumInputs, 1), phase_(0),
+                                                 wavetable_(nullptr) {
+    FixedPointWave::lookup();
+  }
 
   void FixedPointOscillator::process() {
     const mopo_float* amplitude = input(kAmplitude)->source->buffer;
@@ -37,9 +40,18 @@ namespace mopo {
     mopo_float shuffle = utils::clamp(1.0 - input(kShuffle)->source->buffer[0], 0.0, 1.0);
     unsigned int shuffle_index = INT_MAX * shuffle;
 
-    int waveform = static_cast<int>(input(kWaveform)->source->buffer[0] + 0.5);
-    waveform = mopo::utils::iclamp(waveform, 0, FixedPointWaveLookup::kWhiteNoise - 1);
-    mopo_float* wave_buffer = FixedPointWave::getBuffer(waveform, 2.0 * phase_inc);
+    mopo_float waveform_value = input(kWaveform)->source->buffer[0];
+    const Wavetable* wavetable = wavetable_ ? *wavetable_ : nullptr;
+    const mopo_float* wave_buffer = nullptr;
+    if (wavetable) {
+      mopo_float position = Wavetable::waveformToPosition(waveform_value);
+      wave_buffer = wavetable->getBuffer(position, 2.0 * phase_inc);
+    }
+    else {
+      int waveform = static_cast<int>(waveform_value + 0.5);
+      waveform = mopo::utils::iclamp(waveform, 0, FixedPointWaveLookup::kWhiteNoise - 1);
+      wave_buffer = FixedPointWave::getBuffer(waveform, 2.0 * phase_inc);
+    }
 
     mopo_float first_adjust = bool(shuffle) * 2.0 / shuffle;
     mopo_float second_adjust = 1.0 / (1.0 - 0.5 * shuffle);
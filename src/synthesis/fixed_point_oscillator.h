@@ -20,6 +20,7 @@
 
 #include "mopo.h"
 #include "fixed_point_wave.h"
+#include "wavetable.h"
 
 namespace mopo {
 
@@ -41,8 +42,12 @@ namespace mopo {
       virtual void process();
       virtual Processor* clone() const { return new FixedPointOscillator(*this); }
 
+      // Points at the slot holding a user wavetable, all clones share it.
+      void setWavetable(const Wavetable* const* wavetable) { wavetable_ = wavetable; }
+
     protected:
       unsigned int phase_;
+      const Wavetable* const* wavetable_;
   };
 } // namespace mopo
 
@@ -175,6 +175,4 @@ namespace mopo {
       wave[h][2 * FIXED_LOOKUP_SIZE - 1] = FRACTIONAL_MULT * last_delta;
     }
   }
-
-  const FixedPointWaveLookup FixedPointWave::lookup_;
 } // namespace mopo
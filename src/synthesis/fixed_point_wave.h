@@ -89,21 +89,21 @@ namespace mopo {
   class FixedPointWave {
     public:
       static inline mopo_float harmonicWave(int waveform, unsigned int t, int harmonic) {
-        return lookup_.waves_[waveform][harmonic][getIndex(t)];
+        return lookup()->waves_[waveform][harmonic][getIndex(t)];
       }
 
       static inline mopo_float wave(int waveform, unsigned int t, int phase_inc) {
-        return lookup_.waves_[waveform][getHarmonicIndex(phase_inc)][getIndex(t)];
+        return lookup()->waves_[waveform][getHarmonicIndex(phase_inc)][getIndex(t)];
       }
 
       static inline mopo_float wave(int waveform, unsigned int t) {
         unsigned int index = getIndex(t);
-        return lookup_.waves_[waveform][0][index];
+        return lookup()->waves_[waveform][0][index];
       }
 
       static inline mopo_float* getBuffer(int waveform, int phase_inc) {
         int clamped_inc = mopo::utils::iclamp(phase_inc, 1, INT_MAX);
-        return lookup_.waves_[waveform][getHarmonicIndex(clamped_inc)];
+        return lookup()->waves_[waveform][getHarmonicIndex(clamped_inc)];
       }
 
       static inline int getHarmonicIndex(int phase_inc) {
@@ -127,8 +127,13 @@ namespace mopo {
         return t & FixedPointWaveLookup::FRACTIONAL_MASK;
       }
 
-    protected:
-      static const FixedPointWaveLookup lookup_;
+      // The tables are over 10MB so they're built on first use instead of
+      // when the library loads. Oscillators call this on construction so
+      // it doesn't happen on the audio thread.
+      static inline const FixedPointWaveLookup* lookup() {
+        static const FixedPointWaveLookup lookup;
+        return &lookup;
+      }
   };
 } // namespace mopo
 
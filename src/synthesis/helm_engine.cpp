@@ -19,20 +19,60 @@
 #include "dc_filter.h"
 #include "helm_lfo.h"
 #include "helm_voice_handler.h"
-#include "peak_meter.h"
+#include "output_stage.h"
+#include "reverb_tuning.h"
 #include "value_switch.h"
 
+#include <cmath>
+#include <limits>
+#include <mutex>
+
 #ifdef __APPLE__
 #include <fenv.h>
 #endif
 
 #define MAX_DELAY_SAMPLES 300000
+#define IDLE_DECAY 0.00001
+#define MAX_TAIL_SECONDS 120.0
 
 namespace mopo {
 
-  HelmEngine::HelmEngine() : was_playing_arp_(false) {
+  namespace {
+    // Samples for a loop of _period_ samples and gain _feedback_ to decay
+    // below IDLE_DECAY.
+    mopo_float decaySamples(mopo_float period, mopo_float feedback) {
+      mopo_float magnitude = std::fabs(feedback);
+      if (magnitude >= 1.0)
+        return std::numeric_limits<mopo_float>::infinity();
+      if (magnitude <= 0.0)
+        return 0.0;
+      return period * std::log(IDLE_DECAY) / std::log(magnitude);
+    }
+  } // namespace
+
+  HelmEngine::HelmEngine() : was_playing_arp_(false), idle_(false), silent_samples_(0.0),
+                             tail_length_(0.0),
+                             note_render_caching_(false), pitch_wheel_(0.0) {
+    deferOrdering(true);
     init();
+    orderFromPrototype();
     bps_ = controls_["beats_per_minute"];
+
+    control_map controls = getControls();
+    noise_volume_ = controls["noise_volume"];
+    unison_voices_1_ = controls["osc_1_unison_voices"];
+    unison_voices_2_ = controls["osc_2_unison_voices"];
+    portamento_type_ = controls["portamento_type"];
+    legato_ = controls["legato"];
+
+    for (auto& control : controls)
+      render_cache_controls_.push_back(control.second);
+    render_cache_values_.resize(render_cache_controls_.size(), 0.0);
+
+    // Every voice the polyphony allows is built before the engine plays.
+    int num_voices = voice_handler_->getNumVoicesWanted();
+    for (int i = 0; i < num_voices; ++i)
+      voice_handler_->addVoice(voice_handler_->createVoice());
   }
 
   HelmEngine::~HelmEngine() {
@@ -40,6 +80,17 @@ namespace mopo {
       disconnectModulation(*mod_connections_.begin());
   }
 
+  // Every engine builds the same graph so the processing order found for the
+  // first one is copied to the rest instead of ordering on every connection.
+  void HelmEngine::orderFromPrototype() {
+    static std::mutex prototype_mutex;
+    static std::vector<int> prototype_order;
+
+    std::lock_guard<std::mutex> lock(prototype_mutex);
+    if (prototype_order.empty() || !orderGraph(prototype_order))
+      prototype_order = sortGraph();
+  }
+
   void HelmEngine::init() {
 #ifdef FE_DFL_DISABLE_SSE_DENORMS_ENV
     fesetenv(FE_DFL_DISABLE_SSE_DENORMS_ENV);
@@ -66,7 +117,7 @@ namespace mopo {
     Output* lfo_1_waveform = createMonoModControl("mono_lfo_1_waveform", true);
     Output* lfo_1_free_frequency = createMonoModControl("mono_lfo_1_frequency", true);
     Output* lfo_1_amplitude = createMonoModControl("mono_lfo_1_amplitude", true);
-    Output* lfo_1_frequency = createTempoSyncSwitch("mono_lfo_1", lfo_1_free_frequency->owner,
+    Output* lfo_1_frequency = createTempoSyncSwitch("mono_lfo_1", lfo_1_free_frequency,
                                                     beats_per_second_clamped->output(), false);
 
     lfo_1_ = new HelmLfo();
@@ -92,7 +143,7 @@ namespace mopo {
     Output* lfo_2_waveform = createMonoModControl("mono_lfo_2_waveform", true);
     Output* lfo_2_free_frequency = createMonoModControl("mono_lfo_2_frequency", true);
     Output* lfo_2_amplitude = createMonoModControl("mono_lfo_2_amplitude", true);
-    Output* lfo_2_frequency = createTempoSyncSwitch("mono_lfo_2", lfo_2_free_frequency->owner,
+    Output* lfo_2_frequency = createTempoSyncSwitch("mono_lfo_2", lfo_2_free_frequency,
                                                     beats_per_second_clamped->output(), false);
 
     lfo_2_ = new HelmLfo();
@@ -118,7 +169,7 @@ namespace mopo {
     Output* num_steps = createMonoModControl("num_steps", true);
     Output* step_smoothing = createMonoModControl("step_smoothing", true);
     Output* step_free_frequency = createMonoModControl("step_frequency", true);
-    Output* step_frequency = createTempoSyncSwitch("step_sequencer", step_free_frequency->owner,
+    Output* step_frequency = createTempoSyncSwitch("step_sequencer", step_free_frequency,
                                                    beats_per_second_clamped->output(), false);
 
     step_sequencer_ = new StepGenerator(MAX_STEPS);
@@ -150,7 +201,7 @@ namespace mopo {
     // Arpeggiator.
     arp_on_ = createBaseSwitchControl("arp_on");
     Output* arp_free_frequency = createMonoModControl("arp_frequency", true);
-    Output* arp_frequency = createTempoSyncSwitch("arp", arp_free_frequency->owner,
+    Output* arp_frequency = createTempoSyncSwitch("arp", arp_free_frequency,
                                                   beats_per_second_clamped->output(),
                                                   false, arp_on_);
     Output* arp_octaves = createMonoModControl("arp_octaves", true);
@@ -166,7 +217,7 @@ namespace mopo {
     addProcessor(voice_handler_);
 
     // Distortion
-    Distortion* distortion = new Distortion();
+    distortion_ = new Distortion();
     Value* distortion_on = createBaseControl("distortion_on");
     Value* distortion_type = createBaseControl("distortion_type");
     Output* distortion_drive = createMonoModControl("distortion_drive", true);
@@ -174,21 +225,25 @@ namespace mopo {
     cr::MagnitudeScale* distortion_gain = new cr::MagnitudeScale();
     distortion_gain->plug(distortion_drive);
 
-    distortion->plug(voice_handler_, Distortion::kAudio);
-    distortion->plug(distortion_on, Distortion::kOn);
-    distortion->plug(distortion_type, Distortion::kType);
-    distortion->plug(distortion_gain, Distortion::kDrive);
-    distortion->plug(distortion_mix, Distortion::kMix);
-    addProcessor(distortion);
+    distortion_oversampler_ = new Oversampler();
+    distortion_oversampler_->plug(voice_handler_, Oversampler::kAudio);
+    addProcessor(distortion_oversampler_);
+
+    distortion_->plug(distortion_on, Distortion::kOn);
+    distortion_->plug(distortion_type, Distortion::kType);
+    distortion_->plug(distortion_gain, Distortion::kDrive);
+    distortion_->plug(distortion_mix, Distortion::kMix);
+    distortion_oversampler_->addProcessor(distortion_);
+    distortion_oversampler_->setOversampledOutput(distortion_->output());
     addProcessor(distortion_gain);
 
     // Delay effect.
     Output* delay_free_frequency = createMonoModControl("delay_frequency", true);
-    Output* delay_frequency = createTempoSyncSwitch("delay", delay_free_frequency->owner,
+    Output* delay_frequency = createTempoSyncSwitch("delay", delay_free_frequency,
                                                     beats_per_second_clamped->output(), false);
     Output* delay_feedback = createMonoModControl("delay_feedback", true);
     Output* delay_wet = createMonoModControl("delay_dry_wet", true);
-    Value* delay_on = createBaseControl("delay_on");
+    delay_on_ = createBaseControl("delay_on");
 
     cr::Clamp* delay_feedback_clamped = new cr::Clamp(-1, 1);
     delay_feedback_clamped->plug(delay_feedback);
@@ -199,26 +254,27 @@ namespace mopo {
     cr::FrequencyToSamples* delay_samples = new cr::FrequencyToSamples();
     delay_samples->plug(delay_frequency_smoothed);
 
-    Delay* delay = new Delay(MAX_DELAY_SAMPLES);
-    delay->plug(distortion, Delay::kAudio);
-    delay->plug(delay_samples, Delay::kSampleDelay);
-    delay->plug(delay_feedback_clamped, Delay::kFeedback);
-    delay->plug(delay_wet, Delay::kWet);
+    delay_ = new Delay(MAX_DELAY_SAMPLES);
+    delay_->plug(delay_samples, Delay::kSampleDelay);
+    delay_->plug(delay_feedback_clamped, Delay::kFeedback);
+    delay_->plug(delay_wet, Delay::kWet);
 
-    BypassRouter* delay_container = new BypassRouter();
-    delay_container->plug(delay_on, BypassRouter::kOn);
-    delay_container->plug(distortion, BypassRouter::kAudio);
-    delay_container->addProcessor(delay_feedback_clamped);
-    delay_container->addProcessor(delay_frequency_smoothed);
-    delay_container->addProcessor(delay_samples);
-    delay_container->addProcessor(delay);
-    delay_container->registerOutput(delay->output());
+    delay_container_ = new BypassRouter();
+    delay_container_->plug(delay_on_, BypassRouter::kOn);
+    delay_container_->addProcessor(delay_feedback_clamped);
+    delay_container_->addProcessor(delay_frequency_smoothed);
+    delay_container_->addProcessor(delay_samples);
+    delay_container_->addProcessor(delay_);
+    delay_container_->registerOutput(delay_->output());
+    routeDistortion();
 
-    addProcessor(delay_container);
+    addProcessor(delay_container_);
+    delay_samples_ = delay_samples->output();
+    delay_feedback_ = delay_feedback_clamped->output();
 
     // DC Blocker.
     DcFilter* dc_filter = new DcFilter();
-    dc_filter->plug(delay_container, DcFilter::kAudio);
+    dc_filter->plug(delay_container_, DcFilter::kAudio);
 
     addProcessor(dc_filter);
 
@@ -226,7 +282,7 @@ namespace mopo {
     Output* reverb_feedback = createMonoModControl("reverb_feedback", true);
     Output* reverb_damping = createMonoModControl("reverb_damping", true);
     Output* reverb_wet = createMonoModControl("reverb_dry_wet", true);
-    Value* reverb_on = createBaseControl("reverb_on");
+    reverb_on_ = createBaseControl("reverb_on");
 
     cr::Clamp* reverb_feedback_clamped = new cr::Clamp(-1, 1);
     reverb_feedback_clamped->plug(reverb_feedback);
@@ -238,7 +294,7 @@ namespace mopo {
     reverb->plug(reverb_wet, Reverb::kWet);
 
     BypassRouter* reverb_container = new BypassRouter();
-    reverb_container->plug(reverb_on, BypassRouter::kOn);
+    reverb_container->plug(reverb_on_, BypassRouter::kOn);
     reverb_container->plug(dc_filter, BypassRouter::kAudio);
     reverb_container->addProcessor(reverb);
     reverb_container->addProcessor(reverb_feedback_clamped);
@@ -246,41 +302,19 @@ namespace mopo {
     reverb_container->registerOutput(reverb->output(1));
 
     addProcessor(reverb_container);
+    reverb_feedback_ = reverb_feedback_clamped->output();
 
-    // Volume.
+    // Volume, level meter and hard clip.
     Output* volume = createMonoModControl("volume", true);
-    LinearSmoothBuffer* smooth_volume = new LinearSmoothBuffer();
-    smooth_volume->plug(volume);
-
-    Multiply* scaled_audio_left = new Multiply();
-    scaled_audio_left->plug(reverb_container->output(0), 0);
-    scaled_audio_left->plug(smooth_volume, 1);
-
-    Multiply* scaled_audio_right = new Multiply();
-    scaled_audio_right->plug(reverb_container->output(1), 0);
-    scaled_audio_right->plug(smooth_volume, 1);
-
-    peak_meter_ = new PeakMeter();
-    peak_meter_->plug(scaled_audio_left, 0);
-    peak_meter_->plug(scaled_audio_right, 1);
-    mod_sources_["peak_meter"] = peak_meter_->output();
-
-    // Hard Clip.
-    Clamp* clamp_left = new Clamp(-2.1, 2.1);
-    clamp_left->plug(scaled_audio_left);
-
-    Clamp* clamp_right = new Clamp(-2.1, 2.1);
-    clamp_right->plug(scaled_audio_right);
-    
-    addProcessor(peak_meter_);
-    addProcessor(smooth_volume);
-    addProcessor(scaled_audio_left);
-    addProcessor(scaled_audio_right);
-
-    addProcessor(clamp_left);
-    addProcessor(clamp_right);
-    registerOutput(clamp_left->output());
-    registerOutput(clamp_right->output());
+    output_stage_ = new OutputStage();
+    output_stage_->plug(reverb_container->output(0), OutputStage::kAudioLeft);
+    output_stage_->plug(reverb_container->output(1), OutputStage::kAudioRight);
+    output_stage_->plug(volume, OutputStage::kVolume);
+    mod_sources_["peak_meter"] = output_stage_->output(OutputStage::kPeak);
+
+    addProcessor(output_stage_);
+    registerOutput(output_stage_->output(OutputStage::kLeft));
+    registerOutput(output_stage_->output(OutputStage::kRight));
 
     HelmModule::init();
   }
@@ -296,6 +330,8 @@ namespace mopo {
     ValueSwitch* mono_mod_switch = getMonoModulationSwitch(connection->destination);
     MOPO_ASSERT(mono_mod_switch != nullptr);
 
+    // A readout used as a source has to be written while it's connected.
+    voice_handler_->subscribeReadout(source);
     connection->modulation_scale.plug(source, 0);
     connection->modulation_scale.plug(&connection->amount, 1);
     source->owner->router()->addProcessor(&connection->modulation_scale);
@@ -341,9 +377,18 @@ namespace mopo {
     }
 
     source->owner->router()->removeProcessor(&connection->modulation_scale);
+    voice_handler_->unsubscribeReadout(source);
     mod_connections_.erase(connection);
   }
 
+  void HelmEngine::subscribeReadout(const Output* readout) {
+    voice_handler_->subscribeReadout(readout);
+  }
+
+  void HelmEngine::unsubscribeReadout(const Output* readout) {
+    voice_handler_->unsubscribeReadout(readout);
+  }
+
   int HelmEngine::getNumActiveVoices() {
     return voice_handler_->getNumActiveVoices();
   }
@@ -352,6 +397,18 @@ namespace mopo {
     return voice_handler_->getLastActiveNote();
   }
 
+  int HelmEngine::getNumVoicesWanted() const {
+    return voice_handler_->getNumVoicesWanted();
+  }
+
+  Voice* HelmEngine::createVoice() {
+    return voice_handler_->createVoice();
+  }
+
+  bool HelmEngine::addVoice(Voice* voice) {
+    return voice_handler_->addVoice(voice);
+  }
+
   void HelmEngine::process() {
     bool playing_arp = arp_on_->value();
     if (was_playing_arp_ != playing_arp)
@@ -359,6 +416,33 @@ namespace mopo {
 
     was_playing_arp_ = playing_arp;
     arpeggiator_->process();
+
+    mopo_float tail_samples = getTailSamples();
+    tail_length_ = std::min<double>(MAX_TAIL_SECONDS, tail_samples / sample_rate_);
+
+    if (getNumActiveVoices() == 0 && silent_samples_ >= tail_samples) {
+      if (!idle_) {
+        output(0)->clearBuffer();
+        output(1)->clearBuffer();
+        idle_ = true;
+      }
+
+      // Free running modulation keeps its phase as if it had been processed.
+      lfo_1_->skip(buffer_size_);
+      lfo_2_->skip(buffer_size_);
+      step_sequencer_->skip(buffer_size_);
+      return;
+    }
+
+    idle_ = false;
+    if (getNumActiveVoices())
+      silent_samples_ = 0.0;
+    else
+      silent_samples_ += buffer_size_;
+
+    if (note_render_caching_)
+      updateRenderCaching();
+
     ProcessorRouter::process();
 
     if (getNumActiveVoices() == 0) {
@@ -367,14 +451,112 @@ namespace mopo {
     }
   }
 
+  void HelmEngine::setDistortionOversampling(int amount) {
+    distortion_oversampler_->setOversampling(amount);
+    routeDistortion();
+  }
+
+  // At 1x the distortion reads the voices and the delay reads the distortion
+  // so the oversampler doesn't copy anything.
+  void HelmEngine::routeDistortion() {
+    const Output* distortion_input = voice_handler_->output();
+    const Output* distortion_output = distortion_->output();
+    if (distortion_oversampler_->getOversampling() > 1) {
+      distortion_input = distortion_oversampler_->oversampledAudio();
+      distortion_output = distortion_oversampler_->output();
+    }
+
+    distortion_->plug(distortion_input, Distortion::kAudio);
+    delay_->plug(distortion_output, Delay::kAudio);
+    delay_container_->plug(distortion_output, BypassRouter::kAudio);
+  }
+
+  int HelmEngine::getDistortionOversampling() const {
+    return distortion_oversampler_->getOversampling();
+  }
+
+  int HelmEngine::getLatency() const {
+    return distortion_oversampler_->getLatency();
+  }
+
+  void HelmEngine::setNoteRenderCaching(bool caching) {
+    note_render_caching_ = caching;
+    if (caching) {
+      voice_handler_->createRenderCache();
+    }
+    else {
+      voice_handler_->setRenderCaching(false);
+      voice_handler_->clearRenderCache();
+    }
+  }
+
+  // Random unison phases, noise, gliding from the last note and anything
+  // modulated can make the same note sound different each time.
+  bool HelmEngine::isRenderCacheable() const {
+    return mod_connections_.empty() && pitch_wheel_ == 0.0 &&
+           noise_volume_->value() == 0.0 && unison_voices_1_->value() <= 1.0 &&
+           unison_voices_2_->value() <= 1.0 && portamento_type_->value() == 0.0 &&
+           legato_->value() == 0.0;
+  }
+
+  void HelmEngine::updateRenderCaching() {
+    bool changed = false;
+    int num_controls = render_cache_controls_.size();
+    for (int i = 0; i < num_controls; ++i) {
+      mopo_float value = render_cache_controls_[i]->value();
+      if (render_cache_values_[i] != value) {
+        render_cache_values_[i] = value;
+        changed = true;
+      }
+    }
+
+    if (changed)
+      voice_handler_->clearRenderCache();
+    voice_handler_->setRenderCaching(isRenderCacheable());
+  }
+
+  mopo_float HelmEngine::getTailSamples() const {
+    mopo_float tail = getLatency();
+
+    if (delay_on_->value()) {
+      mopo_float period = delay_samples_->buffer[0];
+      tail += period + decaySamples(period, delay_feedback_->buffer[0]);
+    }
+
+    if (reverb_on_->value()) {
+      // Damping only removes highs so the comb loop gain is the feedback.
+      mopo_float longest_comb = (COMB_TUNINGS[NUM_COMB - 1] + STEREO_SPREAD) * sample_rate_;
+      tail += decaySamples(longest_comb, reverb_feedback_->buffer[0]);
+
+      for (int i = 0; i < NUM_ALL_PASS; ++i) {
+        mopo_float period = (ALL_PASS_TUNINGS[i] + STEREO_SPREAD) * sample_rate_;
+        tail += decaySamples(period, 0.5);
+      }
+    }
+
+    return tail;
+  }
+
+  void HelmEngine::setVoiceDetailReduction(bool reduce) {
+    voice_handler_->clearRenderCache();
+    voice_handler_->setDetailReduction(reduce);
+  }
+
+  const Wavetable* HelmEngine::setWavetable(Wavetable::Slot slot, const Wavetable* wavetable) {
+    voice_handler_->clearRenderCache();
+    return voice_handler_->setWavetable(slot, wavetable);
+  }
+
   void HelmEngine::setBufferSize(int buffer_size) {
     ProcessorRouter::setBufferSize(buffer_size);
     arpeggiator_->setBufferSize(buffer_size);
+    voice_handler_->clearRenderCache();
   }
 
   void HelmEngine::setSampleRate(int sample_rate) {
     ProcessorRouter::setSampleRate(sample_rate);
     arpeggiator_->setSampleRate(sample_rate);
+    voice_handler_->clearRenderCache();
   }
 
   void HelmEngine::allNotesOff(int sample) {
@@ -399,6 +581,7 @@ namespace mopo {
   }
 
   void HelmEngine::setPitchWheel(mopo_float value, int channel) {
+    pitch_wheel_ = value;
     voice_handler_->setPitchWheel(value, channel);
   }
 
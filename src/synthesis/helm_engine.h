@@ -21,12 +21,19 @@
 #include "mopo.h"
 #include "helm_common.h"
 #include "helm_module.h"
+#include "wavetable.h"
+
+#include <atomic>
 
 namespace mopo {
   class Arpeggiator;
+  class BypassRouter;
+  class Delay;
+  class Distortion;
   class HelmVoiceHandler;
   class HelmLfo;
-  class PeakMeter;
+  class Oversampler;
+  class OutputStage;
   class Value;
   class ValueSwitch;
 
@@ -50,6 +57,47 @@ namespace mopo {
       int getNumActiveVoices();
       mopo_float getLastActiveNote() const;
 
+      // Voices are cloned off the audio thread. Build getNumVoicesWanted()
+      // voices with createVoice() while nothing changes the voice graph and
+      // pass them to addVoice() from the audio thread. Voices it returns false
+      // for are still yours to delete.
+      int getNumVoicesWanted() const;
+      Voice* createVoice();
+      bool addVoice(Voice* voice);
+
+      // Per voice readouts for display are only copied out of the voices
+      // while they're subscribed. Other outputs are always up to date and
+      // are ignored. Call from the audio thread.
+      void subscribeReadout(const Output* readout);
+      void unsubscribeReadout(const Output* readout);
+
+      // Runs the distortion at 1, 2, 4 or 8 times the sample rate.
+      void setDistortionOversampling(int amount);
+      int getDistortionOversampling() const;
+
+      // Samples of delay added by oversampling.
+      int getLatency() const;
+
+      // How long the effects ring out after the last voice stops. Once that
+      // much silence has passed process() only outputs zeros and moves the
+      // LFOs and step sequencer along until a voice starts again.
+      // getTailLength() is updated every block and safe to call from any thread.
+      mopo_float getTailSamples() const;
+      double getTailLength() const { return tail_length_; }
+      bool isIdle() const { return idle_; }
+
+      // Replays recorded notes instead of running the voices while the patch
+      // renders every note the same way. Off by default.
+      void setNoteRenderCaching(bool caching);
+
+      // Renders quiet and releasing voices with fewer unison voices and no
+      // formant filter. Off by default.
+      void setVoiceDetailReduction(bool reduce);
+
+      // Swaps in a user wavetable for an oscillator and returns the one it
+      // replaced. Call from the audio thread, free the old table elsewhere.
+      const Wavetable* setWavetable(Wavetable::Slot slot, const Wavetable* wavetable);
+
       // Keyboard events.
       void allNotesOff(int sample = 0) override;
       void noteOn(mopo_float note, mopo_float velocity = 1.0,
@@ -67,10 +115,20 @@ namespace mopo {
       void sustainOff();
 
     private:
+      void orderFromPrototype();
+      bool isRenderCacheable() const;
+      void updateRenderCaching();
+      void routeDistortion();
+
       HelmVoiceHandler* voice_handler_;
       Arpeggiator* arpeggiator_;
       ValueSwitch* arp_on_;
       bool was_playing_arp_;
+      bool idle_;
+      mopo_float silent_samples_;
+      std::atomic<double> tail_length_;
+      bool note_render_caching_;
+      mopo_float pitch_wheel_;
 
       Value* lfo_1_retrigger_;
       Value* lfo_2_retrigger_;
@@ -78,9 +136,26 @@ namespace mopo {
       Value* bps_;
       HelmLfo* lfo_1_;
       HelmLfo* lfo_2_;
-      PeakMeter* peak_meter_;
+      Oversampler* distortion_oversampler_;
+      Distortion* distortion_;
+      Delay* delay_;
+      BypassRouter* delay_container_;
+      Value* delay_on_;
+      Value* reverb_on_;
+      const Output* delay_samples_;
+      const Output* delay_feedback_;
+      const Output* reverb_feedback_;
+      OutputStage* output_stage_;
       StepGenerator* step_sequencer_;
 
+      Value* noise_volume_;
+      Value* unison_voices_1_;
+      Value* unison_voices_2_;
+      Value* portamento_type_;
+      Value* legato_;
+      std::vector<Value*> render_cache_controls_;
+      std::vector<mopo_float> render_cache_values_;
+
       std::set<ModulationConnection*> mod_connections_;
   };
 } // namespace mopo
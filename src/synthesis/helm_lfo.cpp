@@ -74,6 +74,13 @@ namespace mopo {
     }
   }
 
+  // Moves the phase along without updating the outputs.
+  void HelmLfo::skip(int samples) {
+    offset_ += samples * input(kFrequency)->at(0) / sample_rate_;
+    mopo_float integral;
+    offset_ = utils::mod(offset_, &integral);
+  }
+
   void HelmLfo::correctToTime(mopo_float samples) {
     mopo_float frequency = input(kFrequency)->at(0);
     offset_ = samples * frequency / sample_rate_;
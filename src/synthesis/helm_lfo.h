@@ -47,6 +47,7 @@ namespace mopo {
       virtual Processor* clone() const override { return new HelmLfo(*this); }
       void process() override;
       void correctToTime(mopo_float samples);
+      void skip(int samples);
 
     protected:
       mopo_float offset_;
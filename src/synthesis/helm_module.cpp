@@ -126,40 +126,34 @@ namespace mopo {
 
     poly_modulation_readout_[name] = poly_total->output();
 
+    // Until the control is poly modulated every voice would scale the same
+    // mono value, so that scaling runs once in the mono router instead.
+    Output* mono_value = base_control;
+    Output* poly_value = modulation_total->output();
+    Processor* mono_scale = createSkewScale(details);
+    Processor* poly_scale = createSkewScale(details);
+    if (mono_scale) {
+      mono_scale->plug(base_control);
+      getMonoRouter()->addProcessor(mono_scale);
+      mono_value = mono_scale->output();
+
+      poly_scale->plug(modulation_total);
+      poly_owner->addProcessor(poly_scale);
+      poly_value = poly_scale->output();
+    }
+
     ValueSwitch* control_switch = new ValueSwitch(0.0);
-    control_switch->plugNext(base_control);
-    control_switch->plugNext(modulation_total);
+    control_switch->plugNext(mono_value);
+    control_switch->plugNext(poly_value);
     control_switch->addProcessor(poly_total);
     control_switch->addProcessor(modulation_total);
+    if (poly_scale)
+      control_switch->addProcessor(poly_scale);
     control_switch->set(0);
     poly_owner->addProcessor(control_switch);
     poly_modulation_switches_[name] = control_switch;
 
     Output* control_rate_total = control_switch->output(ValueSwitch::kSwitch);
-    if (details.display_skew == ValueDetails::kQuadratic) {
-      Processor* scale = nullptr;
-      if (details.post_offset)
-        scale = new cr::Quadratic(details.post_offset);
-      else
-        scale = new cr::Square();
-      
-      scale->plug(control_rate_total);
-      poly_owner->addProcessor(scale);
-      control_rate_total = scale->output();
-    }
-    else if (details.display_skew == ValueDetails::kExponential) {
-      cr::ExponentialScale* exponential = new cr::ExponentialScale(2.0, details.post_offset);
-      exponential->plug(control_rate_total);
-      poly_owner->addProcessor(exponential);
-      control_rate_total = exponential->output();
-    }
-    else if (details.display_skew == ValueDetails::kSquareRoot) {
-      cr::Root* root = new cr::Root(details.post_offset);
-      root->plug(control_rate_total);
-      poly_owner->addProcessor(root);
-      control_rate_total = root->output();
-    }
-
     if (control_rate)
       return control_rate_total;
 
@@ -169,7 +163,20 @@ namespace mopo {
     return audio_rate->output();
   }
 
-  Output* HelmModule::createTempoSyncSwitch(std::string name, Processor* frequency,
+  Processor* HelmModule::createSkewScale(const ValueDetails& details) {
+    if (details.display_skew == ValueDetails::kQuadratic) {
+      if (details.post_offset)
+        return new cr::Quadratic(details.post_offset);
+      return new cr::Square();
+    }
+    if (details.display_skew == ValueDetails::kExponential)
+      return new cr::ExponentialScale(2.0, details.post_offset);
+    if (details.display_skew == ValueDetails::kSquareRoot)
+      return new cr::Root(details.post_offset);
+    return nullptr;
+  }
+
+  Output* HelmModule::createTempoSyncSwitch(std::string name, Output* frequency,
                                             Output* bps, bool poly, ValueSwitch* owner) {
     static const Value dotted_ratio(2.0 / 3.0);
     static const Value triplet_ratio(3.0 / 2.0);
@@ -177,9 +184,9 @@ namespace mopo {
     ProcessorRouter* router = poly ? getPolyRouter() : getMonoRouter();
     Output* tempo = nullptr;
     if (poly)
-      tempo = createPolyModControl(name + "_tempo", frequency->isControlRate());
+      tempo = createPolyModControl(name + "_tempo", frequency->owner->isControlRate());
     else
-      tempo = createMonoModControl(name + "_tempo", frequency->isControlRate());
+      tempo = createMonoModControl(name + "_tempo", frequency->owner->isControlRate());
 
     Gate* choose_tempo = new Gate();
     choose_tempo->plug(tempo, Gate::kChoice);
@@ -70,8 +70,12 @@ namespace mopo {
       Output* createPolyModControl(std::string name, bool control_rate,
                                    bool smooth_value = false);
 
+      // Returns the node applying the display skew in _details_, or null if
+      // the control is linear.
+      Processor* createSkewScale(const ValueDetails& details);
+
       // Creates a switch from free running frequencies to tempo synced frequencies.
-      Output* createTempoSyncSwitch(std::string name, Processor* frequency,
+      Output* createTempoSyncSwitch(std::string name, Output* frequency,
                                     Output* bps, bool poly = false,
                                     ValueSwitch* owner = nullptr);
 
@@ -17,6 +17,9 @@
 #include "helm_oscillators.h"
 
 #include "detune_lookup.h"
+#include "voice_detail.h"
+
+#include <algorithm>
 
 #define RAND_DECAY 0.999
 
@@ -32,7 +35,10 @@ namespace mopo {
       sqrt(1.0 / 8.0), sqrt(1.0 / 8.0),
   };
 
-  HelmOscillators::HelmOscillators() : Processor(kNumInputs, 1) {
+  HelmOscillators::HelmOscillators() : Processor(kNumInputs, 1),
+                                       wavetable1_(nullptr), wavetable2_(nullptr),
+                                       last_voices1_(1), last_voices2_(1) {
+    FixedPointWave::lookup();
     utils::zeroBuffer(oscillator1_cross_mods_, MAX_BUFFER_SIZE + 1);
     utils::zeroBuffer(oscillator2_cross_mods_, MAX_BUFFER_SIZE + 1);
 
@@ -110,13 +116,24 @@ namespace mopo {
     }
   }
 
-  void HelmOscillators::prepareBuffers(mopo_float** wave_buffers,
+  void HelmOscillators::prepareBuffers(const mopo_float** wave_buffers,
                                        const int* detune_diffs,
                                        const int* oscillator_phase_diffs,
-                                       int waveform) {
+                                       mopo_float waveform, const Wavetable* wavetable) {
+    if (wavetable) {
+      mopo_float position = Wavetable::waveformToPosition(waveform);
+      for (int v = 0; v < MAX_UNISON; ++v) {
+        int phase_diff = detune_diffs[v] + oscillator_phase_diffs[0];
+        wave_buffers[v] = wavetable->getBuffer(position, phase_diff);
+      }
+      return;
+    }
+
+    int wave = static_cast<int>(waveform + 0.5);
+    wave = utils::iclamp(wave, 0, FixedPointWaveLookup::kWhiteNoise - 1);
     for (int v = 0; v < MAX_UNISON; ++v) {
       int phase_diff = detune_diffs[v] + oscillator_phase_diffs[0];
-      wave_buffers[v] = FixedPointWave::getBuffer(waveform, phase_diff);
+      wave_buffers[v] = FixedPointWave::getBuffer(wave, phase_diff);
     }
   }
 
@@ -135,13 +152,13 @@ namespace mopo {
     computeDetuneRatios(detune_diffs2_, oscillator2_phase_diffs_[0],
                         harmonize2, detune2, voices2);
 
-    int wave1 = static_cast<int>(input(kOscillator1Waveform)->source->buffer[0] + 0.5);
-    int wave2 = static_cast<int>(input(kOscillator2Waveform)->source->buffer[0] + 0.5);
-    wave1 = utils::iclamp(wave1, 0, FixedPointWaveLookup::kWhiteNoise - 1);
-    wave2 = utils::iclamp(wave2, 0, FixedPointWaveLookup::kWhiteNoise - 1);
+    mopo_float wave1 = input(kOscillator1Waveform)->source->buffer[0];
+    mopo_float wave2 = input(kOscillator2Waveform)->source->buffer[0];
+    const Wavetable* wavetable1 = wavetable1_ ? *wavetable1_ : nullptr;
+    const Wavetable* wavetable2 = wavetable2_ ? *wavetable2_ : nullptr;
 
-    prepareBuffers(wave_buffers1_, detune_diffs1_, oscillator1_phase_diffs_, wave1);
-    prepareBuffers(wave_buffers2_, detune_diffs2_, oscillator2_phase_diffs_, wave2);
+    prepareBuffers(wave_buffers1_, detune_diffs1_, oscillator1_phase_diffs_, wave1, wavetable1);
+    prepareBuffers(wave_buffers2_, detune_diffs2_, oscillator2_phase_diffs_, wave2, wavetable2);
   }
 
   void HelmOscillators::processCrossMod() {
@@ -184,6 +201,17 @@ namespace mopo {
   void HelmOscillators::processVoices() {
     int voices1 = utils::iclamp(input(kUnisonVoices1)->source->buffer[0], 1, MAX_UNISON);
     int voices2 = utils::iclamp(input(kUnisonVoices2)->source->buffer[0], 1, MAX_UNISON);
+    if (input(kReducedDetail)->at(0)) {
+      voices1 = std::min(voices1, VoiceDetail::REDUCED_UNISON_VOICES);
+      voices2 = std::min(voices2, VoiceDetail::REDUCED_UNISON_VOICES);
+    }
+
+    if (input(kReset)->source->triggered) {
+      last_voices1_ = voices1;
+      last_voices2_ = voices2;
+    }
+    int from_voices1 = last_voices1_;
+    int from_voices2 = last_voices2_;
 
     utils::zeroBuffer(oscillator1_totals_, buffer_size_);
     utils::zeroBuffer(oscillator2_totals_, buffer_size_);
@@ -201,7 +229,7 @@ namespace mopo {
     for (; j < buffer_size_; ++j)
       tickInitialVoices(j);
 
-    for (int v = 1; v < voices1; ++v) {
+    for (int v = 1; v < std::min(voices1, from_voices1); ++v) {
       const mopo_float* wave_buffer = wave_buffers1_[v];
       unsigned int start_phase = oscillator1_phases_[v];
       int detune = detune_diffs1_[v];
@@ -219,7 +247,7 @@ namespace mopo {
         tickVoice1(i, v, wave_buffer, start_phase, detune);
     }
 
-    for (int v = 1; v < voices2; ++v) {
+    for (int v = 1; v < std::min(voices2, from_voices2); ++v) {
       const mopo_float* wave_buffer = wave_buffers2_[v];
       unsigned int start_phase = oscillator2_phases_[v];
       int detune = detune_diffs2_[v];
@@ -236,12 +264,41 @@ namespace mopo {
         tickVoice2(i, v, wave_buffer, start_phase, detune);
     }
 
+    processFadingVoices(from_voices1, voices1, from_voices2, voices2);
     finishVoices(voices1, voices2);
   }
 
+  // Unison voices being added or dropped fade in or out over the buffer.
+  void HelmOscillators::processFadingVoices(int from_voices1, int to_voices1,
+                                            int from_voices2, int to_voices2) {
+    mopo_float fade_inc = 1.0 / buffer_size_;
+
+    mopo_float start1 = to_voices1 > from_voices1 ? 0.0 : 1.0;
+    mopo_float inc1 = to_voices1 > from_voices1 ? fade_inc : -fade_inc;
+    for (int v = std::min(from_voices1, to_voices1); v < std::max(from_voices1, to_voices1); ++v) {
+      const mopo_float* wave_buffer = wave_buffers1_[v];
+      unsigned int start_phase = oscillator1_phases_[v];
+      int detune = detune_diffs1_[v];
+
+      for (int i = 0; i < buffer_size_; ++i)
+        tickFadeVoice1(i, wave_buffer, start_phase, detune, start1 + (i + 1) * inc1);
+    }
+
+    mopo_float start2 = to_voices2 > from_voices2 ? 0.0 : 1.0;
+    mopo_float inc2 = to_voices2 > from_voices2 ? fade_inc : -fade_inc;
+    for (int v = std::min(from_voices2, to_voices2); v < std::max(from_voices2, to_voices2); ++v) {
+      const mopo_float* wave_buffer = wave_buffers2_[v];
+      unsigned int start_phase = oscillator2_phases_[v];
+      int detune = detune_diffs2_[v];
+
+      for (int i = 0; i < buffer_size_; ++i)
+        tickFadeVoice2(i, wave_buffer, start_phase, detune, start2 + (i + 1) * inc2);
+    }
+  }
+
   void HelmOscillators::finishVoices(int voices1, int voices2) {
-    mopo_float scale1 = scales[voices1];
-    mopo_float scale2 = scales[voices2];
+    mopo_float scale1 = scales[last_voices1_];
+    mopo_float scale2 = scales[last_voices2_];
 
     mopo_float* dest = output()->buffer;
     const mopo_float* amp1 = input(kOscillator1Amplitude)->source->buffer;
@@ -249,9 +306,22 @@ namespace mopo {
     const mopo_float* oscillator1_totals = oscillator1_totals_;
     const mopo_float* oscillator2_totals = oscillator2_totals_;
 
-    VECTORIZE_LOOP
-    for (int j = 0; j < buffer_size_; ++j)
-      tickOut(j, dest, amp1, amp2, oscillator1_totals, oscillator2_totals, scale1, scale2);
+    if (voices1 == last_voices1_ && voices2 == last_voices2_) {
+      VECTORIZE_LOOP
+      for (int j = 0; j < buffer_size_; ++j)
+        tickOut(j, dest, amp1, amp2, oscillator1_totals, oscillator2_totals, scale1, scale2);
+    }
+    else {
+      mopo_float scale_inc1 = (scales[voices1] - scale1) / buffer_size_;
+      mopo_float scale_inc2 = (scales[voices2] - scale2) / buffer_size_;
+
+      for (int j = 0; j < buffer_size_; ++j) {
+        tickOut(j, dest, amp1, amp2, oscillator1_totals, oscillator2_totals,
+                scale1 + (j + 1) * scale_inc1, scale2 + (j + 1) * scale_inc2);
+      }
+      last_voices1_ = voices1;
+      last_voices2_ = voices2;
+    }
 
     oscillator1_cross_mods_[0] = oscillator1_cross_mods_[buffer_size_];
     oscillator2_cross_mods_[0] = oscillator2_cross_mods_[buffer_size_];
@@ -20,6 +20,7 @@
 
 #include "mopo.h"
 #include "fixed_point_wave.h"
+#include "wavetable.h"
 
 namespace mopo {
 
@@ -43,6 +44,7 @@ namespace mopo {
         kHarmonize2,
         kReset,
         kCrossMod,
+        kReducedDetail,
         kNumInputs
       };
 
@@ -54,6 +56,13 @@ namespace mopo {
       Output* getOscillator1Output() { return output(0); }
       Output* getOscillator2Output() { return output(1); }
 
+      // Points at the slots holding user wavetables, all clones share them.
+      void setWavetables(const Wavetable* const* wavetable1,
+                         const Wavetable* const* wavetable2) {
+        wavetable1_ = wavetable1;
+        wavetable2_ = wavetable2;
+      }
+
     protected:
       void reset(int i);
       void loadBasePhaseInc();
@@ -61,14 +70,16 @@ namespace mopo {
                                int oscillator_diff,
                                bool harmonize, mopo_float detune,
                                int voices);
-      void prepareBuffers(mopo_float** wave_buffers,
+      void prepareBuffers(const mopo_float** wave_buffers,
                           const int* detune_diffs,
                           const int* oscillator_phase_diffs,
-                          int waveform);
+                          mopo_float waveform, const Wavetable* wavetable);
 
       void processInitial();
       void processCrossMod();
       void processVoices();
+      void processFadingVoices(int from_voices1, int to_voices1,
+                               int from_voices2, int to_voices2);
       void finishVoices(int voices1, int voices2);
 
       inline void tickCrossMod(int i, const mopo_float cross_mod,
@@ -106,6 +117,20 @@ namespace mopo {
         oscillator2_totals_[i] += FixedPointWave::interpretWave(wave_buffer, phase);
       }
 
+      inline void tickFadeVoice1(int i, const mopo_float* wave_buffer,
+                                 unsigned int start_phase, int detune, mopo_float gain) {
+        int phase = oscillator1_cross_mods_[i] + start_phase +
+                    i * detune + oscillator1_phase_diffs_[i];
+        oscillator1_totals_[i] += gain * FixedPointWave::interpretWave(wave_buffer, phase);
+      }
+
+      inline void tickFadeVoice2(int i, const mopo_float* wave_buffer,
+                                 unsigned int start_phase, int detune, mopo_float gain) {
+        int phase = oscillator2_cross_mods_[i] + start_phase +
+                    i * detune + oscillator2_phase_diffs_[i];
+        oscillator2_totals_[i] += gain * FixedPointWave::interpretWave(wave_buffer, phase);
+      }
+
       inline void tickOut(int i, mopo_float* dest,
                           const mopo_float* amp1, const mopo_float* amp2,
                           const mopo_float* oscillator1_totals,
@@ -128,8 +153,12 @@ namespace mopo {
       unsigned int oscillator1_phases_[MAX_UNISON];
       unsigned int oscillator2_phases_[MAX_UNISON];
 
-      mopo_float* wave_buffers1_[MAX_UNISON];
-      mopo_float* wave_buffers2_[MAX_UNISON];
+      const Wavetable* const* wavetable1_;
+      const Wavetable* const* wavetable2_;
+      int last_voices1_;
+      int last_voices2_;
+      const mopo_float* wave_buffers1_[MAX_UNISON];
+      const mopo_float* wave_buffers2_[MAX_UNISON];
       int detune_diffs1_[MAX_UNISON];
       int detune_diffs2_[MAX_UNISON];
       int oscillator1_phase_diffs_[MAX_BUFFER_SIZE];
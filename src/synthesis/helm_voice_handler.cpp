@@ -37,6 +37,17 @@
 namespace mopo {
 
   namespace {
+    enum OscillatorSmoothing {
+      kSmoothOsc1PhaseInc,
+      kSmoothOsc2PhaseInc,
+      kSmoothOsc1Amplitude,
+      kSmoothOsc2Amplitude,
+      kSmoothSubAmplitude,
+      kSmoothFeedbackSamples,
+      kSmoothFeedbackAmount,
+      kNumOscillatorSmoothing
+    };
+
     struct FormantValues {
       cr::Value gain;
       cr::Value resonance;
@@ -97,6 +108,9 @@ namespace mopo {
       beats_per_second_(beats_per_second) {
     output_ = new Multiply();
     registerOutput(output_->output());
+
+    for (int i = 0; i < Wavetable::kNumSlots; ++i)
+      wavetables_[i] = nullptr;
   }
 
   void HelmVoiceHandler::init() {
@@ -126,6 +140,16 @@ namespace mopo {
 
     // Create all synthesizer voice components.
     createArticulation(note(), last_note(), velocity(), voice_event());
+
+    detail_reduction_ = new cr::Value(0.0);
+    voice_detail_ = new VoiceDetail();
+    voice_detail_->plug(detail_reduction_, VoiceDetail::kEnabled);
+    voice_detail_->plug(amplitude_envelope_->output(Envelope::kValue),
+                        VoiceDetail::kEnvelopeValue);
+    voice_detail_->plug(amplitude_envelope_->output(Envelope::kPhase),
+                        VoiceDetail::kEnvelopePhase);
+    addProcessor(voice_detail_);
+
     createOscillators(current_frequency_->output(),
                       amplitude_envelope_->output(Envelope::kFinished));
     createModulators(amplitude_envelope_->output(Envelope::kFinished));
@@ -162,6 +186,10 @@ namespace mopo {
     addProcessor(pitch_bend);
     addProcessor(bent_midi);
 
+    // All audio rate oscillator controls ramp together.
+    LinearSmoothBank* smoothing = new LinearSmoothBank(kNumOscillatorSmoothing);
+    smoothing->plugTrigger(reset);
+
     // Oscillator 1.
     HelmOscillators* oscillators = new HelmOscillators();
     Output* oscillator1_waveform = createPolyModControl("osc_1_waveform", true);
@@ -183,13 +211,12 @@ namespace mopo {
     cr::FrequencyToPhase* oscillator1_phase_inc = new cr::FrequencyToPhase();
     oscillator1_phase_inc->plug(oscillator1_frequency);
 
-    LinearSmoothBuffer* oscillator1_phase_inc_smooth = new LinearSmoothBuffer();
-    oscillator1_phase_inc_smooth->plug(oscillator1_phase_inc, LinearSmoothBuffer::kValue);
-    oscillator1_phase_inc_smooth->plug(reset, LinearSmoothBuffer::kTrigger);
+    smoothing->plug(oscillator1_phase_inc, kSmoothOsc1PhaseInc);
 
     oscillators->plug(oscillator1_waveform, HelmOscillators::kOscillator1Waveform);
     oscillators->plug(reset, HelmOscillators::kReset);
-    oscillators->plug(oscillator1_phase_inc_smooth, HelmOscillators::kOscillator1PhaseInc);
+    oscillators->plug(smoothing->output(kSmoothOsc1PhaseInc),
+                      HelmOscillators::kOscillator1PhaseInc);
     oscillators->plug(oscillator1_unison_detune, HelmOscillators::kUnisonDetune1);
     oscillators->plug(oscillator1_unison_voices, HelmOscillators::kUnisonVoices1);
     oscillators->plug(oscillator1_unison_harmonize, HelmOscillators::kHarmonize1);
@@ -201,7 +228,6 @@ namespace mopo {
     addProcessor(oscillator1_midi);
     addProcessor(oscillator1_frequency);
     addProcessor(oscillator1_phase_inc);
-    addProcessor(oscillator1_phase_inc_smooth);
     addProcessor(oscillators);
 
     // Oscillator 2.
@@ -224,12 +250,11 @@ namespace mopo {
     cr::FrequencyToPhase* oscillator2_phase_inc = new cr::FrequencyToPhase();
     oscillator2_phase_inc->plug(oscillator2_frequency);
 
-    LinearSmoothBuffer* oscillator2_phase_inc_smooth = new LinearSmoothBuffer();
-    oscillator2_phase_inc_smooth->plug(oscillator2_phase_inc, LinearSmoothBuffer::kValue);
-    oscillator2_phase_inc_smooth->plug(reset, LinearSmoothBuffer::kTrigger);
+    smoothing->plug(oscillator2_phase_inc, kSmoothOsc2PhaseInc);
 
     oscillators->plug(oscillator2_waveform, HelmOscillators::kOscillator2Waveform);
-    oscillators->plug(oscillator2_phase_inc_smooth, HelmOscillators::kOscillator2PhaseInc);
+    oscillators->plug(smoothing->output(kSmoothOsc2PhaseInc),
+                      HelmOscillators::kOscillator2PhaseInc);
     oscillators->plug(oscillator2_unison_detune, HelmOscillators::kUnisonDetune2);
     oscillators->plug(oscillator2_unison_voices, HelmOscillators::kUnisonVoices2);
     oscillators->plug(oscillator2_unison_harmonize, HelmOscillators::kHarmonize2);
@@ -238,23 +263,22 @@ namespace mopo {
     addProcessor(oscillator2_midi);
     addProcessor(oscillator2_frequency);
     addProcessor(oscillator2_phase_inc);
-    addProcessor(oscillator2_phase_inc_smooth);
 
     // Oscillator mix.
     Output* osc_1_amplitude = createPolyModControl("osc_1_volume", true);
-    LinearSmoothBuffer* smooth_osc_1_amp = new LinearSmoothBuffer();
-    smooth_osc_1_amp->plug(osc_1_amplitude, LinearSmoothBuffer::kValue);
-    smooth_osc_1_amp->plug(reset, LinearSmoothBuffer::kTrigger);
-    oscillators->plug(smooth_osc_1_amp, HelmOscillators::kOscillator1Amplitude);
+    smoothing->plug(osc_1_amplitude, kSmoothOsc1Amplitude);
+    oscillators->plug(smoothing->output(kSmoothOsc1Amplitude),
+                      HelmOscillators::kOscillator1Amplitude);
 
     Output* osc_2_amplitude = createPolyModControl("osc_2_volume", true);
-    LinearSmoothBuffer* smooth_osc_2_amp = new LinearSmoothBuffer();
-    smooth_osc_2_amp->plug(osc_2_amplitude, LinearSmoothBuffer::kValue);
-    smooth_osc_2_amp->plug(reset, LinearSmoothBuffer::kTrigger);
-    oscillators->plug(smooth_osc_2_amp, HelmOscillators::kOscillator2Amplitude);
+    smoothing->plug(osc_2_amplitude, kSmoothOsc2Amplitude);
+    oscillators->plug(smoothing->output(kSmoothOsc2Amplitude),
+                      HelmOscillators::kOscillator2Amplitude);
+    oscillators->setWavetables(&wavetables_[Wavetable::kOscillator1],
+                               &wavetables_[Wavetable::kOscillator2]);
 
-    addProcessor(smooth_osc_1_amp);
-    addProcessor(smooth_osc_2_amp);
+    oscillators->plug(voice_detail_->output(VoiceDetail::kReduced),
+                      HelmOscillators::kReducedDetail);
 
     // Sub Oscillator.
     cr::Add* sub_midi = new cr::Add();
@@ -272,9 +296,7 @@ namespace mopo {
     Output* sub_waveform = createPolyModControl("sub_waveform", true);
     Output* sub_shuffle = createPolyModControl("sub_shuffle", true);
     Output* sub_volume = createPolyModControl("sub_volume", true);
-    LinearSmoothBuffer* smooth_sub_volume = new LinearSmoothBuffer();
-    smooth_sub_volume->plug(sub_volume, LinearSmoothBuffer::kValue);
-    smooth_sub_volume->plug(reset, LinearSmoothBuffer::kTrigger);
+    smoothing->plug(sub_volume, kSmoothSubAmplitude);
 
     FixedPointOscillator* sub_oscillator = new FixedPointOscillator();
     sub_oscillator->plug(sub_phase_inc, FixedPointOscillator::kPhaseInc);
@@ -282,13 +304,14 @@ namespace mopo {
     sub_oscillator->plug(sub_waveform, FixedPointOscillator::kWaveform);
     sub_oscillator->plug(reset, FixedPointOscillator::kReset);
     sub_oscillator->plug(sub_octave, FixedPointOscillator::kLowOctave);
-    sub_oscillator->plug(smooth_sub_volume, FixedPointOscillator::kAmplitude);
+    sub_oscillator->plug(smoothing->output(kSmoothSubAmplitude),
+                         FixedPointOscillator::kAmplitude);
+    sub_oscillator->setWavetable(&wavetables_[Wavetable::kSubOscillator]);
 
     addProcessor(sub_midi);
     addProcessor(sub_frequency);
     addProcessor(sub_phase_inc);
     addProcessor(sub_oscillator);
-    addProcessor(smooth_sub_volume);
 
     Add *oscillator_sum = new Add();
     oscillator_sum->plug(oscillators, 0);
@@ -329,31 +352,26 @@ namespace mopo {
     cr::FrequencyToSamples* osc_feedback_samples = new cr::FrequencyToSamples();
     osc_feedback_samples->plug(osc_feedback_frequency);
 
-    LinearSmoothBuffer* osc_feedback_samples_audio = new LinearSmoothBuffer();
-    osc_feedback_samples_audio->plug(osc_feedback_samples, LinearSmoothBuffer::kValue);
-    osc_feedback_samples_audio->plug(reset, LinearSmoothBuffer::kTrigger);
+    smoothing->plug(osc_feedback_samples, kSmoothFeedbackSamples);
     addProcessor(osc_feedback_transposed);
     addProcessor(osc_feedback_midi);
     addProcessor(osc_feedback_frequency);
     addProcessor(osc_feedback_samples);
-    addProcessor(osc_feedback_samples_audio);
 
     cr::Clamp* osc_feedback_amount_clamped = new cr::Clamp();
     osc_feedback_amount_clamped->plug(osc_feedback_amount);
 
-    LinearSmoothBuffer* osc_feedback_amount_audio = new LinearSmoothBuffer();
-    osc_feedback_amount_audio->plug(osc_feedback_amount_clamped, LinearSmoothBuffer::kValue);
-    osc_feedback_amount_audio->plug(reset, LinearSmoothBuffer::kTrigger);
+    smoothing->plug(osc_feedback_amount_clamped, kSmoothFeedbackAmount);
 
     osc_feedback_ = new SimpleDelay(MAX_FEEDBACK_SAMPLES);
     osc_feedback_->plug(oscillator_noise_sum, SimpleDelay::kAudio);
-    osc_feedback_->plug(osc_feedback_samples_audio, SimpleDelay::kSampleDelay);
-    osc_feedback_->plug(osc_feedback_amount_audio, SimpleDelay::kFeedback);
+    osc_feedback_->plug(smoothing->output(kSmoothFeedbackSamples), SimpleDelay::kSampleDelay);
+    osc_feedback_->plug(smoothing->output(kSmoothFeedbackAmount), SimpleDelay::kFeedback);
     osc_feedback_->plug(reset, SimpleDelay::kReset);
 
     addProcessor(osc_feedback_);
     addProcessor(osc_feedback_amount_clamped);
-    addProcessor(osc_feedback_amount_audio);
+    addProcessor(smoothing);
   }
 
   void HelmVoiceHandler::createModulators(Output* reset) {
@@ -361,7 +379,7 @@ namespace mopo {
     Output* lfo_waveform = createPolyModControl("poly_lfo_waveform", true);
     Output* lfo_free_frequency = createPolyModControl("poly_lfo_frequency", true);
     Output* lfo_free_amplitude = createPolyModControl("poly_lfo_amplitude", true);
-    Output* lfo_frequency = createTempoSyncSwitch("poly_lfo", lfo_free_frequency->owner,
+    Output* lfo_frequency = createTempoSyncSwitch("poly_lfo", lfo_free_frequency,
                                                   beats_per_second_, true);
     poly_lfo_ = new HelmLfo();
     poly_lfo_->plug(reset, HelmLfo::kReset);
@@ -375,8 +393,8 @@ namespace mopo {
     addProcessor(poly_lfo_);
     addProcessor(scaled_lfo);
     mod_sources_["poly_lfo"] = scaled_lfo->output();
-    mod_sources_["poly_lfo_amp"] = registerOutput(scaled_lfo->output());
-    mod_sources_["poly_lfo_phase"] = registerOutput(poly_lfo_->output(Oscillator::kPhase));
+    mod_sources_["poly_lfo_amp"] = registerReadout(scaled_lfo->output());
+    mod_sources_["poly_lfo_phase"] = registerReadout(poly_lfo_->output(Oscillator::kPhase));
 
     // Extra Envelope.
     Output* mod_attack = createPolyModControl("mod_attack", true);
@@ -393,8 +411,8 @@ namespace mopo {
 
     addProcessor(extra_envelope_);
     mod_sources_["mod_envelope"] = extra_envelope_->output();
-    mod_sources_["mod_envelope_amp"] = registerOutput(extra_envelope_->output(Envelope::kValue));
-    mod_sources_["mod_envelope_phase"] = registerOutput(extra_envelope_->output(Envelope::kPhase));
+    mod_sources_["mod_envelope_amp"] = registerReadout(extra_envelope_->output(Envelope::kValue));
+    mod_sources_["mod_envelope_phase"] = registerReadout(extra_envelope_->output(Envelope::kPhase));
 
     // Random Modulation
     TriggerRandom* random_mod = new TriggerRandom();
@@ -499,8 +517,9 @@ namespace mopo {
     addProcessor(drive_magnitude);
 
     mod_sources_["fil_envelope"] = filter_envelope_->output();
-    mod_sources_["fil_envelope_amp"] = registerOutput(filter_envelope_->output(Envelope::kValue));
-    mod_sources_["fil_envelope_phase"] = registerOutput(filter_envelope_->output(Envelope::kPhase));
+    mod_sources_["fil_envelope_amp"] = registerReadout(filter_envelope_->output(Envelope::kValue));
+    mod_sources_["fil_envelope_phase"] =
+        registerReadout(filter_envelope_->output(Envelope::kPhase));
 
     // Stutter.
     BypassRouter* stutter_container = new BypassRouter();
@@ -510,13 +529,13 @@ namespace mopo {
     stutter_container->plug(stutter_on, BypassRouter::kOn);
     stutter_container->plug(filter, BypassRouter::kAudio);
 
-    Stutter* stutter = new Stutter(STUTTER_MAX_SAMPLES);
+    Stutter* stutter = new Stutter(STUTTER_MAX_PERIOD);
     Output* stutter_free_frequency = createPolyModControl("stutter_frequency", true);
-    Output* stutter_frequency = createTempoSyncSwitch("stutter", stutter_free_frequency->owner,
+    Output* stutter_frequency = createTempoSyncSwitch("stutter", stutter_free_frequency,
                                                       beats_per_second_, true, stutter_on);
     Output* resample_free_frequency = createPolyModControl("stutter_resample_frequency", true);
     Output* resample_frequency = createTempoSyncSwitch("stutter_resample",
-                                                       resample_free_frequency->owner,
+                                                       resample_free_frequency,
                                                        beats_per_second_, true, stutter_on);
 
     Output* stutter_softness = createPolyModControl("stutter_softness", true);
@@ -532,10 +551,12 @@ namespace mopo {
 
     // Formant Filter.
     formant_container_ = new BypassRouter();
+    formant_container_->setCrossfade(true);
     addProcessor(formant_container_);
 
     ValueSwitch* formant_on = createBaseSwitchControl("formant_on");
-    formant_container_->plug(formant_on->output(ValueSwitch::kValue), BypassRouter::kOn);
+    voice_detail_->plug(formant_on->output(ValueSwitch::kValue), VoiceDetail::kFormantEnabled);
+    formant_container_->plug(voice_detail_->output(VoiceDetail::kFormantOn), BypassRouter::kOn);
     formant_container_->plug(stutter_container, BypassRouter::kAudio);
 
     formant_filter_ = new FormantManager(NUM_FORMANTS);
@@ -728,9 +749,9 @@ namespace mopo {
 
     mod_sources_["amp_envelope"] = amplitude_envelope_->output();
     mod_sources_["amp_envelope_amp"] =
-        registerOutput(amplitude_envelope_->output(Envelope::kValue));
+        registerReadout(amplitude_envelope_->output(Envelope::kValue));
     mod_sources_["amp_envelope_phase"] =
-        registerOutput(amplitude_envelope_->output(Envelope::kPhase));
+        registerReadout(amplitude_envelope_->output(Envelope::kPhase));
     mod_sources_["note"] = note_percentage->output();
     mod_sources_["velocity"] = current_velocity->output();
 
@@ -770,19 +791,11 @@ namespace mopo {
     return VoiceHandler::noteOff(note, sample);
   }
 
-  bool HelmVoiceHandler::shouldAccumulate(Output* output) {
-    if (output->owner == poly_lfo_ || output->owner == amplitude_envelope_ ||
-        output->owner == filter_envelope_ || output->owner == extra_envelope_) {
-      return false;
-    }
-    return VoiceHandler::shouldAccumulate(output);
-  }
-
   void HelmVoiceHandler::setupPolyModulationReadouts() {
     output_map& poly_mods = HelmModule::getPolyModulations();
 
     for (auto& mod : poly_mods)
-      poly_readouts_[mod.first] = registerOutput(mod.second);
+      poly_readouts_[mod.first] = registerReadout(mod.second);
   }
 
   void HelmVoiceHandler::setModWheel(mopo_float value, int channel) {
@@ -795,6 +808,13 @@ namespace mopo {
     pitch_wheel_amounts_[channel - 1]->set(value);
   }
 
+  const Wavetable* HelmVoiceHandler::setWavetable(Wavetable::Slot slot,
+                                                  const Wavetable* wavetable) {
+    const Wavetable* old_wavetable = wavetables_[slot];
+    wavetables_[slot] = wavetable;
+    return old_wavetable;
+  }
+
   output_map& HelmVoiceHandler::getPolyModulations() {
     return poly_readouts_;
   }
@@ -21,6 +21,8 @@
 #include "mopo.h"
 #include "helm_common.h"
 #include "helm_module.h"
+#include "voice_detail.h"
+#include "wavetable.h"
 
 #include <vector>
 
@@ -55,11 +57,16 @@ namespace mopo {
       void noteOn(mopo_float note, mopo_float velocity = 1,
                   int sample = 0, int channel = 0) override;
       VoiceEvent noteOff(mopo_float note, int sample = 0) override;
-      bool shouldAccumulate(Output* output) override;
       void setModWheel(mopo_float value, int channel = 0);
       void setPitchWheel(mopo_float value, int channel = 0);
       Output* note_retrigger() { return &note_retriggered_; }
 
+      // Replaces a built in waveform with a user wavetable, nullptr goes back
+      // to the built in ones. Returns the old table for the caller to free.
+      const Wavetable* setWavetable(Wavetable::Slot slot, const Wavetable* wavetable);
+
+      void setDetailReduction(bool reduce) { detail_reduction_->set(reduce); }
+
       // HelmModule
       output_map& getPolyModulations() override;
 
@@ -104,6 +111,10 @@ namespace mopo {
       Multiply* output_;
 
       output_map poly_readouts_;
+      const Wavetable* wavetables_[Wavetable::kNumSlots];
+
+      Value* detail_reduction_;
+      VoiceDetail* voice_detail_;
   };
 } // namespace mopo
 
@@ -14,22 +14,47 @@
  * along with mopo.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "peak_meter.h"
+#include "output_stage.h"
 #include "utils.h"
 
+#define MAX_OUTPUT 2.1
 #define PEAK_DECAY 0.00003
 #define DELTA_SCALE 20.0
 #define MIN_MOVEMENT 0.00002
 
 namespace mopo {
 
-  PeakMeter::PeakMeter() : Processor(2, 1), current_peak_left_(0.0), current_peak_right_(0.0) {
-  }
+  OutputStage::OutputStage() : Processor(kNumInputs, kNumOutputs), last_volume_(0.0),
+                               current_peak_left_(0.0), current_peak_right_(0.0) { }
+
+  void OutputStage::process() {
+    const mopo_float* left = input(kAudioLeft)->source->buffer;
+    const mopo_float* right = input(kAudioRight)->source->buffer;
+    mopo_float* dest_left = output(kLeft)->buffer;
+    mopo_float* dest_right = output(kRight)->buffer;
+
+    mopo_float volume = input(kVolume)->at(0);
+    mopo_float inc = (volume - last_volume_) / buffer_size_;
+    mopo_float start = last_volume_ + inc;
+    mopo_float peak_left = 0.0;
+    mopo_float peak_right = 0.0;
 
-  void PeakMeter::process() {
-    mopo_float peak_left = utils::peak(input(0)->source->buffer, buffer_size_, 8);
-    mopo_float peak_right = utils::peak(input(1)->source->buffer, buffer_size_, 8);
+    VECTORIZE_LOOP
+    for (int i = 0; i < buffer_size_; ++i) {
+      mopo_float gain = start + i * inc;
+      mopo_float sample_left = gain * left[i];
+      mopo_float sample_right = gain * right[i];
+      peak_left = utils::max(peak_left, fabs(sample_left));
+      peak_right = utils::max(peak_right, fabs(sample_right));
+      dest_left[i] = utils::clamp(sample_left, -MAX_OUTPUT, MAX_OUTPUT);
+      dest_right[i] = utils::clamp(sample_right, -MAX_OUTPUT, MAX_OUTPUT);
+    }
+
+    last_volume_ = volume;
+    updatePeaks(peak_left, peak_right);
+  }
 
+  void OutputStage::updatePeaks(mopo_float peak_left, mopo_float peak_right) {
     mopo_float exponent = buffer_size_ * (1.0 * mopo::DEFAULT_SAMPLE_RATE) / sample_rate_;
     mopo_float movement = MIN_MOVEMENT * exponent;
 
@@ -42,7 +67,7 @@ namespace mopo {
 
     current_peak_left_ = utils::max(current_peak_left_ - movement, peak_left);
     current_peak_right_ = utils::max(current_peak_right_ - movement, peak_right);
-    output()->buffer[0] = current_peak_left_;
-    output()->buffer[1] = current_peak_right_;
+    output(kPeak)->buffer[0] = current_peak_left_;
+    output(kPeak)->buffer[1] = current_peak_right_;
   }
 } // namespace mopo
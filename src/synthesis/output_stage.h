@@ -15,24 +15,44 @@
  */
 
 #pragma once
-#ifndef PEAK_METER_H
-#define PEAK_METER_H
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
 
 #include "processor.h"
 
 namespace mopo {
 
-  class PeakMeter : public Processor {
+  // The last step before the host, done in one pass over the block. The
+  // volume is ramped to its new value and applied, the peaks are measured for
+  // the level meter and the result is hard clipped.
+  class OutputStage : public Processor {
     public:
-      PeakMeter();
+      enum Inputs {
+        kAudioLeft,
+        kAudioRight,
+        kVolume,
+        kNumInputs
+      };
 
-      virtual Processor* clone() const override { return new PeakMeter(*this); }
+      enum Outputs {
+        kLeft,
+        kRight,
+        kPeak,
+        kNumOutputs
+      };
+
+      OutputStage();
+
+      virtual Processor* clone() const override { return new OutputStage(*this); }
       void process() override;
 
     protected:
+      void updatePeaks(mopo_float peak_left, mopo_float peak_right);
+
+      mopo_float last_volume_;
       mopo_float current_peak_left_;
       mopo_float current_peak_right_;
   };
 } // namespace mopo
 
-#endif // PEAK_METER_H
+#endif // OUTPUT_STAGE_H
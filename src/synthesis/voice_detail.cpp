@@ -0,0 +1,47 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "voice_detail.h"
+
+#include "envelope.h"
+
+#define RELEASE_DETAIL_LEVEL 0.1
+#define QUIET_DETAIL_LEVEL 0.01
+#define DETAIL_HYSTERESIS 2.0
+
+namespace mopo {
+
+  VoiceDetail::VoiceDetail() : Processor(kNumInputs, kNumOutputs, true),
+                               reduced_(false) { }
+
+  void VoiceDetail::process() {
+    mopo_float value = input(kEnvelopeValue)->at(0);
+    int phase = input(kEnvelopePhase)->at(0);
+    bool formant_on = input(kFormantEnabled)->at(0);
+
+    if (input(kEnabled)->at(0) == 0.0 || phase == Envelope::kAttacking)
+      reduced_ = false;
+    else {
+      mopo_float level = phase == Envelope::kReleasing ? RELEASE_DETAIL_LEVEL : QUIET_DETAIL_LEVEL;
+      if (reduced_)
+        level *= DETAIL_HYSTERESIS;
+      reduced_ = value < level;
+    }
+
+    output(kReduced)->buffer[0] = reduced_;
+    output(kFormantOn)->buffer[0] = formant_on && !reduced_;
+  }
+} // namespace mopo
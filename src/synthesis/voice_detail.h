@@ -0,0 +1,56 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef VOICE_DETAIL_H
+#define VOICE_DETAIL_H
+
+#include "processor.h"
+
+namespace mopo {
+
+  // Decides when a voice is quiet enough to render with less detail. Voices
+  // in their release drop detail earlier than held ones and get it back when
+  // they're attacking again.
+  class VoiceDetail : public Processor {
+    public:
+      static const int REDUCED_UNISON_VOICES = 3;
+
+      enum Inputs {
+        kEnabled,
+        kEnvelopeValue,
+        kEnvelopePhase,
+        kFormantEnabled,
+        kNumInputs
+      };
+
+      enum Outputs {
+        kReduced,
+        kFormantOn,
+        kNumOutputs
+      };
+
+      VoiceDetail();
+
+      virtual Processor* clone() const override { return new VoiceDetail(*this); }
+      void process() override;
+
+    private:
+      bool reduced_;
+  };
+} // namespace mopo
+
+#endif // VOICE_DETAIL_H
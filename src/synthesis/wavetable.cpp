@@ -0,0 +1,167 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "wavetable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+
+#define SILENT_HARMONIC 0.000001
+
+namespace mopo {
+
+  namespace {
+    typedef std::complex<mopo_float> complex;
+
+    const int TABLE_SIZE = FixedPointWaveLookup::FIXED_LOOKUP_SIZE;
+    const int MAX_HARMONIC = TABLE_SIZE / 2 - 1;
+
+    // In place radix 2 transform, _size_ must be a power of two.
+    void fft(complex* data, int size, bool inverse) {
+      for (int i = 1, j = 0; i < size; ++i) {
+        int bit = size >> 1;
+        for (; j & bit; bit >>= 1)
+          j ^= bit;
+        j ^= bit;
+
+        if (i < j)
+          std::swap(data[i], data[j]);
+      }
+
+      mopo_float direction = inverse ? 1.0 : -1.0;
+      for (int length = 2; length <= size; length <<= 1) {
+        int half = length / 2;
+        complex step = std::polar(1.0, direction * 2.0 * PI / length);
+
+        for (int start = 0; start < size; start += length) {
+          complex twiddle = 1.0;
+          for (int k = 0; k < half; ++k) {
+            complex odd = twiddle * data[start + k + half];
+            data[start + k + half] = data[start + k] - odd;
+            data[start + k] += odd;
+            twiddle *= step;
+          }
+        }
+      }
+    }
+  } // namespace
+
+  Wavetable::Wavetable(const mopo_float* samples, int frame_size, int num_frames) :
+      num_frames_(std::min(num_frames, MAX_FRAMES)) {
+    MOPO_ASSERT(frame_size > 0 && num_frames > 0);
+
+    mopo_float peak = 0.0;
+    for (int i = 0; i < frame_size * num_frames; ++i)
+      peak = std::max(peak, std::fabs(samples[i]));
+    mopo_float scale = peak > 0.0 ? 1.0 / peak : 0.0;
+
+    std::vector<int> offsets;
+    offsets.reserve(num_frames_ * LEVELS);
+    for (int f = 0; f < num_frames_; ++f) {
+      int source_frame = num_frames_ > 1 ? (f * (num_frames - 1)) / (num_frames_ - 1) : 0;
+      computeFrame(samples + source_frame * frame_size, frame_size, scale, offsets);
+    }
+
+    levels_.resize(offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i)
+      levels_[i] = data_.data() + offsets[i];
+  }
+
+  // One forward transform gives the harmonics. The full band level is an
+  // inverse transform and the band limited levels are built up one harmonic
+  // at a time from the top level down.
+  void Wavetable::computeFrame(const mopo_float* samples, int frame_size, mopo_float scale,
+                               std::vector<int>& offsets) {
+    std::vector<complex> spectrum(FFT_SIZE);
+    for (int i = 0; i < FFT_SIZE; ++i) {
+      mopo_float position = (1.0 * i * frame_size) / FFT_SIZE;
+      int index = position;
+      mopo_float from = samples[index];
+      mopo_float to = samples[(index + 1) % frame_size];
+      spectrum[i] = scale * utils::interpolate(from, to, position - index);
+    }
+    fft(spectrum.data(), FFT_SIZE, false);
+
+    mopo_float harmonic_scale = 2.0 / FFT_SIZE;
+    std::vector<mopo_float> cos_table(TABLE_SIZE);
+    std::vector<mopo_float> sin_table(TABLE_SIZE);
+    for (int i = 0; i < TABLE_SIZE; ++i) {
+      cos_table[i] = cos((2.0 * PI * i) / TABLE_SIZE);
+      sin_table[i] = sin((2.0 * PI * i) / TABLE_SIZE);
+    }
+
+    int frame_offsets[LEVELS];
+    int offset = -1;
+    std::vector<mopo_float> total(TABLE_SIZE, 0.0);
+
+    for (int h = FixedPointWaveLookup::HARMONICS; h > 0; --h) {
+      int harmonic = LEVELS - h;
+      complex value = harmonic_scale * spectrum[harmonic];
+      bool silent = std::abs(value) < SILENT_HARMONIC;
+
+      if (!silent) {
+        int phase = 0;
+        for (int i = 0; i < TABLE_SIZE; ++i) {
+          total[i] += value.real() * cos_table[phase] - value.imag() * sin_table[phase];
+          phase = (phase + harmonic) & (TABLE_SIZE - 1);
+        }
+      }
+
+      if (!silent || offset < 0) {
+        offset = data_.size();
+        data_.insert(data_.end(), total.begin(), total.end());
+        data_.resize(offset + LEVEL_SIZE);
+        computeDiffs(data_.data() + offset);
+      }
+      frame_offsets[h] = offset;
+    }
+
+    bool full_band_silent = true;
+    std::vector<complex> full_band(TABLE_SIZE, 0.0);
+    for (int harmonic = 1; harmonic <= MAX_HARMONIC; ++harmonic) {
+      complex value = spectrum[harmonic] / (1.0 * FFT_SIZE);
+      full_band[harmonic] = value;
+      full_band[TABLE_SIZE - harmonic] = std::conj(value);
+
+      if (harmonic >= LEVELS && 2.0 * std::abs(value) >= SILENT_HARMONIC)
+        full_band_silent = false;
+    }
+
+    if (full_band_silent)
+      frame_offsets[0] = offset;
+    else {
+      fft(full_band.data(), TABLE_SIZE, true);
+
+      frame_offsets[0] = data_.size();
+      data_.resize(frame_offsets[0] + LEVEL_SIZE);
+      mopo_float* level = data_.data() + frame_offsets[0];
+      for (int i = 0; i < TABLE_SIZE; ++i)
+        level[i] = full_band[i].real();
+      computeDiffs(level);
+    }
+
+    offsets.insert(offsets.end(), frame_offsets, frame_offsets + LEVELS);
+  }
+
+  void Wavetable::computeDiffs(mopo_float* level) {
+    for (int i = 0; i < TABLE_SIZE - 1; ++i)
+      level[i + TABLE_SIZE] = FixedPointWaveLookup::FRACTIONAL_MULT * (level[i + 1] - level[i]);
+
+    mopo_float last_delta = level[0] - level[TABLE_SIZE - 1];
+    level[2 * TABLE_SIZE - 1] = FixedPointWaveLookup::FRACTIONAL_MULT * last_delta;
+  }
+} // namespace mopo
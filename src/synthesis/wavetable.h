@@ -0,0 +1,77 @@
+/* Copyright 2013-2017 Matt Tytel
+ *
+ * helm is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * helm is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with helm.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#ifndef WAVETABLE_H
+#define WAVETABLE_H
+
+#include "mopo.h"
+#include "fixed_point_wave.h"
+
+#include <vector>
+
+namespace mopo {
+
+  // Band limited versions of user loaded single cycle waves. The buffers are
+  // laid out like the FixedPointWaveLookup tables so the oscillators can read
+  // them with FixedPointWave::interpretWave. A level that adds no audible
+  // harmonic shares its buffer with the level before it.
+  class Wavetable {
+    public:
+      enum Slot {
+        kOscillator1,
+        kOscillator2,
+        kSubOscillator,
+        kNumSlots
+      };
+
+      static const int MAX_FRAMES = 32;
+      static const int FFT_SIZE = 2048;
+
+      // _samples_ holds _num_frames_ single cycles of _frame_size_ samples
+      // each. Frames beyond MAX_FRAMES are skipped evenly.
+      Wavetable(const mopo_float* samples, int frame_size, int num_frames);
+
+      // The waveform control scans through the frames of a loaded table.
+      static mopo_float waveformToPosition(mopo_float waveform) {
+        return waveform / (FixedPointWaveLookup::kWhiteNoise - 1);
+      }
+
+      int numFrames() const { return num_frames_; }
+      size_t memoryUsed() const { return data_.size() * sizeof(mopo_float); }
+
+      // _position_ goes from 0.0 at the first frame to 1.0 at the last.
+      inline const mopo_float* getBuffer(mopo_float position, int phase_inc) const {
+        int frame = utils::iclamp(position * (num_frames_ - 1) + 0.5, 0, num_frames_ - 1);
+        int clamped_inc = utils::iclamp(phase_inc, 1, INT_MAX);
+        return levels_[frame * LEVELS + FixedPointWave::getHarmonicIndex(clamped_inc)];
+      }
+
+    private:
+      static const int LEVELS = FixedPointWaveLookup::HARMONICS + 1;
+      static const int LEVEL_SIZE = 2 * FixedPointWaveLookup::FIXED_LOOKUP_SIZE;
+
+      void computeFrame(const mopo_float* samples, int frame_size, mopo_float scale,
+                        std::vector<int>& offsets);
+      void computeDiffs(mopo_float* level);
+
+      int num_frames_;
+      std::vector<mopo_float> data_;
+      std::vector<const mopo_float*> levels_;
+  };
+} // namespace mopo
+
+#endif // WAVETABLE_H